@@ -49,7 +49,7 @@ void OrbitCamera::init(EventSystem &a_event_system)
 	this->m_move_callback = [this](ror::Event &e) {
 		if (e.is_compatible<ror::Vector2d>())
 		{
-			auto vec2 = std::any_cast<ror::Vector2d>(e.m_payload);
+			auto vec2 = e.get_payload<ror::Vector2d>();
 			this->update_position_function(vec2.x, vec2.y);
 		}
 	};
@@ -58,7 +58,7 @@ void OrbitCamera::init(EventSystem &a_event_system)
 		if (e.is_compatible<ror::Vector2d>())
 		{
 			float scale    = 1.0f;
-			auto  vec2     = std::any_cast<ror::Vector2d>(e.m_payload);
+			auto  vec2     = e.get_payload<ror::Vector2d>();
 			auto  code     = event_code(e.m_handle);
 			auto  modifier = event_modifier(e.m_handle);
 
@@ -79,7 +79,7 @@ void OrbitCamera::init(EventSystem &a_event_system)
 	this->m_resize_callback = [this](ror::Event &e) {
 		if (e.is_compatible<ror::Vector2ui>())
 		{
-			auto vec2 = std::any_cast<ror::Vector2ui>(e.m_payload);
+			auto vec2 = e.get_payload<ror::Vector2ui>();
 			this->bounds(static_cast<float32_t>(vec2.x), static_cast<float32_t>(vec2.y));
 		}
 		else
@@ -91,7 +91,7 @@ void OrbitCamera::init(EventSystem &a_event_system)
 	this->m_zoom_callback = [this](ror::Event &e) {
 		if (e.is_compatible<ror::Vector2d>())
 		{
-			auto vec2 = std::any_cast<ror::Vector2d>(e.m_payload);
+			auto vec2 = e.get_payload<ror::Vector2d>();
 			this->zoom(vec2.x);
 		}
 		else
@@ -105,7 +105,7 @@ void OrbitCamera::init(EventSystem &a_event_system)
 		{
 			float32_t scale = 1.0f;
 
-			auto vec2     = std::any_cast<ror::Vector2d>(e.m_payload);
+			auto vec2     = e.get_payload<ror::Vector2d>();
 			auto modifier = event_modifier(e.m_handle);
 
 			if (modifier == EventModifier::command)
@@ -263,6 +263,7 @@ void OrbitCamera::setup_frustums()
 	this->m_frustums[cascade_index].far(this->m_z_far);
 	this->m_frustums[cascade_index].near(this->m_z_near);
 	this->m_frustums[cascade_index].aspect(this->m_aspect_ratio);
+	this->m_frustums[cascade_index].infinite(this->m_type == CameraType::perspective);        // Perspective projection is infinite, see update_projection
 	this->m_frustums[cascade_index].setup(this->m_view);
 }
 
@@ -235,6 +235,12 @@ FORCE_INLINE constexpr auto &OrbitCamera::frustum_center(size_t a_index) const
 	return this->m_frustums[a_index].center();
 }
 
+FORCE_INLINE constexpr auto &OrbitCamera::frustum(size_t a_index) const
+{
+	assert(a_index < cascade_count && "Cascade index out of bound");
+	return this->m_frustums[a_index];
+}
+
 FORCE_INLINE void OrbitCamera::set_parameters(CameraType a_type, float32_t a_width, float32_t a_height,
                                               float32_t a_near, float32_t a_far,
                                               Vector3f a_center, Vector3f a_eye,
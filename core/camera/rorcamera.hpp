@@ -172,6 +172,7 @@ class ROAR_ENGINE_ITEM OrbitCamera final : public Camera
 	FORCE_INLINE constexpr auto &frustum_bounding_box(size_t a_index = 0u) const;
 	FORCE_INLINE constexpr auto &frustum_corners(size_t a_index = 0u) const;
 	FORCE_INLINE constexpr auto &frustum_center(size_t a_index = 0u) const;
+	FORCE_INLINE constexpr auto &frustum(size_t a_index = 0u) const;
 	FORCE_INLINE void            set_parameters(CameraType a_type, float32_t a_width, float32_t a_height,
 	                                            float32_t a_near, float32_t a_far,
 	                                            Vector3f a_center, Vector3f a_eye,
@@ -29,6 +29,7 @@
 #include "math/rorvector3.hpp"
 #include "math/rorvector4.hpp"
 #include "rorfrustum.hpp"
+#include <cmath>
 
 namespace ror
 {
@@ -62,7 +63,8 @@ void Frustum::setup(const ror::Matrix4f &a_view)
 
 	this->m_view = a_view;
 
-	this->m_bounding_box = ror::BoundingBoxf{};        // Reset the bounding box
+	this->m_bounding_box = ror::BoundingBoxf{};                     // Reset the bounding box
+	this->m_center       = ror::Vector3f{0.0f, 0.0f, 0.0f};        // Reset the center otherwise it drifts with each setup
 
 	auto result = this->m_view.inverse(this->m_view_inverse);
 	assert(result && "Can't invert view matrix");
@@ -79,6 +81,90 @@ void Frustum::setup(const ror::Matrix4f &a_view)
 	}
 
 	this->m_center = this->m_center / 8.0f;
+
+	// Corners 0-3 are near LB, RB, RT, LT and 4-7 are the same on the far plane
+	const uint32_t plane_corners[6][3] = {
+	    {0, 3, 7},        // left
+	    {1, 5, 6},        // right
+	    {0, 4, 5},        // bottom
+	    {3, 2, 6},        // top
+	    {0, 1, 2},        // near
+	    {4, 6, 5}         // far
+	};
+
+	for (uint32_t i = 0; i < 6; ++i)
+	{
+		auto &plane = this->m_planes[i];
+		plane.set(this->m_corners[plane_corners[i][0]], this->m_corners[plane_corners[i][1]], this->m_corners[plane_corners[i][2]]);
+
+		// Make sure all planes face inwards, center is always inside the frustum
+		if (plane.distance_to_point(this->m_center) < 0.0f)
+			plane.set(-plane.normal(), -plane.distance());
+	}
+}
+
+bool Frustum::visible(const ror::BoundingSpheref &a_sphere) const noexcept
+{
+	const uint32_t planes_count = this->m_infinite ? 5u : 6u;
+	const auto     center       = a_sphere.center();
+	const auto     radius       = a_sphere.radius();
+
+	for (uint32_t i = 0; i < planes_count; ++i)
+		if (this->m_planes[i].distance_to_point(center) < -radius)
+			return false;
+
+	return true;
+}
+
+/**
+ * @brief      Checks an axis aligned box against the frustum planes
+ * @details    For each plane only the box corner furthest along the plane normal is checked, if that is behind the plane so is the whole box.
+               This is conservative, boxes near frustum edges might be reported visible when they are not, it never culls visible boxes.
+ * @param      a_box   World space axis aligned box
+ * @return     return  False if the box is completely outside
+ */
+bool Frustum::visible(const ror::BoundingBoxf &a_box) const noexcept
+{
+	const uint32_t planes_count = this->m_infinite ? 5u : 6u;
+	const auto     minimum      = a_box.minimum();
+	const auto     maximum      = a_box.maximum();
+
+	if (minimum.x > maximum.x || minimum.y > maximum.y || minimum.z > maximum.z)        // Empty box, nothing to cull against
+		return true;
+
+	for (uint32_t i = 0; i < planes_count; ++i)
+	{
+		auto         &plane  = this->m_planes[i];
+		auto          normal = plane.normal();
+		ror::Vector3f positive{normal.x >= 0.0f ? maximum.x : minimum.x,
+		                       normal.y >= 0.0f ? maximum.y : minimum.y,
+		                       normal.z >= 0.0f ? maximum.z : minimum.z};
+
+		if (plane.distance_to_point(positive) < 0.0f)
+			return false;
+	}
+
+	return true;
+}
+
+bool Frustum::visible(const ror::BoundingBoxf &a_box, const ror::Matrix4f &a_model) const noexcept
+{
+	const auto minimum = a_box.minimum();
+	const auto maximum = a_box.maximum();
+
+	if (minimum.x > maximum.x || minimum.y > maximum.y || minimum.z > maximum.z)
+		return true;
+
+	// Transform center and half extent into world space and create a box that contains the transformed box
+	auto center = a_model * ((minimum + maximum) * 0.5f);
+	auto half   = (maximum - minimum) * 0.5f;
+
+	auto         &m = a_model.m_values;
+	ror::Vector3f extent{std::abs(m[0]) * half.x + std::abs(m[4]) * half.y + std::abs(m[8]) * half.z,
+	                     std::abs(m[1]) * half.x + std::abs(m[5]) * half.y + std::abs(m[9]) * half.z,
+	                     std::abs(m[2]) * half.x + std::abs(m[6]) * half.y + std::abs(m[10]) * half.z};
+
+	return this->visible(ror::BoundingBoxf{center - extent, center + extent});
 }
 
 }        // namespace ror
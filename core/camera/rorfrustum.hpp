@@ -46,6 +46,10 @@ class ROAR_ENGINE_ITEM Frustum final
 
 	void setup(const ror::Matrix4f &a_view);
 
+	bool visible(const ror::BoundingSpheref &a_sphere) const noexcept;                                   //! False only if the sphere is completely outside one of the planes
+	bool visible(const ror::BoundingBoxf &a_box) const noexcept;                                         //! Same as above for a world space axis aligned box
+	bool visible(const ror::BoundingBoxf &a_box, const ror::Matrix4f &a_model) const noexcept;        //! Object space box, a_model takes it to world space
+
 	// clang-format off
 	FORCE_INLINE constexpr auto &corners() const { return this->m_corners;       }
 	FORCE_INLINE constexpr auto &center()  const { return this->m_center;        }
@@ -54,11 +58,14 @@ class ROAR_ENGINE_ITEM Frustum final
 	FORCE_INLINE constexpr auto near()     const { return this->m_near;          }
 	FORCE_INLINE constexpr auto aspect()   const { return this->m_aspect;        }
 	FORCE_INLINE constexpr auto &box()     const { return this->m_bounding_box;  }
+	FORCE_INLINE constexpr auto &planes()  const { return this->m_planes;        }
+	FORCE_INLINE constexpr auto infinite() const { return this->m_infinite;      }
 
 	FORCE_INLINE void fov(float32_t a_fov)        { this->m_fov = a_fov;       }
 	FORCE_INLINE void far(float32_t a_far)        { this->m_far = a_far;       }
 	FORCE_INLINE void near(float32_t a_near)      { this->m_near = a_near;     }
 	FORCE_INLINE void aspect(float32_t a_aspect)  { this->m_aspect = a_aspect; }
+	FORCE_INLINE void infinite(bool a_infinite)   { this->m_infinite = a_infinite; }
 	// clang-format on
 
   protected:
@@ -70,9 +77,10 @@ class ROAR_ENGINE_ITEM Frustum final
 	ror::Vector3f        m_center;                   //! The center of the frustum
 	ror::Matrix4f        m_view{};                   //! View matrix of the frustum
 	ror::Matrix4f        m_view_inverse{};           //! Inverse of the view matrix
-	ror::Planef          m_planes[6];                // The planes that bounds a frustum
+	ror::Planef          m_planes[6];                //! The planes that bounds a frustum, normals facing inwards in left, right, bottom, top, near, far order
 	ror::BoundingSpheref m_bounding_sphere{};        //! Bounding sphere of the frustum
 	ror::BoundingBoxf    m_bounding_box{};           //! Bounding box of the frustum
+	bool                 m_infinite{false};          //! If the projection has no far plane, far plane is then not used for culling
 
   protected:
   private:
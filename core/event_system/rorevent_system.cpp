@@ -395,76 +395,80 @@ std::string create_event_handle(EventHandle a_handle)
 	return ror::event_type(type) + ror::event_code(code) + ror::event_modifier(modifier) + ror::event_state(state);
 }
 
-EventSystem::EventSystem()
+constexpr uint32_t EventSystem::page_index(EventHandle a_event_handle)
 {
-	this->init();
+	auto type     = enum_to_type_cast(event_type(a_event_handle));
+	auto modifier = enum_to_type_cast(event_modifier(a_event_handle));
+	auto state    = enum_to_type_cast(event_state(a_event_handle));
+
+	assert(type < event_type_count && modifier < event_modifier_count && state < event_state_count && "Invalid event handle");
+
+	return (state * event_modifier_count + modifier) * event_type_count + type;
+}
+
+EventSystem::EventSubscribers &EventSystem::subscribers(EventHandle a_event_handle)
+{
+	auto &page = this->m_subscribers[page_index(a_event_handle)];
+	if (!page)
+		page = std::make_unique<EventPage>();
+
+	return (*page)[enum_to_type_cast(event_code(a_event_handle))];
 }
 
-void EventSystem::subscribe(EventHandle a_event_handle, std::function<void(Event &)> a_function, const std::source_location &a_loc)
+const EventSystem::EventSubscribers *EventSystem::subscribers(EventHandle a_event_handle) const
+{
+	auto &page = this->m_subscribers[page_index(a_event_handle)];
+	if (!page)
+		return nullptr;
+
+	return &(*page)[enum_to_type_cast(event_code(a_event_handle))];
+}
+
+void EventSystem::subscribe(EventHandle a_event_handle, EventCallback a_function, const std::source_location &a_loc)
 {
 	std::lock_guard<std::mutex> lock{this->m_mutex};
 
-	this->m_subscribers[a_event_handle].push_back({std::move(a_function), extract_callback_identifier(a_loc)});
+	this->subscribers(a_event_handle).push_back({std::move(a_function), extract_callback_identifier(a_loc)});
 }
 
-void EventSystem::subscribe_early(EventHandle a_event_handle, std::function<void(Event &)> a_function, const std::source_location &a_loc)
+void EventSystem::subscribe_early(EventHandle a_event_handle, EventCallback a_function, const std::source_location &a_loc)
 {
 	std::lock_guard<std::mutex> lock{this->m_mutex};
 
-	auto &subs = this->m_subscribers[a_event_handle];
+	auto &subs = this->subscribers(a_event_handle);
 	subs.insert(subs.begin(), {std::move(a_function), extract_callback_identifier(a_loc)});
 }
 
-void EventSystem::unsubscribe(EventHandle a_event_handle, std::function<void(Event &)> a_function)
+void EventSystem::unsubscribe(EventHandle a_event_handle, EventCallback a_function)
 {
 	std::lock_guard<std::mutex> lock{this->m_mutex};
 
-	auto  function_find_predicate = [&a_function](EventSubscriber &subscriber) { return subscriber.m_callback.target_type().hash_code() == a_function.target_type().hash_code(); };
-	auto &subscribers             = this->m_subscribers[a_event_handle];
+	auto  function_find_predicate = [&a_function](EventSubscriber &subscriber) { return subscriber.m_callback.same_target(a_function); };
+	auto &subscribers             = this->subscribers(a_event_handle);
 	auto  iter                    = std::find_if(subscribers.begin(), subscribers.end(), function_find_predicate);
 
 	if (iter != subscribers.end())
 		subscribers.erase(iter);
 }
 
-void EventSystem::init()
-{
-	auto event_type_max     = enum_to_type_cast(EventType::max);
-	auto event_code_max     = enum_to_type_cast(EventCode::max);
-	auto event_modifier_max = enum_to_type_cast(EventModifier::max);
-	auto event_state_max    = enum_to_type_cast(EventState::max);
-
-	auto subscribers_count = event_type_max * event_modifier_max * event_state_max;
-
-	std::lock_guard<std::mutex> lock{this->m_mutex};
-	this->m_subscribers.reserve(subscribers_count);
-
-	// This will create some invalid handle combinations like mouse + a + right + move but thats ok
-	for (size_t i = 0; i < event_type_max; ++i)
-		for (size_t j = 0; j < event_code_max; ++j)
-			for (size_t k = 0; k < event_modifier_max; ++k)
-				for (size_t l = 0; l < event_state_max; ++l)
-					this->m_subscribers[create_event_handle(static_cast<EventType>(i),
-					                                        static_cast<EventCode>(j),
-					                                        static_cast<EventModifier>(k),
-					                                        static_cast<EventState>(l))] = {};
-}
-
 void EventSystem::notify(Event a_event) const
 {
 	if (a_event.m_live)
 	{
-		auto &subs = this->m_subscribers.at(a_event.m_handle);
-		for (auto &sub : subs)
+		auto *subs = this->subscribers(a_event.m_handle);
+		if (subs)
 		{
-			sub.m_callback(a_event);
-			if (!a_event.m_live)        // Some subscribers might consume the event, in which case the order of subscription matters
-				break;
+			for (auto &sub : *subs)
+			{
+				sub.m_callback(a_event);
+				if (!a_event.m_live)        // Some subscribers might consume the event, in which case the order of subscription matters
+					break;
+			}
 		}
 
 		if constexpr (ror::get_build() == ror::BuildType::build_debug)
 		{
-			if (subs.empty() && ror::settings().m_warn_event_system)
+			if ((!subs || subs->empty()) && ror::settings().m_warn_event_system)
 				ror::log_warn("Event not registered {}", create_event_handle(a_event.m_handle));
 			else if (ror::settings().m_log_event_system)
 				ror::log_info("Event triggered {}", create_event_handle(a_event.m_handle));
@@ -472,68 +476,130 @@ void EventSystem::notify(Event a_event) const
 	}
 }
 
-void EventSystem::notify(std::vector<Event> a_events) const
+void EventSystem::notify(const std::vector<Event> &a_events) const
 {
-	for (auto event : a_events)
+	for (auto &event : a_events)
 		this->notify(event);
 }
 
-void EventSystem::print_keybindings() const
+void EventSystem::post(const Event &a_event)
 {
-	std::string result;
-	result.reserve(this->m_subscribers.size() * 150);
+	if (!this->m_overflowing.load(std::memory_order_acquire) && this->m_queue.push(a_event))
+		return;
+
+	// Queue is full because the main thread hasn't dispatched for a while, this thread keeps using the overflow until its dispatched
+	std::lock_guard<std::mutex> lock{this->m_overflow_mutex};
+	this->m_overflow.push_back(a_event);
+	this->m_overflowing.store(true, std::memory_order_release);
+}
 
-	for (const auto &entry : this->m_subscribers)
+// Events that carry absolute state, only the last one of a consecutive run of these needs dispatching
+static bool coalescable(EventHandle a_handle)
+{
+	auto state = event_state(a_handle);
+	return state == EventState::move || state == EventState::resize;
+}
+
+void EventSystem::dispatch_queued()
+{
+	auto &events = this->m_dispatching;
+	events.clear();
+
+	Event event;
+	while (this->m_queue.pop(event))
+		events.push_back(event);
+
+	// Anything in the overflow was posted after the same threads events in the queue
+	if (this->m_overflowing.load(std::memory_order_acquire))
 	{
-		if (entry.second.empty())
-			continue;
+		std::lock_guard<std::mutex> lock{this->m_overflow_mutex};
+		events.insert(events.end(), this->m_overflow.begin(), this->m_overflow.end());
+		this->m_overflow.clear();
+		this->m_overflowing.store(false, std::memory_order_release);
+	}
 
-		if (event_type(entry.first) != EventType::keyboard)
+	for (size_t i = 0; i < events.size(); ++i)
+	{
+		if (i + 1 < events.size() && events[i].m_handle == events[i + 1].m_handle && coalescable(events[i].m_handle))
 			continue;
 
-		auto short_event = ror::event_code(ror::event_code(entry.first));
-		auto handle_str = create_event_handle(entry.first);
-		assert(handle_str.size() < column_size && "Keyboard handle is bigger than column_size characters");
-		assert(short_event.size() < (column_size / 3) && "Keyboard handle short event is bigger than half column_size characters");
+		this->notify(events[i]);
+	}
+}
 
-		result += "\n| ";
-		result += short_event.substr(0, short_event.size() - 1);
+static void append_keybinding(std::string &a_result, EventHandle a_handle, const std::vector<EventSystem::EventSubscriber> &a_subscribers)
+{
+	auto short_event = ror::event_code(ror::event_code(a_handle));
+	auto handle_str  = create_event_handle(a_handle);
+	assert(handle_str.size() < column_size && "Keyboard handle is bigger than column_size characters");
+	assert(short_event.size() < (column_size / 3) && "Keyboard handle short event is bigger than half column_size characters");
+
+	a_result += "\n| ";
+	a_result += short_event.substr(0, short_event.size() - 1);
 
-		for (uint32_t i = 0; i < (column_size / 3) - short_event.size(); i++)
-			result += " ";
+	for (uint32_t i = 0; i < (column_size / 3) - short_event.size(); i++)
+		a_result += " ";
 
-		result += "| ";
-		result += handle_str;
+	a_result += "| ";
+	a_result += handle_str;
 
-		for (uint32_t i = 0; i < column_size - handle_str.size(); i++)
-			result += " ";
+	for (uint32_t i = 0; i < column_size - handle_str.size(); i++)
+		a_result += " ";
 
-		result += "|";
+	a_result += "|";
 
-		uint32_t sub_it = 1;
-		for (const auto &subscriber : entry.second)
+	uint32_t sub_it = 1;
+	for (const auto &subscriber : a_subscribers)
+	{
+		a_result += " ";
+		if (sub_it > 1)
 		{
-			result += " ";
-			if (sub_it > 1)
-			{
-				for (uint32_t i = 0; i < column_size + (column_size / 3) + 1; i++)
-					result += " ";
+			for (uint32_t i = 0; i < column_size + (column_size / 3) + 1; i++)
+				a_result += " ";
 
-				result += " | ";
-			}
+			a_result += " | ";
+		}
 
-			result += subscriber_name(subscriber);
-			if (sub_it < entry.second.size())
-			{
-				result += "\n";
-				sub_it++;
-			}
+		a_result += subscriber_name(subscriber);
+		if (sub_it < a_subscribers.size())
+		{
+			a_result += "\n";
+			sub_it++;
 		}
+	}
+}
+
+void EventSystem::print_keybindings() const
+{
+	std::string result;
+	size_t      bindings_count{0};
+
+	for (uint32_t index = 0; index < event_pages_count; ++index)
+	{
+		auto &page = this->m_subscribers[index];
+		if (!page)
+			continue;
+
+		// Reverse of page_index()
+		auto type     = static_cast<EventType>(index % event_type_count);
+		auto modifier = static_cast<EventModifier>((index / event_type_count) % event_modifier_count);
+		auto state    = static_cast<EventState>(index / (event_type_count * event_modifier_count));
+
+		if (type != EventType::keyboard)
+			continue;
 
-		// result += " | ";
+		for (uint32_t code = 0; code < event_code_count; ++code)
+		{
+			auto &subscribers = (*page)[code];
+			if (subscribers.empty())
+				continue;
+
+			bindings_count++;
+			append_keybinding(result, create_event_handle(type, static_cast<EventCode>(code), modifier, state), subscribers);
+		}
 	}
 
-	ror::log_info("Here all the keybinding for {} subscribers\n{}", this->m_subscribers.size(), result);
+	ror::log_info("Here all the keybinding for {} subscribers\n{}", bindings_count, result);
 }
 
 }        // namespace ror
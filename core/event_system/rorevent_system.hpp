@@ -25,18 +25,24 @@
 
 #pragma once
 
+#include "foundation/rorconcurrent_queue.hpp"
 #include "foundation/rorcrtp.hpp"
+#include "foundation/rordelegate.hpp"
 #include "foundation/rormacros.hpp"
 #include "foundation/rorutilities.hpp"
 #include "rhi/rorhandles.hpp"
 #include <algorithm>
-#include <any>
+#include <array>
+#include <atomic>
 #include <cstdio>
+#include <cstring>
 #include <functional>
 #include <list>
+#include <memory>
+#include <mutex>
 #include <queue>
 #include <source_location>
-#include <typeinfo>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -119,26 +125,39 @@ constexpr EventCode     event_code(EventHandle a_handle);
 constexpr EventModifier event_modifier(EventHandle a_handle);
 constexpr EventState    event_state(EventHandle a_handle);
 
+// Each payload type gets its own tag, its address is the type id so no typeid or RTTI is needed
+template <class _type>
+inline constexpr char event_payload_tag{};
+
 struct Event
 {
-	EventHandle m_handle{0};         //! Handle to the event containing, type, code, modifier and state
-	bool        m_live{true};        //! Is the event still live or consumed by some subscriber
-	std::any    m_payload{0};        //! Payload of the event containing a user data to something the user knows // TODO: Get rid of std::any
+	static constexpr size_t payload_size = 16;        //! Big enough for a Vector2d or Vector4f, anything bigger should be sent as a pointer
+
+	EventHandle m_handle{0};                                                  //! Handle to the event containing, type, code, modifier and state
+	bool        m_live{true};                                                 //! Is the event still live or consumed by some subscriber
+	const char *m_payload_type{&event_payload_tag<int32_t>};                  //! Tag of the type stored in m_payload
+	alignas(8) std::byte m_payload[payload_size]{};                           //! Payload of the event containing a user data to something the user knows
 
 	FORCE_INLINE Event()
 	{}
-	FORCE_INLINE Event(EventHandle a_event_handle, bool a_live, std::any a_payload = 0) :
-	    m_handle(a_event_handle), m_live(a_live), m_payload(a_payload)
-	{}
+
+	template <class _type = int32_t>
+	FORCE_INLINE Event(EventHandle a_event_handle, bool a_live, _type a_payload = 0) :
+	    m_handle(a_event_handle), m_live(a_live), m_payload_type(&event_payload_tag<_type>)
+	{
+		static_assert(std::is_trivially_copyable_v<_type>, "Event payloads are copied as bytes, use a pointer for anything else");
+		static_assert(sizeof(_type) <= payload_size && alignof(_type) <= 8, "Event payload too big, use a pointer instead");
+
+		std::memcpy(this->m_payload, &a_payload, sizeof(_type));
+	}
 
 	/**
 	 * Checks if the payload type is what it should be
-	 * TODO: Check the performance of this, it might be slow due to typeid
 	 */
 	template <class _type>
 	FORCE_INLINE constexpr bool is_compatible() const noexcept
 	{
-		return this->m_payload.has_value() && this->m_payload.type() == typeid(_type);
+		return this->m_payload_type == &event_payload_tag<_type>;
 	}
 
 	/**
@@ -147,12 +166,14 @@ struct Event
 	 * of the requested type is returned
 	 */
 	template <class _type>
-	FORCE_INLINE constexpr auto get_payload() const noexcept
+	FORCE_INLINE _type get_payload() const noexcept
 	{
+		_type payload{};
+
 		if (is_compatible<_type>())
-			return std::any_cast<_type>(this->m_payload);
+			std::memcpy(&payload, this->m_payload, sizeof(_type));
 
-		return _type();
+		return payload;
 	}
 };
 
@@ -161,12 +182,14 @@ static_assert(static_cast<uint32_t>(EventCode::max) < 256, "Too many EventCodes
 static_assert(static_cast<uint32_t>(EventModifier::max) < 256, "Too many EventModifiers can't fit in 8bit");
 static_assert(static_cast<uint32_t>(EventState::max) < 256, "Too many EventStates can't fit in 8bit");
 
-static_assert(sizeof(Event) <= 40, "Size of Event is too big");
+static_assert(sizeof(Event) <= 32, "Size of Event is too big");
+
+using EventCallback = Delegate<void(Event &)>;
 
 class ROAR_ENGINE_ITEM EventSystem final
 {
   public:
-	EventSystem();                                                                          //! Default constructor
+	FORCE_INLINE              EventSystem()                               = default;        //! Default constructor
 	FORCE_INLINE              EventSystem(const EventSystem &a_other)     = delete;         //! Copy constructor
 	FORCE_INLINE              EventSystem(EventSystem &&a_other) noexcept = delete;         //! Move constructor
 	FORCE_INLINE EventSystem &operator=(const EventSystem &a_other)       = delete;         //! Copy assignment operator
@@ -186,26 +209,46 @@ class ROAR_ENGINE_ITEM EventSystem final
 	 * unsubsribe(..., [](){});
 	 * will not remove the previously added function
 	 */
-	void unsubscribe(EventHandle a_event_handle, std::function<void(Event &)> a_function);
-	void subscribe(EventHandle a_event_handle, std::function<void(Event &)> a_function, const std::source_location &a_loc = std::source_location::current());
-	void subscribe_early(EventHandle a_event_handle, std::function<void(Event &)> a_function, const std::source_location &a_loc = std::source_location::current());
+	void unsubscribe(EventHandle a_event_handle, EventCallback a_function);
+	void subscribe(EventHandle a_event_handle, EventCallback a_function, const std::source_location &a_loc = std::source_location::current());
+	void subscribe_early(EventHandle a_event_handle, EventCallback a_function, const std::source_location &a_loc = std::source_location::current());
 	void notify(Event a_event) const;
-	void notify(std::vector<Event> a_events) const;
+	void notify(const std::vector<Event> &a_events) const;
+	void post(const Event &a_event);        // Can be called from any thread, the event is delivered on the main thread by the next dispatch_queued()
+	void dispatch_queued();                 // Main thread only, called once per frame, coalesces and notifies everything posted so far
 	void print_keybindings() const;
 
 	struct EventSubscriber
 	{
-		std::function<void(Event &)> m_callback{};
-		std::string                  m_name{};
+		EventCallback m_callback{};
+		std::string   m_name{};
 	};
 
   protected:
   private:
-	void init();
+	static constexpr uint32_t event_type_count     = enum_to_type_cast(EventType::max) + 1;            //! Max values are valid too, application_event uses EventState::max
+	static constexpr uint32_t event_code_count     = enum_to_type_cast(EventCode::max) + 1;
+	static constexpr uint32_t event_modifier_count = enum_to_type_cast(EventModifier::max) + 1;
+	static constexpr uint32_t event_state_count    = enum_to_type_cast(EventState::max) + 1;
+	static constexpr uint32_t event_pages_count    = event_type_count * event_modifier_count * event_state_count;
+	static constexpr size_t   event_queue_capacity = 4096;
+
+	using EventSubscribers = std::vector<EventSubscriber>;
+	using EventPage        = std::array<EventSubscribers, event_code_count>;        //! All codes of one type, modifier and state combination
 
-	// TODO: Add some buffering system at some point
-	std::unordered_map<EventHandle, std::vector<EventSubscriber>, EventHandleHash> m_subscribers{};        //! All the functions that needs to be called for this Event Handle
-	std::mutex                                                                     m_mutex{};              //! Mutex to lock m_subscribers when used from multiple threads
+	static constexpr uint32_t page_index(EventHandle a_event_handle);
+	EventSubscribers         &subscribers(EventHandle a_event_handle);
+	const EventSubscribers   *subscribers(EventHandle a_event_handle) const;
+
+	// Pages are indexed directly by the handle bits and only allocated once something subscribes to one of its handles
+	std::array<std::unique_ptr<EventPage>, event_pages_count> m_subscribers{};        //! All the functions that needs to be called for this Event Handle
+	std::mutex                                                m_mutex{};              //! Mutex to lock m_subscribers when used from multiple threads
+
+	ConcurrentQueue<Event> m_queue{event_queue_capacity};        //! Events posted from any thread waiting for dispatch_queued()
+	std::vector<Event>     m_overflow{};                         //! Events posted while m_queue was full, rare and guarded by m_overflow_mutex
+	std::mutex             m_overflow_mutex{};                   //! Mutex to lock m_overflow
+	std::atomic<bool>      m_overflowing{false};                 //! Once a post overflows all posts go to m_overflow until dispatched, keeps per thread order
+	std::vector<Event>     m_dispatching{};                      //! Scratch list of drained events, only used by the main thread
 };
 
 constexpr EventType event_type(EventHandle a_handle)
@@ -237,6 +280,4 @@ std::string event_code(EventCode a_code);
 std::string event_modifier(EventModifier a_modifier);
 std::string event_state(EventState a_state);
 
-using EventCallback = std::function<void(Event &)>;
-
 }        // namespace ror
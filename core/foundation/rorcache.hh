@@ -25,28 +25,94 @@
 
 #include "rorcache.hpp"
 #include <functional>
+#include <mutex>
 #include <utility>
+#include <vector>
 
 namespace ror
 {
-template <class _key, class _type, class _hasher>
-auto Cache<_key, _type, _hasher>::insert(_key a_key, _type a_value)
+template <class _key, class _type, class _hasher, uint32_t _shards_count>
+FORCE_INLINE Cache<_key, _type, _hasher, _shards_count>::Cache(size_t a_byte_budget, EvictionCallback a_eviction_callback) :
+    m_shard_budget((a_byte_budget + _shards_count - 1) / _shards_count),
+    m_eviction_callback(std::move(a_eviction_callback))
+{}
+
+template <class _key, class _type, class _hasher, uint32_t _shards_count>
+FORCE_INLINE auto Cache<_key, _type, _hasher, _shards_count>::shard(const _key &a_key) -> Shard &
+{
+	// Fibonacci hashing of the key hash, the maps use the low bits so shards are picked from the high bits
+	auto hash = static_cast<uint64_t>(_hasher{}(a_key)) * 0x9E3779B97F4A7C15ull;
+	return this->m_shards[static_cast<size_t>(hash >> 32) & (_shards_count - 1)];
+}
+
+template <class _key, class _type, class _hasher, uint32_t _shards_count>
+bool Cache<_key, _type, _hasher, _shards_count>::insert(_key a_key, _type a_value, size_t a_bytes)
+{
+	auto                                &shard = this->shard(a_key);
+	std::vector<std::pair<_key, _type>> evicted{};
+
+	{
+		std::unique_lock<std::shared_mutex> mtx(shard.m_mutex);
+
+		auto result = shard.m_cache.try_emplace(a_key, std::move(a_value), a_bytes);
+		if (!result.second)
+			return false;
+
+		result.first->second.m_order = shard.m_order.insert(shard.m_order.end(), a_key);
+		shard.m_bytes += a_bytes;
+
+		if (this->m_shard_budget)
+			this->evict(shard, evicted);
+	}
+
+	// Callbacks are called without holding the lock so they can use the cache
+	if (this->m_eviction_callback)
+		for (auto &[key, value] : evicted)
+			this->m_eviction_callback(key, value);
+
+	return true;
+}
+
+template <class _key, class _type, class _hasher, uint32_t _shards_count>
+void Cache<_key, _type, _hasher, _shards_count>::evict(Shard &a_shard, std::vector<std::pair<_key, _type>> &a_evicted)
 {
-	std::lock_guard<std::mutex> mtx(this->m_mutex);
+	// Second chance, referenced entries are moved to the back once, the newest entry is never evicted by its own insert
+	while (a_shard.m_bytes > this->m_shard_budget && a_shard.m_order.size() > 1)
+	{
+		auto  order = a_shard.m_order.begin();
+		auto  iter  = a_shard.m_cache.find(*order);
+		auto &entry = iter->second;
+
+		if (entry.m_referenced.exchange(false, std::memory_order_relaxed))
+		{
+			a_shard.m_order.splice(a_shard.m_order.end(), a_shard.m_order, order);
+			continue;
+		}
 
-	auto result = this->m_cache.emplace(a_key, a_value);
-	return result;
+		a_shard.m_bytes -= entry.m_bytes;
+		a_evicted.emplace_back(iter->first, std::move(entry.m_value));
+		a_shard.m_order.erase(order);
+		a_shard.m_cache.erase(iter);
+	}
 }
 
-template <class _key, class _type, class _hasher>
-_type Cache<_key, _type, _hasher>::remove(_key a_key)
+template <class _key, class _type, class _hasher, uint32_t _shards_count>
+std::pair<_type, bool> Cache<_key, _type, _hasher, _shards_count>::remove(_key a_key)
 {
-	std::lock_guard<std::mutex> mtx(this->m_mutex);
+	auto                               &shard = this->shard(a_key);
+	std::unique_lock<std::shared_mutex> mtx(shard.m_mutex);
 
-	auto to_be_erased = this->m_cache.at(a_key);
-	this->m_cache.erase(a_key);
+	auto iter = shard.m_cache.find(a_key);
+	if (iter == shard.m_cache.end())
+		return std::make_pair(_type{}, false);
 
-	return to_be_erased->second;
+	auto to_be_erased = std::move(iter->second.m_value);
+
+	shard.m_bytes -= iter->second.m_bytes;
+	shard.m_order.erase(iter->second.m_order);
+	shard.m_cache.erase(iter);
+
+	return std::make_pair(std::move(to_be_erased), true);
 }
 
 /**
@@ -55,16 +121,59 @@ _type Cache<_key, _type, _hasher>::remove(_key a_key)
  * The reason I am returning _type and not iterator is because iterator could be invalidated
  * by another thread insert in the meantime.
  */
-template <class _key, class _type, class _hasher>
-std::pair<_type, bool> Cache<_key, _type, _hasher>::find(_key a_key)
+template <class _key, class _type, class _hasher, uint32_t _shards_count>
+std::pair<_type, bool> Cache<_key, _type, _hasher, _shards_count>::find(_key a_key)
+{
+	auto                               &shard = this->shard(a_key);
+	std::shared_lock<std::shared_mutex> mtx(shard.m_mutex);
+
+	auto iter = shard.m_cache.find(a_key);
+	if (iter == shard.m_cache.end())
+		return std::make_pair(_type{}, false);
+
+	// Recency only matters with a budget, and only store if not already set to avoid bouncing the cache line between readers
+	if (this->m_shard_budget && !iter->second.m_referenced.load(std::memory_order_relaxed))
+		iter->second.m_referenced.store(true, std::memory_order_relaxed);
+
+	return std::make_pair(iter->second.m_value, true);
+}
+
+template <class _key, class _type, class _hasher, uint32_t _shards_count>
+size_t Cache<_key, _type, _hasher, _shards_count>::size()
 {
-	std::lock_guard<std::mutex> mtx(this->m_mutex);
+	size_t count{0};
+	for (auto &shard : this->m_shards)
+	{
+		std::shared_lock<std::shared_mutex> mtx(shard.m_mutex);
+		count += shard.m_cache.size();
+	}
+
+	return count;
+}
 
-	auto iter = this->m_cache.find(a_key);
+template <class _key, class _type, class _hasher, uint32_t _shards_count>
+size_t Cache<_key, _type, _hasher, _shards_count>::bytes()
+{
+	size_t count{0};
+	for (auto &shard : this->m_shards)
+	{
+		std::shared_lock<std::shared_mutex> mtx(shard.m_mutex);
+		count += shard.m_bytes;
+	}
 
-	return iter != this->m_cache.end() ?
-	           std::make_pair(iter->second, true) :
-	           std::make_pair(_type{}, false);
+	return count;
+}
+
+template <class _key, class _type, class _hasher, uint32_t _shards_count>
+void Cache<_key, _type, _hasher, _shards_count>::clear()
+{
+	for (auto &shard : this->m_shards)
+	{
+		std::unique_lock<std::shared_mutex> mtx(shard.m_mutex);
+		shard.m_cache.clear();
+		shard.m_order.clear();
+		shard.m_bytes = 0;
+	}
 }
 
 }        // namespace ror
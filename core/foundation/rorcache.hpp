@@ -25,38 +25,83 @@
 
 #pragma once
 
+#include "foundation/rorconcurrent_queue.hpp"
 #include "foundation/rorutilities.hpp"
 #include "roar.hpp"
+#include <array>
+#include <atomic>
+#include <functional>
+#include <list>
+#include <shared_mutex>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace ror
 {
 
 /**
- * Thread Safe unordered_map used as a Cache. A very simple wrapper
- * std::unordered_map isn't thread safe like other STL containers
+ * Thread Safe unordered_map used as a Cache, std::unordered_map isn't thread safe like other STL containers
+ * Keys are spread over _shards_count shards each with its own reader-writer lock, so lookups of different keys
+ * rarely contend and lookups of the same key only take the shared lock
+ * Optionally the cache can be given a byte budget, each insert says how many bytes the value costs, when a shard goes
+ * over its share of the budget least recently used values are evicted and handed to the eviction callback
+ * Recency is tracked with second chance FIFO, finds only set a referenced flag so they can stay under the shared lock
  * This class tries to limit its interface to very few methods, all thread safe
  */
-template <class _key, class _type, class _hasher = std::hash<_key>>
+template <class _key, class _type, class _hasher = std::hash<_key>, uint32_t _shards_count = 16>
 class ROAR_ENGINE_ITEM Cache final
 {
   public:
+	using EvictionCallback = std::function<void(const _key &, _type &)>;
+
 	FORCE_INLINE        Cache()                             = default;        //! Default constructor
-	FORCE_INLINE        Cache(const Cache &a_other)         = default;        //! Copy constructor
-	FORCE_INLINE        Cache(Cache &&a_other) noexcept     = default;        //! Move constructor
-	FORCE_INLINE Cache &operator=(const Cache &a_other)     = default;        //! Copy assignment operator
-	FORCE_INLINE Cache &operator=(Cache &&a_other) noexcept = default;        //! Move assignment operator
+	FORCE_INLINE        Cache(const Cache &a_other)         = delete;         //! Copy constructor
+	FORCE_INLINE        Cache(Cache &&a_other) noexcept     = delete;         //! Move constructor
+	FORCE_INLINE Cache &operator=(const Cache &a_other)     = delete;         //! Copy assignment operator
+	FORCE_INLINE Cache &operator=(Cache &&a_other) noexcept = delete;         //! Move assignment operator
 	FORCE_INLINE ~Cache() noexcept                          = default;        //! Destructor
 
+	FORCE_INLINE explicit Cache(size_t a_byte_budget, EvictionCallback a_eviction_callback = {});
+
+	static_assert(_shards_count && (_shards_count & (_shards_count - 1)) == 0, "Shards count must be a power of two");
+
 	// NOTE: Don't add methods like begin() or end() which makes thread safety impossible
-	auto                   insert(_key a_key, _type a_value);
-	_type                  remove(_key a_key);
+	bool                   insert(_key a_key, _type a_value, size_t a_bytes = 0);        // Returns false if a_key already exists, existing value is kept
+	std::pair<_type, bool> remove(_key a_key);                                           // Returns the removed value or false if it didn't exist, doesn't call eviction callback
 	std::pair<_type, bool> find(_key a_key);
+	size_t                 size();
+	size_t                 bytes();
+	void                   clear();
 
   protected:
   private:
-	std::unordered_map<_key, _type, _hasher> m_cache{};        //! Container to keep _key and _type values
-	std::mutex                               m_mutex{};        //! Use to synchronize access from different threads
+	struct Entry
+	{
+		FORCE_INLINE Entry(_type a_value, size_t a_bytes) :
+		    m_value(std::move(a_value)), m_bytes(a_bytes)
+		{}
+
+		_type                              m_value;                    //! Cached value
+		size_t                             m_bytes{0};                 //! Cost of the value against the budget
+		std::atomic<bool>                  m_referenced{false};        //! Set by finds, gives the entry a second chance before eviction
+		typename std::list<_key>::iterator m_order{};                  //! Where the key is in its shard insertion order
+	};
+
+	struct alignas(cache_line_size) Shard
+	{
+		std::unordered_map<_key, Entry, _hasher> m_cache{};        //! Container to keep _key and _type values
+		std::list<_key>                          m_order{};        //! Keys oldest first, eviction candidates are taken from the front
+		size_t                                   m_bytes{0};       //! Sum of bytes of all entries in this shard
+		std::shared_mutex                        m_mutex{};        //! Use to synchronize access from different threads
+	};
+
+	FORCE_INLINE Shard &shard(const _key &a_key);
+	void                evict(Shard &a_shard, std::vector<std::pair<_key, _type>> &a_evicted);
+
+	std::array<Shard, _shards_count> m_shards{};                  //! Keys are spread over these by hash
+	size_t                           m_shard_budget{0};           //! Per shard share of the byte budget, 0 means unbounded
+	EvictionCallback                 m_eviction_callback{};       //! Called outside of locks for each evicted value
 };
 }        // namespace ror
 
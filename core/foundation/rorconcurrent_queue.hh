@@ -0,0 +1,220 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "rorconcurrent_queue.hpp"
+#include <cassert>
+
+namespace ror
+{
+template <class _type>
+FORCE_INLINE WorkStealingDeque<_type>::WorkStealingDeque(size_t a_capacity)
+{
+	assert(a_capacity > 0 && (a_capacity & (a_capacity - 1)) == 0 && "WorkStealingDeque capacity must be power of 2");
+
+	this->m_buffers.emplace_back(std::make_unique<Buffer>(a_capacity));
+	this->m_buffer.store(this->m_buffers.back().get(), std::memory_order_relaxed);
+}
+
+template <class _type>
+FORCE_INLINE typename WorkStealingDeque<_type>::Buffer *WorkStealingDeque<_type>::grow(Buffer *a_buffer, int64_t a_bottom, int64_t a_top)
+{
+	auto new_buffer = std::make_unique<Buffer>(static_cast<size_t>(a_buffer->capacity()) * 2);
+
+	for (int64_t i = a_top; i != a_bottom; ++i)
+		new_buffer->put(i, a_buffer->get(i));
+
+	// Can't delete the old buffer, a thief might still be reading from it, its freed with the deque
+	this->m_buffers.emplace_back(std::move(new_buffer));
+	auto *buffer = this->m_buffers.back().get();
+	this->m_buffer.store(buffer, std::memory_order_release);
+
+	return buffer;
+}
+
+template <class _type>
+FORCE_INLINE void WorkStealingDeque<_type>::push(_type a_item)
+{
+	int64_t bottom = this->m_bottom.load(std::memory_order_relaxed);
+	int64_t top    = this->m_top.load(std::memory_order_acquire);
+	Buffer *buffer = this->m_buffer.load(std::memory_order_relaxed);
+
+	if (bottom - top > buffer->capacity() - 1)
+		buffer = this->grow(buffer, bottom, top);
+
+	buffer->put(bottom, a_item);
+	std::atomic_thread_fence(std::memory_order_release);
+	this->m_bottom.store(bottom + 1, std::memory_order_relaxed);
+}
+
+template <class _type>
+FORCE_INLINE _type WorkStealingDeque<_type>::pop()
+{
+	int64_t bottom = this->m_bottom.load(std::memory_order_relaxed) - 1;
+	Buffer *buffer = this->m_buffer.load(std::memory_order_relaxed);
+
+	this->m_bottom.store(bottom, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	int64_t top = this->m_top.load(std::memory_order_relaxed);
+
+	if (top <= bottom)
+	{
+		_type item = buffer->get(bottom);
+
+		if (top == bottom)
+		{
+			// Last item, race against thieves for it
+			if (!this->m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				item = _type{};
+
+			this->m_bottom.store(bottom + 1, std::memory_order_relaxed);
+		}
+
+		return item;
+	}
+
+	// Was already empty
+	this->m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+	return _type{};
+}
+
+template <class _type>
+FORCE_INLINE _type WorkStealingDeque<_type>::steal()
+{
+	int64_t top = this->m_top.load(std::memory_order_acquire);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	int64_t bottom = this->m_bottom.load(std::memory_order_acquire);
+
+	if (top < bottom)
+	{
+		Buffer *buffer = this->m_buffer.load(std::memory_order_acquire);
+		_type   item   = buffer->get(top);
+
+		if (!this->m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			return _type{};        // Lost the race to another thief or the owner
+
+		return item;
+	}
+
+	return _type{};
+}
+
+template <class _type>
+FORCE_INLINE bool WorkStealingDeque<_type>::empty() const noexcept
+{
+	return this->size() == 0;
+}
+
+template <class _type>
+FORCE_INLINE size_t WorkStealingDeque<_type>::size() const noexcept
+{
+	int64_t bottom = this->m_bottom.load(std::memory_order_relaxed);
+	int64_t top    = this->m_top.load(std::memory_order_relaxed);
+
+	return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+}
+
+template <class _type>
+FORCE_INLINE ConcurrentQueue<_type>::ConcurrentQueue(size_t a_capacity) :
+    m_mask(a_capacity - 1), m_cells(std::make_unique<Cell[]>(a_capacity))
+{
+	assert(a_capacity >= 2 && (a_capacity & (a_capacity - 1)) == 0 && "ConcurrentQueue capacity must be power of 2");
+
+	for (size_t i = 0; i < a_capacity; ++i)
+		this->m_cells[i].m_sequence.store(i, std::memory_order_relaxed);
+}
+
+template <class _type>
+FORCE_INLINE bool ConcurrentQueue<_type>::push(const _type &a_item)
+{
+	Cell  *cell{nullptr};
+	size_t position = this->m_enqueue_position.load(std::memory_order_relaxed);
+
+	while (true)
+	{
+		cell               = &this->m_cells[position & this->m_mask];
+		size_t   sequence  = cell->m_sequence.load(std::memory_order_acquire);
+		intptr_t different = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+		if (different == 0)
+		{
+			if (this->m_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				break;
+		}
+		else if (different < 0)
+			return false;        // Full
+		else
+			position = this->m_enqueue_position.load(std::memory_order_relaxed);
+	}
+
+	cell->m_data = a_item;
+	cell->m_sequence.store(position + 1, std::memory_order_release);
+
+	return true;
+}
+
+template <class _type>
+FORCE_INLINE bool ConcurrentQueue<_type>::pop(_type &a_item)
+{
+	Cell  *cell{nullptr};
+	size_t position = this->m_dequeue_position.load(std::memory_order_relaxed);
+
+	while (true)
+	{
+		cell               = &this->m_cells[position & this->m_mask];
+		size_t   sequence  = cell->m_sequence.load(std::memory_order_acquire);
+		intptr_t different = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+
+		if (different == 0)
+		{
+			if (this->m_dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				break;
+		}
+		else if (different < 0)
+			return false;        // Empty
+		else
+			position = this->m_dequeue_position.load(std::memory_order_relaxed);
+	}
+
+	a_item = std::move(cell->m_data);
+	cell->m_sequence.store(position + this->m_mask + 1, std::memory_order_release);
+
+	return true;
+}
+
+template <class _type>
+FORCE_INLINE bool ConcurrentQueue<_type>::empty() const noexcept
+{
+	return this->m_dequeue_position.load(std::memory_order_relaxed) >= this->m_enqueue_position.load(std::memory_order_relaxed);
+}
+
+template <class _type>
+FORCE_INLINE size_t ConcurrentQueue<_type>::capacity() const noexcept
+{
+	return this->m_mask + 1;
+}
+
+}        // namespace ror
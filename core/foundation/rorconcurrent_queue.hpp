@@ -0,0 +1,142 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#pragma once
+
+#include "roar.hpp"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace ror
+{
+constexpr size_t cache_line_size = 64;        //! Used for padding shared atomics onto their own cache lines to avoid false sharing
+
+/**
+ * Lock free Chase-Lev work stealing deque, implementation follows
+ * "Correct and Efficient Work-Stealing for Weak Memory Models" by Le, Pop, Cohen and Nardelli
+ * Only the owner thread is allowed to push and pop from the bottom, any other thread can steal from the top
+ * _type must be trivially copyable, a value initialized _type{} is returned when the deque is empty, mostly used with pointers
+ * Grows when full, old buffers are kept alive until the deque is destroyed because a thief might still be reading them
+ */
+template <class _type>
+class ROAR_ENGINE_ITEM WorkStealingDeque final
+{
+  public:
+	FORCE_INLINE                    WorkStealingDeque(const WorkStealingDeque &a_other)     = delete;        //! Copy constructor
+	FORCE_INLINE                    WorkStealingDeque(WorkStealingDeque &&a_other) noexcept = delete;        //! Move constructor
+	FORCE_INLINE WorkStealingDeque &operator=(const WorkStealingDeque &a_other)             = delete;        //! Copy assignment operator
+	FORCE_INLINE WorkStealingDeque &operator=(WorkStealingDeque &&a_other) noexcept         = delete;        //! Move assignment operator
+	FORCE_INLINE ~WorkStealingDeque() noexcept                                              = default;       //! Destructor
+
+	FORCE_INLINE explicit WorkStealingDeque(size_t a_capacity = 1024);
+
+	FORCE_INLINE void  push(_type a_item);        //! Owner only
+	FORCE_INLINE _type pop();                     //! Owner only
+	FORCE_INLINE _type steal();                   //! Any thread
+	FORCE_INLINE bool  empty() const noexcept;
+	FORCE_INLINE size_t size() const noexcept;
+
+  protected:
+  private:
+	static_assert(std::is_trivially_copyable_v<_type>, "WorkStealingDeque only supports trivially copyable types");
+
+	class Buffer final
+	{
+	  public:
+		FORCE_INLINE explicit Buffer(size_t a_capacity) :
+		    m_capacity(static_cast<int64_t>(a_capacity)), m_mask(static_cast<int64_t>(a_capacity) - 1), m_data(std::make_unique<std::atomic<_type>[]>(a_capacity))
+		{}
+
+		FORCE_INLINE void put(int64_t a_index, _type a_item) noexcept
+		{
+			this->m_data[static_cast<size_t>(a_index & this->m_mask)].store(a_item, std::memory_order_relaxed);
+		}
+
+		FORCE_INLINE _type get(int64_t a_index) const noexcept
+		{
+			return this->m_data[static_cast<size_t>(a_index & this->m_mask)].load(std::memory_order_relaxed);
+		}
+
+		FORCE_INLINE int64_t capacity() const noexcept
+		{
+			return this->m_capacity;
+		}
+
+	  private:
+		int64_t                                m_capacity{0};        //! Always power of 2
+		int64_t                                m_mask{0};            //! m_capacity - 1
+		std::unique_ptr<std::atomic<_type>[]> m_data{};              //! Circular array of items
+	};
+
+	FORCE_INLINE Buffer *grow(Buffer *a_buffer, int64_t a_bottom, int64_t a_top);
+
+	alignas(cache_line_size) std::atomic<int64_t> m_top{0};                   //! Thieves contend on this
+	alignas(cache_line_size) std::atomic<int64_t> m_bottom{0};                //! Owner writes this
+	std::atomic<Buffer *>                         m_buffer{nullptr};          //! Current circular array
+	std::vector<std::unique_ptr<Buffer>>          m_buffers{};                //! All buffers ever allocated, only the owner touches this
+};
+
+/**
+ * Bounded lock free multi producer multi consumer queue, based on Dmitry Vyukov's bounded MPMC queue
+ * Every cell carries a sequence number that tells producers and consumers whose turn it is, so there are no locks and no ABA issues
+ * push returns false if the queue is full and pop returns false if its empty. Capacity must be a power of 2
+ */
+template <class _type>
+class ROAR_ENGINE_ITEM ConcurrentQueue final
+{
+  public:
+	FORCE_INLINE                  ConcurrentQueue(const ConcurrentQueue &a_other)     = delete;        //! Copy constructor
+	FORCE_INLINE                  ConcurrentQueue(ConcurrentQueue &&a_other) noexcept = delete;        //! Move constructor
+	FORCE_INLINE ConcurrentQueue &operator=(const ConcurrentQueue &a_other)           = delete;        //! Copy assignment operator
+	FORCE_INLINE ConcurrentQueue &operator=(ConcurrentQueue &&a_other) noexcept       = delete;        //! Move assignment operator
+	FORCE_INLINE ~ConcurrentQueue() noexcept                                          = default;       //! Destructor
+
+	FORCE_INLINE explicit ConcurrentQueue(size_t a_capacity = 65536);
+
+	FORCE_INLINE bool   push(const _type &a_item);
+	FORCE_INLINE bool   pop(_type &a_item);
+	FORCE_INLINE bool   empty() const noexcept;
+	FORCE_INLINE size_t capacity() const noexcept;
+
+  protected:
+  private:
+	struct Cell
+	{
+		std::atomic<size_t> m_sequence{0};
+		_type               m_data{};
+	};
+
+	size_t                                   m_mask{0};                  //! Capacity - 1
+	std::unique_ptr<Cell[]>                  m_cells{};                  //! Ring of cells
+	alignas(cache_line_size) std::atomic<size_t> m_enqueue_position{0};    //! Producers contend on this
+	alignas(cache_line_size) std::atomic<size_t> m_dequeue_position{0};    //! Consumers contend on this
+};
+
+}        // namespace ror
+
+#include "rorconcurrent_queue.hh"
@@ -0,0 +1,153 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "rordelegate.hpp"
+#include <cassert>
+#include <cstring>
+#include <new>
+#include <utility>
+
+namespace ror
+{
+template <class _return, class... _arguments, size_t _storage_size>
+template <class _callable, class>
+FORCE_INLINE Delegate<_return(_arguments...), _storage_size>::Delegate(_callable &&a_callable)
+{
+	using callable_type = std::decay_t<_callable>;
+
+	static_assert(sizeof(callable_type) <= _storage_size, "Callable is too big for Delegate, capture less or by reference");
+	static_assert(alignof(callable_type) <= alignof(std::max_align_t), "Callable is over aligned for Delegate");
+	static_assert(std::is_copy_constructible_v<callable_type>, "Delegate callables must be copyable");
+
+	new (this->m_storage) callable_type(std::forward<_callable>(a_callable));
+	this->m_operations = &callable_operations<callable_type>;
+}
+
+template <class _return, class... _arguments, size_t _storage_size>
+FORCE_INLINE Delegate<_return(_arguments...), _storage_size>::Delegate(const Delegate &a_other)
+{
+	this->copy_from(a_other);
+}
+
+template <class _return, class... _arguments, size_t _storage_size>
+FORCE_INLINE Delegate<_return(_arguments...), _storage_size>::Delegate(Delegate &&a_other) noexcept
+{
+	// Callables are copied on move too, this avoids another function pointer per type and moves only happen while subscribing
+	this->copy_from(a_other);
+	a_other.reset();
+}
+
+template <class _return, class... _arguments, size_t _storage_size>
+FORCE_INLINE auto Delegate<_return(_arguments...), _storage_size>::operator=(const Delegate &a_other) -> Delegate &
+{
+	if (this != &a_other)
+	{
+		this->reset();
+		this->copy_from(a_other);
+	}
+
+	return *this;
+}
+
+template <class _return, class... _arguments, size_t _storage_size>
+FORCE_INLINE auto Delegate<_return(_arguments...), _storage_size>::operator=(Delegate &&a_other) noexcept -> Delegate &
+{
+	if (this != &a_other)
+	{
+		this->reset();
+		this->copy_from(a_other);
+		a_other.reset();
+	}
+
+	return *this;
+}
+
+template <class _return, class... _arguments, size_t _storage_size>
+FORCE_INLINE Delegate<_return(_arguments...), _storage_size>::~Delegate() noexcept
+{
+	this->reset();
+}
+
+template <class _return, class... _arguments, size_t _storage_size>
+FORCE_INLINE _return Delegate<_return(_arguments...), _storage_size>::operator()(_arguments... a_arguments) const
+{
+	assert(this->m_operations && "Calling an empty Delegate");
+	return this->m_operations->m_invoke(this->m_storage, std::forward<_arguments>(a_arguments)...);
+}
+
+template <class _return, class... _arguments, size_t _storage_size>
+FORCE_INLINE Delegate<_return(_arguments...), _storage_size>::operator bool() const noexcept
+{
+	return this->m_operations != nullptr;
+}
+
+template <class _return, class... _arguments, size_t _storage_size>
+FORCE_INLINE bool Delegate<_return(_arguments...), _storage_size>::same_target(const Delegate &a_other) const noexcept
+{
+	return this->m_operations == a_other.m_operations;
+}
+
+template <class _return, class... _arguments, size_t _storage_size>
+FORCE_INLINE void Delegate<_return(_arguments...), _storage_size>::reset() noexcept
+{
+	if (this->m_operations && this->m_operations->m_destroy)
+		this->m_operations->m_destroy(this->m_storage);
+
+	this->m_operations = nullptr;
+}
+
+template <class _return, class... _arguments, size_t _storage_size>
+FORCE_INLINE void Delegate<_return(_arguments...), _storage_size>::copy_from(const Delegate &a_other)
+{
+	if (a_other.m_operations && a_other.m_operations->m_copy)
+		a_other.m_operations->m_copy(this->m_storage, a_other.m_storage);
+	else
+		std::memcpy(this->m_storage, a_other.m_storage, _storage_size);
+
+	this->m_operations = a_other.m_operations;
+}
+
+template <class _return, class... _arguments, size_t _storage_size>
+template <class _callable>
+_return Delegate<_return(_arguments...), _storage_size>::invoke(void *a_storage, _arguments... a_arguments)
+{
+	return (*std::launder(static_cast<_callable *>(a_storage)))(std::forward<_arguments>(a_arguments)...);
+}
+
+template <class _return, class... _arguments, size_t _storage_size>
+template <class _callable>
+void Delegate<_return(_arguments...), _storage_size>::copy(void *a_destination, const void *a_source)
+{
+	new (a_destination) _callable(*std::launder(static_cast<const _callable *>(a_source)));
+}
+
+template <class _return, class... _arguments, size_t _storage_size>
+template <class _callable>
+void Delegate<_return(_arguments...), _storage_size>::destroy(void *a_storage) noexcept
+{
+	std::launder(static_cast<_callable *>(a_storage))->~_callable();
+}
+
+}        // namespace ror
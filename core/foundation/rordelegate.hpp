@@ -0,0 +1,94 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#pragma once
+
+#include "foundation/rormacros.hpp"
+#include <cstddef>
+#include <type_traits>
+
+namespace ror
+{
+/**
+ * Non allocating replacement for std::function, the callable is always kept inline in _storage_size bytes
+ * Callables that don't fit are rejected at compile time instead of silently going to the heap
+ * Two delegates have the same target if they were created from the same callable type, this is what
+ * std::function::target_type() was used for when unsubscribing lambdas
+ */
+template <class _signature, size_t _storage_size = 48>
+class Delegate;
+
+template <class _return, class... _arguments, size_t _storage_size>
+class ROAR_ENGINE_ITEM Delegate<_return(_arguments...), _storage_size> final
+{
+  public:
+	FORCE_INLINE           Delegate() = default;                              //! Default constructor
+	FORCE_INLINE           Delegate(const Delegate &a_other);                 //! Copy constructor
+	FORCE_INLINE           Delegate(Delegate &&a_other) noexcept;             //! Move constructor
+	FORCE_INLINE Delegate &operator=(const Delegate &a_other);                //! Copy assignment operator
+	FORCE_INLINE Delegate &operator=(Delegate &&a_other) noexcept;            //! Move assignment operator
+	FORCE_INLINE ~Delegate() noexcept;                                        //! Destructor
+
+	// Not explicit on purpose, lambdas convert to Delegate the same way they used to convert to std::function
+	template <class _callable, class = std::enable_if_t<!std::is_same_v<std::decay_t<_callable>, Delegate>>>
+	FORCE_INLINE Delegate(_callable &&a_callable);        // NOLINT
+
+	FORCE_INLINE _return operator()(_arguments... a_arguments) const;
+	FORCE_INLINE explicit operator bool() const noexcept;
+	FORCE_INLINE bool     same_target(const Delegate &a_other) const noexcept;
+	FORCE_INLINE void     reset() noexcept;
+
+  protected:
+  private:
+	struct Operations
+	{
+		_return (*m_invoke)(void *, _arguments...);                   //! Calls the callable stored at the address
+		void (*m_copy)(void *, const void *);                         //! Copy constructs into the first address, nullptr for trivially copyable callables
+		void (*m_destroy)(void *) noexcept;                           //! Destroys the callable, nullptr for trivially destructible callables
+	};
+
+	template <class _callable>
+	static _return invoke(void *a_storage, _arguments... a_arguments);
+
+	template <class _callable>
+	static void copy(void *a_destination, const void *a_source);
+
+	template <class _callable>
+	static void destroy(void *a_storage) noexcept;
+
+	template <class _callable>
+	static constexpr Operations callable_operations{&invoke<_callable>,
+	                                                std::is_trivially_copyable_v<_callable> ? nullptr : &copy<_callable>,
+	                                                std::is_trivially_destructible_v<_callable> ? nullptr : &destroy<_callable>};
+
+	FORCE_INLINE void copy_from(const Delegate &a_other);
+
+	alignas(std::max_align_t) mutable std::byte m_storage[_storage_size];           //! Inline storage for the callable, mutable because lambdas can be mutable like in std::function
+	const Operations                           *m_operations{nullptr};             //! Per callable type operations, also used as the identity of the callable type
+};
+
+}        // namespace ror
+
+#include "rordelegate.hh"
@@ -23,18 +23,395 @@
 //
 // Version: 1.0.0
 
+#include "profiling/rorprofiler.hpp"
 #include "rorjobsystem.hpp"
+#include <string>
 
 namespace ror
 {
 
-define_translation_unit_vtable(Job)
-{}
+namespace
+{
+thread_local JobSystem *current_job_system{nullptr};        // Set for worker threads only, to the JobSystem they belong to
+thread_local uint32_t   current_worker_index{0};            // Index of the worker in its JobSystem, only valid if current_job_system is set
+
+// Xorshift is more than enough to pick a victim to steal from and is thread safe since the state is on the worker stack
+FORCE_INLINE uint32_t next_random(uint32_t &a_state)
+{
+	a_state ^= a_state << 13;
+	a_state ^= a_state >> 17;
+	a_state ^= a_state << 5;
+
+	return a_state;
+}
+
+// Per thread free list of pooled objects, handed back to the pool when the thread dies
+template <class _type>
+class FreeListCache final
+{
+  public:
+	FORCE_INLINE                FreeListCache()                                = default;        //! Default constructor
+	FORCE_INLINE                FreeListCache(const FreeListCache &a_other)    = delete;         //! Copy constructor
+	FORCE_INLINE                FreeListCache(FreeListCache &&a_other) noexcept = delete;        //! Move constructor
+	FORCE_INLINE FreeListCache &operator=(const FreeListCache &a_other)        = delete;         //! Copy assignment operator
+	FORCE_INLINE FreeListCache &operator=(FreeListCache &&a_other) noexcept    = delete;         //! Move assignment operator
+	FORCE_INLINE ~FreeListCache() noexcept
+	{
+		if (this->m_head)
+			this->m_pool->release_list(this->m_head);
+	}
+
+	_type               *m_head{nullptr};        // Free objects only this thread can acquire
+	FreeListPool<_type> *m_pool{nullptr};        // Where m_head came from
+};
+
+template <class _type>
+thread_local FreeListCache<_type> free_list_cache{};
+
+// Marks a successors list as closed, anyone trying to add a successor after this knows the job is already done
+JobEdge *closed_successors() noexcept
+{
+	return reinterpret_cast<JobEdge *>(uintptr_t{1});
+}
+}        // namespace
+
+template <class _type>
+_type *FreeListPool<_type>::allocate_block()
+{
+	std::lock_guard<std::mutex> lock{this->m_blocks_lock};
+
+	auto &block = this->m_blocks.emplace_back(std::make_unique<Block>());
+	auto &items = block->m_items;
+
+	for (size_t i = 0; i < block_size - 1; ++i)
+		items[i].m_next = &items[i + 1];
+
+	return &items[0];
+}
+
+template <class _type>
+_type *FreeListPool<_type>::acquire()
+{
+	auto &cache = free_list_cache<_type>;
+
+	assert((cache.m_pool == nullptr || cache.m_pool == this) && "Only one FreeListPool per type is allowed");
+	cache.m_pool = this;
+
+	if (!cache.m_head)
+		cache.m_head = this->m_free_list.exchange(nullptr, std::memory_order_acquire);        // Take everything, this is why there is no ABA
+
+	if (!cache.m_head)
+		cache.m_head = this->allocate_block();
+
+	_type *item  = cache.m_head;
+	cache.m_head = item->m_next;
+	item->m_next = nullptr;
+
+	return item;
+}
+
+template <class _type>
+void FreeListPool<_type>::release(_type *a_item) noexcept
+{
+	_type *head = this->m_free_list.load(std::memory_order_relaxed);
+	do
+		a_item->m_next = head;
+	while (!this->m_free_list.compare_exchange_weak(head, a_item, std::memory_order_release, std::memory_order_relaxed));
+}
+
+template <class _type>
+void FreeListPool<_type>::release_list(_type *a_head) noexcept
+{
+	_type *tail = a_head;
+	while (tail->m_next)
+		tail = tail->m_next;
+
+	_type *head = this->m_free_list.load(std::memory_order_relaxed);
+	do
+		tail->m_next = head;
+	while (!this->m_free_list.compare_exchange_weak(head, a_head, std::memory_order_release, std::memory_order_relaxed));
+}
+
+template <class _type>
+void FreeListPool<_type>::reserve(size_t a_count)
+{
+	while (this->capacity() < a_count)
+		this->release_list(this->allocate_block());
+}
+
+template <class _type>
+size_t FreeListPool<_type>::capacity() const noexcept
+{
+	std::lock_guard<std::mutex> lock{this->m_blocks_lock};
+
+	return this->m_blocks.size() * block_size;
+}
+
+template class FreeListPool<Job>;
+template class FreeListPool<JobEdge>;
+
+JobPool &job_pool()
+{
+	static JobPool pool;
+
+	return pool;
+}
+
+JobEdgePool &job_edge_pool()
+{
+	static JobEdgePool pool;
+
+	return pool;
+}
+
+void Job::release() noexcept
+{
+	if (this->m_references.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+	{
+		if (this->m_destroy)
+			this->m_destroy(this);
+
+		job_pool().release(this);
+	}
+}
+
+bool Job::add_successor(JobEdge *a_edge) noexcept
+{
+	JobEdge *head = this->m_successors.load(std::memory_order_acquire);
+	do
+	{
+		if (head == closed_successors())
+			return false;
+
+		a_edge->m_next = head;
+	} while (!this->m_successors.compare_exchange_weak(head, a_edge, std::memory_order_acq_rel, std::memory_order_acquire));
+
+	return true;
+}
+
+void Job::finish() noexcept
+{
+	this->m_done.store(1u, std::memory_order_release);
+	this->m_done.notify_all();
+
+	// Close the list and release everyone waiting on this job, whoever takes the last pending count schedules the job
+	JobEdge *edge = this->m_successors.exchange(closed_successors(), std::memory_order_acq_rel);
+	while (edge)
+	{
+		auto *next      = edge->m_next;
+		auto *successor = edge->m_successor;
+
+		job_edge_pool().release(edge);
+
+		if (successor->predecessor_done())
+			successor->job_system()->schedule(successor);
+
+		edge = next;
+	}
+}
+
+JobSystem *JobSystem::current() noexcept
+{
+	return current_job_system;
+}
+
+void JobSystem::init(uint32_t a_workers_count)
+{
+	a_workers_count = std::max(1u, a_workers_count);
+
+	job_pool();             // Makes sure the pools are created before and hence destroyed after any JobSystem
+	job_edge_pool();
+
+	this->m_injection_queue = std::make_unique<ConcurrentQueue<Job *>>();
+
+	for (size_t i = 0; i < a_workers_count; ++i)
+		this->m_worker_queues.emplace_back(std::make_unique<WorkerQueue>());
+
+	// Kick of all the threads
+	for (uint32_t i = 0; i < a_workers_count; ++i)
+		this->m_workers.emplace_back(std::make_unique<std::thread>(&JobSystem::worker_loop, this, i));
+}
+
+void JobSystem::stop()
+{
+	{
+		std::lock_guard<std::mutex> lock{this->m_lock};
+		this->m_stop.store(true);
+	}
+
+	this->m_condition_variable.notify_all();
+
+	for (auto &worker : this->m_workers)
+		if (worker->joinable())
+			worker->join();
+
+	this->m_workers.clear();
+}
+
+void JobSystem::submit(const JobRef &a_job, const JobRef *a_dependencies, size_t a_dependencies_count)
+{
+	// The queues only hold raw pointers, so the queue holds a reference until a worker has ran it
+	// This reference is taken before any edge is added since a predecessor could schedule the job straight away
+	a_job->add_reference();
+
+	// One extra pending count for the submission itself, so the job can't be scheduled while edges are still being added
+	a_job->add_predecessors(static_cast<uint32_t>(a_dependencies_count) + 1u);
+
+	for (size_t i = 0; i < a_dependencies_count; ++i)
+	{
+		auto *dependency = a_dependencies[i].get();
+		if (!dependency)
+		{
+			a_job->predecessor_done();
+			continue;
+		}
+
+		auto *edge        = job_edge_pool().acquire();
+		edge->m_successor = a_job.get();
+
+		if (!dependency->add_successor(edge))
+		{
+			// Already finished, nothing to wait for
+			job_edge_pool().release(edge);
+			a_job->predecessor_done();
+		}
+	}
+
+	if (a_job->predecessor_done())
+		this->enqueue(a_job.get());
+}
+
+void JobSystem::schedule(Job *a_job)
+{
+	this->enqueue(a_job);
+}
+
+void JobSystem::enqueue(Job *a_job)
+{
+	// Counted before its published, otherwise a thief could pop it and decrement first which wraps the count around
+	this->m_jobs_count.fetch_add(1);
+
+	if (current_job_system == this)
+		this->m_worker_queues[current_worker_index]->push(a_job);        // Only this worker is allowed to push to its own deque
+	else
+	{
+		// Injection queue is bounded, if its full the producer waits for workers to catch up
+		while (!this->m_injection_queue->push(a_job))
+			std::this_thread::yield();
+	}
+
+	// Only touch the lock when someone is actually asleep, m_jobs_count and m_sleepers_count are both seq_cst so either
+	// we see the sleeper or the sleeper sees the job
+	if (this->m_sleepers_count.load() > 0)
+	{
+		{
+			std::lock_guard<std::mutex> lock{this->m_lock};
+		}
+		this->m_condition_variable.notify_one();
+	}
+}
+
+Job *JobSystem::steal_job(uint32_t a_worker_index, uint32_t &a_random_state)
+{
+	auto workers_count = static_cast<uint32_t>(this->m_worker_queues.size());
+	auto victim        = next_random(a_random_state) % workers_count;
+
+	for (uint32_t i = 0; i < workers_count; ++i, victim = (victim + 1) % workers_count)
+	{
+		if (victim == a_worker_index)
+			continue;
+
+		if (auto *job = this->m_worker_queues[victim]->steal())
+			return job;
+	}
+
+	return nullptr;
+}
+
+Job *JobSystem::find_job(uint32_t a_worker_index, uint32_t &a_random_state)
+{
+	Job *job{nullptr};
+
+	if (a_worker_index < this->m_worker_queues.size())
+		job = this->m_worker_queues[a_worker_index]->pop();
+
+	if (!job)
+		this->m_injection_queue->pop(job);
+
+	if (!job)
+		job = this->steal_job(a_worker_index, a_random_state);
+
+	if (job)
+		this->m_jobs_count.fetch_sub(1);
+
+	return job;
+}
+
+void JobSystem::run_job(Job *a_job)
+{
+	{
+		profile_zone("job");
+		(*a_job)();        // Execute the job
+	}
+	a_job->finish();         // Schedules any successors that were only waiting on this job
+	a_job->release();        // Queue's reference, this might be the last one
+}
+
+bool JobSystem::local_queue_empty() const noexcept
+{
+	if (current_job_system == this)
+		return this->m_worker_queues[current_worker_index]->empty();
+
+	return this->m_injection_queue->empty();
+}
+
+bool JobSystem::execute_one()
+{
+	// Non worker threads can still help, they just don't have a deque of their own, so use an out of range worker index
+	uint32_t worker_index = current_job_system == this ? current_worker_index : static_cast<uint32_t>(this->m_worker_queues.size());
+	uint32_t random_state = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(&worker_index)) | 1u;
+
+	auto *job = this->find_job(worker_index, random_state);
+	if (job)
+	{
+		this->run_job(job);
+		return true;
+	}
+
+	return false;
+}
+
+void JobSystem::worker_loop(uint32_t a_worker_index)
+{
+	current_job_system   = this;
+	current_worker_index = a_worker_index;
+
+	ror::profiler().set_thread_name("worker " + std::to_string(a_worker_index));
+
+	uint32_t random_state = (a_worker_index + 1u) * 2654435761u;        // Knuth's multiplicative hash as seed, never zero
+
+	while (true)
+	{
+		auto *job = this->find_job(a_worker_index, random_state);
+		if (job)
+			this->run_job(job);
+		else
+		{
+			// Sleep to be awaken later
+			std::unique_lock<std::mutex> lock{this->m_lock};        // Using unique_lock instead of lock_guard because it needs to be relocked in the wait next
+
+			this->m_sleepers_count.fetch_add(1);
+			this->m_condition_variable.wait(lock, [this]() {
+				return this->m_jobs_count.load() > 0 || this->m_stop.load();
+			});
+			this->m_sleepers_count.fetch_sub(1);
 
-define_translation_unit_vtable(JobDepend)
-{}
+			if (this->m_stop.load() && this->m_jobs_count.load() == 0)
+				break;
+		}
+	}
 
-define_translation_unit_vtable(JobDepend1)
-{}
+	current_job_system = nullptr;
+}
 
 }        // namespace ror
@@ -27,5 +27,208 @@
 
 namespace ror
 {
+FORCE_INLINE JobRef::JobRef(Job *a_job) noexcept :
+    m_job(a_job)
+{
+	if (this->m_job)
+		this->m_job->add_reference();
+}
+
+FORCE_INLINE JobRef::JobRef(const JobRef &a_other) noexcept :
+    JobRef(a_other.m_job)
+{}
+
+FORCE_INLINE JobRef::JobRef(JobRef &&a_other) noexcept :
+    m_job(a_other.m_job)
+{
+	a_other.m_job = nullptr;
+}
+
+FORCE_INLINE JobRef &JobRef::operator=(const JobRef &a_other) noexcept
+{
+	if (this != &a_other)
+	{
+		if (a_other.m_job)
+			a_other.m_job->add_reference();
+
+		this->reset();
+		this->m_job = a_other.m_job;
+	}
+
+	return *this;
+}
+
+FORCE_INLINE JobRef &JobRef::operator=(JobRef &&a_other) noexcept
+{
+	if (this != &a_other)
+	{
+		this->reset();
+		this->m_job   = a_other.m_job;
+		a_other.m_job = nullptr;
+	}
+
+	return *this;
+}
+
+FORCE_INLINE JobRef::~JobRef() noexcept
+{
+	this->reset();
+}
+
+FORCE_INLINE void JobRef::reset() noexcept
+{
+	if (this->m_job)
+		this->m_job->release();
+
+	this->m_job = nullptr;
+}
+
+FORCE_INLINE void Job::reset(JobSystem *a_job_system) noexcept
+{
+	this->m_next       = nullptr;
+	this->m_invoke     = nullptr;
+	this->m_destroy    = nullptr;
+	this->m_task       = nullptr;
+	this->m_result     = nullptr;
+	this->m_job_system = a_job_system;
+	this->m_done.store(0u, std::memory_order_relaxed);
+	this->m_pending.store(0u, std::memory_order_relaxed);
+	this->m_successors.store(nullptr, std::memory_order_relaxed);
+}
+
+template <class _result, class _function>
+FORCE_INLINE void Job::bind(_function &&a_function)
+{
+	using task_type = JobTask<std::decay_t<_function>, _result>;
+
+	static_assert(!std::is_reference_v<_result>, "Jobs can't return references, return a pointer instead");
+
+	task_type *task{nullptr};
+
+	if constexpr (sizeof(task_type) <= storage_size && alignof(task_type) <= 16)
+	{
+		task            = ::new (static_cast<void *>(this->m_storage)) task_type(std::forward<_function>(a_function));
+		this->m_destroy = [](Job *a_job) { static_cast<task_type *>(a_job->m_task)->~task_type(); };
+	}
+	else
+	{
+		task            = new task_type(std::forward<_function>(a_function));        // Too big to fit, only allocation a job can do
+		this->m_destroy = [](Job *a_job) { delete static_cast<task_type *>(a_job->m_task); };
+	}
+
+	this->m_task   = task;
+	this->m_invoke = &task_type::invoke;
+	this->m_result = task->result();
+}
+
+/**
+ * Waits for the job to finish. If called from a worker thread the worker keeps running other jobs while waiting
+ * This makes it safe for jobs to push child jobs and wait on them, the children will either be stolen or ran by the parent itself
+ */
+template <class _future_type>
+FORCE_INLINE void JobHandle<_future_type>::wait()
+{
+	auto *job_system = JobSystem::current();
+	if (job_system)
+	{
+		while (!this->m_job->finished())
+			if (!job_system->execute_one())
+				std::this_thread::yield();
+	}
+
+	this->m_job->wait();
+}
+
+template <class _future_type>
+FORCE_INLINE _future_type JobHandle<_future_type>::data()
+{
+	assert(this->m_valid && "Calling data on invalid job handle");
+
+	this->wait();
+	this->m_valid = false;
+
+	if constexpr (!std::is_void_v<_future_type>)
+		return std::move(*static_cast<_future_type *>(this->m_job->result()));        // NOTE: There is a move happening here, if move is expensive for the return type of the job, fix this
+}
+
+FORCE_INLINE uint32_t JobSystem::grain_size(uint32_t a_begin, uint32_t a_end, uint32_t a_grain_size) const noexcept
+{
+	if (a_grain_size > 0)
+		return a_grain_size;
+
+	// Small enough that there are plenty of split points per worker, big enough that checking the queue is noise
+	return std::clamp((a_end - a_begin) / (this->workers_count() * 64u), 1u, 2048u);
+}
+
+template <class _type, class _body, class _reduce>
+_type JobSystem::parallel_range(uint32_t a_begin, uint32_t a_end, uint32_t a_grain_size, const _type &a_identity, _body &a_body, _reduce &a_reduce)
+{
+	std::array<JobRef, max_splits> splits{};
+	uint32_t                       splits_count{0};
+	_type                          result{a_identity};
+
+	while (a_begin < a_end)
+	{
+		auto remaining = a_end - a_begin;
+
+		// Lazy binary splitting, only split off the upper half if nobody has anything to take from this thread already
+		if (remaining > a_grain_size && splits_count < max_splits && this->local_queue_empty())
+		{
+			auto middle = a_begin + remaining / 2;
+			auto job    = this->make_job<_type>([this, middle, a_end, a_grain_size, &a_identity, &a_body, &a_reduce]() -> _type {
+				return this->parallel_range(middle, a_end, a_grain_size, a_identity, a_body, a_reduce);
+			});
+
+			this->submit(job, nullptr, 0);
+			splits[splits_count++] = std::move(job);
+
+			a_end = middle;
+			continue;
+		}
+
+		auto chunk_end = a_begin + std::min(remaining, a_grain_size);
+		result         = a_body(a_begin, chunk_end, std::move(result));
+		a_begin        = chunk_end;
+	}
+
+	// Later splits cover lower ranges, so walking them backwards keeps the results in index order
+	while (splits_count > 0)
+	{
+		JobHandle<_type> handle{std::move(splits[--splits_count])};
+		result = a_reduce(std::move(result), handle.data());
+	}
+
+	return result;
+}
+
+template <class _function>
+void JobSystem::parallel_for(uint32_t a_begin, uint32_t a_end, _function &&a_function, uint32_t a_grain_size)
+{
+	auto body = [&a_function](uint32_t a_chunk_begin, uint32_t a_chunk_end, NoResult a_result) {
+		for (uint32_t index = a_chunk_begin; index < a_chunk_end; ++index)
+			a_function(index);
+
+		return a_result;
+	};
+
+	auto reduce = [](NoResult a_left, NoResult) {
+		return a_left;
+	};
+
+	this->parallel_range(a_begin, a_end, this->grain_size(a_begin, a_end, a_grain_size), NoResult{}, body, reduce);
+}
+
+template <class _type, class _function, class _reduce>
+_type JobSystem::parallel_reduce(uint32_t a_begin, uint32_t a_end, _type a_identity, _function &&a_function, _reduce &&a_reduce, uint32_t a_grain_size)
+{
+	auto body = [&a_function, &a_reduce](uint32_t a_chunk_begin, uint32_t a_chunk_end, _type a_result) {
+		for (uint32_t index = a_chunk_begin; index < a_chunk_end; ++index)
+			a_result = a_reduce(std::move(a_result), a_function(index));
+
+		return a_result;
+	};
+
+	return this->parallel_range(a_begin, a_end, this->grain_size(a_begin, a_end, a_grain_size), a_identity, body, a_reduce);
+}
 
 }        // namespace ror
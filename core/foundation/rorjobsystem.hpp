@@ -25,28 +25,26 @@
 
 #pragma once
 
+#include "foundation/rorconcurrent_queue.hpp"
 #include "foundation/rormacros.hpp"
-#include "foundation/rorrandom.hpp"
 #include "profiling/rorlog.hpp"
 #include "roar.hpp"
 #include "settings/rorsettings.hpp"
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <cassert>
 #include <condition_variable>
 #include <cstddef>
-#include <deque>
-#include <forward_list>
 #include <functional>
-#include <future>
 #include <memory>
 #include <mutex>
-#include <queue>
+#include <new>
 #include <thread>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
-// #define WORK_STEALING 1
-
 namespace ror
 {
 /**
@@ -63,137 +61,286 @@ FORCE_INLINE uint32_t get_hardware_threads()
 	return tcount;
 }
 
-// TODO: Make all the allocations go away to see if that brings it back to as fast as it can be
+class Job;
+class JobSystem;
+
 /**
- * Base job type used internally by JobSystem
- * A job is a simple function that will be executed along side a done flag
- * This job is ready from the time its created, unless its done
+ * Intrusive reference counted pointer to a pooled Job, it doesn't allocate anything
+ * Jobs go back to the JobPool once the last JobRef to them is gone
  */
-class ROAR_ENGINE_ITEM Job
+class ROAR_ENGINE_ITEM JobRef final
 {
   public:
-	FORCE_INLINE      Job()                             = default;        //! Default constructor
-	FORCE_INLINE      Job(const Job &a_other)           = delete;         //! Copy constructor
-	FORCE_INLINE      Job(Job &&a_other) noexcept       = delete;         //! Move constructor
-	FORCE_INLINE Job &operator=(const Job &a_other)     = delete;         //! Copy assignment operator
-	FORCE_INLINE Job &operator=(Job &&a_other) noexcept = delete;         //! Move assignment operator
-	FORCE_INLINE virtual ~Job() noexcept                = default;        //! Destructor
+	FORCE_INLINE         JobRef() = default;        //! Default constructor
+	FORCE_INLINE         JobRef(const JobRef &a_other) noexcept;
+	FORCE_INLINE         JobRef(JobRef &&a_other) noexcept;
+	FORCE_INLINE JobRef &operator=(const JobRef &a_other) noexcept;
+	FORCE_INLINE JobRef &operator=(JobRef &&a_other) noexcept;
+	FORCE_INLINE ~JobRef() noexcept;
 
-	FORCE_INLINE explicit Job(std::function<void(void)> a_function) :
-	    m_payload(a_function)
-	{}
+	FORCE_INLINE explicit JobRef(Job *a_job) noexcept;
 
-	declare_translation_unit_vtable();
+	FORCE_INLINE Job *get() const noexcept
+	{
+		return this->m_job;
+	}
 
-	void operator()()
+	FORCE_INLINE Job *operator->() const noexcept
 	{
-		this->m_payload();
+		return this->m_job;
 	}
 
-	FORCE_INLINE void finish() noexcept
+	FORCE_INLINE explicit operator bool() const noexcept
 	{
-		// this->m_done.test_and_set();
-		this->m_done.store(true);
+		return this->m_job != nullptr;
 	}
 
-	[[nodiscard]] FORCE_INLINE bool finished() noexcept
+	FORCE_INLINE void reset() noexcept;
+
+  protected:
+  private:
+	Job *m_job{nullptr};        // Pooled job, this reference keeps it alive
+};
+
+using Dependencies = std::vector<JobRef>;
+
+/**
+ * Type erased storage for the job callable and its result, lives inside the Job if it fits otherwise on the heap
+ */
+template <class _function, class _result>
+class JobTask final
+{
+  public:
+	FORCE_INLINE          JobTask(const JobTask &a_other)     = delete;        //! Copy constructor
+	FORCE_INLINE          JobTask(JobTask &&a_other) noexcept = delete;        //! Move constructor
+	FORCE_INLINE JobTask &operator=(const JobTask &a_other)   = delete;        //! Copy assignment operator
+	FORCE_INLINE JobTask &operator=(JobTask &&a_other)        = delete;        //! Move assignment operator
+
+	template <class _callable>
+	FORCE_INLINE explicit JobTask(_callable &&a_function) :
+	    m_function(std::forward<_callable>(a_function))
+	{}
+
+	FORCE_INLINE ~JobTask() noexcept
 	{
-		// return this->m_done.test();
-		return this->m_done.load();
+		if (this->m_has_result)
+			this->result()->~_result();
 	}
 
-	FORCE_INLINE virtual bool ready() noexcept
+	FORCE_INLINE static void invoke(void *a_task)
 	{
-		// Always ready because no dependencies
-		return true;
+		auto *task = static_cast<JobTask *>(a_task);
+		::new (static_cast<void *>(task->m_result)) _result(task->m_function());
+		task->m_has_result = true;
 	}
 
-	// TODO: Add debug code to check how many jobs are alive at one time. Are we actually deleting all those shared_ptrs or not
+	FORCE_INLINE _result *result() noexcept
+	{
+		return std::launder(reinterpret_cast<_result *>(this->m_result));
+	}
 
   protected:
   private:
-	std::function<void(void)> m_payload{};          // Function the job runs along side its arguments
-	std::atomic_bool          m_done{false};        // Cleared by default initializer to false
+	_function m_function;                                    // Function the job runs along side its arguments
+	alignas(_result) std::byte m_result[sizeof(_result)];    // Result is only constructed once the function has ran
+	bool m_has_result{false};                                // Set once m_result is constructed
 };
 
-/**
- * Job specialization with a vector of dependencies used internally by JobSystem
- * A job is a simple function that will be executed along side a done flag and vector of dependencies
- * This job is ready when all of its dependencies are done
- */
-class ROAR_ENGINE_ITEM JobDepend final : public Job
+template <class _function>
+class JobTask<_function, void> final
 {
   public:
-	FORCE_INLINE            JobDepend()                             = default;        //! Default constructor
-	FORCE_INLINE            JobDepend(const JobDepend &a_other)     = delete;         //! Copy constructor
-	FORCE_INLINE            JobDepend(JobDepend &&a_other) noexcept = delete;         //! Move constructor
-	FORCE_INLINE JobDepend &operator=(const JobDepend &a_other)     = delete;         //! Copy assignment operator
-	FORCE_INLINE JobDepend &operator=(JobDepend &&a_other) noexcept = delete;         //! Move assignment operator
-	FORCE_INLINE ~JobDepend() noexcept override                     = default;        //! Destructor
-
-	FORCE_INLINE JobDepend(std::function<void(void)> a_function, std::vector<std::shared_ptr<Job>> a_dependencies) :
-	    Job(a_function), m_dependencies(std::move(a_dependencies))
+	FORCE_INLINE          JobTask(const JobTask &a_other)     = delete;        //! Copy constructor
+	FORCE_INLINE          JobTask(JobTask &&a_other) noexcept = delete;        //! Move constructor
+	FORCE_INLINE JobTask &operator=(const JobTask &a_other)   = delete;        //! Copy assignment operator
+	FORCE_INLINE JobTask &operator=(JobTask &&a_other)        = delete;        //! Move assignment operator
+	FORCE_INLINE ~JobTask() noexcept                          = default;       //! Destructor
+
+	template <class _callable>
+	FORCE_INLINE explicit JobTask(_callable &&a_function) :
+	    m_function(std::forward<_callable>(a_function))
 	{}
 
-	declare_translation_unit_vtable() override;
-
-	FORCE_INLINE bool ready() noexcept override
+	FORCE_INLINE static void invoke(void *a_task)
 	{
-		// Ready when all dependencies are "done"
-		for (auto &d : this->m_dependencies)
-			if (d)
-				if (!d->finished())
-					return false;
+		static_cast<JobTask *>(a_task)->m_function();
+	}
 
-		return true;
+	FORCE_INLINE void *result() noexcept
+	{
+		return nullptr;
 	}
 
   protected:
   private:
-	std::vector<std::shared_ptr<Job>> m_dependencies{};        // All job dependencies, synchronisation performed via m_done in Job
+	_function m_function;        // Function the job runs along side its arguments
 };
 
+constexpr size_t job_alignment = cache_line_size;        //! Jobs never share cache lines with each other
+
 /**
- * Job specialization with a single dependency used internally by JobSystem
- * A job is a simple function that will be executed along side a done flag and a dependency
- * This job is ready when its dependency is done
+ * Recycles objects so the job system doesn't allocate in steady state
+ * Objects are allocated in blocks that are never freed until the pool dies, _type must have an accessible m_next pointer
+ * Each thread acquires from its own free list and refills it by taking the whole shared free list at once
+ * Releases from any thread go to the shared free list, which is a lock free stack that only ever pops everything, so there is no ABA
+ * The per thread free lists are per _type so there should only be one pool per _type, see job_pool() and job_edge_pool()
  */
-class ROAR_ENGINE_ITEM JobDepend1 final : public Job
+template <class _type>
+class ROAR_ENGINE_ITEM FreeListPool final
 {
   public:
-	FORCE_INLINE             JobDepend1()                              = default;        //! Default constructor
-	FORCE_INLINE             JobDepend1(const JobDepend1 &a_other)     = delete;         //! Copy constructor
-	FORCE_INLINE             JobDepend1(JobDepend1 &&a_other) noexcept = delete;         //! Move constructor
-	FORCE_INLINE JobDepend1 &operator=(const JobDepend1 &a_other)      = delete;         //! Copy assignment operator
-	FORCE_INLINE JobDepend1 &operator=(JobDepend1 &&a_other) noexcept  = delete;         //! Move assignment operator
-	FORCE_INLINE ~JobDepend1() noexcept override                       = default;        //! Destructor
-
-	FORCE_INLINE JobDepend1(std::function<void(void)> a_function, std::shared_ptr<Job> a_dependency) :
-	    Job(a_function), m_dependency(a_dependency)
-	{}
+	FORCE_INLINE               FreeListPool()                                  = default;        //! Default constructor
+	FORCE_INLINE               FreeListPool(const FreeListPool &a_other)       = delete;         //! Copy constructor
+	FORCE_INLINE               FreeListPool(FreeListPool &&a_other) noexcept   = delete;         //! Move constructor
+	FORCE_INLINE FreeListPool &operator=(const FreeListPool &a_other)          = delete;         //! Copy assignment operator
+	FORCE_INLINE FreeListPool &operator=(FreeListPool &&a_other) noexcept      = delete;         //! Move assignment operator
+	FORCE_INLINE ~FreeListPool() noexcept                                      = default;        //! Destructor
+
+	static constexpr size_t block_size = 256;        //! Objects per allocation
+
+	_type *acquire();
+	void   release(_type *a_item) noexcept;
+	void   release_list(_type *a_head) noexcept;
+	void   reserve(size_t a_count);
+	size_t capacity() const noexcept;
+
+  protected:
+  private:
+	struct Block
+	{
+		_type m_items[block_size];
+	};
 
-	declare_translation_unit_vtable() override;
+	_type *allocate_block();
 
-	FORCE_INLINE bool ready() noexcept override
+	alignas(cache_line_size) std::atomic<_type *> m_free_list{nullptr};        // Released objects from all threads
+	std::vector<std::unique_ptr<Block>>            m_blocks{};                  // Owns all the objects
+	mutable std::mutex                             m_blocks_lock{};             // Only taken when the pool needs to grow
+};
+
+/**
+ * Link in a job's list of successors, the successor is scheduled once all of its predecessors have walked their edges
+ */
+struct ROAR_ENGINE_ITEM JobEdge
+{
+	Job     *m_successor{nullptr};        // Job waiting on the predecessor that owns this edge
+	JobEdge *m_next{nullptr};             // Next successor or next free edge while in the pool
+};
+
+/**
+ * Job type used internally by JobSystem, these are never allocated by themselves and always come from the JobPool
+ * A job is a type erased callable stored inline (small buffer) along side a done flag, a pending predecessors counter and a list of successors
+ * A job is enqueued exactly once, when its last predecessor finishes, there is no polling for readiness
+ */
+class ROAR_ENGINE_ITEM Job final
+{
+  public:
+	FORCE_INLINE      Job()                             = default;        //! Default constructor
+	FORCE_INLINE      Job(const Job &a_other)           = delete;         //! Copy constructor
+	FORCE_INLINE      Job(Job &&a_other) noexcept       = delete;         //! Move constructor
+	FORCE_INLINE Job &operator=(const Job &a_other)     = delete;         //! Copy assignment operator
+	FORCE_INLINE Job &operator=(Job &&a_other) noexcept = delete;         //! Move assignment operator
+	FORCE_INLINE ~Job() noexcept                        = default;        //! Destructor
+
+	static constexpr size_t storage_size = 48;        //! Callables plus results up to this size don't allocate
+
+	template <class _result, class _function>
+	FORCE_INLINE void bind(_function &&a_function);
+
+	FORCE_INLINE void reset(JobSystem *a_job_system) noexcept;
+
+	FORCE_INLINE void operator()()
 	{
-		// Ready when dependency is "done"
-		if (this->m_dependency)
-			if (!this->m_dependency->finished())
-				return false;
+		this->m_invoke(this->m_task);
+	}
 
-		return true;
+	void finish() noexcept;
+
+	[[nodiscard]] FORCE_INLINE bool finished() const noexcept
+	{
+		return this->m_done.load(std::memory_order_acquire) != 0u;
+	}
+
+	FORCE_INLINE void wait() const noexcept
+	{
+		while (!this->finished())
+			this->m_done.wait(0u, std::memory_order_acquire);
+	}
+
+	/**
+	 * Adds a_edge to the list of jobs to be released when this job finishes
+	 * Returns false if the job has already finished, in which case the successor shouldn't wait on it
+	 */
+	bool add_successor(JobEdge *a_edge) noexcept;
+
+	/**
+	 * Counts one predecessor as done, returns true if that was the last one and the job should now be scheduled
+	 */
+	FORCE_INLINE bool predecessor_done() noexcept
+	{
+		return this->m_pending.fetch_sub(1u, std::memory_order_acq_rel) == 1u;
+	}
+
+	FORCE_INLINE void add_predecessors(uint32_t a_count) noexcept
+	{
+		this->m_pending.fetch_add(a_count, std::memory_order_relaxed);
+	}
+
+	FORCE_INLINE JobSystem *job_system() const noexcept
+	{
+		return this->m_job_system;
 	}
 
+	FORCE_INLINE void *result() const noexcept
+	{
+		return this->m_result;
+	}
+
+	FORCE_INLINE void add_reference() noexcept
+	{
+		this->m_references.fetch_add(1u, std::memory_order_relaxed);
+	}
+
+	void release() noexcept;
+
   protected:
   private:
-	std::shared_ptr<Job> m_dependency{};        // A job dependency, needs synchronisation before reading
+	friend class FreeListPool<Job>;
+
+	using invoke_function  = void (*)(void *);
+	using destroy_function = void (*)(Job *);
+
+	alignas(job_alignment) std::atomic_uint32_t m_references{0};   // Intrusive reference count, handles and queues all hold one
+	std::atomic_uint32_t  m_done{0};                               // Cleared on reuse, can be waited on
+	std::atomic_uint32_t  m_pending{0};                            // Predecessors still running plus one for the submission itself
+	invoke_function       m_invoke{nullptr};                       // Runs the type erased task
+	destroy_function      m_destroy{nullptr};                      // Destroys the type erased task
+	void                 *m_task{nullptr};                         // Points into m_storage or heap if the task was too big
+	void                 *m_result{nullptr};                       // Points to the task result, nullptr for void jobs
+	Job                  *m_next{nullptr};                         // Free list link while in the pool
+	std::atomic<JobEdge *> m_successors{nullptr};                  // Lock free stack of successors, closed when the job finishes
+	JobSystem            *m_job_system{nullptr};                   // Where the job gets scheduled once its predecessors are done
+	alignas(16) std::byte m_storage[storage_size]{};               // Small buffer for the task
 };
 
-using Dependencies = std::vector<std::shared_ptr<Job>>;
+static_assert(sizeof(Job) == 2 * cache_line_size, "Job should be exactly two cache lines");
+
+using JobPool     = FreeListPool<Job>;
+using JobEdgePool = FreeListPool<JobEdge>;
+
+/**
+ * Returns the global JobPool all jobs come from
+ */
+ROAR_ENGINE_ITEM JobPool &job_pool();
+
+/**
+ * Returns the global JobEdgePool all dependency edges come from
+ */
+ROAR_ENGINE_ITEM JobEdgePool &job_edge_pool();
 
 /**
  * JobHandle is public interface to the job system.
- * A JobHandle consists of a Job and a future that clients can wait on for results to be available
+ * A JobHandle consists of a Job that clients can wait on for results to be available
  */
 template <class _future_type>
 class ROAR_ENGINE_ITEM JobHandle final
@@ -202,45 +349,44 @@ class ROAR_ENGINE_ITEM JobHandle final
 	FORCE_INLINE            JobHandle(const JobHandle &a_other)     = delete;         //! Copy constructor
 	FORCE_INLINE            JobHandle(JobHandle &&a_other) noexcept = default;        //! Move constructor
 	FORCE_INLINE JobHandle &operator=(const JobHandle &a_other)     = delete;         //! Copy assignment operator
-	FORCE_INLINE JobHandle &operator=(JobHandle &&a_other) noexcept = delete;         //! Move assignment operator PATL: Don't enable this segfaulting with this
+	FORCE_INLINE JobHandle &operator=(JobHandle &&a_other) noexcept = default;        //! Move assignment operator
 	FORCE_INLINE ~JobHandle() noexcept                              = default;        //! Destructor
 
-	FORCE_INLINE JobHandle(std::shared_ptr<Job> a_job, std::future<_future_type> &&a_future) :
-	    m_job(a_job), m_future(std::move(a_future))
+	FORCE_INLINE explicit JobHandle(JobRef a_job) :
+	    m_job(std::move(a_job)), m_valid(true)
 	{}
 
-	FORCE_INLINE std::future<_future_type> &future()
-	{
-		return this->m_future;
-	}
-
-	FORCE_INLINE std::shared_ptr<Job> job()
+	FORCE_INLINE JobRef job() const
 	{
 		return this->m_job;
 	}
 
-	FORCE_INLINE _future_type data()
+	[[nodiscard]] FORCE_INLINE bool valid() const noexcept
 	{
-		assert(this->m_future.valid() && "Calling get on invalid future");
-		return this->m_future.get();        // NOTE: There is a move happening here, if move is expensive for the return type of the job, fix this
+		return this->m_valid;
 	}
 
-	FORCE_INLINE void wait()
+	[[nodiscard]] FORCE_INLINE bool finished() const noexcept
 	{
-		this->data();
+		return this->m_job->finished();
 	}
 
+	FORCE_INLINE _future_type data();
+	FORCE_INLINE void         wait();
+
   protected:
   private:
 	FORCE_INLINE JobHandle() = default;        //! Default constructor
 
-	std::shared_ptr<Job>      m_job;
-	std::future<_future_type> m_future;        // Need to keep the copy here
+	JobRef m_job{};               // Keeps the job and its result alive
+	bool   m_valid{false};        // Result can only be taken out once
 };
 
 /**
  * JobSystem is the main job system. You would need an instance of this somewhere to push jobs to
- * JobSystem internally uses deque to push jobs onto. Jobs are ran as they come along unless they have dependecies
+ * Every worker owns a lock free Chase-Lev deque, jobs pushed from a worker go to its own deque and are popped LIFO
+ * Jobs pushed from outside the workers go into a lock free injection queue, idle workers steal from each other's deques
+ * Jobs with dependencies are not queued at all until their last dependency finishes, which then schedules them as a continuation
  */
 class ROAR_ENGINE_ITEM JobSystem final
 {
@@ -255,57 +401,7 @@ class ROAR_ENGINE_ITEM JobSystem final
 	}
 
   private:
-	class ROAR_ENGINE_ITEM WorkerQueue final
-	{
-	  public:
-		FORCE_INLINE              WorkerQueue()                               = default;        //! Default constructor
-		FORCE_INLINE              WorkerQueue(const WorkerQueue &a_other)     = delete;         //! Copy constructor
-		FORCE_INLINE              WorkerQueue(WorkerQueue &&a_other) noexcept = delete;         //! Move constructor
-		FORCE_INLINE WorkerQueue &operator=(const WorkerQueue &a_other)       = delete;         //! Copy assignment operator
-		FORCE_INLINE WorkerQueue &operator=(WorkerQueue &&a_other) noexcept   = delete;         //! Move assignment operator
-		FORCE_INLINE ~WorkerQueue() noexcept                                  = default;        //! Destructor
-
-		FORCE_INLINE void push(std::shared_ptr<Job> a_job)
-		{
-			std::lock_guard<std::mutex> lock{this->m_lock};
-			this->m_worker_queue.emplace_back(a_job);
-		}
-
-		FORCE_INLINE std::shared_ptr<Job> pop()
-		{
-			std::lock_guard<std::mutex> lock{this->m_lock};
-			return this->_pop();
-		}
-
-#if defined(WORK_STEALING)
-		FORCE_INLINE std::shared_ptr<Job> steal()
-		{
-			std::lock_guard<std::mutex> lock{this->m_lock};
-			return this->_pop();
-		}
-#endif
-
-		FORCE_INLINE bool empty()
-		{
-			std::lock_guard<std::mutex> lock{this->m_lock};
-			return this->m_worker_queue.empty();
-		}
-
-	  protected:
-	  private:
-		FORCE_INLINE std::shared_ptr<Job> _pop()
-		{
-			if (this->m_worker_queue.empty())
-				return nullptr;
-
-			auto front = this->m_worker_queue.front();
-			this->m_worker_queue.pop_front();
-			return front;
-		}
-
-		std::deque<std::shared_ptr<Job>> m_worker_queue{};        // WorkerQueue queues containing all the jobs for this worker
-		std::mutex                       m_lock{};                // Used to lock shared variables in this worker
-	};
+	using WorkerQueue = WorkStealingDeque<Job *>;
 
   public:
 	FORCE_INLINE JobSystem()        //! Default constructor
@@ -321,59 +417,34 @@ class ROAR_ENGINE_ITEM JobSystem final
 	template <class _function, class... _arguments>
 	decltype(auto) push_job(_function &&a_function, _arguments &&...a_arguments)
 	{
-		auto                 pack_task = make_packaged(std::forward<_function>(a_function), std::forward<_arguments>(a_arguments)...);
-		std::shared_ptr<Job> job       = std::make_shared<Job>([pack_task]() { (*pack_task)(); });
-#if defined(WORK_STEALING)
-		auto index = this->random_worker();
-		this->worker(index).push(job);
-#else
-		this->m_worker_queue.push(job);            // WorkerQueue is thread safe by itself
-#endif
-
-		// std::lock_guard<std::mutex> lock(this->m_lock);        // Don't need to take a lock, condition variable doesn't need one. Keep here to debug issues
-		this->m_condition_variable.notify_one();
-
 		using return_type = decltype(a_function(a_arguments...));
-		return JobHandle<return_type>{job, pack_task->get_future()};
+
+		auto job = this->make_job<return_type>(std::forward<_function>(a_function), std::forward<_arguments>(a_arguments)...);
+		this->submit(job, nullptr, 0);
+
+		return JobHandle<return_type>{std::move(job)};
 	}
 
 	template <class _function, class... _arguments>
 	decltype(auto) push_job(_function &&a_function, Dependencies a_dependencies, _arguments &&...a_arguments)
 	{
-		auto                       pack_task = make_packaged(std::forward<_function>(a_function), std::forward<_arguments>(a_arguments)...);
-		std::shared_ptr<JobDepend> job       = std::make_shared<JobDepend>([pack_task]() { (*pack_task)(); }, std::forward<Dependencies>(a_dependencies));
-#if defined(WORK_STEALING)
-		auto index = this->random_worker();
-		this->worker(index).push(job);
-#else
-		this->m_worker_queue.push(job);            // WorkerQueue is thread safe by itself
-#endif
-
-		// std::lock_guard<std::mutex> lock(this->m_lock);        // Don't need to take a lock, condition variable doesn't need one. Keep here to debug issues
-		this->m_condition_variable.notify_one();
-
 		using return_type = decltype(a_function(a_arguments...));
-		return JobHandle<return_type>{job, pack_task->get_future()};
+
+		auto job = this->make_job<return_type>(std::forward<_function>(a_function), std::forward<_arguments>(a_arguments)...);
+		this->submit(job, a_dependencies.data(), a_dependencies.size());
+
+		return JobHandle<return_type>{std::move(job)};
 	}
 
 	template <class _function, class... _arguments>
-	decltype(auto) push_job(_function &&a_function, std::shared_ptr<Job> a_dependency, _arguments &&...a_arguments)
+	decltype(auto) push_job(_function &&a_function, JobRef a_dependency, _arguments &&...a_arguments)
 	{
-		auto pack_task = make_packaged(std::forward<_function>(a_function), std::forward<_arguments>(a_arguments)...);
-
-		std::shared_ptr<JobDepend1> job = std::make_shared<JobDepend1>([pack_task]() { (*pack_task)(); }, std::forward<std::shared_ptr<Job>>(a_dependency));
-#if defined(WORK_STEALING)
-		auto index = this->random_worker();
-		this->worker(index).push(job);
-#else
-		this->m_worker_queue.push(job);            // WorkerQueue is thread safe by itself
-#endif
+		using return_type = decltype(a_function(a_arguments...));
 
-		// std::lock_guard<std::mutex> lock(this->m_lock);        // Don't need to take a lock, condition variable doesn't need one. Keep here to debug issues
-		this->m_condition_variable.notify_one();
+		auto job = this->make_job<return_type>(std::forward<_function>(a_function), std::forward<_arguments>(a_arguments)...);
+		this->submit(job, &a_dependency, 1);
 
-		using return_type = decltype(a_function(a_arguments...));
-		return JobHandle<return_type>{job, pack_task->get_future()};
+		return JobHandle<return_type>{std::move(job)};
 	}
 
 	template <class _function>
@@ -381,212 +452,115 @@ class ROAR_ENGINE_ITEM JobSystem final
 	{
 		assert(a_group_size > 0 && a_data_size >= a_group_size && "Data and Group size mismatch in push_job_group");
 
-		std::vector<std::shared_ptr<Job>> handles;
-		handles.reserve(a_data_size / a_group_size);
+		Dependencies handles;
+		handles.reserve(a_data_size / a_group_size + 1);
 
 		for (uint32_t i = 0; i < a_data_size; i += a_group_size)
 		{
-			std::shared_ptr<Job> job = std::make_shared<Job>([a_group_size, i, &a_function, a_data_size]() {
+			auto job = this->make_job<void>([a_group_size, i, &a_function, a_data_size]() {
 				for (uint32_t index = i; index < i + a_group_size && index < a_data_size; ++index)
 				{
 					a_function(index);
 				}
 			});
 
-#if defined(WORK_STEALING)
-			auto index = this->random_worker();
-			this->worker(index).push(job);
-#else
-			this->m_worker_queue.push(job);        // WorkerQueue is thread safe by itself
-#endif
-
-			this->m_condition_variable.notify_one();
+			this->submit(job, nullptr, 0);
 
-			handles.emplace_back(job);
+			handles.emplace_back(std::move(job));
 		}
 
 		return this->push_job([]() {}, handles);
 	}
 
-	FORCE_INLINE void stop()
+	/**
+	 * Calls a_function(index) for every index in [a_begin, a_end) and returns when all of them are done
+	 * Uses lazy binary splitting, the range is ran in chunks of a_grain_size and the remaining half is only split off as a new job
+	 * when the calling thread's queue is empty, i.e. when other workers are likely hungry. This adapts to irregular per index costs
+	 * without having to pick a group size up front. a_grain_size of 0 picks one based on the range and number of workers
+	 */
+	template <class _function>
+	void parallel_for(uint32_t a_begin, uint32_t a_end, _function &&a_function, uint32_t a_grain_size = 0);
+
+	/**
+	 * Returns a_reduce(...a_reduce(a_reduce(a_identity, a_function(a_begin)), a_function(a_begin + 1))..., a_function(a_end - 1))
+	 * Split the same way as parallel_for, a_reduce must be associative but doesn't need to be commutative, partial results are combined in index order
+	 */
+	template <class _type, class _function, class _reduce>
+	_type parallel_reduce(uint32_t a_begin, uint32_t a_end, _type a_identity, _function &&a_function, _reduce &&a_reduce, uint32_t a_grain_size = 0);
+
+	/**
+	 * Returns true if the calling thread has nothing queued locally, so any work it splits off is likely going to be stolen
+	 * For non worker threads this checks the injection queue instead
+	 */
+	bool local_queue_empty() const noexcept;
+
+	/**
+	 * Runs one available job on the calling thread if there is any, returns false if nothing was found
+	 * Used by JobHandle::wait() so a worker waiting on a result keeps the system busy instead of blocking a thread
+	 */
+	bool execute_one();
+
+	/**
+	 * Called when a job's last predecessor is done, hands the job over to the queues
+	 */
+	void schedule(Job *a_job);
+
+	/**
+	 * Returns the JobSystem the calling thread is a worker of, nullptr if its not a worker thread
+	 */
+	static JobSystem *current() noexcept;
+
+	FORCE_INLINE uint32_t workers_count() const noexcept
 	{
-		{
-			std::lock_guard<std::mutex> lock{this->m_lock};
-			this->m_stop.store(true);
-		}
-
-		this->m_condition_variable.notify_all();
-
-		for (auto &worker : this->m_workers)
-			if (worker->joinable())
-				worker->join();
-
-		this->m_workers.clear();
+		return static_cast<uint32_t>(this->m_worker_queues.size());
 	}
 
+	void stop();
+
   protected:
   private:
-	template <class _function, class... _arguments>
-	FORCE_INLINE decltype(auto) make_packaged(_function &&a_function, _arguments &&...a_arguments)
+	template <class _result, class _function, class... _arguments>
+	FORCE_INLINE JobRef make_job(_function &&a_function, _arguments &&...a_arguments)
 	{
 		// TODO: Make use of the technique in https://stackoverflow.com/questions/46564845/perfect-forwarding-of-references-with-stdbind-inside-variadic-template
 		// This way clients won't have to wrap function arguments in std::ref and std::cref to push_job labmda's if they are passed by reference
 
-		using return_type = decltype(a_function(a_arguments...));
-		return std::make_shared<std::packaged_task<return_type()>>(
-		    std::bind(std::forward<_function>(a_function), std::forward<_arguments>(a_arguments)...));
-	}
-
-#if defined(WORK_STEALING)
-	FORCE_INLINE uint32_t random_worker() const
-	{
-		return this->m_random_index.next();
-	}
-
-	FORCE_INLINE WorkerQueue &worker(uint32_t a_index)
-	{
-		return *this->m_worker_queues[static_cast<size_t>(a_index)];
-	}
-
-	FORCE_INLINE std::shared_ptr<Job> any_job()
-	{
-		for (auto &q : this->m_worker_queues)
-			if (auto j = q->steal())
-				return j;
-
-		return nullptr;
-	}
-
-	FORCE_INLINE bool all_empty()
-	{
-		for (auto &q : this->m_worker_queues)
-			if (!q->empty())
-				return false;
-
-		return true;
-	}
+		// Arguments are copied into the job like std::bind does, the callable is called with lvalues of those copies
+		JobRef job{job_pool().acquire()};
+		job->reset(this);
+		job->bind<_result>([function = std::forward<_function>(a_function), ... arguments = std::forward<_arguments>(a_arguments)]() mutable -> _result {
+			return function(arguments...);
+		});
 
-	FORCE_INLINE void run_job(std::shared_ptr<Job> a_job, WorkerQueue &a_worker)
-	{
-		if (a_job->ready())
-		{
-			(*a_job)();        // Execute the job
-			a_job->finish();
-		}
-		else
-			// this->m_worker_queue.push(a_job);
-			a_worker.push(a_job);
+		return job;
 	}
-#endif
 
-#if !defined(WORK_STEALING)
-	void init(uint32_t a_workers_count)
-	{
-		const auto payload_function = [this](uint32_t a_thread_id) {
-			(void) a_thread_id;
-			while (true)
-			{
-				auto job = this->m_worker_queue.pop();
-				if (job != nullptr)
-				{
-					if (job->ready())
-					{
-						// If this is blocking and there are no more threads available to run jobs (especially child jobs of the blocking function) we will hang, current solution is more threads
-						// TODO: Find a better solution. Should be mostly handled in client code not spwaning multiple jobs and then waiting in the same job
-						(*job)();        // Execute the job
-						job->finish();
-					}
-					else
-						this->m_worker_queue.push(job);
-				}
-				else
-				{
-					// Sleep to be awaken later
-					std::unique_lock<std::mutex> lock{this->m_lock};        // Using unique_lock instead of lock_guard because it needs to be relocked in the wait next
-					this->m_condition_variable.wait(lock, [this]() {
-						return !this->m_worker_queue.empty() || this->m_stop.load();
-					});
-
-					if (this->m_stop.load())
-						return;
-				}
-			}
-		};
+	// Unit result type for parallel_for so it can share parallel_range with parallel_reduce
+	struct NoResult
+	{};
 
-		this->m_random_index.reset(0u, a_workers_count - 1);
+	static constexpr uint32_t max_splits = 32;        //! Each split halves the remaining range so this is enough for any uint32_t range
 
-		// Kick of all the threads
-		for (size_t i = 0; i < a_workers_count; ++i)
-			this->m_workers.emplace_back(std::make_unique<std::thread>(payload_function, i));
-	}
-#else
-	void init(uint32_t a_workers_count)
-	{
-		const auto payload_function = [this](uint32_t a_thread_id) {
-			(void) a_thread_id;
-			auto &my_worker = this->worker(a_thread_id);
-			while (true)
-			{
-				// auto a_job = this->m_worker_queue.pop();
-				auto job = my_worker.pop();
-				if (job)
-				{
-					this->run_job(job, my_worker);
-				}
-				else
-				{
-					auto &other_worker = this->worker(this->random_worker());
-					// Steal a job
-					job = other_worker.steal();
-					if (job != nullptr)
-					{
-						this->run_job(job, other_worker);
-					}
-					else
-					{
-						// Look for jobs in all queues
-						job = this->any_job();
-						if (job != nullptr)
-						{
-							this->run_job(job, my_worker);
-						}
-						else
-						{
-							// Sleep to be awaken later
-							std::unique_lock<std::mutex> lock{this->m_lock};        // Using unique_lock instead of lock_guard because it needs to be relocked in the wait next
-							this->m_condition_variable.wait(lock, [this, &a_thread_id]() {
-								// return !this->m_worker_queue.empty() || this->m_stop.test();
-								return !this->m_worker_queues[a_thread_id]->empty() || !this->all_empty() || this->m_stop.load();
-							});
-
-							if (this->m_stop.load())
-								return;
-						}
-					}
-				}
-			}
-		};
+	template <class _type, class _body, class _reduce>
+	_type parallel_range(uint32_t a_begin, uint32_t a_end, uint32_t a_grain_size, const _type &a_identity, _body &a_body, _reduce &a_reduce);
 
-		this->m_random_index.reset(0u, a_workers_count - 1);
+	uint32_t grain_size(uint32_t a_begin, uint32_t a_end, uint32_t a_grain_size) const noexcept;
 
-		for (size_t i = 0; i < a_workers_count; ++i)
-			this->m_worker_queues.emplace_back(std::make_unique<WorkerQueue>());
+	void init(uint32_t a_workers_count);
+	void submit(const JobRef &a_job, const JobRef *a_dependencies, size_t a_dependencies_count);
+	void enqueue(Job *a_job);
+	void run_job(Job *a_job);
+	void worker_loop(uint32_t a_worker_index);
+	Job *find_job(uint32_t a_worker_index, uint32_t &a_random_state);
+	Job *steal_job(uint32_t a_worker_index, uint32_t &a_random_state);
 
-		// Kick of all the threads
-		for (size_t i = 0; i < a_workers_count; ++i)
-			this->m_workers.emplace_back(std::make_unique<std::thread>(payload_function, i));
-	}
-#endif
-
-#if !defined(WORK_STEALING)
-	WorkerQueue m_worker_queue{};        // Worker queue that contains all the jobs to be executed
-#else
-	std::vector<std::unique_ptr<WorkerQueue>> m_worker_queues{};        // list of worker queues containing all the jobs for that worker
-#endif
-	ror::Random<uint32_t>   m_random_index{};              // Random index generator from 0 - workers_count - 1
-	std::condition_variable m_condition_variable{};        // Used to signal workers to start working
-	std::mutex              m_lock{};                      // Used to lock shared variables in job system
-	std::atomic_bool        m_stop{false};                 // Used to check if should stop execution
+	std::vector<std::unique_ptr<WorkerQueue>> m_worker_queues{};                //! One Chase-Lev deque per worker, only that worker pushes and pops from it
+	std::unique_ptr<ConcurrentQueue<Job *>>   m_injection_queue{};              //! Jobs pushed from non worker threads end up here
+	alignas(cache_line_size) std::atomic_uint32_t m_jobs_count{0};              //! Number of jobs sitting in any of the queues
+	alignas(cache_line_size) std::atomic_uint32_t m_sleepers_count{0};          //! Number of workers sleeping on the condition variable
+	std::condition_variable m_condition_variable{};                             //! Used to signal workers to start working
+	std::mutex              m_lock{};                                           //! Only used for sleeping and waking workers, never when pushing or popping jobs
+	std::atomic_bool        m_stop{false};                                      //! Used to check if should stop execution
 
 	// Could only really be used in this context with the .test() method, which is only available in c++20
 	// std::atomic_flag                          m_stop{false};                 // Used to check if should stop execution
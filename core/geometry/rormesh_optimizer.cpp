@@ -0,0 +1,507 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "foundation/rorhash.hpp"
+#include "math/rorvector3.hpp"
+#include "rormesh_optimizer.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+namespace ror
+{
+namespace
+{
+constexpr uint32_t invalid_index{~0u};
+
+// Forsyth's constants, the cache size here only shapes the scores and isn't the size of any real cache
+constexpr uint32_t  forsyth_cache_size{32};
+constexpr uint32_t  forsyth_valence_table_size{64};
+constexpr float32_t forsyth_cache_decay_power{1.5f};
+constexpr float32_t forsyth_last_triangle_score{0.75f};
+constexpr float32_t forsyth_valence_boost_scale{2.0f};
+constexpr float32_t forsyth_valence_boost_power{0.5f};
+
+// Size of the FIFO used to find cluster boundaries for overdraw optimisation
+constexpr uint32_t overdraw_cache_size{16};
+
+struct ForsythScores
+{
+	std::array<float32_t, forsyth_cache_size>         m_cache{};          //! Score of each cache position
+	std::array<float32_t, forsyth_valence_table_size> m_valence{};        //! Score of each remaining valence
+};
+
+const ForsythScores &forsyth_scores()
+{
+	static const ForsythScores scores = [] {
+		ForsythScores table{};
+
+		for (uint32_t i = 0; i < forsyth_cache_size; ++i)
+		{
+			// Vertices of the last triangle get a fixed score so the next triangle doesn't just reuse its edge, that would make strips
+			if (i < 3)
+				table.m_cache[i] = forsyth_last_triangle_score;
+			else
+				table.m_cache[i] = std::pow(1.0f - static_cast<float32_t>(i - 3) / static_cast<float32_t>(forsyth_cache_size - 3), forsyth_cache_decay_power);
+		}
+
+		for (uint32_t i = 1; i < forsyth_valence_table_size; ++i)
+			table.m_valence[i] = forsyth_valence_boost_scale * std::pow(static_cast<float32_t>(i), -forsyth_valence_boost_power);
+
+		return table;
+	}();
+
+	return scores;
+}
+
+float32_t forsyth_vertex_score(int32_t a_cache_position, uint32_t a_remaining_valence)
+{
+	// No triangles left to draw means nothing to gain from this vertex
+	if (a_remaining_valence == 0)
+		return -1.0f;
+
+	auto &scores = forsyth_scores();
+
+	float32_t score = a_cache_position >= 0 ? scores.m_cache[static_cast<uint32_t>(a_cache_position)] : 0.0f;
+
+	// Boost vertices with few triangles left so they are finished off instead of leaving lone triangles behind
+	if (a_remaining_valence < forsyth_valence_table_size)
+		score += scores.m_valence[a_remaining_valence];
+	else
+		score += forsyth_valence_boost_scale * std::pow(static_cast<float32_t>(a_remaining_valence), -forsyth_valence_boost_power);
+
+	return score;
+}
+
+hash_64_t vertex_hash(const std::vector<VertexStream> &a_streams, uint32_t a_vertex)
+{
+	hash_64_t hash = 0;
+	for (auto &stream : a_streams)
+		hash_combine_64(hash, hash_64(stream.m_data + static_cast<size_t>(a_vertex) * stream.m_stride, stream.m_size));
+
+	return hash;
+}
+
+bool vertex_equal(const std::vector<VertexStream> &a_streams, uint32_t a_left, uint32_t a_right)
+{
+	for (auto &stream : a_streams)
+		if (std::memcmp(stream.m_data + static_cast<size_t>(a_left) * stream.m_stride, stream.m_data + static_cast<size_t>(a_right) * stream.m_stride, stream.m_size) != 0)
+			return false;
+
+	return true;
+}
+
+/**
+ * FIFO cache simulator, a vertex is in the cache if it was added in the last a_cache_size misses
+ * Bumping the timestamp by more than the cache size empties the cache without touching every vertex
+ */
+class FifoCache
+{
+  public:
+	FifoCache(uint32_t a_vertex_count, uint32_t a_cache_size) :
+	    m_timestamps(a_vertex_count, 0u), m_timestamp(a_cache_size + 1), m_cache_size(a_cache_size)
+	{}
+
+	uint32_t access(uint32_t a_vertex)
+	{
+		if (this->m_timestamp - this->m_timestamps[a_vertex] > this->m_cache_size)
+		{
+			this->m_timestamps[a_vertex] = this->m_timestamp++;
+			return 1;
+		}
+
+		return 0;
+	}
+
+	uint32_t access(const uint32_t *a_triangle)
+	{
+		return this->access(a_triangle[0]) + this->access(a_triangle[1]) + this->access(a_triangle[2]);
+	}
+
+	void clear()
+	{
+		this->m_timestamp += this->m_cache_size + 1;
+	}
+
+  private:
+	std::vector<uint32_t> m_timestamps{};        //! When each vertex was last added to the cache
+	uint32_t              m_timestamp{0};        //! Misses so far plus the clears
+	uint32_t              m_cache_size{0};       //! Vertices in the cache
+};
+
+Vector3f position(const float32_t *a_positions, uint32_t a_stride, uint32_t a_vertex)
+{
+	const auto *p = reinterpret_cast<const float32_t *>(reinterpret_cast<const uint8_t *>(a_positions) + static_cast<size_t>(a_vertex) * a_stride);
+	return {p[0], p[1], p[2]};
+}
+
+}        // namespace
+
+uint32_t generate_vertex_remap(std::vector<uint32_t> &a_remap, const std::vector<uint32_t> &a_indices, uint32_t a_vertex_count, const std::vector<VertexStream> &a_streams)
+{
+	a_remap.assign(a_vertex_count, invalid_index);
+
+	// Open addressing table of the first vertex of each kind, at most half full
+	auto                  table_size = std::bit_ceil(std::max(a_vertex_count * 2u, 16u));
+	auto                  table_mask = table_size - 1;
+	std::vector<uint32_t> table(table_size, invalid_index);
+
+	uint32_t unique_count = 0;
+	for (auto index : a_indices)
+	{
+		assert(index < a_vertex_count && "Index out of range of the vertex streams");
+
+		if (a_remap[index] != invalid_index)
+			continue;
+
+		auto bucket = static_cast<uint32_t>(vertex_hash(a_streams, index)) & table_mask;
+		for (uint32_t probe = 1;; ++probe)
+		{
+			auto &entry = table[bucket];
+
+			if (entry == invalid_index)
+			{
+				entry          = index;
+				a_remap[index] = unique_count++;
+				break;
+			}
+
+			if (vertex_equal(a_streams, entry, index))
+			{
+				a_remap[index] = a_remap[entry];
+				break;
+			}
+
+			bucket = (bucket + probe) & table_mask;        // Triangular probing visits every bucket of a power of two table
+		}
+	}
+
+	return unique_count;
+}
+
+void remap_indices(std::vector<uint32_t> &a_indices, const std::vector<uint32_t> &a_remap)
+{
+	for (auto &index : a_indices)
+	{
+		assert(a_remap[index] != invalid_index && "Remapping an index to a vertex that was dropped");
+		index = a_remap[index];
+	}
+}
+
+void remap_vertices(uint8_t *a_destination, const VertexStream &a_source, const std::vector<uint32_t> &a_remap)
+{
+	for (uint32_t vertex = 0; vertex < a_remap.size(); ++vertex)
+		if (a_remap[vertex] != invalid_index)
+			std::memcpy(a_destination + static_cast<size_t>(a_remap[vertex]) * a_source.m_size, a_source.m_data + static_cast<size_t>(vertex) * a_source.m_stride, a_source.m_size);
+}
+
+void optimize_vertex_cache(std::vector<uint32_t> &a_indices, uint32_t a_vertex_count)
+{
+	assert(a_indices.size() % 3 == 0 && "Only triangle lists can be optimised");
+
+	auto triangles_count = static_cast<uint32_t>(a_indices.size() / 3);
+	if (triangles_count == 0)
+		return;
+
+	// Triangles of each vertex packed into one array, emitted triangles are swapped out past the remaining valence
+	std::vector<uint32_t> valences(a_vertex_count, 0u);
+	std::vector<uint32_t> adjacency_offsets(a_vertex_count + 1, 0u);
+	std::vector<uint32_t> adjacency(a_indices.size());
+
+	for (auto index : a_indices)
+	{
+		assert(index < a_vertex_count && "Index out of range of the vertex count");
+		valences[index]++;
+	}
+
+	for (uint32_t vertex = 0; vertex < a_vertex_count; ++vertex)
+		adjacency_offsets[vertex + 1] = adjacency_offsets[vertex] + valences[vertex];
+
+	{
+		std::vector<uint32_t> cursors(adjacency_offsets.begin(), adjacency_offsets.end() - 1);
+		for (uint32_t i = 0; i < a_indices.size(); ++i)
+			adjacency[cursors[a_indices[i]]++] = i / 3;
+	}
+
+	std::vector<int32_t>   cache_positions(a_vertex_count, -1);
+	std::vector<float32_t> vertex_scores(a_vertex_count);
+	std::vector<float32_t> triangle_scores(triangles_count);
+	std::vector<uint8_t>   emitted(triangles_count, 0);
+
+	for (uint32_t vertex = 0; vertex < a_vertex_count; ++vertex)
+		vertex_scores[vertex] = forsyth_vertex_score(-1, valences[vertex]);
+
+	uint32_t  best_triangle = 0;
+	float32_t best_score    = -1.0f;
+	for (uint32_t triangle = 0; triangle < triangles_count; ++triangle)
+	{
+		const auto *t             = &a_indices[triangle * 3];
+		triangle_scores[triangle] = vertex_scores[t[0]] + vertex_scores[t[1]] + vertex_scores[t[2]];
+
+		if (triangle_scores[triangle] > best_score)
+		{
+			best_score    = triangle_scores[triangle];
+			best_triangle = triangle;
+		}
+	}
+
+	std::vector<uint32_t> output;
+	output.reserve(a_indices.size());
+
+	std::array<uint32_t, forsyth_cache_size + 3> cache{};
+	std::array<uint32_t, forsyth_cache_size + 3> new_cache{};
+	uint32_t                                     cache_count = 0;
+	uint32_t                                     scan_cursor = 0;
+
+	while (output.size() < a_indices.size())
+	{
+		// Nothing in the cache has triangles left, carry on with the next triangle in the original order
+		if (best_triangle == invalid_index)
+		{
+			while (emitted[scan_cursor])
+				++scan_cursor;
+
+			best_triangle = scan_cursor;
+		}
+
+		const auto *triangle_vertices = &a_indices[best_triangle * 3];
+		emitted[best_triangle]        = 1;
+		output.insert(output.end(), triangle_vertices, triangle_vertices + 3);
+
+		for (uint32_t i = 0; i < 3; ++i)
+		{
+			auto vertex = triangle_vertices[i];
+			auto begin  = adjacency.begin() + adjacency_offsets[vertex];
+			auto end    = begin + valences[vertex];
+
+			std::iter_swap(std::find(begin, end, best_triangle), end - 1);
+			valences[vertex]--;
+		}
+
+		// Triangle's vertices go to the front of the LRU cache, the ones pushed out past its size drop out
+		uint32_t new_cache_count = 0;
+		for (uint32_t i = 0; i < 3; ++i)
+			if (std::find(new_cache.begin(), new_cache.begin() + new_cache_count, triangle_vertices[i]) == new_cache.begin() + new_cache_count)        // Degenerate triangles repeat vertices
+				new_cache[new_cache_count++] = triangle_vertices[i];
+
+		for (uint32_t i = 0; i < cache_count; ++i)
+		{
+			auto vertex = cache[i];
+			if (vertex != triangle_vertices[0] && vertex != triangle_vertices[1] && vertex != triangle_vertices[2])
+				new_cache[new_cache_count++] = vertex;
+		}
+
+		for (uint32_t i = 0; i < new_cache_count; ++i)
+		{
+			auto vertex             = new_cache[i];
+			cache_positions[vertex] = i < forsyth_cache_size ? static_cast<int32_t>(i) : -1;
+			vertex_scores[vertex]   = forsyth_vertex_score(cache_positions[vertex], valences[vertex]);
+		}
+
+		// Only triangles of vertices that moved in the cache changed their score, the best of those is drawn next
+		best_triangle = invalid_index;
+		best_score    = -1.0f;
+		for (uint32_t i = 0; i < new_cache_count; ++i)
+		{
+			auto vertex = new_cache[i];
+			auto begin  = adjacency_offsets[vertex];
+			auto end    = begin + valences[vertex];
+
+			for (auto a = begin; a < end; ++a)
+			{
+				auto        triangle      = adjacency[a];
+				const auto *t             = &a_indices[triangle * 3];
+				triangle_scores[triangle] = vertex_scores[t[0]] + vertex_scores[t[1]] + vertex_scores[t[2]];
+
+				if (triangle_scores[triangle] > best_score)
+				{
+					best_score    = triangle_scores[triangle];
+					best_triangle = triangle;
+				}
+			}
+		}
+
+		cache_count = std::min(new_cache_count, forsyth_cache_size);
+		std::copy(new_cache.begin(), new_cache.begin() + cache_count, cache.begin());
+	}
+
+	a_indices = std::move(output);
+}
+
+void optimize_overdraw(std::vector<uint32_t> &a_indices, const float32_t *a_positions, uint32_t a_positions_stride, uint32_t a_vertex_count, float32_t a_threshold)
+{
+	assert(a_indices.size() % 3 == 0 && "Only triangle lists can be optimised");
+
+	auto triangles_count = static_cast<uint32_t>(a_indices.size() / 3);
+	if (triangles_count == 0)
+		return;
+
+	FifoCache cache{a_vertex_count, overdraw_cache_size};
+
+	// Hard boundaries are where the cache optimiser had to restart, all 3 vertices of the triangle are misses
+	std::vector<uint32_t> hard_clusters{};
+	for (uint32_t triangle = 0; triangle < triangles_count; ++triangle)
+		if (cache.access(&a_indices[triangle * 3]) == 3 || triangle == 0)
+			hard_clusters.push_back(triangle);
+
+	hard_clusters.push_back(triangles_count);
+
+	// Soft boundaries split hard clusters as soon as the cache misses of the part so far are within the threshold of the whole cluster
+	std::vector<uint32_t> clusters{};
+	for (size_t i = 0; i + 1 < hard_clusters.size(); ++i)
+	{
+		auto start = hard_clusters[i];
+		auto end   = hard_clusters[i + 1];
+
+		cache.clear();
+		uint32_t cluster_misses = 0;
+		for (auto triangle = start; triangle < end; ++triangle)
+			cluster_misses += cache.access(&a_indices[triangle * 3]);
+
+		auto threshold = a_threshold * static_cast<float32_t>(cluster_misses) / static_cast<float32_t>(end - start);
+
+		cache.clear();
+		clusters.push_back(start);
+
+		uint32_t misses    = 0;
+		uint32_t triangles = 0;
+		for (auto triangle = start; triangle < end; ++triangle)
+		{
+			misses += cache.access(&a_indices[triangle * 3]);
+			triangles++;
+
+			if (triangle + 1 < end && static_cast<float32_t>(misses) <= threshold * static_cast<float32_t>(triangles))
+			{
+				clusters.push_back(triangle + 1);
+				misses    = 0;
+				triangles = 0;
+				cache.clear();
+			}
+		}
+	}
+
+	clusters.push_back(triangles_count);
+
+	// Clusters facing away from the mesh center are likely to occlude the rest so they are drawn first
+	Vector3f mesh_centroid{0.0f, 0.0f, 0.0f};
+	for (auto index : a_indices)
+		mesh_centroid += position(a_positions, a_positions_stride, index);
+
+	mesh_centroid /= static_cast<float32_t>(a_indices.size());
+
+	auto                   clusters_count = static_cast<uint32_t>(clusters.size() - 1);
+	std::vector<float32_t> sort_keys(clusters_count);
+	for (uint32_t i = 0; i < clusters_count; ++i)
+	{
+		Vector3f  centroid{0.0f, 0.0f, 0.0f};
+		Vector3f  normal{0.0f, 0.0f, 0.0f};
+		float32_t area = 0.0f;
+
+		for (auto triangle = clusters[i]; triangle < clusters[i + 1]; ++triangle)
+		{
+			auto p0 = position(a_positions, a_positions_stride, a_indices[triangle * 3 + 0]);
+			auto p1 = position(a_positions, a_positions_stride, a_indices[triangle * 3 + 1]);
+			auto p2 = position(a_positions, a_positions_stride, a_indices[triangle * 3 + 2]);
+
+			auto n             = (p1 - p0).cross_product(p2 - p0);        // Length is twice the area
+			auto triangle_area = n.length();
+
+			centroid += (p0 + p1 + p2) * (triangle_area / 3.0f);
+			normal += n;
+			area += triangle_area;
+		}
+
+		auto normal_length = normal.length();
+		if (area > 0.0f && normal_length > 0.0f)
+			sort_keys[i] = (centroid / area - mesh_centroid).dot_product(normal / normal_length);
+		else
+			sort_keys[i] = 0.0f;
+	}
+
+	std::vector<uint32_t> order(clusters_count);
+	for (uint32_t i = 0; i < clusters_count; ++i)
+		order[i] = i;
+
+	std::stable_sort(order.begin(), order.end(), [&sort_keys](uint32_t a_left, uint32_t a_right) { return sort_keys[a_left] > sort_keys[a_right]; });
+
+	std::vector<uint32_t> output;
+	output.reserve(a_indices.size());
+
+	for (auto cluster : order)
+		output.insert(output.end(), a_indices.begin() + clusters[cluster] * 3, a_indices.begin() + clusters[cluster + 1] * 3);
+
+	a_indices = std::move(output);
+}
+
+uint32_t optimize_vertex_fetch_remap(std::vector<uint32_t> &a_remap, const std::vector<uint32_t> &a_indices, uint32_t a_vertex_count)
+{
+	a_remap.assign(a_vertex_count, invalid_index);
+
+	uint32_t next = 0;
+	for (auto index : a_indices)
+	{
+		assert(index < a_vertex_count && "Index out of range of the vertex count");
+
+		if (a_remap[index] == invalid_index)
+			a_remap[index] = next++;
+	}
+
+	return next;
+}
+
+VertexCacheStatistics analyze_vertex_cache(const std::vector<uint32_t> &a_indices, uint32_t a_vertex_count, uint32_t a_cache_size)
+{
+	VertexCacheStatistics statistics{};
+
+	if (a_indices.empty())
+		return statistics;
+
+	FifoCache            cache{a_vertex_count, a_cache_size};
+	std::vector<uint8_t> referenced(a_vertex_count, 0);
+	uint32_t             referenced_count = 0;
+
+	for (auto index : a_indices)
+	{
+		assert(index < a_vertex_count && "Index out of range of the vertex count");
+
+		statistics.m_vertices_transformed += cache.access(index);
+
+		if (!referenced[index])
+		{
+			referenced[index] = 1;
+			referenced_count++;
+		}
+	}
+
+	statistics.m_acmr = static_cast<float32_t>(statistics.m_vertices_transformed) / static_cast<float32_t>(a_indices.size() / 3);
+	statistics.m_atvr = static_cast<float32_t>(statistics.m_vertices_transformed) / static_cast<float32_t>(referenced_count);
+
+	return statistics;
+}
+
+}        // namespace ror
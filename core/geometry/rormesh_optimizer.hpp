@@ -0,0 +1,113 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#pragma once
+
+#include "foundation/rormacros.hpp"
+#include "foundation/rortypes.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace ror
+{
+/**
+ * Import time optimisations for indexed triangle lists, all functions work on uint32_t indices and leave converting to narrower types to the caller
+ * The usual order is generate_vertex_remap() to weld duplicates, optimize_vertex_cache(), optimize_overdraw() and last optimize_vertex_fetch_remap()
+ * Every step is deterministic so the same input always gives the same output, that's required for cooking
+ */
+
+/**
+ * One vertex attribute stream, a_count elements of m_size bytes each m_stride bytes apart
+ */
+struct VertexStream
+{
+	const uint8_t *m_data{nullptr};        //! First element
+	uint32_t       m_size{0};              //! Bytes per element that take part in comparisons and copies
+	uint32_t       m_stride{0};            //! Bytes from one element to the next
+};
+
+/**
+ * Results of running indices through a FIFO post transform cache simulator
+ * ACMR is transformed vertices per triangle, ~0.5 is as good as it gets for regular meshes and 3.0 means no reuse at all
+ * ATVR is transformed vertices per referenced vertex, 1.0 means every vertex is transformed only once
+ */
+struct VertexCacheStatistics
+{
+	uint32_t  m_vertices_transformed{0};        //! Cache misses
+	float32_t m_acmr{0.0f};                     //! Average cache miss ratio
+	float32_t m_atvr{0.0f};                     //! Average transformed vertex ratio
+};
+
+/**
+ * @brief      Finds vertices that are the same in all streams and maps each to the first one of them
+ * @param      a_remap Receives the new index of each vertex, vertices not referenced by a_indices get ~0u
+ * @param      a_indices Triangle list indices
+ * @param      a_vertex_count Vertices in each stream
+ * @param      a_streams All streams of the vertex, vertices are only duplicates if all streams are byte equal
+ * @return     Number of unique referenced vertices, new indices are in the order vertices are first referenced
+ */
+ROAR_ENGINE_ITEM uint32_t generate_vertex_remap(std::vector<uint32_t> &a_remap, const std::vector<uint32_t> &a_indices, uint32_t a_vertex_count, const std::vector<VertexStream> &a_streams);
+
+/**
+ * @brief      Replaces every index with a_remap[index]
+ */
+ROAR_ENGINE_ITEM void remap_indices(std::vector<uint32_t> &a_indices, const std::vector<uint32_t> &a_remap);
+
+/**
+ * @brief      Copies a_source into a_destination tightly packed in the order given by a_remap, entries with ~0u are dropped
+ * @param      a_destination Must have room for as many elements as there are unique entries in a_remap
+ */
+ROAR_ENGINE_ITEM void remap_vertices(uint8_t *a_destination, const VertexStream &a_source, const std::vector<uint32_t> &a_remap);
+
+/**
+ * @brief      Reorders triangles for post transform vertex cache reuse using Tom Forsyth's "Linear-Speed Vertex Cache Optimisation"
+ *             It doesn't depend on an exact cache size and behaves well on LRU and FIFO caches alike
+ * @param      a_indices Triangle list indices reordered in place, winding of each triangle is kept
+ * @param      a_vertex_count One more than the largest index
+ */
+ROAR_ENGINE_ITEM void optimize_vertex_cache(std::vector<uint32_t> &a_indices, uint32_t a_vertex_count);
+
+/**
+ * @brief      Reorders clusters of cache optimised triangles so the ones facing out from the mesh center are drawn first to reduce overdraw
+ *             Based on "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw" by Sander, Nehab and Barczak
+ *             Clusters are only split where the cache miss ratio stays within a_threshold of the cache optimised order
+ * @param      a_positions x, y and z float32_t per vertex a_positions_stride bytes apart
+ * @param      a_threshold How much worse ACMR can get in exchange for less overdraw, 1.05 allows 5%
+ */
+ROAR_ENGINE_ITEM void optimize_overdraw(std::vector<uint32_t> &a_indices, const float32_t *a_positions, uint32_t a_positions_stride, uint32_t a_vertex_count, float32_t a_threshold = 1.05f);
+
+/**
+ * @brief      Generates a remap that orders vertices in the order they are first used by a_indices so vertex fetch walks memory linearly
+ * @param      a_remap Receives the new index of each vertex, vertices not referenced get ~0u
+ * @return     Number of referenced vertices
+ */
+ROAR_ENGINE_ITEM uint32_t optimize_vertex_fetch_remap(std::vector<uint32_t> &a_remap, const std::vector<uint32_t> &a_indices, uint32_t a_vertex_count);
+
+/**
+ * @brief      Runs a_indices through a FIFO post transform cache of a_cache_size vertices
+ */
+ROAR_ENGINE_ITEM VertexCacheStatistics analyze_vertex_cache(const std::vector<uint32_t> &a_indices, uint32_t a_vertex_count, uint32_t a_cache_size = 16);
+
+}        // namespace ror
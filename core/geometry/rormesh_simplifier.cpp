@@ -0,0 +1,459 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "math/rorvector3.hpp"
+#include "rormesh_optimizer.hpp"
+#include "rormesh_simplifier.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
+namespace ror
+{
+namespace
+{
+constexpr uint32_t invalid_index{~0u};
+
+/**
+ * Sum of squared distances to a set of planes, each weighted by the area of the triangle it came from
+ */
+struct Quadric
+{
+	double64_t m_a00{0.0}, m_a11{0.0}, m_a22{0.0};        //! Diagonal of the symmetric 3x3 matrix
+	double64_t m_a01{0.0}, m_a02{0.0}, m_a12{0.0};        //! Off diagonal of the symmetric 3x3 matrix
+	double64_t m_b0{0.0}, m_b1{0.0}, m_b2{0.0};           //! Linear part
+	double64_t m_c{0.0};                                  //! Constant part
+	double64_t m_weight{0.0};                             //! Total area of all the planes
+
+	void add(const Quadric &a_other)
+	{
+		this->m_a00 += a_other.m_a00;
+		this->m_a11 += a_other.m_a11;
+		this->m_a22 += a_other.m_a22;
+		this->m_a01 += a_other.m_a01;
+		this->m_a02 += a_other.m_a02;
+		this->m_a12 += a_other.m_a12;
+		this->m_b0 += a_other.m_b0;
+		this->m_b1 += a_other.m_b1;
+		this->m_b2 += a_other.m_b2;
+		this->m_c += a_other.m_c;
+		this->m_weight += a_other.m_weight;
+	}
+
+	// Area weighted average of squared distances from a_point to the planes
+	double64_t error(const Vector3f &a_point) const
+	{
+		if (this->m_weight <= 0.0)
+			return 0.0;
+
+		double64_t x = a_point.x, y = a_point.y, z = a_point.z;
+		double64_t e = this->m_a00 * x * x + this->m_a11 * y * y + this->m_a22 * z * z +
+		               2.0 * (this->m_a01 * x * y + this->m_a02 * x * z + this->m_a12 * y * z) +
+		               2.0 * (this->m_b0 * x + this->m_b1 * y + this->m_b2 * z) + this->m_c;
+
+		return std::max(e, 0.0) / this->m_weight;
+	}
+};
+
+Quadric plane_quadric(const Vector3f &a_p0, const Vector3f &a_p1, const Vector3f &a_p2)
+{
+	Quadric quadric{};
+
+	auto normal = (a_p1 - a_p0).cross_product(a_p2 - a_p0);
+	auto length = normal.length();
+
+	if (length <= 0.0f)
+		return quadric;
+
+	double64_t a    = normal.x / length;
+	double64_t b    = normal.y / length;
+	double64_t c    = normal.z / length;
+	double64_t d    = -(a * a_p0.x + b * a_p0.y + c * a_p0.z);
+	double64_t area = length * 0.5;
+
+	quadric.m_a00    = a * a * area;
+	quadric.m_a11    = b * b * area;
+	quadric.m_a22    = c * c * area;
+	quadric.m_a01    = a * b * area;
+	quadric.m_a02    = a * c * area;
+	quadric.m_a12    = b * c * area;
+	quadric.m_b0     = a * d * area;
+	quadric.m_b1     = b * d * area;
+	quadric.m_b2     = c * d * area;
+	quadric.m_c      = d * d * area;
+	quadric.m_weight = area;
+
+	return quadric;
+}
+
+Vector3f read_position(const float32_t *a_positions, uint32_t a_stride, uint32_t a_vertex)
+{
+	const auto *p = reinterpret_cast<const float32_t *>(reinterpret_cast<const uint8_t *>(a_positions) + static_cast<size_t>(a_vertex) * a_stride);
+	return {p[0], p[1], p[2]};
+}
+
+double64_t attribute_error(const std::vector<SimplifyAttribute> &a_attributes, uint32_t a_from, uint32_t a_to)
+{
+	double64_t error = 0.0;
+	for (auto &attribute : a_attributes)
+	{
+		const auto *from = reinterpret_cast<const float32_t *>(reinterpret_cast<const uint8_t *>(attribute.m_data) + static_cast<size_t>(a_from) * attribute.m_stride);
+		const auto *to   = reinterpret_cast<const float32_t *>(reinterpret_cast<const uint8_t *>(attribute.m_data) + static_cast<size_t>(a_to) * attribute.m_stride);
+
+		for (uint32_t i = 0; i < attribute.m_components; ++i)
+		{
+			double64_t difference = from[i] - to[i];
+			error += attribute.m_weight * difference * difference;
+		}
+	}
+
+	return error;
+}
+
+uint64_t edge_key(uint32_t a_first, uint32_t a_second)
+{
+	return (static_cast<uint64_t>(std::min(a_first, a_second)) << 32) | std::max(a_first, a_second);
+}
+
+}        // namespace
+
+float32_t simplify(std::vector<uint32_t> &a_indices, const float32_t *a_positions, uint32_t a_positions_stride, uint32_t a_vertex_count,
+                   uint32_t a_target_index_count, float32_t a_target_error, const std::vector<SimplifyAttribute> &a_attributes)
+{
+	assert(a_indices.size() % 3 == 0 && "Only triangle lists can be simplified");
+
+	if (a_indices.size() <= a_target_index_count)
+		return 0.0f;
+
+	// Positions are normalised to the mesh size so errors and attribute weights don't depend on the scale of the mesh
+	Vector3f minimum{std::numeric_limits<float32_t>::max()};
+	Vector3f maximum{std::numeric_limits<float32_t>::lowest()};
+	for (auto index : a_indices)
+	{
+		assert(index < a_vertex_count && "Index out of range of the vertex count");
+
+		auto p  = read_position(a_positions, a_positions_stride, index);
+		minimum = {std::min(minimum.x, p.x), std::min(minimum.y, p.y), std::min(minimum.z, p.z)};
+		maximum = {std::max(maximum.x, p.x), std::max(maximum.y, p.y), std::max(maximum.z, p.z)};
+	}
+
+	auto scale = (maximum - minimum).maximum();
+	if (scale <= 0.0f)
+		scale = 1.0f;
+
+	std::vector<Vector3f> positions(a_vertex_count);
+	for (uint32_t vertex = 0; vertex < a_vertex_count; ++vertex)
+		positions[vertex] = (read_position(a_positions, a_positions_stride, vertex) - minimum) / scale;
+
+	// Collapses happen between positions, all vertices sharing a position move together so attribute seams never crack
+	std::vector<uint32_t> position_ids{};
+	auto                  position_count = generate_vertex_remap(position_ids, a_indices, a_vertex_count, {{reinterpret_cast<const uint8_t *>(a_positions), sizeof(float32_t) * 3, a_positions_stride}});
+
+	std::vector<uint32_t> wedge_offsets(position_count + 1, 0u);
+	for (auto id : position_ids)
+		if (id != invalid_index)
+			wedge_offsets[id + 1]++;
+
+	for (uint32_t position = 0; position < position_count; ++position)
+		wedge_offsets[position + 1] += wedge_offsets[position];
+
+	std::vector<uint32_t> wedges(wedge_offsets[position_count]);
+	{
+		auto cursors = wedge_offsets;
+		for (uint32_t vertex = 0; vertex < a_vertex_count; ++vertex)
+			if (position_ids[vertex] != invalid_index)
+				wedges[cursors[position_ids[vertex]]++] = vertex;
+	}
+
+	auto position_of = [&](uint32_t a_position) -> const Vector3f & { return positions[wedges[wedge_offsets[a_position]]]; };
+
+	// Edges used by only one triangle are open borders, their positions are locked so borders stay in place
+	std::unordered_map<uint64_t, uint32_t> edge_uses{};
+	edge_uses.reserve(a_indices.size());
+	for (size_t i = 0; i < a_indices.size(); i += 3)
+		for (size_t e = 0; e < 3; ++e)
+			edge_uses[edge_key(position_ids[a_indices[i + e]], position_ids[a_indices[i + (e + 1) % 3]])]++;
+
+	std::vector<uint8_t> locked(position_count, 0);
+	for (auto &edge : edge_uses)
+	{
+		if (edge.second == 1)
+		{
+			locked[static_cast<uint32_t>(edge.first >> 32)]         = 1;
+			locked[static_cast<uint32_t>(edge.first & 0xffffffff)] = 1;
+		}
+	}
+
+	std::vector<Quadric> quadrics(position_count);
+	for (size_t i = 0; i < a_indices.size(); i += 3)
+	{
+		auto quadric = plane_quadric(positions[a_indices[i]], positions[a_indices[i + 1]], positions[a_indices[i + 2]]);
+
+		for (size_t j = 0; j < 3; ++j)
+			quadrics[position_ids[a_indices[i + j]]].add(quadric);
+	}
+
+	double64_t error_limit = static_cast<double64_t>(a_target_error) / scale;
+	error_limit *= error_limit;
+
+	double64_t result_error = 0.0;
+
+	std::vector<uint32_t>   valences(a_vertex_count);
+	std::vector<uint32_t>   adjacency_offsets(a_vertex_count + 1);
+	std::vector<uint32_t>   adjacency{};
+	std::vector<uint32_t>   remap(a_vertex_count);
+	std::vector<uint32_t>   best_targets(position_count);
+	std::vector<double64_t> best_costs(position_count);
+	std::vector<double64_t> best_errors(position_count);
+	std::vector<uint8_t>    collapse_locked(position_count);
+	std::vector<uint32_t>   candidates{};
+
+	// The vertex of a_position a_vertex collapses onto, it has to share a triangle with a_vertex, nearest in attributes if there are more than one
+	auto wedge_target = [&](uint32_t a_vertex, uint32_t a_position) {
+		uint32_t   target = invalid_index;
+		double64_t best   = std::numeric_limits<double64_t>::max();
+
+		for (auto a = adjacency_offsets[a_vertex]; a < adjacency_offsets[a_vertex + 1]; ++a)
+		{
+			for (uint32_t j = 0; j < 3; ++j)
+			{
+				auto vertex = remap[a_indices[adjacency[a] * 3 + j]];
+				if (position_ids[vertex] != a_position)
+					continue;
+
+				auto cost = attribute_error(a_attributes, a_vertex, vertex);
+				if (cost < best)
+				{
+					best   = cost;
+					target = vertex;
+				}
+			}
+		}
+
+		return target;
+	};
+
+	// Every pass collapses each position at most once, cheapest collapses first, until enough triangles are gone or nothing more can collapse
+	while (a_indices.size() > a_target_index_count)
+	{
+		std::fill(valences.begin(), valences.end(), 0u);
+		for (auto index : a_indices)
+			valences[index]++;
+
+		adjacency_offsets[0] = 0;
+		for (uint32_t vertex = 0; vertex < a_vertex_count; ++vertex)
+			adjacency_offsets[vertex + 1] = adjacency_offsets[vertex] + valences[vertex];
+
+		adjacency.resize(a_indices.size());
+		std::copy(adjacency_offsets.begin(), adjacency_offsets.end() - 1, valences.begin());        // valences become fill cursors
+		for (uint32_t i = 0; i < a_indices.size(); ++i)
+			adjacency[valences[a_indices[i]]++] = i / 3;
+
+		for (uint32_t vertex = 0; vertex < a_vertex_count; ++vertex)
+			remap[vertex] = vertex;
+
+		std::fill(best_targets.begin(), best_targets.end(), invalid_index);
+		std::fill(best_costs.begin(), best_costs.end(), std::numeric_limits<double64_t>::max());
+
+		auto consider = [&](uint32_t a_from, uint32_t a_to) {
+			if (locked[a_from] || a_from == a_to)
+				return;
+
+			auto error = quadrics[a_from].error(position_of(a_to));
+			auto cost  = error;
+
+			for (auto w = wedge_offsets[a_from]; w < wedge_offsets[a_from + 1]; ++w)
+			{
+				auto vertex = wedges[w];
+				if (adjacency_offsets[vertex] == adjacency_offsets[vertex + 1])
+					continue;
+
+				auto target = wedge_target(vertex, a_to);
+				if (target == invalid_index)
+					return;
+
+				cost += attribute_error(a_attributes, vertex, target);
+			}
+
+			if (cost < best_costs[a_from])
+			{
+				best_targets[a_from] = a_to;
+				best_costs[a_from]   = cost;
+				best_errors[a_from]  = error;
+			}
+		};
+
+		for (size_t i = 0; i < a_indices.size(); i += 3)
+		{
+			for (size_t e = 0; e < 3; ++e)
+			{
+				auto first  = position_ids[a_indices[i + e]];
+				auto second = position_ids[a_indices[i + (e + 1) % 3]];
+
+				consider(first, second);
+				consider(second, first);
+			}
+		}
+
+		candidates.clear();
+		for (uint32_t position = 0; position < position_count; ++position)
+			if (best_targets[position] != invalid_index && best_errors[position] <= error_limit)
+				candidates.push_back(position);
+
+		std::stable_sort(candidates.begin(), candidates.end(), [&best_costs](uint32_t a_left, uint32_t a_right) { return best_costs[a_left] < best_costs[a_right]; });
+
+		std::fill(collapse_locked.begin(), collapse_locked.end(), 0);
+
+		// Moving a_from onto a_to mustn't turn any of the triangles around it over
+		auto flips = [&](uint32_t a_from, uint32_t a_to) {
+			for (auto w = wedge_offsets[a_from]; w < wedge_offsets[a_from + 1]; ++w)
+			{
+				auto vertex = wedges[w];
+				for (auto a = adjacency_offsets[vertex]; a < adjacency_offsets[vertex + 1]; ++a)
+				{
+					auto triangle = adjacency[a] * 3;
+					auto v0       = remap[a_indices[triangle + 0]];
+					auto v1       = remap[a_indices[triangle + 1]];
+					auto v2       = remap[a_indices[triangle + 2]];
+
+					if (v0 == v1 || v1 == v2 || v0 == v2 || position_ids[v0] == a_to || position_ids[v1] == a_to || position_ids[v2] == a_to)
+						continue;
+
+					auto p0 = positions[v0];
+					auto p1 = positions[v1];
+					auto p2 = positions[v2];
+
+					auto before = (p1 - p0).cross_product(p2 - p0);
+
+					(position_ids[v0] == a_from ? p0 : position_ids[v1] == a_from ? p1 : p2) = position_of(a_to);
+
+					auto after = (p1 - p0).cross_product(p2 - p0);
+
+					if (before.dot_product(after) <= 0.0f)
+						return true;
+				}
+			}
+
+			return false;
+		};
+
+		auto     triangles_to_remove = std::max<size_t>((a_indices.size() - a_target_index_count) / 3, 1);
+		size_t   triangles_removed   = 0;
+		uint32_t collapses           = 0;
+
+		for (auto from : candidates)
+		{
+			auto to = best_targets[from];
+
+			if (collapse_locked[from] || collapse_locked[to] || flips(from, to))
+				continue;
+
+			for (auto w = wedge_offsets[from]; w < wedge_offsets[from + 1]; ++w)
+			{
+				auto vertex = wedges[w];
+				for (auto a = adjacency_offsets[vertex]; a < adjacency_offsets[vertex + 1]; ++a)
+				{
+					auto triangle = adjacency[a] * 3;
+					auto v0       = remap[a_indices[triangle + 0]];
+					auto v1       = remap[a_indices[triangle + 1]];
+					auto v2       = remap[a_indices[triangle + 2]];
+
+					if (v0 != v1 && v1 != v2 && v0 != v2 && (position_ids[v0] == to || position_ids[v1] == to || position_ids[v2] == to))
+						triangles_removed++;
+				}
+			}
+
+			// Targets are looked up before any wedge of from moves, the vertices of to never move in the same pass
+			for (auto w = wedge_offsets[from]; w < wedge_offsets[from + 1]; ++w)
+			{
+				auto vertex = wedges[w];
+				if (adjacency_offsets[vertex] != adjacency_offsets[vertex + 1])
+					remap[vertex] = wedge_target(vertex, to);
+			}
+
+			collapse_locked[from] = 1;
+			collapse_locked[to]   = 1;
+
+			quadrics[to].add(quadrics[from]);
+			result_error = std::max(result_error, best_errors[from]);
+			collapses++;
+
+			if (triangles_removed >= triangles_to_remove)
+				break;
+		}
+
+		if (collapses == 0)
+			break;
+
+		size_t write = 0;
+		for (size_t i = 0; i < a_indices.size(); i += 3)
+		{
+			auto v0 = remap[a_indices[i + 0]];
+			auto v1 = remap[a_indices[i + 1]];
+			auto v2 = remap[a_indices[i + 2]];
+
+			// Degenerate by position, a triangle can end up with two different vertices of the same position on a seam corner
+			if (position_ids[v0] != position_ids[v1] && position_ids[v1] != position_ids[v2] && position_ids[v0] != position_ids[v2])
+			{
+				a_indices[write++] = v0;
+				a_indices[write++] = v1;
+				a_indices[write++] = v2;
+			}
+		}
+
+		a_indices.resize(write);
+	}
+
+	return static_cast<float32_t>(std::sqrt(result_error)) * scale;
+}
+
+std::vector<LodLevel> generate_lods(const std::vector<uint32_t> &a_indices, const float32_t *a_positions, uint32_t a_positions_stride, uint32_t a_vertex_count,
+                                    uint32_t a_max_levels, float32_t a_ratio, float32_t a_max_error, const std::vector<SimplifyAttribute> &a_attributes)
+{
+	std::vector<LodLevel> levels{};
+	levels.push_back({a_indices, 0.0f});
+
+	while (levels.size() < a_max_levels)
+	{
+		auto indices        = levels.back().m_indices;
+		auto previous_count = indices.size();
+		auto previous_error = levels.back().m_error;
+		auto target_count   = static_cast<uint32_t>(static_cast<float32_t>(previous_count) * a_ratio) / 3 * 3;
+
+		auto error = simplify(indices, a_positions, a_positions_stride, a_vertex_count, target_count, a_max_error - previous_error, a_attributes);
+
+		if (indices.empty() || indices.size() * 10 > previous_count * 9)
+			break;
+
+		optimize_vertex_cache(indices, a_vertex_count);
+		levels.push_back({std::move(indices), previous_error + error});
+	}
+
+	return levels;
+}
+
+}        // namespace ror
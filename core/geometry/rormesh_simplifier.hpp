@@ -0,0 +1,80 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#pragma once
+
+#include "foundation/rormacros.hpp"
+#include "foundation/rortypes.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace ror
+{
+/**
+ * A vertex attribute that takes part in the simplification error, like normals or texture coordinates
+ * Differences in it are weighted by m_weight and added to the geometric error which is measured relative to the mesh size
+ */
+struct SimplifyAttribute
+{
+	const float32_t *m_data{nullptr};        //! First component of the first vertex
+	uint32_t         m_stride{0};            //! Bytes from one vertex to the next
+	uint32_t         m_components{0};        //! Number of float32_t components used
+	float32_t        m_weight{1.0f};         //! How much a difference of 1 in this attribute costs compared to moving the surface by the mesh size
+};
+
+/**
+ * @brief      Simplifies a triangle list by collapsing edges in order of their quadric error, from "Surface Simplification Using Quadric Error Metrics" by Garland and Heckbert
+ *             Vertices only ever collapse onto other vertices so the result is a new index buffer for the same vertices
+ *             All vertices sharing a position collapse together, each onto a vertex it shares a triangle with, so attribute seams don't crack
+ *             Vertices on open borders are locked so borders stay in place
+ * @param      a_indices Triangle list indices simplified in place
+ * @param      a_positions x, y and z float32_t per vertex a_positions_stride bytes apart
+ * @param      a_target_index_count Stops once the index count is at or below this
+ * @param      a_target_error Stops before collapses that would move the surface more than this, in the same units as positions
+ * @param      a_attributes Optional attributes that make collapses across attribute changes more expensive
+ * @return     Largest error of all the collapses done, in the same units as positions
+ */
+ROAR_ENGINE_ITEM float32_t simplify(std::vector<uint32_t> &a_indices, const float32_t *a_positions, uint32_t a_positions_stride, uint32_t a_vertex_count,
+                                    uint32_t a_target_index_count, float32_t a_target_error, const std::vector<SimplifyAttribute> &a_attributes = {});
+
+/**
+ * Level of detail generated by generate_lods()
+ */
+struct LodLevel
+{
+	std::vector<uint32_t> m_indices{};         //! Triangle list indices of this level
+	float32_t             m_error{0.0f};        //! Error compared to the full detail mesh, in the same units as positions
+};
+
+/**
+ * @brief      Generates a chain of levels of detail each simplified from the previous one to a_ratio of its indices
+ *             The first level is a_indices as it is with no error, errors of later levels are the sum of the errors of all steps so they never decrease
+ *             The chain stops at a_max_levels or once a step can't remove at least a tenth of the triangles within a_max_error
+ * @param      a_max_error Largest error any level can have, in the same units as positions
+ */
+ROAR_ENGINE_ITEM std::vector<LodLevel> generate_lods(const std::vector<uint32_t> &a_indices, const float32_t *a_positions, uint32_t a_positions_stride, uint32_t a_vertex_count,
+                                                     uint32_t a_max_levels, float32_t a_ratio, float32_t a_max_error, const std::vector<SimplifyAttribute> &a_attributes = {});
+
+}        // namespace ror
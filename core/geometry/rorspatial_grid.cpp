@@ -0,0 +1,72 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "rorspatial_grid.hpp"
+#include <algorithm>
+#include <bit>
+
+namespace ror
+{
+void SpatialGrid::build(const float32_t *a_x, const float32_t *a_y, const float32_t *a_z, uint32_t a_count)
+{
+	// Twice as many buckets as points keeps collisions low, only grows so rebuilds don't allocate
+	auto buckets_count = std::bit_ceil(std::max(a_count * 2u, 16u));
+	this->m_mask       = std::max(this->m_mask, buckets_count - 1);
+
+	this->m_bucket_starts.assign(this->m_mask + 2, 0u);
+	this->m_point_buckets.resize(a_count);
+	this->m_indices.resize(a_count);
+	this->m_x.resize(a_count);
+	this->m_y.resize(a_count);
+	this->m_z.resize(a_count);
+
+	// Counting sort by bucket, first count then prefix sum then scatter in index order so buckets stay sorted by index
+	for (uint32_t i = 0; i < a_count; ++i)
+	{
+		auto b                   = this->bucket(this->cell(a_x[i]), this->cell(a_y[i]), this->cell(a_z[i]));
+		this->m_point_buckets[i] = b;
+		this->m_bucket_starts[b + 1]++;
+	}
+
+	for (uint32_t b = 1; b < this->m_bucket_starts.size(); ++b)
+		this->m_bucket_starts[b] += this->m_bucket_starts[b - 1];
+
+	// Uses the next bucket start as a running cursor and then shifts back
+	for (uint32_t i = 0; i < a_count; ++i)
+	{
+		auto slot             = this->m_bucket_starts[this->m_point_buckets[i]]++;
+		this->m_indices[slot] = i;
+		this->m_x[slot]       = a_x[i];
+		this->m_y[slot]       = a_y[i];
+		this->m_z[slot]       = a_z[i];
+	}
+
+	for (auto b = static_cast<uint32_t>(this->m_bucket_starts.size()) - 1; b > 0; --b)
+		this->m_bucket_starts[b] = this->m_bucket_starts[b - 1];
+
+	this->m_bucket_starts[0] = 0;
+}
+
+}        // namespace ror
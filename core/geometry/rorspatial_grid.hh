@@ -0,0 +1,120 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "rorspatial_grid.hpp"
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+
+namespace ror
+{
+FORCE_INLINE SpatialGrid::SpatialGrid(float32_t a_cell_size)
+{
+	this->cell_size(a_cell_size);
+}
+
+FORCE_INLINE void SpatialGrid::cell_size(float32_t a_cell_size) noexcept
+{
+	assert(a_cell_size > 0.0f && "Spatial grid cell size must be positive");
+
+	this->m_cell_size         = a_cell_size;
+	this->m_inverse_cell_size = 1.0f / a_cell_size;
+}
+
+FORCE_INLINE float32_t SpatialGrid::cell_size() const noexcept
+{
+	return this->m_cell_size;
+}
+
+FORCE_INLINE uint32_t SpatialGrid::size() const noexcept
+{
+	return static_cast<uint32_t>(this->m_indices.size());
+}
+
+FORCE_INLINE int32_t SpatialGrid::cell(float32_t a_value) const noexcept
+{
+	return static_cast<int32_t>(std::floor(a_value * this->m_inverse_cell_size));
+}
+
+FORCE_INLINE uint32_t SpatialGrid::bucket(int32_t a_x, int32_t a_y, int32_t a_z) const noexcept
+{
+	// Large primes from "Optimized Spatial Hashing for Collision Detection of Deformable Objects"
+	auto hash = (static_cast<uint32_t>(a_x) * 73856093u) ^ (static_cast<uint32_t>(a_y) * 19349663u) ^ (static_cast<uint32_t>(a_z) * 83492791u);
+	return hash & this->m_mask;
+}
+
+template <typename _function>
+FORCE_INLINE void SpatialGrid::query(const Vector3f &a_point, float32_t a_radius, _function &&a_function) const
+{
+	assert(a_radius <= this->m_cell_size && "Query radius can't be bigger than the cell size");
+
+	if (this->m_indices.empty())
+		return;
+
+	auto min_x = this->cell(a_point.x - a_radius), max_x = this->cell(a_point.x + a_radius);
+	auto min_y = this->cell(a_point.y - a_radius), max_y = this->cell(a_point.y + a_radius);
+	auto min_z = this->cell(a_point.z - a_radius), max_z = this->cell(a_point.z + a_radius);
+
+	// Different cells can hash to the same bucket, each bucket must only be visited once
+	// A 64 bit filter of seen buckets avoids searching the list for most of them
+	std::array<uint32_t, 27> buckets;
+	uint32_t                 buckets_count{0};
+	uint64_t                 seen{0};
+
+	for (auto z = min_z; z <= max_z; ++z)
+		for (auto y = min_y; y <= max_y; ++y)
+			for (auto x = min_x; x <= max_x; ++x)
+			{
+				auto b   = this->bucket(x, y, z);
+				auto bit = uint64_t{1} << (b & 63u);
+
+				if (!(seen & bit) || std::find(buckets.begin(), buckets.begin() + buckets_count, b) == buckets.begin() + buckets_count)
+					buckets[buckets_count++] = b;
+
+				seen |= bit;
+			}
+
+	auto radius_squared = a_radius * a_radius;
+
+	for (uint32_t i = 0; i < buckets_count; ++i)
+	{
+		auto end = this->m_bucket_starts[buckets[i] + 1];
+		for (auto j = this->m_bucket_starts[buckets[i]]; j < end; ++j)
+		{
+			Vector3f position{this->m_x[j], this->m_y[j], this->m_z[j]};
+
+			auto dx = position.x - a_point.x;
+			auto dy = position.y - a_point.y;
+			auto dz = position.z - a_point.z;
+			auto d2 = dx * dx + dy * dy + dz * dz;
+
+			if (d2 <= radius_squared)
+				a_function(this->m_indices[j], position, d2);
+		}
+	}
+}
+
+}        // namespace ror
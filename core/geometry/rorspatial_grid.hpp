@@ -0,0 +1,81 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#pragma once
+
+#include "foundation/rormacros.hpp"
+#include "foundation/rortypes.hpp"
+#include "math/rorvector3.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace ror
+{
+/**
+ * Spatial hash of points on a uniform grid, used for fixed radius neighbour queries
+ * build() counting sorts point indices by hashed cell so every cell's points are contiguous, positions are copied in the same order
+ * Points within a cell keep their original index order so queries visit neighbours in a deterministic order
+ * The grid is unbounded, cells are hashed into a power of two table sized from the points count, storage is reused between builds
+ * Query radius must not exceed the cell size, that way a query touches at most 3x3x3 cells
+ */
+class ROAR_ENGINE_ITEM SpatialGrid final
+{
+  public:
+	FORCE_INLINE              SpatialGrid()                               = default;        //! Default constructor
+	FORCE_INLINE              SpatialGrid(const SpatialGrid &a_other)     = default;        //! Copy constructor
+	FORCE_INLINE              SpatialGrid(SpatialGrid &&a_other) noexcept = default;        //! Move constructor
+	FORCE_INLINE SpatialGrid &operator=(const SpatialGrid &a_other)       = default;        //! Copy assignment operator
+	FORCE_INLINE SpatialGrid &operator=(SpatialGrid &&a_other) noexcept   = default;        //! Move assignment operator
+	FORCE_INLINE ~SpatialGrid() noexcept                                  = default;        //! Destructor
+
+	FORCE_INLINE explicit SpatialGrid(float32_t a_cell_size);
+
+	void build(const float32_t *a_x, const float32_t *a_y, const float32_t *a_z, uint32_t a_count);        // Positions as separate streams, only read during build
+
+	template <typename _function>
+	FORCE_INLINE void query(const Vector3f &a_point, float32_t a_radius, _function &&a_function) const;        // Calls a_function(index, position, distance_squared) for all points within a_radius of a_point
+
+	FORCE_INLINE void      cell_size(float32_t a_cell_size) noexcept;
+	FORCE_INLINE float32_t cell_size() const noexcept;
+	FORCE_INLINE uint32_t  size() const noexcept;
+
+  private:
+	FORCE_INLINE int32_t  cell(float32_t a_value) const noexcept;
+	FORCE_INLINE uint32_t bucket(int32_t a_x, int32_t a_y, int32_t a_z) const noexcept;
+
+	float32_t              m_cell_size{1.0f};                //! Size of each cell in all 3 dimensions
+	float32_t              m_inverse_cell_size{1.0f};        //! 1 / m_cell_size
+	uint32_t               m_mask{0};                        //! Bucket count - 1, only grows
+	std::vector<uint32_t>  m_bucket_starts{};                //! Start of each bucket in m_indices, has one extra entry at the end
+	std::vector<uint32_t>  m_point_buckets{};                //! Bucket of each point, scratch for build
+	std::vector<uint32_t>  m_indices{};                      //! Point indices sorted by bucket
+	std::vector<float32_t> m_x{};                            //! Point positions in m_indices order
+	std::vector<float32_t> m_y{};                            //! Point positions in m_indices order
+	std::vector<float32_t> m_z{};                            //! Point positions in m_indices order
+};
+
+}        // namespace ror
+
+#include "rorspatial_grid.hh"
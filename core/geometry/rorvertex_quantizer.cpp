@@ -0,0 +1,350 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "geometry/rorvertex_quantizer.hpp"
+#include "math/rorvector_functions.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace ror
+{
+namespace
+{
+constexpr float32_t unorm8_max{255.0f};
+constexpr float32_t unorm16_max{65535.0f};
+constexpr float32_t snorm16_max{32767.0f};
+
+template <size_t _count>
+FORCE_INLINE std::array<float32_t, _count> read_floats(const VertexStream &a_stream, uint32_t a_index) noexcept
+{
+	assert(a_stream.m_size >= sizeof(float32_t) * _count && "Stream doesn't have enough components");
+
+	std::array<float32_t, _count> values{};
+	std::memcpy(values.data(), a_stream.m_data + static_cast<size_t>(a_index) * a_stream.m_stride, sizeof(float32_t) * _count);
+
+	return values;
+}
+
+FORCE_INLINE Vector3f normalized_or_up(Vector3f a_vector) noexcept
+{
+	auto length = a_vector.length();
+
+	return length > 0.0f ? a_vector / length : Vector3f{0.0f, 0.0f, 1.0f};
+}
+
+FORCE_INLINE float32_t sign_not_zero(float32_t a_value) noexcept
+{
+	return a_value >= 0.0f ? 1.0f : -1.0f;
+}
+
+}        // namespace
+
+uint16_t float_to_half(float32_t a_value) noexcept
+{
+	auto bits     = std::bit_cast<uint32_t>(a_value);
+	auto sign     = (bits >> 16) & 0x8000u;
+	auto exponent = static_cast<int32_t>((bits >> 23) & 0xffu);
+	auto mantissa = bits & 0x7fffffu;
+
+	if (exponent == 0xff)        // Infinity or NaN, NaNs keep a mantissa bit so they stay NaNs
+		return static_cast<uint16_t>(sign | 0x7c00u | (mantissa ? 0x200u | (mantissa >> 13) : 0u));
+
+	auto half_exponent = exponent - 127 + 15;
+	if (half_exponent >= 31)
+		return static_cast<uint16_t>(sign | 0x7c00u);
+
+	if (half_exponent <= 0)
+	{
+		// Too small even for a subnormal, rounds to zero
+		if (half_exponent < -10)
+			return static_cast<uint16_t>(sign);
+
+		mantissa |= 0x800000u;
+
+		auto shift     = static_cast<uint32_t>(14 - half_exponent);
+		auto half      = mantissa >> shift;
+		auto remainder = mantissa & ((1u << shift) - 1u);
+		auto halfway   = 1u << (shift - 1u);
+
+		if (remainder > halfway || (remainder == halfway && (half & 1u)))
+			++half;        // Can carry into the smallest normal which is still the right answer
+
+		return static_cast<uint16_t>(sign | half);
+	}
+
+	auto half      = sign | (static_cast<uint32_t>(half_exponent) << 10) | (mantissa >> 13);
+	auto remainder = mantissa & 0x1fffu;
+
+	if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u)))
+		++half;        // Can carry into the exponent and up to infinity which is still the right answer
+
+	return static_cast<uint16_t>(half);
+}
+
+float32_t half_to_float(uint16_t a_value) noexcept
+{
+	auto sign     = static_cast<uint32_t>(a_value & 0x8000u) << 16;
+	auto exponent = static_cast<uint32_t>(a_value >> 10) & 0x1fu;
+	auto mantissa = static_cast<uint32_t>(a_value) & 0x3ffu;
+
+	if (exponent == 0)
+	{
+		auto value = std::ldexp(static_cast<float32_t>(mantissa), -24);
+		return sign ? -value : value;
+	}
+
+	if (exponent == 31)
+		return std::bit_cast<float32_t>(sign | 0x7f800000u | (mantissa << 13));
+
+	return std::bit_cast<float32_t>(sign | ((exponent + 112u) << 23) | (mantissa << 13));
+}
+
+uint16_t quantize_unorm16(float32_t a_value) noexcept
+{
+	return static_cast<uint16_t>(std::lround(std::clamp(a_value, 0.0f, 1.0f) * unorm16_max));
+}
+
+int16_t quantize_snorm16(float32_t a_value) noexcept
+{
+	return static_cast<int16_t>(std::lround(std::clamp(a_value, -1.0f, 1.0f) * snorm16_max));
+}
+
+float32_t dequantize_unorm16(uint16_t a_value) noexcept
+{
+	return static_cast<float32_t>(a_value) / unorm16_max;
+}
+
+float32_t dequantize_snorm16(int16_t a_value) noexcept
+{
+	return std::max(static_cast<float32_t>(a_value) / snorm16_max, -1.0f);
+}
+
+Vector2f octahedral_encode(const Vector3f &a_normal) noexcept
+{
+	auto n = a_normal / (std::abs(a_normal.x) + std::abs(a_normal.y) + std::abs(a_normal.z));
+
+	if (n.z < 0.0f)
+		return {(1.0f - std::abs(n.y)) * sign_not_zero(n.x), (1.0f - std::abs(n.x)) * sign_not_zero(n.y)};
+
+	return {n.x, n.y};
+}
+
+// Same as octahedral_decode() in the generated vertex shaders
+Vector3f octahedral_decode(const Vector2f &a_encoded) noexcept
+{
+	Vector3f n{a_encoded.x, a_encoded.y, 1.0f - std::abs(a_encoded.x) - std::abs(a_encoded.y)};
+
+	auto t = std::max(-n.z, 0.0f);
+	n.x += n.x >= 0.0f ? -t : t;
+	n.y += n.y >= 0.0f ? -t : t;
+
+	return n.normalized();
+}
+
+void octahedral_encode_snorm16(const Vector3f &a_normal, int16_t *a_encoded) noexcept
+{
+	auto encoded = octahedral_encode(a_normal);
+	auto x       = encoded.x * snorm16_max;
+	auto y       = encoded.y * snorm16_max;
+
+	auto best_dot = -2.0f;
+	for (auto qx : {std::floor(x), std::ceil(x)})
+	{
+		for (auto qy : {std::floor(y), std::ceil(y)})
+		{
+			auto ex  = static_cast<int16_t>(std::clamp(qx, -snorm16_max, snorm16_max));
+			auto ey  = static_cast<int16_t>(std::clamp(qy, -snorm16_max, snorm16_max));
+			auto dot = octahedral_decode({dequantize_snorm16(ex), dequantize_snorm16(ey)}).dot_product(a_normal);
+
+			if (dot > best_dot)
+			{
+				best_dot     = dot;
+				a_encoded[0] = ex;
+				a_encoded[1] = ey;
+			}
+		}
+	}
+}
+
+void quantize_positions(std::vector<uint16_t> &a_output, const VertexStream &a_positions, uint32_t a_count, const BoundingBoxf &a_bounds)
+{
+	auto minimum = a_bounds.minimum();
+	auto extent  = a_bounds.extent();
+
+	a_output.reserve(a_output.size() + static_cast<size_t>(a_count) * 4);
+	for (uint32_t vertex = 0; vertex < a_count; ++vertex)
+	{
+		auto position = read_floats<3>(a_positions, vertex);
+
+		for (int32_t axis = 0; axis < 3; ++axis)
+			a_output.push_back(extent[axis] > 0.0f ? quantize_unorm16((position[static_cast<size_t>(axis)] - minimum[axis]) / extent[axis]) : uint16_t{0});
+
+		a_output.push_back(std::numeric_limits<uint16_t>::max());
+	}
+}
+
+Vector3f dequantize_position(const uint16_t *a_position, const BoundingBoxf &a_bounds) noexcept
+{
+	auto minimum = a_bounds.minimum();
+	auto extent  = a_bounds.extent();
+
+	return {minimum.x + dequantize_unorm16(a_position[0]) * extent.x,
+	        minimum.y + dequantize_unorm16(a_position[1]) * extent.y,
+	        minimum.z + dequantize_unorm16(a_position[2]) * extent.z};
+}
+
+void quantize_normals(std::vector<int16_t> &a_output, const VertexStream &a_normals, uint32_t a_count)
+{
+	a_output.resize(a_output.size() + static_cast<size_t>(a_count) * 2);
+	auto *output = a_output.data() + a_output.size() - static_cast<size_t>(a_count) * 2;
+
+	for (uint32_t vertex = 0; vertex < a_count; ++vertex)
+	{
+		auto normal = read_floats<3>(a_normals, vertex);
+		octahedral_encode_snorm16(normalized_or_up({normal[0], normal[1], normal[2]}), output + vertex * 2);
+	}
+}
+
+Vector3f dequantize_normal(const int16_t *a_normal) noexcept
+{
+	return octahedral_decode({dequantize_snorm16(a_normal[0]), dequantize_snorm16(a_normal[1])});
+}
+
+void quantize_tangents(std::vector<int16_t> &a_output, const VertexStream &a_tangents, uint32_t a_count)
+{
+	a_output.resize(a_output.size() + static_cast<size_t>(a_count) * 4);
+	auto *output = a_output.data() + a_output.size() - static_cast<size_t>(a_count) * 4;
+
+	for (uint32_t vertex = 0; vertex < a_count; ++vertex)
+	{
+		auto  tangent = read_floats<4>(a_tangents, vertex);
+		auto *encoded = output + vertex * 4;
+
+		octahedral_encode_snorm16(normalized_or_up({tangent[0], tangent[1], tangent[2]}), encoded);
+		encoded[2] = 0;
+		encoded[3] = tangent[3] < 0.0f ? static_cast<int16_t>(-snorm16_max) : static_cast<int16_t>(snorm16_max);
+	}
+}
+
+Vector4f dequantize_tangent(const int16_t *a_tangent) noexcept
+{
+	auto tangent = dequantize_normal(a_tangent);
+
+	return {tangent.x, tangent.y, tangent.z, dequantize_snorm16(a_tangent[3])};
+}
+
+void quantize_texture_coordinates(std::vector<uint16_t> &a_output, const VertexStream &a_texture_coordinates, uint32_t a_count)
+{
+	a_output.reserve(a_output.size() + static_cast<size_t>(a_count) * 2);
+	for (uint32_t vertex = 0; vertex < a_count; ++vertex)
+	{
+		auto uv = read_floats<2>(a_texture_coordinates, vertex);
+
+		a_output.push_back(float_to_half(uv[0]));
+		a_output.push_back(float_to_half(uv[1]));
+	}
+}
+
+Vector2f dequantize_texture_coordinate(const uint16_t *a_texture_coordinate) noexcept
+{
+	return {half_to_float(a_texture_coordinate[0]), half_to_float(a_texture_coordinate[1])};
+}
+
+void quantize_weights(std::vector<uint8_t> &a_output, const VertexStream &a_weights, uint32_t a_count)
+{
+	assert((a_weights.m_size == sizeof(float32_t) * 4 || a_weights.m_size == sizeof(uint16_t) * 4 || a_weights.m_size == sizeof(uint8_t) * 4) && "Weights must have four float32_t, unorm16 or unorm8 components");
+
+	a_output.reserve(a_output.size() + static_cast<size_t>(a_count) * 4);
+	for (uint32_t vertex = 0; vertex < a_count; ++vertex)
+	{
+		const auto               *source = a_weights.m_data + static_cast<size_t>(vertex) * a_weights.m_stride;
+		std::array<float32_t, 4> weights{};
+
+		if (a_weights.m_size == sizeof(float32_t) * 4)
+		{
+			std::memcpy(weights.data(), source, sizeof(weights));
+		}
+		else if (a_weights.m_size == sizeof(uint16_t) * 4)
+		{
+			std::array<uint16_t, 4> values{};
+			std::memcpy(values.data(), source, sizeof(values));
+			std::transform(values.begin(), values.end(), weights.begin(), [](uint16_t a_value) { return dequantize_unorm16(a_value); });
+		}
+		else
+		{
+			std::transform(source, source + 4, weights.begin(), [](uint8_t a_value) { return static_cast<float32_t>(a_value) / unorm8_max; });
+		}
+
+		float32_t sum = weights[0] + weights[1] + weights[2] + weights[3];
+		if (sum > 0.0f)
+			for (auto &weight : weights)
+				weight *= unorm8_max / sum;
+
+		std::array<int32_t, 4> quantized{};
+		int32_t                quantized_sum{0};
+		for (size_t i = 0; i < 4; ++i)
+		{
+			quantized[i] = static_cast<int32_t>(std::lround(weights[i]));
+			quantized_sum += quantized[i];
+		}
+
+		// Rounding can be off by a couple, fix that up on whichever weights were rounded furthest the wrong way
+		while (sum > 0.0f && quantized_sum != static_cast<int32_t>(unorm8_max))
+		{
+			auto step = quantized_sum < static_cast<int32_t>(unorm8_max) ? 1 : -1;
+			auto best = 0u;
+			auto gap  = -2.0f;
+
+			for (uint32_t i = 0; i < 4; ++i)
+			{
+				auto candidate = (weights[i] - static_cast<float32_t>(quantized[i])) * static_cast<float32_t>(step);
+				if (candidate > gap && quantized[i] + step >= 0 && quantized[i] + step <= static_cast<int32_t>(unorm8_max))
+				{
+					gap  = candidate;
+					best = i;
+				}
+			}
+
+			quantized[best] += step;
+			quantized_sum += step;
+		}
+
+		for (auto value : quantized)
+			a_output.push_back(static_cast<uint8_t>(value));
+	}
+}
+
+Vector4f dequantize_weights(const uint8_t *a_weights) noexcept
+{
+	return {static_cast<float32_t>(a_weights[0]) / unorm8_max, static_cast<float32_t>(a_weights[1]) / unorm8_max,
+	        static_cast<float32_t>(a_weights[2]) / unorm8_max, static_cast<float32_t>(a_weights[3]) / unorm8_max};
+}
+
+}        // namespace ror
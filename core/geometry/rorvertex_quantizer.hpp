@@ -0,0 +1,101 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#pragma once
+
+#include "bounds/rorbounding.hpp"
+#include "foundation/rormacros.hpp"
+#include "foundation/rortypes.hpp"
+#include "geometry/rormesh_optimizer.hpp"
+#include "math/rorvector2.hpp"
+#include "math/rorvector3.hpp"
+#include "math/rorvector4.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace ror
+{
+/**
+ * Import time quantization of vertex attributes into smaller formats the GPU can fetch directly
+ * Each quantize_* function reads a_count elements of a VertexStream and appends tightly packed quantized elements to its output
+ * The dequantize_* functions do exactly what vertex fetch and the generated vertex shaders do, so they can be used to measure the error
+ * Normalized integers decode like GPUs do, unorm as value / max and snorm as max(value / max, -1)
+ */
+
+ROAR_ENGINE_ITEM uint16_t  float_to_half(float32_t a_value) noexcept;        // Rounds to nearest even, overflows to infinity and keeps NaNs
+ROAR_ENGINE_ITEM float32_t half_to_float(uint16_t a_value) noexcept;
+
+ROAR_ENGINE_ITEM uint16_t  quantize_unorm16(float32_t a_value) noexcept;        // a_value is clamped to [0, 1]
+ROAR_ENGINE_ITEM int16_t   quantize_snorm16(float32_t a_value) noexcept;        // a_value is clamped to [-1, 1]
+ROAR_ENGINE_ITEM float32_t dequantize_unorm16(uint16_t a_value) noexcept;
+ROAR_ENGINE_ITEM float32_t dequantize_snorm16(int16_t a_value) noexcept;
+
+/**
+ * @brief      Maps a unit vector onto the octahedron and unfolds it into a square, "A Survey of Efficient Representations for Independent Unit Vectors" by Cigolle et al.
+ * @return     Both components in [-1, 1]
+ */
+ROAR_ENGINE_ITEM Vector2f octahedral_encode(const Vector3f &a_normal) noexcept;
+ROAR_ENGINE_ITEM Vector3f octahedral_decode(const Vector2f &a_encoded) noexcept;        // Returns a unit vector
+
+/**
+ * @brief      Encodes a unit vector as two snorm16 values, of the four ways to round it the one decoding closest to a_normal is picked
+ */
+ROAR_ENGINE_ITEM void octahedral_encode_snorm16(const Vector3f &a_normal, int16_t *a_encoded) noexcept;
+
+/**
+ * @brief      Quantizes float32_t x, y and z positions to unorm16 x, y, z and w relative to a_bounds, w is always 1
+ *             Positions outside a_bounds are clamped to it, axes where a_bounds is flat decode to its minimum
+ *             Decodes to a_bounds.minimum() + unorm * a_bounds.extent(), error on each axis is at most half of extent / 65535
+ */
+ROAR_ENGINE_ITEM void     quantize_positions(std::vector<uint16_t> &a_output, const VertexStream &a_positions, uint32_t a_count, const BoundingBoxf &a_bounds);
+ROAR_ENGINE_ITEM Vector3f dequantize_position(const uint16_t *a_position, const BoundingBoxf &a_bounds) noexcept;
+
+/**
+ * @brief      Quantizes float32_t x, y and z normals to two octahedral snorm16 values, normals are normalized first
+ */
+ROAR_ENGINE_ITEM void     quantize_normals(std::vector<int16_t> &a_output, const VertexStream &a_normals, uint32_t a_count);
+ROAR_ENGINE_ITEM Vector3f dequantize_normal(const int16_t *a_normal) noexcept;
+
+/**
+ * @brief      Quantizes float32_t x, y, z and w tangents to four snorm16 values, octahedral x and y, 0 and the handedness in w as -1 or 1
+ */
+ROAR_ENGINE_ITEM void     quantize_tangents(std::vector<int16_t> &a_output, const VertexStream &a_tangents, uint32_t a_count);
+ROAR_ENGINE_ITEM Vector4f dequantize_tangent(const int16_t *a_tangent) noexcept;
+
+/**
+ * @brief      Quantizes float32_t u and v texture coordinates to two half floats
+ */
+ROAR_ENGINE_ITEM void     quantize_texture_coordinates(std::vector<uint16_t> &a_output, const VertexStream &a_texture_coordinates, uint32_t a_count);
+ROAR_ENGINE_ITEM Vector2f dequantize_texture_coordinate(const uint16_t *a_texture_coordinate) noexcept;
+
+/**
+ * @brief      Quantizes four joint weights to unorm8 values that add up to exactly 255
+ *             a_weights.m_size tells the source type, 16 for float32_t, 8 for unorm16 and 4 for unorm8 weights
+ *             Weights are renormalized first, each weight is off by less than 1 / 255 afterwards
+ */
+ROAR_ENGINE_ITEM void     quantize_weights(std::vector<uint8_t> &a_output, const VertexStream &a_weights, uint32_t a_count);
+ROAR_ENGINE_ITEM Vector4f dequantize_weights(const uint8_t *a_weights) noexcept;
+
+}        // namespace ror
@@ -0,0 +1,289 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "foundation/rorutilities.hpp"
+#include "graphics/roranimation.hpp"
+#include "math/rorquaternion.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+namespace ror
+{
+namespace
+{
+// Sampler outputs are either floats or integers that were widened to uint32_t by the loader
+FORCE_INLINE bool is_float_output(const Animation::AnimationSampler &a_sampler)
+{
+	return a_sampler.m_output_format == rhi::VertexFormat::float32_1 ||
+	       a_sampler.m_output_format == rhi::VertexFormat::float32_2 ||
+	       a_sampler.m_output_format == rhi::VertexFormat::float32_3 ||
+	       a_sampler.m_output_format == rhi::VertexFormat::float32_4;
+}
+
+// Reads a_count of the a_components of a_element starting from component a_first
+FORCE_INLINE void read_output(const Animation::AnimationSampler &a_sampler, size_t a_element, uint32_t a_components, uint32_t a_first, uint32_t a_count, float32_t *a_output)
+{
+	auto offset = a_element * a_components + a_first;
+
+	if (is_float_output(a_sampler))
+	{
+		std::memcpy(a_output, reinterpret_cast<const float32_t *>(a_sampler.m_output.data()) + offset, a_count * sizeof(float32_t));
+	}
+	else
+	{
+		auto values = reinterpret_cast<const uint32_t *>(a_sampler.m_output.data()) + offset;
+		for (uint32_t i = 0; i < a_count; ++i)
+			a_output[i] = static_cast<float32_t>(values[i]);
+	}
+}
+
+FORCE_INLINE void read_output(const Animation::AnimationSampler &a_sampler, size_t a_element, uint32_t a_components, float32_t *a_output)
+{
+	read_output(a_sampler, a_element, a_components, 0, a_components, a_output);
+}
+
+FORCE_INLINE void normalize_rotation(float32_t *a_output)
+{
+	Quaternionf rotation{a_output[0], a_output[1], a_output[2], a_output[3]};
+	rotation.normalize();
+
+	a_output[0] = rotation.x;
+	a_output[1] = rotation.y;
+	a_output[2] = rotation.z;
+	a_output[3] = rotation.w;
+}
+
+constexpr uint32_t max_components{4};        // TRS is at most 4 components, only weights can be more and those are interpolated this many at a time
+}        // namespace
+
+uint32_t animation_sampler_components(const Animation::AnimationSampler &a_sampler)
+{
+	auto keys = a_sampler.m_input.size();
+	if (keys == 0)
+		return 0;
+
+	if (a_sampler.m_interpolation == AnimationInterpolation::cubicspline)
+		keys *= 3;        // In-tangent, value and out-tangent per keyframe
+
+	return static_cast_safe<uint32_t>((a_sampler.m_output.size() / sizeof(float32_t)) / keys);
+}
+
+uint32_t animation_keyframe(const Animation::AnimationSampler &a_sampler, float32_t a_time, uint32_t &a_cursor)
+{
+	auto &input = a_sampler.m_input;
+	auto  count = static_cast_safe<uint32_t>(input.size());
+
+	if (count < 2)
+	{
+		a_cursor = 0;
+		return 0;
+	}
+
+	uint32_t last_segment = count - 2;
+
+	// Try the keyframe from last time and the one after it before searching
+	uint32_t cursor = std::min(a_cursor, last_segment);
+	for (uint32_t hint : {cursor, cursor + 1})
+	{
+		if (hint > last_segment)
+			break;
+
+		if (input[hint].m_value <= a_time && (hint == last_segment || a_time < input[hint + 1].m_value))
+		{
+			a_cursor = hint;
+			return hint;
+		}
+	}
+
+	auto upper = std::upper_bound(input.begin(), input.end(), a_time, [](float32_t a_value, const Animation::AnimationInput &a_input) { return a_value < a_input.m_value; });
+	auto index = std::distance(input.begin(), upper);
+
+	a_cursor = static_cast_safe<uint32_t>(std::clamp<ptrdiff_t>(index - 1, 0, static_cast<ptrdiff_t>(last_segment)));
+
+	return a_cursor;
+}
+
+void animation_sample(const Animation::AnimationSampler &a_sampler, AnimationTarget a_target, float32_t a_time, uint32_t &a_cursor, float32_t *a_output)
+{
+	auto components = animation_sampler_components(a_sampler);
+	auto count      = a_sampler.m_input.size();
+
+	if (components == 0)
+		return;
+
+	bool cubic = a_sampler.m_interpolation == AnimationInterpolation::cubicspline;
+
+	// Cubic spline elements are in-tangent, value and out-tangent triplets
+	auto value_element = [cubic](size_t a_key) { return cubic ? a_key * 3 + 1 : a_key; };
+
+	if (count == 1)
+	{
+		read_output(a_sampler, value_element(0), components, a_output);
+		return;
+	}
+
+	auto key   = animation_keyframe(a_sampler, a_time, a_cursor);
+	auto start = a_sampler.m_input[key].m_value;
+	auto delta = a_sampler.m_input[key + 1].m_value - start;
+	auto t     = delta > 0.0f ? std::clamp((a_time - start) / delta, 0.0f, 1.0f) : 0.0f;
+
+	switch (a_sampler.m_interpolation)
+	{
+		case AnimationInterpolation::step:
+		{
+			read_output(a_sampler, t < 1.0f ? key : key + 1, components, a_output);
+			break;
+		}
+		case AnimationInterpolation::linear:
+		{
+			if (a_target == AnimationTarget::rotation)
+			{
+				assert(components == 4 && "Rotation sampler doesn't have quaternion outputs");
+
+				float32_t from[4], to[4];
+				read_output(a_sampler, key, 4, from);
+				read_output(a_sampler, key + 1, 4, to);
+
+				Quaternionf q0{from[0], from[1], from[2], from[3]};
+				Quaternionf q1{to[0], to[1], to[2], to[3]};
+
+				// Take the shortest path, slerp falls back to lerp for close quaternions which doesn't flip the sign itself
+				if (q0.dot_product(q1) < 0.0f)
+					q1 = Quaternionf{-q1.x, -q1.y, -q1.z, -q1.w};
+
+				auto rotation = quaternion_slerp(q0, q1, t);
+
+				a_output[0] = rotation.x;
+				a_output[1] = rotation.y;
+				a_output[2] = rotation.z;
+				a_output[3] = rotation.w;
+			}
+			else
+			{
+				for (uint32_t first = 0; first < components; first += max_components)
+				{
+					auto      block = std::min(components - first, max_components);
+					float32_t from[max_components], to[max_components];
+
+					read_output(a_sampler, key, components, first, block, from);
+					read_output(a_sampler, key + 1, components, first, block, to);
+
+					for (uint32_t i = 0; i < block; ++i)
+						a_output[first + i] = from[i] + t * (to[i] - from[i]);
+				}
+			}
+			break;
+		}
+		case AnimationInterpolation::cubicspline:
+		{
+			// Hermite basis as defined in the glTF 2.0 spec, tangents are scaled by the keyframe delta
+			auto t2 = t * t;
+			auto t3 = t2 * t;
+
+			auto h00 = 2.0f * t3 - 3.0f * t2 + 1.0f;
+			auto h10 = (t3 - 2.0f * t2 + t) * delta;
+			auto h01 = -2.0f * t3 + 3.0f * t2;
+			auto h11 = (t3 - t2) * delta;
+
+			for (uint32_t first = 0; first < components; first += max_components)
+			{
+				auto      block = std::min(components - first, max_components);
+				float32_t v0[max_components];        // Value at key
+				float32_t b0[max_components];        // Out-tangent at key
+				float32_t a1[max_components];        // In-tangent at key + 1
+				float32_t v1[max_components];        // Value at key + 1
+
+				read_output(a_sampler, key * 3 + 1, components, first, block, v0);
+				read_output(a_sampler, key * 3 + 2, components, first, block, b0);
+				read_output(a_sampler, (key + 1) * 3 + 0, components, first, block, a1);
+				read_output(a_sampler, (key + 1) * 3 + 1, components, first, block, v1);
+
+				for (uint32_t i = 0; i < block; ++i)
+					a_output[first + i] = h00 * v0[i] + h10 * b0[i] + h01 * v1[i] + h11 * a1[i];
+			}
+
+			if (a_target == AnimationTarget::rotation)
+				normalize_rotation(a_output);
+
+			break;
+		}
+	}
+}
+
+float32_t animation_time(const Animation &a_animation, float32_t a_seconds)
+{
+	if (a_animation.m_samplers.empty())
+		return 0.0f;
+
+	float32_t start = std::numeric_limits<float32_t>::max();
+	float32_t end   = std::numeric_limits<float32_t>::lowest();
+
+	for (auto &sampler : a_animation.m_samplers)
+	{
+		start = std::min(start, sampler.m_minimum.m_value);
+		end   = std::max(end, sampler.m_maximum.m_value);
+	}
+
+	auto duration = end - start;
+	if (duration <= 0.0f)
+		return start;
+
+	return start + std::fmod(a_seconds, duration);
+}
+
+void animation_animate(const Animation &a_animation, float32_t a_time, std::vector<uint32_t> &a_cursors, std::vector<Transformf> &a_transforms, float32_t *a_weights, const std::vector<int32_t> &a_weights_offsets)
+{
+	a_cursors.resize(a_animation.m_channels.size(), 0u);
+
+	uint32_t channel_index = 0;
+	for (auto &channel : a_animation.m_channels)
+	{
+		auto &sampler = a_animation.m_samplers[channel.m_sampler_index];
+		auto &cursor  = a_cursors[channel_index++];
+		auto  node    = channel.m_target_node_index;
+
+		assert(node < a_transforms.size() && "Animation channel targets a node that doesn't exist");
+
+		auto &transform = a_transforms[node];
+		switch (channel.m_target_node_path)
+		{
+			// clang-format off
+			case AnimationTarget::translation: animation_sample(sampler, channel.m_target_node_path, a_time, cursor, &transform.m_translation.x); break;
+			case AnimationTarget::rotation:    animation_sample(sampler, channel.m_target_node_path, a_time, cursor, &transform.m_rotation.x);    break;
+			case AnimationTarget::scale:       animation_sample(sampler, channel.m_target_node_path, a_time, cursor, &transform.m_scale.x);       break;
+			// clang-format on
+			case AnimationTarget::weight:
+			{
+				if (a_weights && node < a_weights_offsets.size() && a_weights_offsets[node] != -1)
+					animation_sample(sampler, channel.m_target_node_path, a_time, cursor, a_weights + a_weights_offsets[node]);
+				break;
+			}
+		}
+	}
+}
+
+}        // namespace ror
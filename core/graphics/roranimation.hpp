@@ -26,11 +26,13 @@
 #pragma once
 
 #include "foundation/rortypes.hpp"
+#include "math/rortransform.hpp"
 #include "math/rorvector4.hpp"
 #include "rhi/rorbuffer_allocator.hpp"
 #include "rhi/rortypes.hpp"
 #include "rhi/rorvertex_description.hpp"
 #include <limits>
+#include <vector>
 
 namespace ror
 {
@@ -93,6 +95,35 @@ class ROAR_ENGINE_ITEM Animation
 	std::vector<AnimationChannel, rhi::BufferAllocator<AnimationChannel>> m_channels{};        //! All channels in this animation
 };
 
+/**
+ * CPU playback state of one animated model instance
+ * Keeps a keyframe cursor per channel of the animation being played, playback is mostly monotonic so the keyframe
+ * found in the last frame, or the one after it, is almost always the one needed and the binary search is skipped
+ * Also keeps the local transforms of all the model nodes so nothing needs to be allocated per frame
+ */
+class ROAR_ENGINE_ITEM AnimationState final
+{
+  public:
+	uint32_t                m_animation{std::numeric_limits<uint32_t>::max()};        //! Which animation the cursors belong to
+	std::vector<uint32_t>   m_cursors{};                                               //! Last keyframe found per channel
+	std::vector<Transformf> m_transforms{};                                            //! Animated local transforms of the model nodes
+	std::vector<int32_t>    m_weights_offsets{};                                       //! Offset of each model node morph weights within the model's weights, -1 if it has none
+};
+
+/**
+ * CPU sampling of glTF animations, supports linear (slerp for rotations), step and cubic spline interpolation
+ * animation_keyframe returns the index k of the keyframe such that input[k] <= a_time < input[k + 1], clamped to the first and last segment
+ * animation_sample writes animation_sampler_components() floats into a_output, a_cursor is used as a hint and is updated to the keyframe found
+ * animation_time maps a_seconds into the animation range, looping over the duration of the animation
+ * animation_animate samples all channels of a_animation at a_time into a_transforms, indexed by node
+ * and into a_weights at a_weights_offsets[node] for morph weights, nodes without morph weights must have -1 offsets
+ */
+uint32_t  animation_sampler_components(const Animation::AnimationSampler &a_sampler);
+uint32_t  animation_keyframe(const Animation::AnimationSampler &a_sampler, float32_t a_time, uint32_t &a_cursor);
+void      animation_sample(const Animation::AnimationSampler &a_sampler, AnimationTarget a_target, float32_t a_time, uint32_t &a_cursor, float32_t *a_output);
+float32_t animation_time(const Animation &a_animation, float32_t a_seconds);
+void      animation_animate(const Animation &a_animation, float32_t a_time, std::vector<uint32_t> &a_cursors, std::vector<Transformf> &a_transforms, float32_t *a_weights, const std::vector<int32_t> &a_weights_offsets);
+
 static_assert(sizeof(Animation::AnimationInput) == 4, "AnimationInput is not 4 bytes float");
 static_assert(sizeof(Animation::AnimationOutput) == 1, "AnimationOutput is not 1 byte");
 }        // namespace ror
@@ -0,0 +1,158 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "graphics/rorboids.hpp"
+#include "profiling/rorprofiler.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace ror
+{
+Boids::Boids(uint32_t a_count, Vector3f a_minimum, Vector3f a_maximum, uint32_t a_seed) :
+    m_minimum(a_minimum),
+    m_maximum(a_maximum)
+{
+	uint32_t state = a_seed ? a_seed : 1u;
+
+	auto random = [&state]() {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return static_cast<float32_t>(state >> 8) * (1.0f / 16777216.0f);
+	};
+
+	for (auto *stream : {&this->m_x, &this->m_y, &this->m_z, &this->m_vx, &this->m_vy, &this->m_vz, &this->m_nvx, &this->m_nvy, &this->m_nvz})
+		stream->resize(a_count, 0.0f);
+
+	auto extent = a_maximum - a_minimum;
+	for (uint32_t i = 0; i < a_count; ++i)
+	{
+		this->m_x[i]  = a_minimum.x + extent.x * random();
+		this->m_y[i]  = a_minimum.y + extent.y * random();
+		this->m_z[i]  = a_minimum.z + extent.z * random();
+		this->m_vx[i] = (random() * 2.0f - 1.0f) * this->m_max_speed;
+		this->m_vy[i] = (random() * 2.0f - 1.0f) * this->m_max_speed;
+		this->m_vz[i] = (random() * 2.0f - 1.0f) * this->m_max_speed;
+	}
+}
+
+void Boids::build_grid()
+{
+	this->m_grid.cell_size(this->m_neighbour_radius);
+	this->m_grid.build(this->m_x.data(), this->m_y.data(), this->m_z.data(), this->size());
+}
+
+void Boids::steer(float32_t a_delta_seconds, uint32_t a_first, uint32_t a_last)
+{
+	auto separation_squared = this->m_separation_distance * this->m_separation_distance;
+
+	for (uint32_t i = a_first; i < a_last; ++i)
+	{
+		Vector3f position{this->m_x[i], this->m_y[i], this->m_z[i]};
+		Vector3f velocity{this->m_vx[i], this->m_vy[i], this->m_vz[i]};
+		Vector3f centre{0.0f, 0.0f, 0.0f};
+		Vector3f heading{0.0f, 0.0f, 0.0f};
+		Vector3f separation{0.0f, 0.0f, 0.0f};
+		uint32_t neighbours{0};
+
+		this->m_grid.query(position, this->m_neighbour_radius, [&](uint32_t a_index, const Vector3f &a_other, float32_t a_distance_squared) {
+			if (a_index == i)
+				return;
+
+			centre += a_other;
+			heading += Vector3f{this->m_vx[a_index], this->m_vy[a_index], this->m_vz[a_index]};
+			++neighbours;
+
+			// Pushes harder the closer they are
+			if (a_distance_squared < separation_squared)
+				separation += (position - a_other) / std::max(a_distance_squared, 0.0001f);
+		});
+
+		Vector3f acceleration{separation * this->m_separation_weight};
+
+		if (neighbours)
+		{
+			auto inverse = 1.0f / static_cast<float32_t>(neighbours);
+
+			acceleration += (centre * inverse - position) * this->m_cohesion_weight;
+			acceleration += (heading * inverse - velocity) * this->m_alignment_weight;
+		}
+
+		// Turn back towards the bounds, its a soft limit
+		for (int32_t axis = 0; axis < 3; ++axis)
+		{
+			if (position[axis] < this->m_minimum[axis])
+				acceleration[axis] += this->m_bounds_weight;
+			else if (position[axis] > this->m_maximum[axis])
+				acceleration[axis] -= this->m_bounds_weight;
+		}
+
+		velocity += acceleration * a_delta_seconds;
+
+		auto speed_squared = velocity.length_squared();
+		if (speed_squared > this->m_max_speed * this->m_max_speed)
+			velocity *= this->m_max_speed / std::sqrt(speed_squared);
+
+		this->m_nvx[i] = velocity.x;
+		this->m_nvy[i] = velocity.y;
+		this->m_nvz[i] = velocity.z;
+	}
+}
+
+void Boids::integrate(float32_t a_delta_seconds, uint32_t a_first, uint32_t a_last)
+{
+	for (uint32_t i = a_first; i < a_last; ++i)
+	{
+		this->m_vx[i] = this->m_nvx[i];
+		this->m_vy[i] = this->m_nvy[i];
+		this->m_vz[i] = this->m_nvz[i];
+
+		this->m_x[i] += this->m_vx[i] * a_delta_seconds;
+		this->m_y[i] += this->m_vy[i] * a_delta_seconds;
+		this->m_z[i] += this->m_vz[i] * a_delta_seconds;
+	}
+}
+
+void Boids::update(float32_t a_delta_seconds)
+{
+	profile_zone("Boids::update");
+
+	this->build_grid();
+	this->steer(a_delta_seconds, 0, this->size());
+	this->integrate(a_delta_seconds, 0, this->size());
+}
+
+void Boids::update(ror::JobSystem &a_job_system, float32_t a_delta_seconds)
+{
+	profile_zone("Boids::update");
+
+	this->build_grid();
+
+	// Steering reads positions that integration writes, so all of steering must finish first
+	a_job_system.parallel_for(0u, this->size(), [this, a_delta_seconds](uint32_t a_index) { this->steer(a_delta_seconds, a_index, a_index + 1); });
+	a_job_system.parallel_for(0u, this->size(), [this, a_delta_seconds](uint32_t a_index) { this->integrate(a_delta_seconds, a_index, a_index + 1); });
+}
+
+}        // namespace ror
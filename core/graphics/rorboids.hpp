@@ -0,0 +1,96 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#pragma once
+
+#include "foundation/rorjobsystem.hpp"
+#include "foundation/rormacros.hpp"
+#include "foundation/rortypes.hpp"
+#include "geometry/rorspatial_grid.hpp"
+#include "math/rorvector3.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace ror
+{
+/**
+ * Flocking simulation of boids with separation, alignment and cohesion rules
+ * Only neighbours within m_neighbour_radius are considered, found through a spatial grid rebuilt every update
+ * Positions and velocities are kept as structure of arrays, steering only reads the previous state and writes new velocities
+ * so any range of boids can be steered on its own job and results are identical however the work is split
+ */
+class ROAR_ENGINE_ITEM Boids final
+{
+  public:
+	FORCE_INLINE        Boids()                             = default;        //! Default constructor
+	FORCE_INLINE        Boids(const Boids &a_other)         = default;        //! Copy constructor
+	FORCE_INLINE        Boids(Boids &&a_other) noexcept     = default;        //! Move constructor
+	FORCE_INLINE Boids &operator=(const Boids &a_other)     = default;        //! Copy assignment operator
+	FORCE_INLINE Boids &operator=(Boids &&a_other) noexcept = default;        //! Move assignment operator
+	FORCE_INLINE ~Boids() noexcept                          = default;        //! Destructor
+
+	Boids(uint32_t a_count, Vector3f a_minimum, Vector3f a_maximum, uint32_t a_seed = 1u);        // Randomly places a_count boids inside the box
+
+	void update(float32_t a_delta_seconds);                                          // Single threaded
+	void update(ror::JobSystem &a_job_system, float32_t a_delta_seconds);            // Steers and integrates boids with parallel_for on all workers
+	void steer(float32_t a_delta_seconds, uint32_t a_first, uint32_t a_last);        // New velocities of boids in [a_first, a_last), needs an up to date grid
+	void integrate(float32_t a_delta_seconds, uint32_t a_first, uint32_t a_last);    // Applies new velocities and moves boids in [a_first, a_last)
+	void build_grid();
+
+	// clang-format off
+	FORCE_INLINE constexpr auto  size()               const noexcept  {  return static_cast<uint32_t>(this->m_x.size());      }
+	FORCE_INLINE constexpr auto &positions_x()        const noexcept  {  return this->m_x;                                     }
+	FORCE_INLINE constexpr auto &positions_y()        const noexcept  {  return this->m_y;                                     }
+	FORCE_INLINE constexpr auto &positions_z()        const noexcept  {  return this->m_z;                                     }
+	FORCE_INLINE constexpr auto &velocities_x()       const noexcept  {  return this->m_vx;                                    }
+	FORCE_INLINE constexpr auto &velocities_y()       const noexcept  {  return this->m_vy;                                    }
+	FORCE_INLINE constexpr auto &velocities_z()       const noexcept  {  return this->m_vz;                                    }
+	FORCE_INLINE constexpr auto &grid()               const noexcept  {  return this->m_grid;                                  }
+	// clang-format on
+
+	float32_t m_neighbour_radius{2.0f};                //! Boids further than this are ignored, also the grid cell size
+	float32_t m_separation_distance{0.5f};             //! Boids closer than this push each other away
+	float32_t m_cohesion_weight{1.0f};                 //! Tendency to move towards the centre of the neighbours
+	float32_t m_alignment_weight{1.0f};                //! Tendency to match the velocity of the neighbours
+	float32_t m_separation_weight{4.0f};               //! Tendency to keep away from close neighbours
+	float32_t m_bounds_weight{10.0f};                  //! How strongly boids are turned back when they leave the bounds
+	float32_t m_max_speed{5.0f};                       //! Speed limit of each boid
+	Vector3f  m_minimum{-50.0f, 0.0f, -50.0f};         //! Minimum of the bounds the boids try to stay in
+	Vector3f  m_maximum{50.0f, 50.0f, 50.0f};          //! Maximum of the bounds the boids try to stay in
+
+  private:
+	std::vector<float32_t> m_x{};         //! Positions
+	std::vector<float32_t> m_y{};         //! Positions
+	std::vector<float32_t> m_z{};         //! Positions
+	std::vector<float32_t> m_vx{};        //! Velocities
+	std::vector<float32_t> m_vy{};        //! Velocities
+	std::vector<float32_t> m_vz{};        //! Velocities
+	std::vector<float32_t> m_nvx{};       //! New velocities written by steer
+	std::vector<float32_t> m_nvy{};       //! New velocities written by steer
+	std::vector<float32_t> m_nvz{};       //! New velocities written by steer
+	SpatialGrid            m_grid{};      //! Neighbour query structure, rebuilt from the positions each update
+};
+
+}        // namespace ror
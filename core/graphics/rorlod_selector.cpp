@@ -0,0 +1,180 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "foundation/rormacros.hpp"
+#include "foundation/rorutilities.hpp"
+#include "graphics/rorlod_selector.hpp"
+#include "math/rormatrix4_functions.hpp"
+#include "profiling/rorprofiler.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace ror
+{
+void LodSelector::clear()
+{
+	this->m_primitives.clear();
+	this->m_draws.clear();
+	this->m_triangles = 0;
+}
+
+void LodSelector::reset()
+{
+	this->clear();
+	this->m_pixels.clear();
+	this->m_selected.clear();
+}
+
+uint32_t LodSelector::add(const LodPrimitive &a_primitive)
+{
+	assert(a_primitive.m_bounds && "Primitive needs bounds to select its level of detail");
+
+	this->m_primitives.push_back(a_primitive);
+
+	return static_cast<uint32_t>(this->m_primitives.size() - 1);
+}
+
+float32_t LodSelector::projection_scale(float32_t a_y_fov, float32_t a_viewport_height)
+{
+	return a_viewport_height / (2.0f * std::tan(ror::to_radians(a_y_fov) * 0.5f));
+}
+
+// Coarsest level whose error covers no more than a_pixel_error pixels, errors never decrease from one level to the next
+uint32_t LodSelector::pick(uint32_t a_primitive, float32_t a_pixel_error) const noexcept
+{
+	auto &primitive = this->m_primitives[a_primitive];
+	auto  pixels    = this->m_pixels[a_primitive];
+
+	uint32_t lod = 0;
+	while (lod + 1 < primitive.m_lods_count && primitive.m_lods[lod + 1].m_error * pixels <= a_pixel_error)
+		++lod;
+
+	return lod;
+}
+
+uint64_t LodSelector::triangles(uint32_t a_primitive, uint32_t a_lod) const noexcept
+{
+	auto &primitive = this->m_primitives[a_primitive];
+
+	return primitive.m_lods_count ? primitive.m_lods[a_lod].m_index_count / 3 : 0;
+}
+
+void LodSelector::select(ror::JobSystem &a_job_system, const OrbitCamera &a_camera, const Frustum *a_frustum)
+{
+	this->select(a_job_system, a_camera.eye(), projection_scale(a_camera.y_fov(), a_camera.height()), a_frustum);
+}
+
+void LodSelector::select(ror::JobSystem &a_job_system, const Vector3f &a_eye, float32_t a_projection_scale, const Frustum *a_frustum)
+{
+	profile_zone("LodSelector::select");
+
+	auto count = this->size();
+
+	this->m_pixels.resize(count);
+	this->m_selected.resize(count, 0u);
+
+	auto sum = [](uint64_t a_left, uint64_t a_right) { return a_left + a_right; };
+
+	auto switch_error     = this->m_pixel_error * (1.0f - this->m_hysteresis);
+	auto select_primitive = [this, &a_eye, a_projection_scale, a_frustum, switch_error](uint32_t a_index) -> uint64_t {
+		auto &primitive = this->m_primitives[a_index];
+
+		if (a_frustum && !a_frustum->visible(*primitive.m_bounds, primitive.m_model))
+		{
+			this->m_selected[a_index] = culled;
+			return 0;
+		}
+
+		auto scale    = std::max({primitive.m_model.x_axis().length(), primitive.m_model.y_axis().length(), primitive.m_model.z_axis().length()});
+		auto centre   = primitive.m_model * primitive.m_bounds->center();
+		auto radius   = primitive.m_bounds->diagonal() * 0.5f * scale;
+		auto distance = (centre - a_eye).length() - radius;
+
+		// Inside the bounds nothing but full detail will do
+		this->m_pixels[a_index] = distance > 0.0f ? scale * a_projection_scale / distance : std::numeric_limits<float32_t>::max();
+
+		auto lod      = this->pick(a_index, switch_error);
+		auto previous = this->m_selected[a_index];
+
+		if (previous != culled && previous > lod && previous < primitive.m_lods_count && primitive.m_lods[previous].m_error * this->m_pixels[a_index] <= this->m_pixel_error)
+			lod = previous;
+
+		this->m_selected[a_index] = lod;
+
+		return this->triangles(a_index, lod);
+	};
+
+	auto total = a_job_system.parallel_reduce(0u, count, uint64_t{0}, select_primitive, sum);
+
+	if (this->m_triangle_budget && total > this->m_triangle_budget)
+	{
+		auto triangles_at = [this, &a_job_system, count, &sum](float32_t a_pixel_error) {
+			auto primitive_triangles = [this, a_pixel_error](uint32_t a_index) -> uint64_t {
+				return this->m_selected[a_index] == culled ? 0 : this->triangles(a_index, this->pick(a_index, a_pixel_error));
+			};
+
+			return a_job_system.parallel_reduce(0u, count, uint64_t{0}, primitive_triangles, sum);
+		};
+
+		// Double the pixel error until the budget is met or nothing gets any coarser, then bisect between the last two
+		auto low  = this->m_pixel_error;
+		auto high = this->m_pixel_error * 2.0f;
+		for (uint32_t i = 0; i < 32 && triangles_at(high) > this->m_triangle_budget; ++i)
+		{
+			low = high;
+			high *= 2.0f;
+		}
+
+		for (uint32_t i = 0; i < 16; ++i)
+		{
+			auto middle = (low + high) * 0.5f;
+			if (triangles_at(middle) > this->m_triangle_budget)
+				low = middle;
+			else
+				high = middle;
+		}
+
+		a_job_system.parallel_for(0u, count, [this, high](uint32_t a_index) {
+			if (this->m_selected[a_index] != culled)
+				this->m_selected[a_index] = this->pick(a_index, high);
+		});
+	}
+
+	this->m_draws.clear();
+	this->m_triangles = 0;
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		auto lod = this->m_selected[index];
+		if (lod != culled)
+		{
+			this->m_draws.push_back({index, lod});
+			this->m_triangles += this->triangles(index, lod);
+		}
+	}
+}
+
+}        // namespace ror
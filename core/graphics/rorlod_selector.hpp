@@ -0,0 +1,114 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#pragma once
+
+#include "bounds/rorbounding.hpp"
+#include "camera/rorcamera.hpp"
+#include "camera/rorfrustum.hpp"
+#include "foundation/rorjobsystem.hpp"
+#include "foundation/rormacros.hpp"
+#include "foundation/rortypes.hpp"
+#include "graphics/rormesh.hpp"
+#include "math/rormatrix4.hpp"
+#include "math/rorvector3.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace ror
+{
+/**
+ * A primitive taking part in level of detail selection, its bounds are in object space and m_model takes them to world space
+ */
+struct LodPrimitive
+{
+	Matrix4f            m_model{};                //! World transform of the primitive
+	const BoundingBoxf *m_bounds{nullptr};        //! Object space bounds, usually Mesh::bounding_box()
+	const MeshLod      *m_lods{nullptr};          //! Levels of detail finest first, usually Mesh::lods()
+	uint32_t            m_lods_count{0};          //! Primitives without levels are always drawn in full and don't count towards the budget
+};
+
+/**
+ * A visible primitive and the level it should be drawn with
+ */
+struct LodDraw
+{
+	uint32_t m_primitive{0};        //! Index of the primitive in the order it was added
+	uint32_t m_lod{0};              //! Index into its levels of detail
+};
+
+/**
+ * Picks a level of detail for each primitive from how many pixels its geometric error covers on screen
+ * The error of a level is projected at the closest point of the primitive's world space bounding sphere to the eye
+ * The coarsest level projecting to no more than m_pixel_error pixels is picked, coarser levels are only switched to once they are
+ * m_hysteresis below that, so primitives hovering around a switch distance don't pop back and forth every frame
+ * With a triangle budget the pixel error is raised for everyone until the picked levels fit, hysteresis is ignored while over budget
+ * Primitives are expected to be added in the same order every frame, the level picked last time is remembered by index
+ */
+class ROAR_ENGINE_ITEM LodSelector final
+{
+  public:
+	FORCE_INLINE              LodSelector()                             = default;        //! Default constructor
+	FORCE_INLINE              LodSelector(const LodSelector &a_other)     = default;        //! Copy constructor
+	FORCE_INLINE              LodSelector(LodSelector &&a_other) noexcept = default;        //! Move constructor
+	FORCE_INLINE LodSelector &operator=(const LodSelector &a_other)       = default;        //! Copy assignment operator
+	FORCE_INLINE LodSelector &operator=(LodSelector &&a_other) noexcept   = default;        //! Move assignment operator
+	FORCE_INLINE ~LodSelector() noexcept                                  = default;        //! Destructor
+
+	void     clear();                                     // Forgets the primitives but not the levels picked last time
+	void     reset();                                     // Forgets everything
+	uint32_t add(const LodPrimitive &a_primitive);        // Returns the index the primitive is referred to with in draws
+
+	// a_projection_scale is pixels per world unit at distance 1, a_frustum can be null if no culling is required
+	void select(ror::JobSystem &a_job_system, const Vector3f &a_eye, float32_t a_projection_scale, const Frustum *a_frustum = nullptr);
+	void select(ror::JobSystem &a_job_system, const OrbitCamera &a_camera, const Frustum *a_frustum = nullptr);
+
+	static float32_t projection_scale(float32_t a_y_fov, float32_t a_viewport_height);        // a_y_fov in degrees
+
+	static constexpr uint32_t culled{~0u};        //! Level of primitives outside the frustum
+
+	// clang-format off
+	FORCE_INLINE constexpr auto  size()                        const noexcept  {  return static_cast<uint32_t>(this->m_primitives.size());  }
+	FORCE_INLINE constexpr auto &draws()                       const noexcept  {  return this->m_draws;                                     }
+	FORCE_INLINE constexpr auto  triangles()                   const noexcept  {  return this->m_triangles;                                 }
+	FORCE_INLINE constexpr auto  lod(uint32_t a_primitive)     const noexcept  {  return this->m_selected[a_primitive];                     }
+	// clang-format on
+
+	float32_t m_pixel_error{1.0f};            //! Largest error in pixels a picked level should have
+	float32_t m_hysteresis{0.25f};            //! Fraction of m_pixel_error a coarser level has to be below to be switched to
+	uint64_t  m_triangle_budget{0};           //! Most triangles all visible primitives can add up to, 0 means no budget
+
+  private:
+	uint32_t pick(uint32_t a_primitive, float32_t a_pixel_error) const noexcept;
+	uint64_t triangles(uint32_t a_primitive, uint32_t a_lod) const noexcept;
+
+	std::vector<LodPrimitive> m_primitives{};        //! Primitives added since the last clear()
+	std::vector<float32_t>    m_pixels{};            //! Pixels a unit of error covers for each primitive, worked out by select()
+	std::vector<uint32_t>     m_selected{};          //! Level picked for each primitive, kept across clear() for hysteresis
+	std::vector<LodDraw>      m_draws{};             //! Visible primitives in the order they were added
+	uint64_t                  m_triangles{0};        //! Triangles of all draws
+};
+
+}        // namespace ror
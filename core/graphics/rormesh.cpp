@@ -70,6 +70,7 @@ void Mesh::resize(size_t a_primitives_count)
 	this->m_morph_targets_vertex_descriptors.resize(a_primitives_count);
 	this->m_primitive_types.resize(a_primitives_count);
 	this->m_has_indices_states.resize(a_primitives_count);
+	this->m_lods.resize(a_primitives_count);
 	this->m_vertex_hashes.resize(a_primitives_count);
 	this->m_fragment_hashes.resize(a_primitives_count);
 	this->m_program_hashes.resize(a_primitives_count);
@@ -154,4 +155,12 @@ bool Mesh::has_morphs(rhi::BufferSemantic a_semantic) const noexcept
 	return false;
 }
 
+bool Mesh::has_quantized_positions(size_t a_primitive_index) const noexcept
+{
+	auto &descriptor = this->m_attribute_vertex_descriptors[a_primitive_index];
+
+	return (descriptor.type() & ror::enum_to_type_cast(rhi::BufferSemantic::vertex_position)) &&
+	       descriptor.attribute(rhi::BufferSemantic::vertex_position).format() == rhi::VertexFormat::uint16_4_norm;
+}
+
 }        // namespace ror
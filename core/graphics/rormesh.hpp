@@ -57,6 +57,17 @@ enum AttributeIndices
 #undef item
 #undef item_value
 
+/**
+ * One level of detail of a mesh primitive, a range of triangles in its index buffer
+ * Level 0 is the full detail mesh, later levels have fewer triangles and larger errors
+ */
+struct MeshLod
+{
+	uint32_t  m_index_offset{0};        //! First index of this level in the primitive index buffer
+	uint32_t  m_index_count{0};         //! Number of indices of this level
+	float32_t m_error{0.0f};            //! How far this level's surface is from the full detail one, in mesh units
+};
+
 class ROAR_ENGINE_ITEM Mesh final
 {
   public:
@@ -74,6 +85,8 @@ class ROAR_ENGINE_ITEM Mesh final
 	void upload(rhi::Device &a_device);
 	void update_primitive_hash(size_t a_primitive_id, size_t a_skin_count, hash_64_t a_material_hash);
 
+	bool has_quantized_positions(size_t a_primitive_index) const noexcept;
+
 	// clang-format off
 	FORCE_INLINE constexpr auto  weights_count()                              const noexcept { return this->m_morph_weights.size();                                }
 	FORCE_INLINE constexpr auto  primitives_count()                           const noexcept { return this->m_attribute_vertex_descriptors.size();                 }
@@ -85,6 +98,8 @@ class ROAR_ENGINE_ITEM Mesh final
 	FORCE_INLINE constexpr auto  primitive_type(size_t a_primitive_index)     const noexcept { return this->m_primitive_types[a_primitive_index];                  }
 	FORCE_INLINE constexpr auto  has_indices(size_t a_primitive_index)        const noexcept { return this->m_has_indices_states[a_primitive_index];               }
 	FORCE_INLINE constexpr auto &bounding_box(size_t a_primitive_index)       const noexcept { return this->m_bounding_boxes[a_primitive_index];                   }
+	FORCE_INLINE constexpr auto &lods(size_t a_primitive_index)               const noexcept { return this->m_lods[a_primitive_index];                             }
+	FORCE_INLINE constexpr auto &position_bounds()                            const noexcept { return this->m_position_bounds;                                     }
 	FORCE_INLINE constexpr auto  material(size_t a_primitive_index)           const noexcept { return this->m_material_indices[a_primitive_index];                 }
 	FORCE_INLINE constexpr auto  program(size_t a_primitive_index)            const noexcept { return this->m_program_indices[a_primitive_index];                  }
 	FORCE_INLINE constexpr auto  skin_index()                                 const noexcept { return this->m_skin_index;                                          }
@@ -95,6 +110,8 @@ class ROAR_ENGINE_ITEM Mesh final
 																									   this->m_morph_targets_vertex_descriptors.size() > 0);       }
 	FORCE_INLINE constexpr auto &weights()                                          noexcept { return this->m_morph_weights;                                       }
 	FORCE_INLINE constexpr auto &bounding_box(size_t a_primitive_index)             noexcept { return this->m_bounding_boxes[a_primitive_index];                   }
+	FORCE_INLINE constexpr auto &lods(size_t a_primitive_index)                     noexcept { return this->m_lods[a_primitive_index];                             }
+	FORCE_INLINE constexpr auto &position_bounds()                                  noexcept { return this->m_position_bounds;                                     }
 	FORCE_INLINE constexpr auto &vertex_descriptor(size_t a_primitive_index)        noexcept { return this->m_attribute_vertex_descriptors[a_primitive_index];     }
 	FORCE_INLINE constexpr auto &target_descriptor(size_t a_primitive_index)        noexcept { return this->m_morph_targets_vertex_descriptors[a_primitive_index]; }
 
@@ -132,6 +149,8 @@ class ROAR_ENGINE_ITEM Mesh final
 	std::vector<bool>                                       m_has_indices_states{};                      //! Should be init with false
 	std::vector<float32_t, rhi::BufferAllocator<float32_t>> m_morph_weights{};                           //! Optional morph weights provided per mesh
 	std::vector<ror::BoundingBoxf, BoundingBoxAllocator>    m_bounding_boxes{};                          //! Bounding box of each mesh part
+	std::vector<std::vector<MeshLod>>                       m_lods{};                                    //! Levels of detail of each mesh part, empty if the part has none
+	ror::BoundingBoxf                                       m_position_bounds{};                         //! Bounds of positions of all mesh parts without morph targets, quantized positions are relative to it
 	std::vector<int32_t, rhi::BufferAllocator<int32_t>>     m_material_indices{};                        //! Should be init with -1 and might not have valid values after load, Maybe add a default material
 	std::vector<int32_t, rhi::BufferAllocator<int32_t>>     m_program_indices{};                         //! Should be init with -1 but should have valid values when fully loaded
 	int32_t                                                 m_skin_index{-1};                            //! If the mesh has Skin their index is saved here, Should be init with -1
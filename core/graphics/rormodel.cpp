@@ -30,15 +30,20 @@
 #include "foundation/rorsystem.hpp"
 #include "foundation/rortypes.hpp"
 #include "foundation/rorutilities.hpp"
+#include "geometry/rormesh_optimizer.hpp"
+#include "geometry/rormesh_simplifier.hpp"
+#include "geometry/rorvertex_quantizer.hpp"
 #include "graphics/rormaterial.hpp"
 #include "graphics/rormesh.hpp"
 #include "graphics/rormodel.hpp"
+#include "graphics/rormodel_cache.hpp"
 #include "graphics/rornode.hpp"
 #include "math/rormatrix.hpp"
 #include "math/rormatrix4.hpp"
 #include "math/rorvector.hpp"
 #include "math/rorvector4.hpp"
 #include "profiling/rorlog.hpp"
+#include "profiling/rorprofiler.hpp"
 #include "resources/rorresource.hpp"
 #include "rhi/rorbuffer_view.hpp"
 #include "rhi/rorbuffers_pack.hpp"
@@ -46,15 +51,18 @@
 #include "rhi/rortexture.hpp"
 #include "rhi/rortypes.hpp"
 #include "rhi/rorvertex_description.hpp"
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <filesystem>
+#include <limits>
 #include <set>
 #include <stack>
 #include <stdexcept>
+#include <system_error>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -148,12 +156,10 @@ rhi::TextureImage read_texture_from_cgltf_base64(const cgltf_options *a_options,
 	return ti;
 }
 
-rhi::TextureImage read_texture_from_cgltf_buffer_view(const cgltf_buffer_view *a_buffer_view, const char *a_mimetype)
+// Reads an encoded image either straight out of its buffer view or out of the cooked model on warm loads
+rhi::TextureImage read_texture_from_cgltf_image_data(const uint8_t *a_data, size_t a_size, const char *a_mimetype, const char *a_name)
 {
-	// unsigned char *data = static_cast<unsigned char *>(a_buffer_view->data);
-	const uint8_t *data = cgltf_buffer_view_data(a_buffer_view);
-
-	assert(data && "Can't find valid data inside image buffer_view");
+	assert(a_data && "Can't find valid data inside image buffer_view");
 
 	ResourceExtension extension{extension_from_mimetype(a_mimetype)};
 	assert(extension != ResourceExtension::unknown && "Couldn't find extension from mimetype");
@@ -163,12 +169,16 @@ rhi::TextureImage read_texture_from_cgltf_buffer_view(const cgltf_buffer_view *a
 	rhi::TextureImage ti;
 
 	// TODO: Abstract this out into rortexture.cpp
-	cgltf_size data_size{a_buffer_view->size};
-	rhi::read_texture_from_memory(data, data_size, ti, false, (a_buffer_view->name != nullptr) ? a_buffer_view->name : "cgltf_buffer_view_image");
+	rhi::read_texture_from_memory(a_data, a_size, ti, false, (a_name != nullptr) ? a_name : "cgltf_buffer_view_image");
 
 	return ti;
 }
 
+rhi::TextureImage read_texture_from_cgltf_buffer_view(const cgltf_buffer_view *a_buffer_view, const char *a_mimetype)
+{
+	return read_texture_from_cgltf_image_data(cgltf_buffer_view_data(a_buffer_view), a_buffer_view->size, a_mimetype, a_buffer_view->name);
+}
+
 bool uri_base64_encoded(const char *a_uri)
 {
 	if (strncmp(a_uri, "data:", 5) == 0)
@@ -205,8 +215,9 @@ cgltf_result cgltf_load_buffer_file_as_resource(const cgltf_options *options, cg
 	// after combining, the tail of the resulting path is a uri; decode_uri converts it into path
 	cgltf_decode_uri(path + strlen(path) - strlen(uri));
 
-	auto &resource = load_resource(path, ResourceSemantic::models);
-	auto &data     = resource.data();
+	// Buffers can be huge, map them instead of copying, the mapping lives as long as the cached Resource does
+	auto &resource = map_resource(path, ResourceSemantic::models);
+	auto  data     = resource.data_span();
 
 	assert(data.size() == size && "Resource loaded of wrong size");
 	(void) size;
@@ -287,6 +298,344 @@ cgltf_result cgltf_load_buffers_as_resource(const cgltf_options *options, cgltf_
 	return cgltf_result_success;
 }
 
+// Decoding only reads from the glTF buffers, the const_cast is only there because DecodedStream and the upload tuples take uint8_t *
+static uint8_t *gltf_buffer_data(const bytes_span &a_buffer)
+{
+	return const_cast<uint8_t *>(a_buffer.data());
+}
+
+// Hash of everything a cooked model depends on, the glTF itself and its external buffers
+// External buffers are hashed by size and modification time instead of content, reading them is what cooking avoids
+static hash_64_t gltf_source_hash(const Resource &a_resource, const cgltf_data *a_data)
+{
+	auto hash = a_resource.data_hash();
+
+	for (size_t i = 0; i < a_data->buffers_count; ++i)
+	{
+		const char *uri = a_data->buffers[i].uri;
+
+		if (uri == nullptr || uri_base64_encoded(uri))        // Already part of the glTF or glb content
+			continue;
+
+		std::string buffer_path{a_resource.absolute_path().parent_path() / uri};
+		cgltf_decode_uri(buffer_path.data());
+		buffer_path.resize(std::strlen(buffer_path.c_str()));
+
+		std::error_code error;
+		auto            size = std::filesystem::file_size(buffer_path, error);
+		auto            time = std::filesystem::last_write_time(buffer_path, error);
+
+		hash_combine_64(hash, static_cast<hash_64_t>(size));
+		hash_combine_64(hash, static_cast<hash_64_t>(time.time_since_epoch().count()));
+	}
+
+	// Optimised, quantized meshes and their levels of detail are what gets cooked, so switching any of them makes cooked data stale
+	hash_combine_64(hash, static_cast<hash_64_t>(ror::settings().m_optimize_meshes));
+	hash_combine_64(hash, static_cast<hash_64_t>(ror::settings().m_generate_lods));
+	hash_combine_64(hash, static_cast<hash_64_t>(ror::settings().m_quantize_vertices));
+
+	return hash;
+}
+
+// Copies the next cooked stream into a_destination, sizes only differ if the blob doesn't belong to this glTF
+static void read_cooked_stream(ModelCache &a_model_cache, rhi::BufferSemantic a_semantic, void *a_destination, size_t a_size)
+{
+	auto [data, size, stride] = a_model_cache.next(a_semantic);
+	(void) stride;
+
+	assert(size == a_size && "Cooked stream size doesn't match the glTF accessor");
+
+	if (data)
+		std::memcpy(a_destination, data, std::min(static_cast<size_t>(size), a_size));
+}
+
+using AttributesData = std::unordered_map<rhi::BufferSemantic, std::tuple<uint8_t *, uint32_t, uint32_t>>;
+
+// An accessor decoded by a primitive decode job, it becomes part of the AttributesData of its descriptor when the decoded primitives are merged
+struct DecodedStream
+{
+	rhi::BufferSemantic m_semantic{rhi::BufferSemantic::vertex_position};        // Semantic of the stream
+	uint8_t            *m_data{nullptr};                                          // Start of the first element, nullptr on warm loads where it comes from the ModelCache instead
+	uint32_t            m_element_size{0};                                        // Size of one element in bytes
+	uint32_t            m_count{0};                                               // Number of elements
+	uint32_t            m_stride{0};                                              // Bytes from one element to the next
+};
+
+// Streams of one VertexDescriptor, either of a primitive or one of its morph targets
+struct DecodedDescriptor
+{
+	rhi::VertexDescriptor     *m_descriptor{nullptr};        // Non-owning, lives in the Mesh
+	std::vector<DecodedStream> m_streams{};                  // In the order the accessors are read, which is also the order they are cooked in
+	AttributesData             m_attributes_data{};          // Filled by the merge, used by VertexDescriptor::allocate() and fill()
+};
+
+// Everything a primitive decode job produces that has to wait for the merge, including unpacked data the streams point into
+struct DecodedPrimitive
+{
+	std::vector<DecodedDescriptor>        m_descriptors{};            // The primitive first followed by its morph targets, same order as they are allocated in
+	std::array<std::vector<uint8_t>, 2>   m_weights_uint8{};          // Normalised weights
+	std::array<std::vector<uint16_t>, 2>  m_weights_uint16{};         // Normalised weights
+	std::array<std::vector<float32_t>, 2> m_weights_float32{};        // Normalised weights
+	std::vector<uint16_t>                 m_indices{};                // uint8_t indices unpacked to uint16_t, or optimised indices narrowed to uint16_t
+	std::vector<std::vector<uint8_t>>     m_optimized{};              // Streams rewritten by the mesh optimizer, tightly packed
+	std::vector<std::vector<uint16_t>>    m_quantized_uint16{};       // Quantized positions and half float texture coordinates
+	std::vector<std::vector<int16_t>>     m_quantized_int16{};        // Octahedral normals and tangents
+	std::vector<std::vector<uint8_t>>     m_quantized_uint8{};        // Quantized weights
+	std::vector<MeshLod>                  m_lods{};                   // Levels of detail in the index stream, filled by the optimizer on cold loads
+	bool                                  m_has_indices{false};       // Mesh::has_indices() is a std::vector<bool> so its only written in the merge
+	bool                                  m_has_lods{false};          // Only depends on the glTF and settings so warm loads know to read the cooked levels
+};
+
+constexpr uint32_t  lod_max_levels{5};                     // Including the full detail level
+constexpr float32_t lod_reduction{0.5f};                   // Each level aims for this fraction of the indices of the one before
+constexpr float32_t lod_max_relative_error{0.05f};         // Largest error of any level, relative to the largest extent of the primitive
+
+// Simplifies the optimised primitive into a chain of levels of detail and appends them to a_indices after the full detail one
+// Normals and the first texture coordinates, if they are floats, make collapses across attribute changes more expensive
+static std::vector<MeshLod> generate_primitive_lods(std::vector<uint32_t> &a_indices, const DecodedDescriptor &a_descriptor, uint32_t a_vertex_count)
+{
+	profile_zone("generate_primitive_lods");
+
+	const DecodedStream                 *positions{nullptr};
+	std::vector<ror::SimplifyAttribute> attributes{};
+
+	for (auto &stream : a_descriptor.m_streams)
+	{
+		if (stream.m_semantic == rhi::BufferSemantic::vertex_position && stream.m_element_size == sizeof(float32_t) * 3)
+			positions = &stream;
+		else if (stream.m_semantic == rhi::BufferSemantic::vertex_normal && stream.m_element_size == sizeof(float32_t) * 3)
+			attributes.push_back({reinterpret_cast<const float32_t *>(stream.m_data), stream.m_stride, 3, 0.5f});
+		else if (stream.m_semantic == rhi::BufferSemantic::vertex_texture_coord_0 && stream.m_element_size == sizeof(float32_t) * 2)
+			attributes.push_back({reinterpret_cast<const float32_t *>(stream.m_data), stream.m_stride, 2, 1.0f});
+	}
+
+	std::vector<MeshLod> lods{{0, static_cast_safe<uint32_t>(a_indices.size()), 0.0f}};
+
+	if (!positions || a_indices.empty())
+		return lods;
+
+	const auto *position_data = reinterpret_cast<const float32_t *>(positions->m_data);
+
+	ror::Vector3f minimum{std::numeric_limits<float32_t>::max()};
+	ror::Vector3f maximum{std::numeric_limits<float32_t>::lowest()};
+	for (uint32_t vertex = 0; vertex < a_vertex_count; ++vertex)
+	{
+		ror::Vector3f p{position_data[vertex * 3], position_data[vertex * 3 + 1], position_data[vertex * 3 + 2]};
+		minimum = {std::min(minimum.x, p.x), std::min(minimum.y, p.y), std::min(minimum.z, p.z)};
+		maximum = {std::max(maximum.x, p.x), std::max(maximum.y, p.y), std::max(maximum.z, p.z)};
+	}
+
+	auto levels = ror::generate_lods(a_indices, position_data, positions->m_stride, a_vertex_count, lod_max_levels, lod_reduction, (maximum - minimum).maximum() * lod_max_relative_error, attributes);
+
+	for (size_t level = 1; level < levels.size(); ++level)
+	{
+		lods.push_back({static_cast_safe<uint32_t>(a_indices.size()), static_cast_safe<uint32_t>(levels[level].m_indices.size()), levels[level].m_error});
+		a_indices.insert(a_indices.end(), levels[level].m_indices.begin(), levels[level].m_indices.end());
+	}
+
+	return lods;
+}
+
+// Welds duplicate vertices, reorders triangles for the post transform cache and overdraw, then orders vertices by first use for fetch
+// All streams of the primitive and its morph targets are remapped together and replaced by tightly packed copies, these are also what gets cooked
+// Indices are written as uint16_t if they were already or a_narrow_indices is set, even if the primitive can't be optimised
+// With a_decoded.m_has_lods set levels of detail follow the full detail indices, primitives that can't be optimised get only the full detail level
+static void optimize_decoded_primitive(DecodedPrimitive &a_decoded, bool a_narrow_indices)
+{
+	profile_zone("optimize_decoded_primitive");
+
+	DecodedStream               *index_stream{nullptr};
+	std::vector<DecodedStream *> vertex_streams{};
+
+	for (auto &decoded_descriptor : a_decoded.m_descriptors)
+		for (auto &stream : decoded_descriptor.m_streams)
+			if (stream.m_semantic == rhi::BufferSemantic::vertex_index)
+				index_stream = &stream;
+			else
+				vertex_streams.push_back(&stream);
+
+	if (!index_stream)
+		return;
+
+	std::vector<uint32_t> indices(index_stream->m_count);
+	for (size_t i = 0; i < indices.size(); ++i)
+	{
+		const uint8_t *index = index_stream->m_data + i * index_stream->m_stride;
+		if (index_stream->m_element_size == sizeof(uint16_t))
+		{
+			uint16_t value;
+			std::memcpy(&value, index, sizeof(uint16_t));
+			indices[i] = value;
+		}
+		else
+		{
+			std::memcpy(&indices[i], index, sizeof(uint32_t));
+		}
+	}
+
+	auto vertex_count = vertex_streams.empty() ? 0u : vertex_streams[0]->m_count;
+	bool optimizable  = vertex_count > 0 && indices.size() % 3 == 0 &&
+	                   std::all_of(vertex_streams.begin(), vertex_streams.end(), [vertex_count](const DecodedStream *a_stream) { return a_stream->m_count == vertex_count; }) &&
+	                   std::all_of(indices.begin(), indices.end(), [vertex_count](uint32_t a_index) { return a_index < vertex_count; });
+
+	if (optimizable)
+	{
+		std::vector<ror::VertexStream> streams{};
+		streams.reserve(vertex_streams.size());
+		for (auto *stream : vertex_streams)
+			streams.push_back({stream->m_data, stream->m_element_size, stream->m_stride});
+
+		std::vector<uint32_t> remap{};
+		auto                  unique_count = ror::generate_vertex_remap(remap, indices, vertex_count, streams);
+		ror::remap_indices(indices, remap);
+
+		ror::optimize_vertex_cache(indices, unique_count);
+
+		// Overdraw optimisation needs positions in the welded order, only float positions are supported
+		for (size_t i = 0; i < vertex_streams.size(); ++i)
+		{
+			if (vertex_streams[i]->m_semantic == rhi::BufferSemantic::vertex_position && vertex_streams[i]->m_element_size == sizeof(float32_t) * 3)
+			{
+				std::vector<float32_t> positions(static_cast<size_t>(unique_count) * 3);
+				ror::remap_vertices(reinterpret_cast<uint8_t *>(positions.data()), streams[i], remap);
+				ror::optimize_overdraw(indices, positions.data(), sizeof(float32_t) * 3, unique_count);
+				break;
+			}
+		}
+
+		std::vector<uint32_t> fetch_remap{};
+		auto                  fetch_count = ror::optimize_vertex_fetch_remap(fetch_remap, indices, unique_count);
+		ror::remap_indices(indices, fetch_remap);
+
+		// Combine both remaps so every stream is copied only once
+		for (auto &index : remap)
+			if (index != ~0u)
+				index = fetch_remap[index];
+
+		a_decoded.m_optimized.reserve(vertex_streams.size() + 1);
+		for (size_t i = 0; i < vertex_streams.size(); ++i)
+		{
+			auto *stream = vertex_streams[i];
+			auto &data   = a_decoded.m_optimized.emplace_back(static_cast<size_t>(fetch_count) * stream->m_element_size);
+
+			ror::remap_vertices(data.data(), streams[i], remap);
+
+			stream->m_data   = data.data();
+			stream->m_count  = fetch_count;
+			stream->m_stride = stream->m_element_size;
+		}
+
+		if (a_decoded.m_has_lods)
+			a_decoded.m_lods = generate_primitive_lods(indices, a_decoded.m_descriptors[0], fetch_count);
+	}
+
+	if (a_decoded.m_has_lods && a_decoded.m_lods.empty())
+		a_decoded.m_lods.push_back({0, static_cast_safe<uint32_t>(indices.size()), 0.0f});
+
+	index_stream->m_count = static_cast_safe<uint32_t>(indices.size());
+
+	if (a_narrow_indices || index_stream->m_element_size == sizeof(uint16_t))
+	{
+		a_decoded.m_indices.resize(indices.size());
+		std::transform(indices.begin(), indices.end(), a_decoded.m_indices.begin(), [](uint32_t a_index) { return static_cast<uint16_t>(a_index); });
+
+		index_stream->m_data         = reinterpret_cast<uint8_t *>(a_decoded.m_indices.data());
+		index_stream->m_element_size = sizeof(uint16_t);
+	}
+	else
+	{
+		auto &data = a_decoded.m_optimized.emplace_back(indices.size() * sizeof(uint32_t));
+		std::memcpy(data.data(), indices.data(), data.size());
+
+		index_stream->m_data = data.data();
+	}
+
+	index_stream->m_stride = index_stream->m_element_size;
+}
+
+// Format a primitive attribute is stored in with settings().m_quantize_vertices, only depends on the glTF so warm loads agree with the cooked data
+// Positions are relative to Mesh::position_bounds(), normals and tangents are octahedral, generated vertex shaders decode both
+// Morph targets are left as they are, their deltas aren't bounded by the primitive
+static rhi::VertexFormat quantized_vertex_format(rhi::BufferSemantic a_semantic, rhi::VertexFormat a_format)
+{
+	if (a_semantic == rhi::BufferSemantic::vertex_position && a_format == rhi::VertexFormat::float32_3)
+		return rhi::VertexFormat::uint16_4_norm;        // There is no widely supported 3 component 16 bit format
+
+	if (a_semantic == rhi::BufferSemantic::vertex_normal && a_format == rhi::VertexFormat::float32_3)
+		return rhi::VertexFormat::int16_2_norm;
+
+	if (a_semantic == rhi::BufferSemantic::vertex_tangent && a_format == rhi::VertexFormat::float32_4)
+		return rhi::VertexFormat::int16_4_norm;
+
+	if ((a_semantic == rhi::BufferSemantic::vertex_texture_coord_0 || a_semantic == rhi::BufferSemantic::vertex_texture_coord_1 || a_semantic == rhi::BufferSemantic::vertex_texture_coord_2) &&
+	    a_format == rhi::VertexFormat::float32_2)
+		return rhi::VertexFormat::half16_2;
+
+	if ((a_semantic == rhi::BufferSemantic::vertex_weight_0 || a_semantic == rhi::BufferSemantic::vertex_weight_1) &&
+	    (a_format == rhi::VertexFormat::float32_4 || a_format == rhi::VertexFormat::uint16_4 || a_format == rhi::VertexFormat::uint8_4))
+		return rhi::VertexFormat::uint8_4_norm;
+
+	return a_format;
+}
+
+// Converts the streams of the primitive, not of its morph targets, to the formats quantized_vertex_format() picked into tightly packed copies
+// Runs after the optimizer because welding, overdraw optimisation and levels of detail all need full precision positions
+static void quantize_decoded_primitive(DecodedPrimitive &a_decoded, const ror::BoundingBoxf &a_position_bounds)
+{
+	profile_zone("quantize_decoded_primitive");
+
+	auto &decoded_descriptor = a_decoded.m_descriptors[0];
+
+	for (auto &stream : decoded_descriptor.m_streams)
+	{
+		if (stream.m_semantic == rhi::BufferSemantic::vertex_index)
+			continue;
+
+		ror::VertexStream source{stream.m_data, stream.m_element_size, stream.m_stride};
+		auto              format = decoded_descriptor.m_descriptor->attribute(stream.m_semantic).format();
+		uint8_t          *data{nullptr};
+
+		if (format == rhi::VertexFormat::uint16_4_norm)
+		{
+			auto &quantized = a_decoded.m_quantized_uint16.emplace_back();
+			ror::quantize_positions(quantized, source, stream.m_count, a_position_bounds);
+			data = reinterpret_cast<uint8_t *>(quantized.data());
+		}
+		else if (format == rhi::VertexFormat::int16_2_norm)
+		{
+			auto &quantized = a_decoded.m_quantized_int16.emplace_back();
+			ror::quantize_normals(quantized, source, stream.m_count);
+			data = reinterpret_cast<uint8_t *>(quantized.data());
+		}
+		else if (format == rhi::VertexFormat::int16_4_norm)
+		{
+			auto &quantized = a_decoded.m_quantized_int16.emplace_back();
+			ror::quantize_tangents(quantized, source, stream.m_count);
+			data = reinterpret_cast<uint8_t *>(quantized.data());
+		}
+		else if (format == rhi::VertexFormat::half16_2)
+		{
+			auto &quantized = a_decoded.m_quantized_uint16.emplace_back();
+			ror::quantize_texture_coordinates(quantized, source, stream.m_count);
+			data = reinterpret_cast<uint8_t *>(quantized.data());
+		}
+		else if (format == rhi::VertexFormat::uint8_4_norm)
+		{
+			auto &quantized = a_decoded.m_quantized_uint8.emplace_back();
+			ror::quantize_weights(quantized, source, stream.m_count);
+			data = quantized.data();
+		}
+		else
+		{
+			continue;
+		}
+
+		stream.m_data         = data;
+		stream.m_element_size = rhi::vertex_format_to_bytes(format);
+		stream.m_stride       = stream.m_element_size;
+	}
+}
+
 rhi::Format get_format_from_gltf_type_format(cgltf_type a_type, cgltf_component_type a_component_type)
 {
 	if (a_type == cgltf_type::cgltf_type_vec4 || a_type == cgltf_type::cgltf_type_mat2)
@@ -1173,14 +1522,121 @@ void Model::create_grid(bool a_generate_shaders, rhi::BuffersPack &a_buffers_pac
 	upload_position4_color4(mesh, prim_id, grid_data, a_buffers_pack);
 }
 
+// Semantic the loader gives a glTF vertex or morph target attribute
+static rhi::BufferSemantic gltf_attribute_semantic(const cgltf_attribute &a_attribute)
+{
+	auto index = static_cast<uint64_t>(a_attribute.index);
+
+	// clang-format off
+	switch (a_attribute.type)
+	{
+		case cgltf_attribute_type::cgltf_attribute_type_normal:   return rhi::BufferSemantic::vertex_normal;
+		case cgltf_attribute_type::cgltf_attribute_type_tangent:  return rhi::BufferSemantic::vertex_tangent;
+		case cgltf_attribute_type::cgltf_attribute_type_texcoord: return static_cast<rhi::BufferSemantic>(ror::enum_to_type_cast(rhi::BufferSemantic::vertex_texture_coord_0) << index);
+		case cgltf_attribute_type::cgltf_attribute_type_color:    return static_cast<rhi::BufferSemantic>(ror::enum_to_type_cast(rhi::BufferSemantic::vertex_color_0) << index);
+		case cgltf_attribute_type::cgltf_attribute_type_joints:   return static_cast<rhi::BufferSemantic>(ror::enum_to_type_cast(rhi::BufferSemantic::vertex_bone_id_0) << index);
+		case cgltf_attribute_type::cgltf_attribute_type_weights:  return static_cast<rhi::BufferSemantic>(ror::enum_to_type_cast(rhi::BufferSemantic::vertex_weight_0) << index);
+		case cgltf_attribute_type::cgltf_attribute_type_position:
+		case cgltf_attribute_type::cgltf_attribute_type_invalid:
+		case cgltf_attribute_type::cgltf_attribute_type_custom:
+		case cgltf_attribute_type::cgltf_attribute_type_max_enum: break;
+	}
+	// clang-format on
+
+	return rhi::BufferSemantic::vertex_position;
+}
+
+// Every stream load_from_gltf_file() cooks for a_data with the current settings, in the order it reads them
+// Has to mirror the decode and merge of primitives, skins and animations, a cooked blob that doesn't match this exactly is cooked again
+// Vertex and index counts change when primitives are optimised so those sizes are only known for primitives that aren't
+static std::vector<ModelCache::ExpectedStream> gltf_cooked_streams(const cgltf_data *a_data)
+{
+	std::vector<ModelCache::ExpectedStream> streams{};
+
+	auto accessor_size = [](const cgltf_accessor *a_accessor) { return static_cast_safe<uint32_t>(cgltf_calc_size(a_accessor->type, a_accessor->component_type)); };
+
+	// Images inside buffer views come first, warm loads read them while queueing the image jobs before anything else is read
+	for (size_t i = 0; i < a_data->images_count; ++i)
+		if (a_data->images[i].buffer_view)
+		{
+			auto size = static_cast_safe<uint32_t>(a_data->images[i].buffer_view->size);
+			streams.push_back({rhi::BufferSemantic::texture_image_data, size, size});
+		}
+
+	for (size_t i = 0; i < a_data->meshes_count; ++i)
+	{
+		const cgltf_mesh &cmesh = a_data->meshes[i];
+
+		for (size_t j = 0; j < cmesh.primitives_count; ++j)
+		{
+			const cgltf_primitive &cprim    = cmesh.primitives[j];
+			bool                   optimize = ror::settings().m_optimize_meshes && cprim.indices && cprim.type == cgltf_primitive_type_triangles;
+			bool                   quantize = ror::settings().m_quantize_vertices;
+
+			auto add_attribute = [&streams, &accessor_size, optimize](const cgltf_attribute &a_attribute, bool a_quantize) {
+				auto semantic = gltf_attribute_semantic(a_attribute);
+				auto format   = get_format_from_gltf_type_format(a_attribute.data->type, a_attribute.data->component_type);
+				auto stored   = a_quantize ? quantized_vertex_format(semantic, format) : format;
+				auto stride   = stored != format ? rhi::vertex_format_to_bytes(stored) : accessor_size(a_attribute.data);
+
+				streams.push_back({semantic, stride, optimize ? 0 : stride * static_cast_safe<uint32_t>(a_attribute.data->count)});
+			};
+
+			for (size_t k = 0; k < cprim.attributes_count; ++k)
+				add_attribute(cprim.attributes[k], quantize);
+
+			if (cprim.indices)
+			{
+				auto index_format = get_format_from_gltf_type_format(cprim.indices->type, cprim.indices->component_type);
+				auto vertex_count = cprim.attributes_count ? cprim.attributes[0].data->count : 0;
+				auto stride       = accessor_size(cprim.indices);
+
+				if (index_format == rhi::Format::uint8_1 || (optimize && index_format == rhi::Format::uint32_1 && vertex_count <= std::numeric_limits<uint16_t>::max() + 1u))
+					stride = sizeof(uint16_t);
+
+				streams.push_back({rhi::BufferSemantic::vertex_index, stride, optimize ? 0 : stride * static_cast_safe<uint32_t>(cprim.indices->count)});
+			}
+
+			for (size_t k = 0; k < cprim.targets_count; ++k)
+				for (size_t l = 0; l < cprim.targets[k].attributes_count; ++l)
+					add_attribute(cprim.targets[k].attributes[l], false);
+
+			if (optimize && ror::settings().m_generate_lods)
+				streams.push_back({rhi::BufferSemantic::mesh_data, sizeof(MeshLod), 0});
+		}
+	}
+
+	for (size_t i = 0; i < a_data->skins_count; ++i)
+		if (a_data->skins[i].inverse_bind_matrices)
+			streams.push_back({rhi::BufferSemantic::skin_data, sizeof(ror::Matrix4f), static_cast_safe<uint32_t>(a_data->skins[i].inverse_bind_matrices->count * sizeof(ror::Matrix4f))});
+
+	for (size_t i = 0; i < a_data->animations_count; ++i)
+	{
+		const cgltf_animation &canimation = a_data->animations[i];
+
+		for (size_t j = 0; j < canimation.samplers_count; ++j)
+		{
+			auto input_size  = static_cast_safe<uint32_t>(canimation.samplers[j].input->count * sizeof(float32_t));
+			auto output_size = static_cast_safe<uint32_t>(canimation.samplers[j].output->count * sizeof(float32_t) * cgltf_num_components(canimation.samplers[j].output->type));
+
+			streams.push_back({rhi::BufferSemantic::animation_input_data, input_size, input_size});
+			streams.push_back({rhi::BufferSemantic::animation_output_data, output_size, output_size});
+		}
+	}
+
+	return streams;
+}
+
 void Model::load_from_gltf_file(std::filesystem::path a_filename, std::vector<ror::OrbitCamera> &a_cameras, std::vector<ror::Light> &a_lights, bool a_generate_shaders, rhi::BuffersPack &a_buffers_pack)
 {
+	profile_zone("Model::load_from_gltf_file");
+
 	(void) a_lights;
 
 	this->m_generate_shaders = a_generate_shaders;
 
 	// Lets start by reading a_filename via resource cache
-	auto &resource = load_resource(a_filename, ResourceSemantic::models);
+	auto &resource = map_resource(a_filename, ResourceSemantic::models);
 	auto &filename = resource.absolute_path();
 
 	// Get an instance of job system
@@ -1191,7 +1647,8 @@ void Model::load_from_gltf_file(std::filesystem::path a_filename, std::vector<ro
 	cgltf_options options{};        // Default setting
 	cgltf_data   *data{nullptr};
 	// Since we have loaded as resource use cgltf_parse instead of cgltf_parse_file(&options, filename.c_str(), &data);
-	cgltf_result result = cgltf_parse(&options, resource.data().data(), resource.data().size(), &data);
+	auto         bytes  = resource.data_span();
+	cgltf_result result = cgltf_parse(&options, bytes.data(), bytes.size(), &data);
 
 	if (result != cgltf_result_success)
 	{
@@ -1200,6 +1657,17 @@ void Model::load_from_gltf_file(std::filesystem::path a_filename, std::vector<ro
 	}
 	else
 	{
+		// Cooked model data replaces loading and decoding the buffers on warm loads, the json is still parsed for everything else
+		ModelCache model_cache{gltf_source_hash(resource, data)};
+		bool       cook_model = ror::settings().m_cook_models;
+
+		// A blob from an older or different loader layout is dropped here, before anything is read from it, and cooked again
+		if (cook_model && model_cache.load())
+			model_cache.validate(gltf_cooked_streams(data));
+
+		// Images inside buffer views are cooked as well, so warm loads don't touch the buffers at all
+		bool needs_buffers = !model_cache.warm();
+
 		std::unordered_map<const cgltf_image *, int32_t>    image_to_index{};
 		std::unordered_map<const cgltf_sampler *, int32_t>  sampler_to_index{};
 		std::unordered_map<const cgltf_texture *, int32_t>  texture_to_index{};
@@ -1209,9 +1677,10 @@ void Model::load_from_gltf_file(std::filesystem::path a_filename, std::vector<ro
 		std::unordered_map<const cgltf_node *, int32_t>     node_to_index{};
 		std::unordered_map<const cgltf_skin *, int32_t>     skin_to_index{};
 
-		// TODO: This loading is very serial, turning this into Jobs doesn't help much. Find a way to be more parallel
+		auto buffers_load_lambda = [&options, &data, &filename, this, &buffer_to_index, needs_buffers]() -> bool {
+			if (!needs_buffers)
+				return true;
 
-		auto buffers_load_lambda = [&options, &data, &filename, this, &buffer_to_index]() -> bool {
 			// Load all the buffers as resource(s)
 			cgltf_result buffers_result = cgltf_load_buffers_as_resource(&options, data, filename.c_str());
 
@@ -1225,9 +1694,8 @@ void Model::load_from_gltf_file(std::filesystem::path a_filename, std::vector<ro
 			this->m_buffers.reserve(data->buffers_count);
 			for (size_t i = 0; i < data->buffers_count; ++i)
 			{
-				// In the following I am creating std::vector<uint8_t> buffer from data->buffers[i] and emplacing it directly into m_buffers
-				// Note we don't need a reserve here because the vector size is provided in constructor to emplace_back
-				this->m_buffers.emplace_back(static_cast<BinBuffer *>(data->buffers[i].data), static_cast<BinBuffer *>(data->buffers[i].data) + data->buffers[i].size);
+				// No copy, external buffers are mapped resources that outlive the model, glb and base64 ones live until cgltf_free()
+				this->m_buffers.emplace_back(static_cast<const uint8_t *>(data->buffers[i].data), data->buffers[i].size);
 				buffer_to_index.emplace(&data->buffers[i], i);
 			}
 
@@ -1251,6 +1719,10 @@ void Model::load_from_gltf_file(std::filesystem::path a_filename, std::vector<ro
 			return ror::read_texture_from_cgltf_buffer_view(a_buffer_view, a_mimetype);
 		};
 
+		auto from_cooked_lambda = [](const uint8_t *a_data, size_t a_size, const char *a_mimetype, const char *a_name) -> rhi::TextureImage {
+			return ror::read_texture_from_cgltf_image_data(a_data, a_size, a_mimetype, a_name);
+		};
+
 #if defined(USE_JS)
 		std::vector<JobHandle<rhi::TextureImage>> future_texures{};
 		future_texures.reserve(data->images_count);
@@ -1292,6 +1764,17 @@ void Model::load_from_gltf_file(std::filesystem::path a_filename, std::vector<ro
 #endif
 				}
 			}
+			else if (model_cache.warm())
+			{
+				assert(data->images[i].buffer_view && data->images[i].mime_type && "Image with buffer view must have a valid buffer view and mimeType");
+				auto [image_data, image_size, image_stride] = model_cache.next(rhi::BufferSemantic::texture_image_data);
+				(void) image_stride;
+#if defined(USE_JS)
+				future_texures.emplace_back(js.push_job(from_cooked_lambda, image_data, image_size, data->images[i].mime_type, data->images[i].buffer_view->name));        // vector of job_handles
+#else
+				this->m_images.emplace_back(from_cooked_lambda(image_data, image_size, data->images[i].mime_type, data->images[i].buffer_view->name));
+#endif
+			}
 			else
 			{
 				assert(data->images[i].buffer_view && data->images[i].mime_type && "Image with buffer view must have a valid buffer view and mimeType");
@@ -1314,6 +1797,15 @@ void Model::load_from_gltf_file(std::filesystem::path a_filename, std::vector<ro
 				(void) res;
 			}
 
+			// Images inside buffer views are cooked before everything else, in the order the warm path reads them in
+			if (cook_model && !model_cache.warm())
+				for (size_t i = 0; i < data->images_count; ++i)
+					if (data->images[i].buffer_view)
+					{
+						auto *buffer_view = data->images[i].buffer_view;
+						model_cache.record(rhi::BufferSemantic::texture_image_data, cgltf_buffer_view_data(buffer_view), static_cast_safe<uint32_t>(buffer_view->size), 1, static_cast_safe<uint32_t>(buffer_view->size));
+					}
+
 			// Read all the samplers
 			this->m_samplers.reserve(data->samplers_count + 1);
 			// Lets have a default sampler at index 0
@@ -1491,8 +1983,12 @@ void Model::load_from_gltf_file(std::filesystem::path a_filename, std::vector<ro
 			}
 
 			// Read all the meshes
+			// Primitives are decoded in parallel, the decoded data is then allocated in the BuffersPack and cooked in the same order a serial load does it
+			// and only after that copied into the buffers, again in parallel. This way the loaded data and buffers layout stay the same as a serial load
 			this->m_meshes.resize(data->meshes_count);
-			for (size_t i = 0; i < data->meshes_count; ++i)
+
+			std::vector<std::pair<uint32_t, uint32_t>> primitives;        // Mesh and primitive index of every primitive
+			for (uint32_t i = 0; i < data->meshes_count; ++i)
 			{
 				Mesh             &mesh  = this->m_meshes[i];
 				const cgltf_mesh &cmesh = data->meshes[i];
@@ -1502,176 +1998,241 @@ void Model::load_from_gltf_file(std::filesystem::path a_filename, std::vector<ro
 
 				mesh.resize(cmesh.primitives_count);
 
-				for (size_t j = 0; j < cmesh.primitives_count; ++j)
+				// Quantized positions of all primitives are relative to the same bounds, so the decode is per node and not per primitive
+				auto &position_bounds = mesh.position_bounds();
+				for (uint32_t j = 0; j < cmesh.primitives_count; ++j)
 				{
-					const cgltf_primitive &cprim                                    = cmesh.primitives[j];
-					auto                  &vertex_attribute_descriptor              = mesh.vertex_descriptor(j);
-					auto                  &morph_target_vertex_attribute_descriptor = mesh.target_descriptor(j);
+					primitives.emplace_back(i, j);
 
-					std::unordered_map<rhi::BufferSemantic, std::tuple<uint8_t *, uint32_t, uint32_t>> attribs_data;
+					const cgltf_primitive &cprim = cmesh.primitives[j];
+					for (size_t k = 0; k < cprim.attributes_count; ++k)
+					{
+						const cgltf_attribute &attrib = cprim.attributes[k];
+						if (attrib.type == cgltf_attribute_type_position && attrib.data->has_min && attrib.data->has_max)
+						{
+							position_bounds.add_point({attrib.data->min[0], attrib.data->min[1], attrib.data->min[2]});
+							position_bounds.add_point({attrib.data->max[0], attrib.data->max[1], attrib.data->max[2]});
+						}
+					}
+				}
 
-					assert(cprim.type == cgltf_primitive_type_triangles && "Mesh primitive type is not triangles which is the only supported type at the moment");
-					mesh.primitive_type(j, cglf_primitive_to_primitive_topology(cprim.type));
+				// Save Morph target weights
+				if (cmesh.primitives_count > 0)
+				{
+					auto &mesh_weights = mesh.weights();
+					mesh_weights.resize(cmesh.weights_count);
 
-					if (cprim.has_draco_mesh_compression)
-						ror::log_critical("Mesh has draco mesh compression but its not supported");
+					// TODO: Do a bulk copy please once tested and it works
+					for (size_t m = 0; m < cmesh.weights_count; ++m)
+						mesh_weights[m] = cmesh.weights[m];
+				}
+			}
 
-					if (cprim.material)
-						mesh.material(j, find_safe_index(material_to_index, cprim.material));
-					else
-						mesh.material(j, 0);
+			std::vector<DecodedPrimitive> decoded_primitives(primitives.size());
 
-					mesh.program(j, -1);
+			// Only touches its own primitive in the mesh, everything shared is either read only or left for the merge
+			auto decode_primitive = [&](uint32_t a_index) {
+				auto [i, j] = primitives[a_index];
 
-					std::array<std::vector<uint8_t>, 2>   weights_uint8_pointer{};
-					std::array<std::vector<uint16_t>, 2>  weights_uint16_pointer{};
-					std::array<std::vector<float32_t>, 2> weights_float32_pointer{};
+				Mesh                  &mesh                                     = this->m_meshes[i];
+				const cgltf_mesh      &cmesh                                    = data->meshes[i];
+				const cgltf_primitive &cprim                                    = cmesh.primitives[j];
+				auto                  &vertex_attribute_descriptor              = mesh.vertex_descriptor(j);
+				auto                  &morph_target_vertex_attribute_descriptor = mesh.target_descriptor(j);
+				auto                  &decoded                                  = decoded_primitives[a_index];
 
-					// Read all other vertex attributes
-					for (size_t k = 0; k < cprim.attributes_count; ++k)
-					{
-						const cgltf_attribute &attrib = cprim.attributes[k];
+				decoded.m_descriptors.reserve(cprim.targets_count + 1);        // References into it must stay valid
 
-						assert(attrib.data->buffer_view && "rhi::BufferView doesn't have a valid buffer view");
+				// Only indexed triangle lists are optimised, the decision and index narrowing only depend on the glTF so warm loads agree with the cooked data
+				bool optimize       = ror::settings().m_optimize_meshes && cprim.indices && cprim.type == cgltf_primitive_type_triangles;
+				bool quantize       = ror::settings().m_quantize_vertices;
+				bool narrow_indices = false;
 
-						if (attrib.data->is_sparse)
-							ror::log_critical("Don't support sparse attribute accessors");
+				decoded.m_has_lods = optimize && ror::settings().m_generate_lods;
 
-						rhi::BufferSemantic current_index = rhi::BufferSemantic::vertex_position;
+				auto &decoded_attributes        = decoded.m_descriptors.emplace_back();
+				decoded_attributes.m_descriptor = &vertex_attribute_descriptor;
 
-						switch (attrib.type)
-						{
-							case cgltf_attribute_type::cgltf_attribute_type_position:
-								assert(attrib.data->has_min && attrib.data->has_max && "Position attributes must provide min and max");
-								assert(attrib.index == 0 && "Don't suport more than 1 position");
+				assert(cprim.type == cgltf_primitive_type_triangles && "Mesh primitive type is not triangles which is the only supported type at the moment");
+				mesh.primitive_type(j, cglf_primitive_to_primitive_topology(cprim.type));
 
-								current_index = rhi::BufferSemantic::vertex_position;
-								{
-									auto &mesh_bbox = mesh.bounding_box(j);
-									mesh_bbox.create_from_min_max({attrib.data->min[0], attrib.data->min[1], attrib.data->min[2]},
-									                              {attrib.data->max[0], attrib.data->max[1], attrib.data->max[2]});
-								}
-								break;
-							case cgltf_attribute_type::cgltf_attribute_type_normal:
-								assert((attrib.data->component_type == cgltf_component_type_r_32f || attrib.data->component_type == cgltf_component_type_r_8) &&
-								       (attrib.data->type == cgltf_type_vec3 || attrib.data->type == cgltf_type_vec2) && "Normal not in the right format, float3 required");
-								assert(attrib.index == 0 && "Don't suport more than 1 normal");
-								current_index = rhi::BufferSemantic::vertex_normal;
-								break;
-							case cgltf_attribute_type::cgltf_attribute_type_tangent:
-								assert((attrib.data->component_type == cgltf_component_type_r_32f || attrib.data->component_type == cgltf_component_type_r_8) &&
-								       (attrib.data->type == cgltf_type_vec4) && "Tangent not in the right format, float4 required");        // If its 3D only need to add w=[+1, -1] to denote handedness
-								assert(attrib.index == 0 && "Don't suport more than 1 tangent");
-								current_index = rhi::BufferSemantic::vertex_tangent;
-								break;
-							case cgltf_attribute_type::cgltf_attribute_type_texcoord:
-								assert((attrib.data->component_type == cgltf_component_type_r_32f || attrib.data->component_type == cgltf_component_type_r_16u) &&
-								       (attrib.data->type == cgltf_type_vec2 || attrib.data->type == cgltf_type_vec3) && "Texture coordinate not in the right format, float2 required");
-								assert(attrib.index < 3 && "Don't support more than 3 texture coordinate sets");
-								current_index = static_cast<rhi::BufferSemantic>(ror::enum_to_type_cast(rhi::BufferSemantic::vertex_texture_coord_0) << static_cast<uint64_t>(attrib.index));
-								break;
-							case cgltf_attribute_type::cgltf_attribute_type_color:
-								assert((attrib.data->component_type == cgltf_component_type_r_32f || attrib.data->component_type == cgltf_component_type_r_8u) &&
-								       (attrib.data->type == cgltf_type_vec3 || attrib.data->type == cgltf_type_vec4) && "Color not in the right format, float3 required");
-								assert(attrib.index < 2 && "Don't support more than 2 color sets");
-								current_index = static_cast<rhi::BufferSemantic>(ror::enum_to_type_cast(rhi::BufferSemantic::vertex_color_0) << static_cast<uint64_t>(attrib.index));
-								break;
-							case cgltf_attribute_type::cgltf_attribute_type_joints:
-								assert((attrib.data->component_type == cgltf_component_type_r_32u || attrib.data->component_type == cgltf_component_type_r_16u || attrib.data->component_type == cgltf_component_type_r_8u) &&
-								       attrib.data->type == cgltf_type_vec4 && "Joints not in the right format, unsigned8/16_4 required");
-								assert(attrib.index < 2 && "Don't support more than 2 joint sets");
-								current_index = static_cast<rhi::BufferSemantic>(ror::enum_to_type_cast(rhi::BufferSemantic::vertex_bone_id_0) << static_cast<uint64_t>(attrib.index));
-								break;
-							case cgltf_attribute_type::cgltf_attribute_type_weights:
-								assert((attrib.data->component_type == cgltf_component_type_r_32f || attrib.data->component_type == cgltf_component_type_r_16u || attrib.data->component_type == cgltf_component_type_r_8u) &&
-								       attrib.data->type == cgltf_type_vec4 && "Weights not in the right format, unsigned_8/16/float_4 required");
-								assert(attrib.index < 2 && "Don't support more than 2 weight sets");
-								current_index = static_cast<rhi::BufferSemantic>(ror::enum_to_type_cast(rhi::BufferSemantic::vertex_weight_0) << static_cast<uint64_t>(attrib.index));
-								break;
-							case cgltf_attribute_type::cgltf_attribute_type_invalid:
-							case cgltf_attribute_type::cgltf_attribute_type_custom:
-							case cgltf_attribute_type::cgltf_attribute_type_max_enum:
-								assert(0 && "rhi::BufferView not valid yet");
-								break;
-						}
+				if (cprim.has_draco_mesh_compression)
+					ror::log_critical("Mesh has draco mesh compression but its not supported");
 
-						// TODO: GL expects stride to be zero if data is tightly packed
-						// NOTE: cgltf buffer_view->stride vs accessor->stride notes
-						// If buffer_view is valid and has a stride and not zero (0), accessor->stride == buffer_view->stride
-						// If buffer_view does not have a stride or its zero. accessor->stride is calculated from format byte size * number of components
-						// What this means is that if (buffer_view->stride == 0) it means tightly packed data, use accessor->stride as stride from one element to another
-						// If buffer->view->stride != 0 that means not-tightly packed data, stride is accessor->stride which is equal to buffer_view->stride
-						// This buffer_view->stride is only valid for attributes or if enabled by extensions
-
-						const auto *attrib_accessor  = attrib.data;
-						auto        attrib_format    = get_format_from_gltf_type_format(attrib_accessor->type, attrib_accessor->component_type);
-						auto        buffer_index     = find_safe_index(buffer_to_index, attrib_accessor->buffer_view->buffer);
-						auto        attrib_byte_size = cgltf_calc_size(attrib_accessor->type, attrib_accessor->component_type);
-						auto        stride           = attrib_accessor->buffer_view->stride;
-						auto        offset           = attrib_accessor->buffer_view->offset + attrib_accessor->offset;
+				if (cprim.material)
+					mesh.material(j, find_safe_index(material_to_index, cprim.material));
+				else
+					mesh.material(j, 0);
 
-						if (stride == 0)
-							stride = attrib_byte_size;
+				mesh.program(j, -1);
 
-						if (attrib_accessor->normalized)
-							ror::log_critical("Attribute accessor data is normalised but there is no support at the moment for normalised data");
+				// Read all other vertex attributes
+				for (size_t k = 0; k < cprim.attributes_count; ++k)
+				{
+					const cgltf_attribute &attrib = cprim.attributes[k];
 
-						assert(buffer_index >= 0 && "Not a valid buffer index returned, possibly no buffer associated with this attribute");
-						uint8_t *data_pointer = reinterpret_cast<uint8_t *>(this->m_buffers[static_cast<size_t>(buffer_index)].data());
+					assert(attrib.data->buffer_view && "rhi::BufferView doesn't have a valid buffer view");
 
-						// Special consideration to weights, here we are normalizing them
-						if (attrib.type == cgltf_attribute_type_weights)
-						{
-							assert(attrib.index >= 0 && attrib.index < 2 && "Attribute index out of bounds");
-							offset     = 0;
-							stride     = attrib_byte_size;
-							auto index = static_cast<size_t>(attrib.index);
+					if (attrib.data->is_sparse)
+						ror::log_critical("Don't support sparse attribute accessors");
 
-							if (attrib_format == rhi::Format::float32_4)
-							{
-								weights_float32_pointer[index] = unpack_normalized<float32_t>(attrib_accessor);
-								data_pointer                   = reinterpret_cast<uint8_t *>(weights_float32_pointer[index].data());
-							}
-							else if (attrib_format == rhi::Format::uint16_4)
-							{
-								weights_uint16_pointer[index] = unpack_normalized<uint16_t>(attrib_accessor);
-								data_pointer                  = reinterpret_cast<uint8_t *>(weights_uint16_pointer[index].data());
-							}
-							else if (attrib_format == rhi::Format::uint8_4)
-							{
-								weights_uint8_pointer[index] = unpack_normalized<uint8_t>(attrib_accessor);
-								data_pointer                 = reinterpret_cast<uint8_t *>(weights_uint8_pointer[index].data());
-							}
-							else
+					rhi::BufferSemantic current_index = rhi::BufferSemantic::vertex_position;
+
+					switch (attrib.type)
+					{
+						case cgltf_attribute_type::cgltf_attribute_type_position:
+							assert(attrib.data->has_min && attrib.data->has_max && "Position attributes must provide min and max");
+							assert(attrib.index == 0 && "Don't suport more than 1 position");
+
+							current_index = rhi::BufferSemantic::vertex_position;
 							{
-								assert(0 && "Shouldn't reach here, can't have any other type of weights");
+								auto &mesh_bbox = mesh.bounding_box(j);
+								mesh_bbox.create_from_min_max({attrib.data->min[0], attrib.data->min[1], attrib.data->min[2]},
+								                              {attrib.data->max[0], attrib.data->max[1], attrib.data->max[2]});
 							}
-						}
+							break;
+						case cgltf_attribute_type::cgltf_attribute_type_normal:
+							assert((attrib.data->component_type == cgltf_component_type_r_32f || attrib.data->component_type == cgltf_component_type_r_8) &&
+							       (attrib.data->type == cgltf_type_vec3 || attrib.data->type == cgltf_type_vec2) && "Normal not in the right format, float3 required");
+							assert(attrib.index == 0 && "Don't suport more than 1 normal");
+							current_index = rhi::BufferSemantic::vertex_normal;
+							break;
+						case cgltf_attribute_type::cgltf_attribute_type_tangent:
+							assert((attrib.data->component_type == cgltf_component_type_r_32f || attrib.data->component_type == cgltf_component_type_r_8) &&
+							       (attrib.data->type == cgltf_type_vec4) && "Tangent not in the right format, float4 required");        // If its 3D only need to add w=[+1, -1] to denote handedness
+							assert(attrib.index == 0 && "Don't suport more than 1 tangent");
+							current_index = rhi::BufferSemantic::vertex_tangent;
+							break;
+						case cgltf_attribute_type::cgltf_attribute_type_texcoord:
+							assert((attrib.data->component_type == cgltf_component_type_r_32f || attrib.data->component_type == cgltf_component_type_r_16u) &&
+							       (attrib.data->type == cgltf_type_vec2 || attrib.data->type == cgltf_type_vec3) && "Texture coordinate not in the right format, float2 required");
+							assert(attrib.index < 3 && "Don't support more than 3 texture coordinate sets");
+							current_index = static_cast<rhi::BufferSemantic>(ror::enum_to_type_cast(rhi::BufferSemantic::vertex_texture_coord_0) << static_cast<uint64_t>(attrib.index));
+							break;
+						case cgltf_attribute_type::cgltf_attribute_type_color:
+							assert((attrib.data->component_type == cgltf_component_type_r_32f || attrib.data->component_type == cgltf_component_type_r_8u) &&
+							       (attrib.data->type == cgltf_type_vec3 || attrib.data->type == cgltf_type_vec4) && "Color not in the right format, float3 required");
+							assert(attrib.index < 2 && "Don't support more than 2 color sets");
+							current_index = static_cast<rhi::BufferSemantic>(ror::enum_to_type_cast(rhi::BufferSemantic::vertex_color_0) << static_cast<uint64_t>(attrib.index));
+							break;
+						case cgltf_attribute_type::cgltf_attribute_type_joints:
+							assert((attrib.data->component_type == cgltf_component_type_r_32u || attrib.data->component_type == cgltf_component_type_r_16u || attrib.data->component_type == cgltf_component_type_r_8u) &&
+							       attrib.data->type == cgltf_type_vec4 && "Joints not in the right format, unsigned8/16_4 required");
+							assert(attrib.index < 2 && "Don't support more than 2 joint sets");
+							current_index = static_cast<rhi::BufferSemantic>(ror::enum_to_type_cast(rhi::BufferSemantic::vertex_bone_id_0) << static_cast<uint64_t>(attrib.index));
+							break;
+						case cgltf_attribute_type::cgltf_attribute_type_weights:
+							assert((attrib.data->component_type == cgltf_component_type_r_32f || attrib.data->component_type == cgltf_component_type_r_16u || attrib.data->component_type == cgltf_component_type_r_8u) &&
+							       attrib.data->type == cgltf_type_vec4 && "Weights not in the right format, unsigned_8/16/float_4 required");
+							assert(attrib.index < 2 && "Don't support more than 2 weight sets");
+							current_index = static_cast<rhi::BufferSemantic>(ror::enum_to_type_cast(rhi::BufferSemantic::vertex_weight_0) << static_cast<uint64_t>(attrib.index));
+							break;
+						case cgltf_attribute_type::cgltf_attribute_type_invalid:
+						case cgltf_attribute_type::cgltf_attribute_type_custom:
+						case cgltf_attribute_type::cgltf_attribute_type_max_enum:
+							assert(0 && "rhi::BufferView not valid yet");
+							break;
+					}
 
-						std::tuple<uint8_t *, uint32_t, uint32_t> data_tuple{data_pointer + offset, attrib_accessor->count * attrib_byte_size, stride};
-						attribs_data.emplace(current_index, std::move(data_tuple));
+					// TODO: GL expects stride to be zero if data is tightly packed
+					// NOTE: cgltf buffer_view->stride vs accessor->stride notes
+					// If buffer_view is valid and has a stride and not zero (0), accessor->stride == buffer_view->stride
+					// If buffer_view does not have a stride or its zero. accessor->stride is calculated from format byte size * number of components
+					// What this means is that if (buffer_view->stride == 0) it means tightly packed data, use accessor->stride as stride from one element to another
+					// If buffer->view->stride != 0 that means not-tightly packed data, stride is accessor->stride which is equal to buffer_view->stride
+					// This buffer_view->stride is only valid for attributes or if enabled by extensions
 
-						vertex_attribute_descriptor.add(current_index, attrib_format, &a_buffers_pack);
+					const auto *attrib_accessor = attrib.data;
+					auto        attrib_format   = get_format_from_gltf_type_format(attrib_accessor->type, attrib_accessor->component_type);
+					auto        vertex_format   = quantize ? quantized_vertex_format(current_index, attrib_format) : attrib_format;        // Cold loads convert the stream in quantize_decoded_primitive()
+
+					if (model_cache.warm())
+					{
+						decoded_attributes.m_streams.push_back({current_index});
+						vertex_attribute_descriptor.add(current_index, vertex_format, &a_buffers_pack);
+						continue;
 					}
 
-					// Read vertex indices buffer
-					std::vector<uint16_t> index_data_pointer{};
-					if (cprim.indices)
+					auto buffer_index     = find_safe_index(buffer_to_index, attrib_accessor->buffer_view->buffer);
+					auto attrib_byte_size = cgltf_calc_size(attrib_accessor->type, attrib_accessor->component_type);
+					auto stride           = attrib_accessor->buffer_view->stride;
+					auto offset           = attrib_accessor->buffer_view->offset + attrib_accessor->offset;
+
+					if (stride == 0)
+						stride = attrib_byte_size;
+
+					if (attrib_accessor->normalized)
+						ror::log_critical("Attribute accessor data is normalised but there is no support at the moment for normalised data");
+
+					assert(buffer_index >= 0 && "Not a valid buffer index returned, possibly no buffer associated with this attribute");
+					uint8_t *data_pointer = gltf_buffer_data(this->m_buffers[static_cast<size_t>(buffer_index)]);
+
+					// Special consideration to weights, here we are normalizing them
+					if (attrib.type == cgltf_attribute_type_weights)
 					{
-						assert(cprim.indices->type == cgltf_type_scalar && "Indices are not the right type, only SCALAR indices supported");
-						assert((cprim.indices->component_type == cgltf_component_type_r_32u || cprim.indices->component_type == cgltf_component_type_r_16u || cprim.indices->component_type == cgltf_component_type_r_8u) &&
-						       "Indices are not in the right component type , only uint8_t, uint16_t and uint32_t supported");
+						assert(attrib.index >= 0 && attrib.index < 2 && "Attribute index out of bounds");
+						offset     = 0;
+						stride     = attrib_byte_size;
+						auto index = static_cast<size_t>(attrib.index);
 
-						assert(cprim.indices->buffer_view && "Indices doesn't have a valid buffer view");
-						// assert(cprim.indices->buffer_view->type == cgltf_buffer_view_type_indices && "Indices buffer view type is wrong"); type is always invalid, because no such thing in bufferView in glTF
+						if (attrib_format == rhi::Format::float32_4)
+						{
+							decoded.m_weights_float32[index] = unpack_normalized<float32_t>(attrib_accessor);
+							data_pointer                     = reinterpret_cast<uint8_t *>(decoded.m_weights_float32[index].data());
+						}
+						else if (attrib_format == rhi::Format::uint16_4)
+						{
+							decoded.m_weights_uint16[index] = unpack_normalized<uint16_t>(attrib_accessor);
+							data_pointer                    = reinterpret_cast<uint8_t *>(decoded.m_weights_uint16[index].data());
+						}
+						else if (attrib_format == rhi::Format::uint8_4)
+						{
+							decoded.m_weights_uint8[index] = unpack_normalized<uint8_t>(attrib_accessor);
+							data_pointer                   = reinterpret_cast<uint8_t *>(decoded.m_weights_uint8[index].data());
+						}
+						else
+						{
+							assert(0 && "Shouldn't reach here, can't have any other type of weights");
+						}
+					}
 
-						if (cprim.indices->buffer_view->has_meshopt_compression)
-							ror::log_critical("Mesh has meshopt_compression but its not supported");
+					decoded_attributes.m_streams.push_back({current_index, data_pointer + offset, static_cast_safe<uint32_t>(attrib_byte_size), static_cast_safe<uint32_t>(attrib_accessor->count), static_cast_safe<uint32_t>(stride)});
 
-						mesh.has_indices(j, true);
+					vertex_attribute_descriptor.add(current_index, vertex_format, &a_buffers_pack);
+				}
+
+				// Read vertex indices buffer
+				if (cprim.indices)
+				{
+					assert(cprim.indices->type == cgltf_type_scalar && "Indices are not the right type, only SCALAR indices supported");
+					assert((cprim.indices->component_type == cgltf_component_type_r_32u || cprim.indices->component_type == cgltf_component_type_r_16u || cprim.indices->component_type == cgltf_component_type_r_8u) &&
+					       "Indices are not in the right component type , only uint8_t, uint16_t and uint32_t supported");
 
-						auto index_format = get_format_from_gltf_type_format(cprim.indices->type, cprim.indices->component_type);
+					assert(cprim.indices->buffer_view && "Indices doesn't have a valid buffer view");
+					// assert(cprim.indices->buffer_view->type == cgltf_buffer_view_type_indices && "Indices buffer view type is wrong"); type is always invalid, because no such thing in bufferView in glTF
 
+					if (cprim.indices->buffer_view->has_meshopt_compression)
+						ror::log_critical("Mesh has meshopt_compression but its not supported");
+
+					decoded.m_has_indices = true;
+
+					auto index_format = get_format_from_gltf_type_format(cprim.indices->type, cprim.indices->component_type);
+
+					// Optimised indices never exceed the vertex count so uint32_t indices fit in uint16_t if the vertices do
+					auto vertex_count = cprim.attributes_count ? cprim.attributes[0].data->count : 0;
+					if (optimize && index_format == rhi::Format::uint32_1 && vertex_count <= std::numeric_limits<uint16_t>::max() + 1u)
+						narrow_indices = true;
+
+					if (model_cache.warm())
+					{
+						// uint8_t indices are cooked already unpacked to uint16_t
+						if (index_format == rhi::Format::uint8_1)
+							index_format = rhi::Format::uint16_1;
+
+						decoded_attributes.m_streams.push_back({rhi::BufferSemantic::vertex_index});
+					}
+					else
+					{
 						// TODO: GL expects stride to be zero if data is tightly packed
 						assert(!cprim.indices->is_sparse && "Sparse index buffers not supported");
 
@@ -1691,155 +2252,241 @@ void Model::load_from_gltf_file(std::filesystem::path a_filename, std::vector<ro
 
 						if (index_format == rhi::Format::uint8_1)
 						{
-							index_data_pointer = unpack_uint8_to_uint16(cprim.indices);
-							indices_byte_size  = sizeof(uint16_t);
-							index_format       = rhi::Format::uint16_1;
-							offset             = 0;
-							stride             = indices_byte_size;
+							decoded.m_indices = unpack_uint8_to_uint16(cprim.indices);
+							indices_byte_size = sizeof(uint16_t);
+							index_format      = rhi::Format::uint16_1;
+							offset            = 0;
+							stride            = indices_byte_size;
 						}
-						uint8_t *data_pointer = (index_data_pointer.size() ? reinterpret_cast<uint8_t *>(index_data_pointer.data()) : reinterpret_cast<uint8_t *>(this->m_buffers[static_cast<size_t>(buffer_index)].data()));
+						uint8_t *data_pointer = (decoded.m_indices.size() ? reinterpret_cast<uint8_t *>(decoded.m_indices.data()) : gltf_buffer_data(this->m_buffers[static_cast<size_t>(buffer_index)]));
 
-						std::tuple<uint8_t *, uint32_t, uint32_t> data_tuple{data_pointer + offset, attrib_accessor->count * indices_byte_size, stride};
-						attribs_data.emplace(rhi::BufferSemantic::vertex_index, std::move(data_tuple));
-
-						vertex_attribute_descriptor.add(rhi::BufferSemantic::vertex_index, index_format, &a_buffers_pack);
+						decoded_attributes.m_streams.push_back({rhi::BufferSemantic::vertex_index, data_pointer + offset, static_cast_safe<uint32_t>(indices_byte_size), static_cast_safe<uint32_t>(attrib_accessor->count), static_cast_safe<uint32_t>(stride)});
 					}
-					else
-						mesh.has_indices(j, false);
 
-					// Now upload data from all the attributes into vertex_attribute_descriptor
-					vertex_attribute_descriptor.upload(attribs_data, &a_buffers_pack);
+					// Cold loads narrow them in optimize_decoded_primitive(), warm loads get them narrowed from the cooked data
+					if (narrow_indices)
+						index_format = rhi::Format::uint16_1;
 
-					// Read morph targets
-					for (size_t k = 0; k < cprim.targets_count; ++k)
+					vertex_attribute_descriptor.add(rhi::BufferSemantic::vertex_index, index_format, &a_buffers_pack);
+				}
+
+				// Read morph targets
+				morph_target_vertex_attribute_descriptor.reserve(cprim.targets_count);
+				for (size_t k = 0; k < cprim.targets_count; ++k)
+				{
+					const cgltf_morph_target &target = cprim.targets[k];
+
+					auto &decoded_target = decoded.m_descriptors.emplace_back();
+
+					rhi::VertexDescriptor target_vertex_descriptor{};
+					for (size_t l = 0; l < target.attributes_count; ++l)
 					{
-						const cgltf_morph_target &target = cprim.targets[k];
+						const cgltf_attribute &attrib = target.attributes[l];
+
+						if (attrib.data->is_sparse)
+							ror::log_critical("Don't support sparse attribute accessors");
 
-						std::unordered_map<rhi::BufferSemantic, std::tuple<uint8_t *, uint32_t, uint32_t>> morph_targets_attribs_data;
+						assert(attrib.data->buffer_view && "rhi::BufferView doesn't have a valid buffer view");
+						rhi::BufferSemantic current_index = rhi::BufferSemantic::vertex_position;
 
-						rhi::VertexDescriptor target_vertex_descriptor{};
-						for (size_t l = 0; l < target.attributes_count; ++l)
+						switch (attrib.type)
 						{
-							const cgltf_attribute &attrib = target.attributes[l];
+							case cgltf_attribute_type::cgltf_attribute_type_position:
+								assert(attrib.data->has_min && attrib.data->has_max && "Position attributes must provide min and max");
 
-							if (attrib.data->is_sparse)
-								ror::log_critical("Don't support sparse attribute accessors");
+								current_index = rhi::BufferSemantic::vertex_position;
+								{
+									ror::BoundingBoxf total_bbox;
 
-							assert(attrib.data->buffer_view && "rhi::BufferView doesn't have a valid buffer view");
-							rhi::BufferSemantic current_index = rhi::BufferSemantic::vertex_position;
+									total_bbox.create_from_min_max({attrib.data->min[0], attrib.data->min[1], attrib.data->min[2]},
+									                               {attrib.data->max[0], attrib.data->max[1], attrib.data->max[2]});
 
-							switch (attrib.type)
-							{
-								case cgltf_attribute_type::cgltf_attribute_type_position:
-									assert(attrib.data->has_min && attrib.data->has_max && "Position attributes must provide min and max");
-
-									current_index = rhi::BufferSemantic::vertex_position;
-									{
-										ror::BoundingBoxf total_bbox;
-
-										total_bbox.create_from_min_max({attrib.data->min[0], attrib.data->min[1], attrib.data->min[2]},
-										                               {attrib.data->max[0], attrib.data->max[1], attrib.data->max[2]});
-
-										// Not actually precise bounding box will do for now
-										auto &mesh_bbox = mesh.bounding_box(j);
-										mesh_bbox.add_bounding(total_bbox);
-									}
-									break;
-								case cgltf_attribute_type::cgltf_attribute_type_normal:
-									assert((attrib.data->component_type == cgltf_component_type_r_32f || attrib.data->component_type == cgltf_component_type_r_8) &&
-									       (attrib.data->type == cgltf_type_vec3 || attrib.data->type == cgltf_type_vec2) && "Normal not in the right format");
-									current_index = rhi::BufferSemantic::vertex_normal;
-									break;
-								case cgltf_attribute_type::cgltf_attribute_type_tangent:
-									assert((attrib.data->component_type == cgltf_component_type_r_32f || attrib.data->component_type == cgltf_component_type_r_8) &&
-									       (attrib.data->type == cgltf_type_vec4 || attrib.data->type == cgltf_type_vec3) && "Tangent not in the right format");
-									current_index = rhi::BufferSemantic::vertex_tangent;
-									break;
-								case cgltf_attribute_type::cgltf_attribute_type_texcoord:
-								case cgltf_attribute_type::cgltf_attribute_type_color:
-								case cgltf_attribute_type::cgltf_attribute_type_joints:
-								case cgltf_attribute_type::cgltf_attribute_type_weights:
-								case cgltf_attribute_type::cgltf_attribute_type_invalid:
-								case cgltf_attribute_type::cgltf_attribute_type_custom:
-								case cgltf_attribute_type::cgltf_attribute_type_max_enum:
-									assert(0 && "Morph target not supported for this attribute");
-									break;
-							}
+									// Not actually precise bounding box will do for now
+									auto &mesh_bbox = mesh.bounding_box(j);
+									mesh_bbox.add_bounding(total_bbox);
+								}
+								break;
+							case cgltf_attribute_type::cgltf_attribute_type_normal:
+								assert((attrib.data->component_type == cgltf_component_type_r_32f || attrib.data->component_type == cgltf_component_type_r_8) &&
+								       (attrib.data->type == cgltf_type_vec3 || attrib.data->type == cgltf_type_vec2) && "Normal not in the right format");
+								current_index = rhi::BufferSemantic::vertex_normal;
+								break;
+							case cgltf_attribute_type::cgltf_attribute_type_tangent:
+								assert((attrib.data->component_type == cgltf_component_type_r_32f || attrib.data->component_type == cgltf_component_type_r_8) &&
+								       (attrib.data->type == cgltf_type_vec4 || attrib.data->type == cgltf_type_vec3) && "Tangent not in the right format");
+								current_index = rhi::BufferSemantic::vertex_tangent;
+								break;
+							case cgltf_attribute_type::cgltf_attribute_type_texcoord:
+							case cgltf_attribute_type::cgltf_attribute_type_color:
+							case cgltf_attribute_type::cgltf_attribute_type_joints:
+							case cgltf_attribute_type::cgltf_attribute_type_weights:
+							case cgltf_attribute_type::cgltf_attribute_type_invalid:
+							case cgltf_attribute_type::cgltf_attribute_type_custom:
+							case cgltf_attribute_type::cgltf_attribute_type_max_enum:
+								assert(0 && "Morph target not supported for this attribute");
+								break;
+						}
 
-							// TODO: GL expects stride to be zero if data is tightly packed
+						// TODO: GL expects stride to be zero if data is tightly packed
 
-							const auto *attrib_accessor  = attrib.data;
-							auto        attrib_format    = get_format_from_gltf_type_format(attrib_accessor->type, attrib_accessor->component_type);
-							auto        buffer_index     = find_safe_index(buffer_to_index, attrib_accessor->buffer_view->buffer);
-							auto        attrib_byte_size = cgltf_calc_size(attrib_accessor->type, attrib_accessor->component_type);
-							auto        stride           = attrib_accessor->buffer_view->stride;
-							auto        offset           = attrib_accessor->buffer_view->offset + attrib_accessor->offset;
+						const auto *attrib_accessor = attrib.data;
+						auto        attrib_format   = get_format_from_gltf_type_format(attrib_accessor->type, attrib_accessor->component_type);
 
-							if (stride == 0)
-								stride = attrib_byte_size;
+						if (model_cache.warm())
+						{
+							decoded_target.m_streams.push_back({current_index});
+							target_vertex_descriptor.add(current_index, attrib_format, &a_buffers_pack);
+							continue;
+						}
 
-							if (attrib_accessor->normalized)
-								ror::log_critical("Attribute morph taget data is normalised but there is no support at the moment for normalised data");
+						auto buffer_index     = find_safe_index(buffer_to_index, attrib_accessor->buffer_view->buffer);
+						auto attrib_byte_size = cgltf_calc_size(attrib_accessor->type, attrib_accessor->component_type);
+						auto stride           = attrib_accessor->buffer_view->stride;
+						auto offset           = attrib_accessor->buffer_view->offset + attrib_accessor->offset;
 
-							assert(buffer_index >= 0 && "Not a valid buffer index returned, possibly no buffer associated with this morph target attribute");
-							uint8_t *data_pointer = reinterpret_cast<uint8_t *>(this->m_buffers[static_cast<size_t>(buffer_index)].data());
+						if (stride == 0)
+							stride = attrib_byte_size;
 
-							std::tuple<uint8_t *, uint32_t, uint32_t> data_tuple{data_pointer + offset, attrib_accessor->count * attrib_byte_size, stride};
+						if (attrib_accessor->normalized)
+							ror::log_critical("Attribute morph taget data is normalised but there is no support at the moment for normalised data");
 
-							morph_targets_attribs_data.emplace(current_index, std::move(data_tuple));
+						assert(buffer_index >= 0 && "Not a valid buffer index returned, possibly no buffer associated with this morph target attribute");
+						uint8_t *data_pointer = gltf_buffer_data(this->m_buffers[static_cast<size_t>(buffer_index)]);
 
-							target_vertex_descriptor.add(current_index, attrib_format, &a_buffers_pack);
-						}
+						decoded_target.m_streams.push_back({current_index, data_pointer + offset, static_cast_safe<uint32_t>(attrib_byte_size), static_cast_safe<uint32_t>(attrib_accessor->count), static_cast_safe<uint32_t>(stride)});
 
-						// Now copy all the buffer_views for morph_targets
-						target_vertex_descriptor.upload(morph_targets_attribs_data, &a_buffers_pack);
-						morph_target_vertex_attribute_descriptor.emplace_back(std::move(target_vertex_descriptor));
+						target_vertex_descriptor.add(current_index, attrib_format, &a_buffers_pack);
 					}
 
-					// By now each attribute and morph target attributes are loaded, lets update the locations in morph target attributes
-					uint32_t location_offset = 0;
-					if (!vertex_attribute_descriptor.attributes().empty())
-					{
-						const auto &att = vertex_attribute_descriptor.attributes().back();
+					decoded_target.m_descriptor = &morph_target_vertex_attribute_descriptor.emplace_back(std::move(target_vertex_descriptor));
+				}
 
-						// Its +1 than the last attribute in the list, but if last attribute was vertex_index we use its location instead
-						auto location = att.location();
-						if (att.semantics() == rhi::BufferSemantic::vertex_index)
-							location_offset = location;
-						else
-							location_offset = location + 1;
+				// By now each attribute and morph target attributes are loaded, lets update the locations in morph target attributes
+				uint32_t location_offset = 0;
+				if (!vertex_attribute_descriptor.attributes().empty())
+				{
+					const auto &att = vertex_attribute_descriptor.attributes().back();
+
+					// Its +1 than the last attribute in the list, but if last attribute was vertex_index we use its location instead
+					auto location = att.location();
+					if (att.semantics() == rhi::BufferSemantic::vertex_index)
+						location_offset = location;
+					else
+						location_offset = location + 1;
+				}
+
+				for (auto &morph_vertex_descriptor : morph_target_vertex_attribute_descriptor)
+				{
+					auto &morph_attributes = morph_vertex_descriptor.attributes();
+					for (auto &morph_attribute : morph_attributes)
+					{
+						morph_attribute.location(morph_attribute.location() + location_offset);
 					}
+					if (!morph_attributes.empty())
+					{
+						auto location   = morph_attributes.back().location();
+						location_offset = location + 1;
+					}
+				}
 
-					for (auto &morph_vertex_descriptor : morph_target_vertex_attribute_descriptor)
+				assert(cmesh.weights_count == cprim.targets_count && "Targets count and weights don't match data error");
+
+				if (optimize && !model_cache.warm())
+					optimize_decoded_primitive(decoded, narrow_indices);
+
+				if (quantize && !model_cache.warm())
+					quantize_decoded_primitive(decoded, mesh.position_bounds());
+			};
+
+			auto primitives_count   = static_cast_safe<uint32_t>(primitives.size());
+			auto for_each_primitive = [&](auto &&a_function) {
+#if defined(USE_JS)
+				if (ror::settings().m_parallel_model_decode)
+				{
+					js.parallel_for(0u, primitives_count, a_function);
+					return;
+				}
+#endif
+				for (uint32_t index = 0; index < primitives_count; ++index)
+					a_function(index);
+			};
+
+			for_each_primitive(decode_primitive);
+
+			// Merge in mesh and primitive order, that's the order streams are cooked in and space is allocated in the buffers
+			for (uint32_t index = 0; index < primitives_count; ++index)
+			{
+				auto [i, j]   = primitives[index];
+				auto &mesh    = this->m_meshes[i];
+				auto &decoded = decoded_primitives[index];
+
+				mesh.has_indices(j, decoded.m_has_indices);        // Not written by the decode jobs because its a std::vector<bool>
+
+				for (auto &decoded_descriptor : decoded.m_descriptors)
+				{
+					for (auto &stream : decoded_descriptor.m_streams)
 					{
-						auto &morph_attributes = morph_vertex_descriptor.attributes();
-						for (auto &morph_attribute : morph_attributes)
-						{
-							morph_attribute.location(morph_attribute.location() + location_offset);
-						}
-						if (!morph_attributes.empty())
+						if (model_cache.warm())
 						{
-							auto location   = morph_attributes.back().location();
-							location_offset = location + 1;
+							decoded_descriptor.m_attributes_data.emplace(stream.m_semantic, model_cache.next(stream.m_semantic));
+							continue;
 						}
+
+						if (cook_model)
+							model_cache.record(stream.m_semantic, stream.m_data, stream.m_element_size, stream.m_count, stream.m_stride);
+
+						std::tuple<uint8_t *, uint32_t, uint32_t> data_tuple{stream.m_data, stream.m_count * stream.m_element_size, stream.m_stride};
+						decoded_descriptor.m_attributes_data.emplace(stream.m_semantic, std::move(data_tuple));
 					}
 
-					// Save Morph target weights
-					assert(cmesh.weights_count == cprim.targets_count && "Targets count and weights don't match data error");
-					auto &mesh_weights = mesh.weights();
-					mesh_weights.resize(cmesh.weights_count);
+					decoded_descriptor.m_descriptor->allocate(decoded_descriptor.m_attributes_data, &a_buffers_pack);
+				}
 
-					// TODO: Do a bulk copy please once tested and it works
-					for (size_t m = 0; m < cmesh.weights_count; ++m)
-						mesh_weights[m] = cmesh.weights[m];
+				// Levels of detail are cooked after the streams of their primitive
+				if (decoded.m_has_lods)
+				{
+					auto &lods = mesh.lods(j);
+
+					if (model_cache.warm())
+					{
+						auto [data, size, stride] = model_cache.next(rhi::BufferSemantic::mesh_data);
+						(void) stride;
+
+						lods.resize(size / sizeof(MeshLod));
+						if (data)
+							std::memcpy(lods.data(), data, lods.size() * sizeof(MeshLod));
+					}
+					else
+					{
+						lods = std::move(decoded.m_lods);
 
-					// Add mesh primitive bounding box to the model bounding box
-					this->m_bounding_box.add_bounding(mesh.bounding_box(j));
+						if (cook_model)
+							model_cache.record(rhi::BufferSemantic::mesh_data, reinterpret_cast<const uint8_t *>(lods.data()), sizeof(MeshLod), static_cast_safe<uint32_t>(lods.size()), sizeof(MeshLod));
+					}
+
+					// The index buffer holds every level but draws use the full detail one unless a level is picked
+					assert(!lods.empty() && "Primitive with levels of detail has none");
+					if (!lods.empty())
+						mesh.vertex_descriptor(j).attribute(rhi::BufferSemantic::vertex_index).count(lods[0].m_index_count);
 				}
 
-				mesh_to_index.emplace(&cmesh, i);
+				// Add mesh primitive bounding box to the model bounding box
+				this->m_bounding_box.add_bounding(mesh.bounding_box(j));
 			}
 
+			for (uint32_t i = 0; i < data->meshes_count; ++i)
+				mesh_to_index.emplace(&data->meshes[i], i);
+
+			// All allocations are done so buffers won't grow anymore while the jobs copy into them
+			for_each_primitive([&decoded_primitives, &a_buffers_pack](uint32_t a_index) {
+				auto &decoded = decoded_primitives[a_index];
+
+				for (auto &decoded_descriptor : decoded.m_descriptors)
+					decoded_descriptor.m_descriptor->fill(decoded_descriptor.m_attributes_data, &a_buffers_pack);
+
+				decoded = DecodedPrimitive{};        // Unpacked data isn't needed anymore
+			});
+
 			// Read all the nodes
 			this->m_nodes.resize(data->nodes_count);                  // Will fill the empty Node just created later
 			this->m_nodes_side_data.resize(data->nodes_count);        // Will fill the empty Node side data just created later
@@ -1900,10 +2547,19 @@ void Model::load_from_gltf_file(std::filesystem::path a_filename, std::vector<ro
 					auto *inverse_bind_matrices_accessor = cskin.inverse_bind_matrices;
 					auto &bind_matrices                  = skin.inverse_bind_matrices();
 					bind_matrices.resize(cskin.inverse_bind_matrices->count);
-					// TODO: Do this unpacking manually, there is a lot of overhead of doing it this way
-					cgltf_accessor_unpack_floats(inverse_bind_matrices_accessor,
-					                             reinterpret_cast<cgltf_float *>(bind_matrices.data()),
-					                             bind_matrices.size() * 16);
+
+					if (model_cache.warm())
+						read_cooked_stream(model_cache, rhi::BufferSemantic::skin_data, bind_matrices.data(), bind_matrices.size() * sizeof(ror::Matrix4f));
+					else
+					{
+						// TODO: Do this unpacking manually, there is a lot of overhead of doing it this way
+						cgltf_accessor_unpack_floats(inverse_bind_matrices_accessor,
+						                             reinterpret_cast<cgltf_float *>(bind_matrices.data()),
+						                             bind_matrices.size() * 16);
+
+						if (cook_model)
+							model_cache.record(rhi::BufferSemantic::skin_data, reinterpret_cast<const uint8_t *>(bind_matrices.data()), sizeof(ror::Matrix4f), static_cast_safe<uint32_t>(bind_matrices.size()), sizeof(ror::Matrix4f));
+					}
 				}
 
 				auto &joints = skin.joints();
@@ -2059,9 +2715,19 @@ void Model::load_from_gltf_file(std::filesystem::path a_filename, std::vector<ro
 						animation_sampler.m_input.resize(anim_sampler_accessor->count);        // Don't need to multiply attrib_byte_size because m_input is float32_t
 						animation_sampler.m_minimum.m_value = anim_sampler_accessor->min[0];
 						animation_sampler.m_maximum.m_value = anim_sampler_accessor->max[0];
-						cgltf_accessor_unpack_floats(anim_sampler_accessor,
-						                             reinterpret_cast<cgltf_float *>(animation_sampler.m_input.data()),
-						                             animation_sampler.m_input.size());
+
+						auto input_size = animation_sampler.m_input.size() * sizeof(Animation::AnimationInput);
+						if (model_cache.warm())
+							read_cooked_stream(model_cache, rhi::BufferSemantic::animation_input_data, animation_sampler.m_input.data(), input_size);
+						else
+						{
+							cgltf_accessor_unpack_floats(anim_sampler_accessor,
+							                             reinterpret_cast<cgltf_float *>(animation_sampler.m_input.data()),
+							                             animation_sampler.m_input.size());
+
+							if (cook_model)
+								model_cache.record(rhi::BufferSemantic::animation_input_data, reinterpret_cast<const uint8_t *>(animation_sampler.m_input.data()), static_cast_safe<uint32_t>(input_size), 1, static_cast_safe<uint32_t>(input_size));
+						}
 					}
 
 					{
@@ -2082,25 +2748,38 @@ void Model::load_from_gltf_file(std::filesystem::path a_filename, std::vector<ro
 
 						animation_sampler.m_output.resize(anim_sampler_accessor->count * sizeof(float32_t) * component_count);        // Using sizeof float32_t which is the same as sizeof uint32_t these are the two types allowed
 
+						auto output_size = animation_sampler.m_output.size();        // AnimationOutput is a byte
+
 						if (anim_sampler_accessor->component_type < cgltf_component_type_r_32f)
 						{
 							ror::log_critical("This format isn't supported in node_transform.glsl.comp, add support there");
 							// TODO: Don't cast to uint, use the provided precision
 							animation_sampler.m_output_format = int_format_to_int32_format_bit(format);        // Since we are casting everyting to uint lets adjust format accordingly
-							uint32_t *ptr_to_data             = reinterpret_cast<uint32_t *>(animation_sampler.m_output.data());
-							for (size_t index = 0; index < anim_sampler_accessor->count; ++index)
+
+							if (!model_cache.warm())
 							{
-								cgltf_accessor_read_uint(anim_sampler_accessor, index, ptr_to_data, component_size);
-								ptr_to_data += component_count;
+								uint32_t *ptr_to_data = reinterpret_cast<uint32_t *>(animation_sampler.m_output.data());
+								for (size_t index = 0; index < anim_sampler_accessor->count; ++index)
+								{
+									cgltf_accessor_read_uint(anim_sampler_accessor, index, ptr_to_data, component_size);
+									ptr_to_data += component_count;
+								}
 							}
 						}
 						else
 						{
 							animation_sampler.m_output_format = format;
-							cgltf_accessor_unpack_floats(anim_sampler_accessor,
-							                             reinterpret_cast<cgltf_float *>(animation_sampler.m_output.data()),
-							                             animation_sampler.m_output.size() / sizeof(float32_t));
+
+							if (!model_cache.warm())
+								cgltf_accessor_unpack_floats(anim_sampler_accessor,
+								                             reinterpret_cast<cgltf_float *>(animation_sampler.m_output.data()),
+								                             animation_sampler.m_output.size() / sizeof(float32_t));
 						}
+
+						if (model_cache.warm())
+							read_cooked_stream(model_cache, rhi::BufferSemantic::animation_output_data, animation_sampler.m_output.data(), output_size);
+						else if (cook_model)
+							model_cache.record(rhi::BufferSemantic::animation_output_data, reinterpret_cast<const uint8_t *>(animation_sampler.m_output.data()), static_cast_safe<uint32_t>(output_size), 1, static_cast_safe<uint32_t>(output_size));
 					}
 
 					switch (canimation.samplers[j].interpolation)
@@ -2172,7 +2851,7 @@ void Model::load_from_gltf_file(std::filesystem::path a_filename, std::vector<ro
 #if defined(USE_JS)
 		auto rest_of_data_load_handle = js.push_job(rest_of_data_load_lambda, buffers_load_handle.job());
 #else
-		rest_of_data_load_lambda();
+		auto data_load_success = rest_of_data_load_lambda();
 #endif
 
 #if defined(USE_JS)
@@ -2195,6 +2874,10 @@ void Model::load_from_gltf_file(std::filesystem::path a_filename, std::vector<ro
 		update_materials_textures_to_linear(this->m_materials, this->m_textures, this->m_images);
 
 #endif
+		// Everything is decoded by now, cook it so next time none of the buffers need loading
+		if (cook_model && !model_cache.warm() && data_load_success)
+			model_cache.save();
+
 		if (ror::settings().m_force_mipmapped_textures)
 			for (auto &t : this->m_textures)
 			{
@@ -2210,6 +2893,8 @@ void Model::load_from_gltf_file(std::filesystem::path a_filename, std::vector<ro
 				force_mipmaps(ti, ts);
 			}
 
+		// Views into base64 and glb buffers are about to dangle
+		this->m_buffers.clear();
 		cgltf_free(data);
 	}
 }
@@ -112,7 +112,7 @@ class ROAR_ENGINE_ITEM Model final
 	std::vector<ror::Node, rhi::BufferAllocator<ror::Node>>                     m_nodes{};                       //! All the nodes in this asset
 	std::vector<ror::NodeData, rhi::BufferAllocator<ror::NodeData>>             m_nodes_side_data{};             //! All the nodes parallel data that needs to be maintained
 	std::vector<ror::Animation, rhi::BufferAllocator<ror::Animation>>           m_animations{};                  //! All the animations in this asset
-	BinBuffer_Vector_Vector                                                     m_buffers{};                     //! All the buffers provided in gltf, only required temporarily
+	std::vector<bytes_span>                                                     m_buffers{};                     //! Views of all the buffers provided in gltf, into their mapped resources or cgltf's memory, only valid while loading
 	ror::BoundingBoxf                                                           m_bounding_box{};                //! Model bounding box, a combination of its mesh in object space
 	bool                                                                        m_generate_shaders{true};        //! Flag to determine if the model requires its shaders to be generated or these are provided,
 	                                                                                                             //! For instanced models to many nodes this will generate shaders for all nodes
@@ -0,0 +1,245 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "foundation/rorutilities.hpp"
+#include "graphics/rormodel_cache.hpp"
+#include "profiling/rorlog.hpp"
+#include "resources/rorresource.hpp"
+#include <cassert>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+
+namespace ror
+{
+namespace
+{
+constexpr uint32_t model_cache_magic{0x4D524F52};        // "RORM"
+constexpr uint32_t model_cache_version{5};               // Bump this whenever the loader changes what it records
+constexpr size_t   model_cache_alignment{16};            // Every stream starts 16 bytes aligned in the payload
+
+FORCE_INLINE size_t align_up(size_t a_value)
+{
+	return (a_value + model_cache_alignment - 1) & ~(model_cache_alignment - 1);
+}
+}        // namespace
+
+ModelCache::ModelCache(hash_64_t a_source_hash) :
+    m_source_hash(a_source_hash)
+{}
+
+std::filesystem::path ModelCache::path() const
+{
+	return get_cache_path() / "models" / (std::to_string(this->m_source_hash) + ".rorm");
+}
+
+bool ModelCache::warm() const noexcept
+{
+	return this->m_warm;
+}
+
+bool ModelCache::load()
+{
+	auto            blob_path = this->path();
+	std::error_code error;
+
+	if (!std::filesystem::exists(blob_path, error))
+		return false;
+
+	// The mapping is owned by the cached Resource and stays alive for the rest of the run
+	auto &resource = map_resource(blob_path, ResourceSemantic::caches);
+	auto  blob     = resource.data_span();
+
+	Header header{};
+	if (blob.size() < sizeof(Header))
+		return false;
+
+	std::memcpy(&header, blob.data(), sizeof(Header));
+
+	if (header.m_magic != model_cache_magic || header.m_version != model_cache_version || header.m_source_hash != this->m_source_hash)
+	{
+		ror::log_warn("Ignoring stale cooked model {}", blob_path.c_str());
+		return false;
+	}
+
+	auto table_size = header.m_streams_count * sizeof(Stream);
+	if (header.m_streams_count > blob.size() / sizeof(Stream) || sizeof(Header) + table_size > header.m_payload_offset || header.m_payload_offset > blob.size())
+	{
+		ror::log_critical("Cooked model {} is corrupt, it will be cooked again", blob_path.c_str());
+		return false;
+	}
+
+	this->m_streams.resize(header.m_streams_count);
+	std::memcpy(this->m_streams.data(), blob.data() + sizeof(Header), table_size);
+
+	auto payload_size = blob.size() - header.m_payload_offset;
+	for (auto &stream : this->m_streams)
+	{
+		if (stream.m_offset > payload_size || stream.m_size > payload_size - stream.m_offset)
+		{
+			ror::log_critical("Cooked model {} is corrupt, it will be cooked again", blob_path.c_str());
+			this->m_streams.clear();
+			return false;
+		}
+	}
+
+	this->m_payload_data = blob.data() + header.m_payload_offset;
+	this->m_cursor       = 0;
+	this->m_warm         = true;
+
+	return true;
+}
+
+bool ModelCache::save()
+{
+	assert(!this->m_warm && "Saving a model cache that was loaded from a blob");
+
+	auto            blob_path = this->path();
+	auto            temp_path = std::filesystem::path{blob_path}.concat(".tmp");
+	std::error_code error;
+
+	std::filesystem::create_directories(blob_path.parent_path(), error);
+
+	Header header{};
+	header.m_magic          = model_cache_magic;
+	header.m_version        = model_cache_version;
+	header.m_source_hash    = this->m_source_hash;
+	header.m_streams_count  = this->m_streams.size();
+	header.m_payload_offset = align_up(sizeof(Header) + this->m_streams.size() * sizeof(Stream));
+
+	// Written to a temporary and renamed so readers, including this process if the old blob is still mapped, never see a half written blob
+	{
+		std::ofstream blob_file(temp_path, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!blob_file.is_open())
+		{
+			ror::log_error("Can't open cooked model {} for writing", temp_path.c_str());
+			return false;
+		}
+
+		const char padding[model_cache_alignment]{};
+		auto       table_size = this->m_streams.size() * sizeof(Stream);
+
+		blob_file.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+		blob_file.write(reinterpret_cast<const char *>(this->m_streams.data()), static_cast<std::streamsize>(table_size));
+		blob_file.write(padding, static_cast<std::streamsize>(header.m_payload_offset - sizeof(Header) - table_size));
+		blob_file.write(reinterpret_cast<const char *>(this->m_payload.data()), static_cast<std::streamsize>(this->m_payload.size()));
+
+		if (!blob_file.good())
+		{
+			ror::log_error("Writing cooked model {} failed", temp_path.c_str());
+			blob_file.close();
+			std::filesystem::remove(temp_path, error);
+			return false;
+		}
+	}
+
+	std::filesystem::rename(temp_path, blob_path, error);
+	if (error)
+	{
+		ror::log_error("Can't move cooked model into {}, {}", blob_path.c_str(), error.message());
+		std::filesystem::remove(temp_path, error);
+		return false;
+	}
+
+	ror::log_info("Cooked model saved to {}", blob_path.c_str());
+
+	return true;
+}
+
+void ModelCache::record(rhi::BufferSemantic a_semantic, const uint8_t *a_data, uint32_t a_element_size, uint32_t a_count, uint32_t a_stride)
+{
+	assert(!this->m_warm && "Recording into a model cache that was loaded from a blob");
+	assert(a_stride >= a_element_size && "Stride can't be smaller than the element");
+
+	Stream stream{};
+	stream.m_semantic = enum_to_type_cast(a_semantic);
+	stream.m_offset   = align_up(this->m_payload.size());
+	stream.m_size     = a_element_size * a_count;
+	stream.m_stride   = a_element_size;
+
+	this->m_payload.resize(stream.m_offset + stream.m_size);
+	uint8_t *destination = this->m_payload.data() + stream.m_offset;
+
+	// Interleaved sources are packed tightly, so warm loads can always do a bulk upload
+	if (a_stride == a_element_size)
+		std::memcpy(destination, a_data, stream.m_size);
+	else
+		for (uint32_t i = 0; i < a_count; ++i)
+			std::memcpy(destination + i * a_element_size, a_data + i * a_stride, a_element_size);
+
+	this->m_streams.emplace_back(stream);
+}
+
+bool ModelCache::validate(const std::vector<ExpectedStream> &a_expected)
+{
+	if (!this->m_warm)
+		return false;
+
+	bool valid = this->m_streams.size() == a_expected.size();
+
+	for (size_t i = 0; i < a_expected.size() && valid; ++i)
+	{
+		auto &stream   = this->m_streams[i];
+		auto &expected = a_expected[i];
+
+		valid = stream.m_semantic == enum_to_type_cast(expected.m_semantic) &&
+		        stream.m_stride == expected.m_stride &&
+		        (expected.m_size == 0 ? stream.m_stride != 0 && stream.m_size % stream.m_stride == 0 : stream.m_size == expected.m_size);
+	}
+
+	if (!valid)
+	{
+		ror::log_warn("Cooked model {} doesn't match what the loader expects, it will be cooked again", this->path().c_str());
+
+		this->m_streams.clear();
+		this->m_payload_data = nullptr;
+		this->m_cursor       = 0;
+		this->m_warm         = false;
+	}
+
+	return valid;
+}
+
+ModelCache::StreamData ModelCache::next(rhi::BufferSemantic a_semantic)
+{
+	assert(this->m_warm && "Reading from a model cache that wasn't loaded");
+
+	// validate() already made sure the table matches, so this only happens if the loader reads streams it didn't expect
+	if (this->m_cursor >= this->m_streams.size() || this->m_streams[this->m_cursor].m_semantic != enum_to_type_cast(a_semantic))
+	{
+		assert(0 && "Cooked model stream read out of the order validate() expected");
+		ror::log_critical("Cooked model stream {} doesn't match what the loader expects, delete {}", this->m_cursor, this->path().c_str());
+		return {nullptr, 0, 0};
+	}
+
+	auto &stream = this->m_streams[this->m_cursor++];
+
+	// Upload only reads from this, the const_cast is only there because of the tuple type VertexDescriptor::upload() takes
+	return {const_cast<uint8_t *>(this->m_payload_data + stream.m_offset), stream.m_size, stream.m_stride};
+}
+
+}        // namespace ror
@@ -0,0 +1,101 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#pragma once
+
+#include "foundation/rorhash.hpp"
+#include "foundation/rormacros.hpp"
+#include "rhi/rortypes.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <tuple>
+#include <vector>
+
+namespace ror
+{
+/**
+ * Cooked model data, all the decoded glTF accessors and images inside buffer views of a model saved as a single versioned binary blob in the cache directory
+ * Blobs are keyed by the content hash of the glTF file and its buffers. On warm loads the blob is mapped and its streams are
+ * handed to VertexDescriptor::upload() as they are, so none of the glTF buffers need to be loaded, unpacked or normalised again
+ * Streams are recorded in the order the loader reads the accessors and are read back in the same order, each one carries its semantic for validation
+ */
+class ROAR_ENGINE_ITEM ModelCache final
+{
+  public:
+	using StreamData = std::tuple<uint8_t *, uint32_t, uint32_t>;        // Data pointer, size and stride, as expected by VertexDescriptor::upload()
+
+	// A stream the loader will read, in the order it reads them
+	struct ExpectedStream
+	{
+		rhi::BufferSemantic m_semantic{rhi::BufferSemantic::vertex_position};        // Semantic the loader asks next() for
+		uint32_t            m_stride{0};                                              // Element size in bytes
+		uint32_t            m_size{0};                                                // Size in bytes, 0 if it isn't known before the stream is read
+	};
+
+	FORCE_INLINE             ModelCache()                              = delete;         //! Default constructor
+	FORCE_INLINE             ModelCache(const ModelCache &a_other)     = delete;         //! Copy constructor
+	FORCE_INLINE             ModelCache(ModelCache &&a_other) noexcept = delete;         //! Move constructor
+	FORCE_INLINE ModelCache &operator=(const ModelCache &a_other)      = delete;         //! Copy assignment operator
+	FORCE_INLINE ModelCache &operator=(ModelCache &&a_other) noexcept  = delete;         //! Move assignment operator
+	FORCE_INLINE ~ModelCache() noexcept                                = default;        //! Destructor
+
+	explicit ModelCache(hash_64_t a_source_hash);
+
+	bool                  load();                                                                                                                       // Maps the blob for the source hash, returns false if its missing, of another version or corrupt
+	bool                  validate(const std::vector<ExpectedStream> &a_expected);                                                                      // Drops the mapped blob unless its stream table is exactly a_expected, the model is then loaded cold and cooked again
+	bool                  save();                                                                                                                       // Writes all recorded streams into the blob, returns false if it can't be written
+	void                  record(rhi::BufferSemantic a_semantic, const uint8_t *a_data, uint32_t a_element_size, uint32_t a_count, uint32_t a_stride);        // Copies a_count elements tightly packed into the blob
+	StreamData            next(rhi::BufferSemantic a_semantic);                                                                                         // Next recorded stream from the mapped blob
+	bool                  warm() const noexcept;
+	std::filesystem::path path() const;
+
+  protected:
+  private:
+	struct Header
+	{
+		uint32_t  m_magic{0};
+		uint32_t  m_version{0};
+		hash_64_t m_source_hash{0};
+		uint64_t  m_streams_count{0};
+		uint64_t  m_payload_offset{0};
+	};
+
+	struct Stream
+	{
+		uint64_t m_semantic{0};        // rhi::BufferSemantic of the stream
+		uint64_t m_offset{0};          // Offset of the stream from the start of the payload
+		uint32_t m_size{0};            // Size in bytes
+		uint32_t m_stride{0};          // Element size in bytes, streams are always tightly packed
+	};
+
+	hash_64_t            m_source_hash{0};           // Content hash of the glTF and its buffers this blob is cooked from
+	std::vector<Stream>  m_streams{};                // Stream table, either recorded or read from the mapped blob
+	std::vector<uint8_t> m_payload{};                // Recorded streams data, only used while cooking
+	const uint8_t       *m_payload_data{nullptr};    // Payload inside the mapped blob, owned by the Resource that mapped it
+	size_t               m_cursor{0};                // Next stream to read on warm loads
+	bool                 m_warm{false};              // True if a valid blob is mapped
+};
+
+}        // namespace ror
@@ -75,6 +75,8 @@ class ROAR_ENGINE_ITEM NodeData
 	FORCE_INLINE NodeData()
 	{
 		this->m_shader_buffer.add_entry("node_offset", rhi::Format::uint32_4);
+		this->m_shader_buffer.add_entry("position_offset", rhi::Format::float32_4);
+		this->m_shader_buffer.add_entry("position_scale", rhi::Format::float32_4);
 	}
 
 	FORCE_INLINE void upload(rhi::Device &a_device)
@@ -89,6 +91,15 @@ class ROAR_ENGINE_ITEM NodeData
 		this->m_shader_buffer.buffer_unmap();
 	}
 
+	// Quantized positions of the node's mesh decode to a_offset + position * a_scale
+	FORCE_INLINE void update_position_decode(ror::Vector4f a_offset, ror::Vector4f a_scale)
+	{
+		this->m_shader_buffer.buffer_map();
+		this->m_shader_buffer.update("position_offset", &a_offset.x);
+		this->m_shader_buffer.update("position_scale", &a_scale.x);
+		this->m_shader_buffer.buffer_unmap();
+	}
+
 	template <typename _encoder>
 	FORCE_INLINE constexpr void bind(_encoder a_encoder, rhi::ShaderStage a_stage)
 	{
@@ -118,7 +129,7 @@ class ROAR_ENGINE_ITEM NodeData
 	// The solution is that we keep this here and in scene load time confirm in debug mode that m_shader_buffer has the same structure as renderer's one
 	// This one is currently not used to generate glsl so the names doesn't matter as long as the structure is same
 	// Further more its frequency is constant because this doesn't change, but in case it ever does we need to create a vector look at c6075b8826a8 commit
-	rhi::ShaderBuffer m_shader_buffer{"nodes_offsets",        //! Node specific shader buffer, currently only contains node_index
+	rhi::ShaderBuffer m_shader_buffer{"nodes_offsets",        //! Node specific shader buffer, contains node_index and the quantized position decode
 	                                  rhi::ShaderBufferType::ubo,
 	                                  rhi::ShaderBufferFrequency::constant,        // NOTE: Don't change to per_frame behaviour, if you do update accordingly
 	                                  rhi::Layout::std140,
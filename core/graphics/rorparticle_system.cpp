@@ -0,0 +1,241 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "graphics/rorparticle_system.hpp"
+#include "math/rorsimd.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace ror
+{
+ParticleSystem::ParticleSystem(uint32_t a_capacity, uint32_t a_seed) :
+    m_random_state(a_seed ? a_seed : 1u)
+{
+	this->reserve(a_capacity);
+}
+
+void ParticleSystem::reserve(uint32_t a_capacity)
+{
+	auto padded = (a_capacity + simd_width - 1) / simd_width * simd_width;
+
+	for (auto &stream : this->m_streams)
+		stream.assign(padded, 0.0f);
+
+	this->m_capacity         = a_capacity;
+	this->m_size             = 0;
+	this->m_emit_accumulator = 0.0f;
+}
+
+void ParticleSystem::clear() noexcept
+{
+	this->m_size             = 0;
+	this->m_emit_accumulator = 0.0f;
+}
+
+FORCE_INLINE float32_t ParticleSystem::random() noexcept
+{
+	auto &state = this->m_random_state;
+
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+
+	return static_cast<float32_t>(state >> 8) * (1.0f / 16777216.0f);        // Top 24 bits fit exactly in a float mantissa
+}
+
+FORCE_INLINE float32_t *ParticleSystem::stream_data(Stream a_stream) noexcept
+{
+	return this->m_streams[static_cast<uint32_t>(a_stream)].data();
+}
+
+void ParticleSystem::simulate(float32_t a_delta_seconds)
+{
+	this->integrate(a_delta_seconds, 0, this->m_size);
+	this->retire();
+	this->emit(a_delta_seconds);
+}
+
+void ParticleSystem::integrate(float32_t a_delta_seconds, uint32_t a_first, uint32_t a_last)
+{
+	assert(a_first % simd_width == 0 && "Integration range must start at a simd boundary");
+	assert(a_last <= this->m_size && "Integration range out of bounds");
+
+	auto *px = this->stream_data(Stream::position_x);
+	auto *py = this->stream_data(Stream::position_y);
+	auto *pz = this->stream_data(Stream::position_z);
+	auto *vx = this->stream_data(Stream::velocity_x);
+	auto *vy = this->stream_data(Stream::velocity_y);
+	auto *vz = this->stream_data(Stream::velocity_z);
+	auto *ag = this->stream_data(Stream::age);
+	auto *ar = this->stream_data(Stream::age_rate);
+	auto *cr = this->stream_data(Stream::color_r);
+	auto *cg = this->stream_data(Stream::color_g);
+	auto *cb = this->stream_data(Stream::color_b);
+	auto *ca = this->stream_data(Stream::color_a);
+
+	// Colour is a lerp from start to end by normalized age
+	auto color_delta = this->m_end_color - this->m_start_color;
+	auto gravity_dt  = this->m_gravity * a_delta_seconds;
+
+	// Streams are padded so the last partial group can run full width, lanes past m_size are never read back
+	auto last = std::min((a_last + simd_width - 1) / simd_width * simd_width, static_cast<uint32_t>(this->m_streams[0].size()));
+
+#if defined(ROR_MATH_SIMD)
+	auto dt = simd::splat(a_delta_seconds);
+	auto gx = simd::splat(gravity_dt.x);
+	auto gy = simd::splat(gravity_dt.y);
+	auto gz = simd::splat(gravity_dt.z);
+	auto sr = simd::splat(this->m_start_color.x);
+	auto sg = simd::splat(this->m_start_color.y);
+	auto sb = simd::splat(this->m_start_color.z);
+	auto sa = simd::splat(this->m_start_color.w);
+	auto dr = simd::splat(color_delta.x);
+	auto dg = simd::splat(color_delta.y);
+	auto db = simd::splat(color_delta.z);
+	auto da = simd::splat(color_delta.w);
+
+	for (uint32_t i = a_first; i < last; i += simd_width)
+	{
+		auto vx4 = simd::add(simd::load(vx + i), gx);
+		auto vy4 = simd::add(simd::load(vy + i), gy);
+		auto vz4 = simd::add(simd::load(vz + i), gz);
+
+		simd::store(vx + i, vx4);
+		simd::store(vy + i, vy4);
+		simd::store(vz + i, vz4);
+
+		simd::store(px + i, simd::add(simd::load(px + i), simd::mul(vx4, dt)));
+		simd::store(py + i, simd::add(simd::load(py + i), simd::mul(vy4, dt)));
+		simd::store(pz + i, simd::add(simd::load(pz + i), simd::mul(vz4, dt)));
+
+		auto age4 = simd::add(simd::load(ag + i), simd::mul(simd::load(ar + i), dt));
+		simd::store(ag + i, age4);
+
+		simd::store(cr + i, simd::add(sr, simd::mul(dr, age4)));
+		simd::store(cg + i, simd::add(sg, simd::mul(dg, age4)));
+		simd::store(cb + i, simd::add(sb, simd::mul(db, age4)));
+		simd::store(ca + i, simd::add(sa, simd::mul(da, age4)));
+	}
+#else
+	for (uint32_t i = a_first; i < last; ++i)
+	{
+		vx[i] += gravity_dt.x;
+		vy[i] += gravity_dt.y;
+		vz[i] += gravity_dt.z;
+
+		px[i] += vx[i] * a_delta_seconds;
+		py[i] += vy[i] * a_delta_seconds;
+		pz[i] += vz[i] * a_delta_seconds;
+
+		ag[i] += ar[i] * a_delta_seconds;
+
+		cr[i] = this->m_start_color.x + color_delta.x * ag[i];
+		cg[i] = this->m_start_color.y + color_delta.y * ag[i];
+		cb[i] = this->m_start_color.z + color_delta.z * ag[i];
+		ca[i] = this->m_start_color.w + color_delta.w * ag[i];
+	}
+#endif
+}
+
+void ParticleSystem::retire()
+{
+	const auto *age  = this->stream_data(Stream::age);
+	uint32_t    size = this->m_size;
+	uint32_t    i    = 0;
+
+	// Swap the last live particle into each dead one, order isn't preserved but only dead particles and the tail are touched
+	while (i < size)
+	{
+		if (age[i] >= 1.0f)
+		{
+			--size;
+			for (auto &stream : this->m_streams)
+				stream[i] = stream[size];
+		}
+		else
+			++i;
+	}
+
+	this->m_size = size;
+}
+
+void ParticleSystem::emit(float32_t a_delta_seconds)
+{
+	this->m_emit_accumulator += this->m_rate * a_delta_seconds;
+
+	auto count = static_cast<uint32_t>(this->m_emit_accumulator);
+	this->m_emit_accumulator -= static_cast<float32_t>(count);
+
+	this->spawn(count);
+}
+
+void ParticleSystem::burst(uint32_t a_count)
+{
+	this->spawn(a_count);
+}
+
+void ParticleSystem::spawn(uint32_t a_count)
+{
+	a_count = std::min(a_count, this->m_capacity - this->m_size);        // Anything that doesn't fit is dropped
+
+	auto *px = this->stream_data(Stream::position_x);
+	auto *py = this->stream_data(Stream::position_y);
+	auto *pz = this->stream_data(Stream::position_z);
+	auto *vx = this->stream_data(Stream::velocity_x);
+	auto *vy = this->stream_data(Stream::velocity_y);
+	auto *vz = this->stream_data(Stream::velocity_z);
+	auto *ag = this->stream_data(Stream::age);
+	auto *ar = this->stream_data(Stream::age_rate);
+	auto *cr = this->stream_data(Stream::color_r);
+	auto *cg = this->stream_data(Stream::color_g);
+	auto *cb = this->stream_data(Stream::color_b);
+	auto *ca = this->stream_data(Stream::color_a);
+
+	auto life_range = this->m_life_time_max - this->m_life_time_min;
+
+	for (uint32_t i = this->m_size; i < this->m_size + a_count; ++i)
+	{
+		px[i] = this->m_origin.x;
+		py[i] = this->m_origin.y;
+		pz[i] = this->m_origin.z;
+
+		vx[i] = this->m_velocity.x + this->m_velocity_spread.x * (this->random() * 2.0f - 1.0f);
+		vy[i] = this->m_velocity.y + this->m_velocity_spread.y * (this->random() * 2.0f - 1.0f);
+		vz[i] = this->m_velocity.z + this->m_velocity_spread.z * (this->random() * 2.0f - 1.0f);
+
+		ag[i] = 0.0f;
+		ar[i] = 1.0f / std::max(this->m_life_time_min + life_range * this->random(), 0.0001f);
+
+		cr[i] = this->m_start_color.x;
+		cg[i] = this->m_start_color.y;
+		cb[i] = this->m_start_color.z;
+		ca[i] = this->m_start_color.w;
+	}
+
+	this->m_size += a_count;
+}
+
+}        // namespace ror
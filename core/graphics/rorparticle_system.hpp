@@ -0,0 +1,133 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#pragma once
+
+#include "foundation/rormacros.hpp"
+#include "foundation/rortypes.hpp"
+#include "math/rorvector3.hpp"
+#include "math/rorvector4.hpp"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace ror
+{
+/**
+ * A particle emitter that owns all its particles as structure of arrays
+ * Each attribute is its own stream of floats so integration runs 4 particles at a time using the simd backend
+ * Ages are normalized, each particle ages by its own rate (1 / life time) and retires when its age reaches 1
+ * Retiring swaps the last live particle into the hole so live particles are always [0, size), emitting only appends
+ * All streams are allocated once with the capacity, no allocations happen while simulating
+ * integrate() of disjoint ranges can run on different jobs, retire() and emit() must run alone per emitter
+ */
+class ROAR_ENGINE_ITEM ParticleSystem final
+{
+  public:
+	enum class Stream : uint32_t
+	{
+		position_x,
+		position_y,
+		position_z,
+		velocity_x,
+		velocity_y,
+		velocity_z,
+		age,
+		age_rate,
+		color_r,
+		color_g,
+		color_b,
+		color_a,
+		max
+	};
+
+	FORCE_INLINE                 ParticleSystem()                                  = default;        //! Default constructor
+	FORCE_INLINE                 ParticleSystem(const ParticleSystem &a_other)     = default;        //! Copy constructor
+	FORCE_INLINE                 ParticleSystem(ParticleSystem &&a_other) noexcept = default;        //! Move constructor
+	FORCE_INLINE ParticleSystem &operator=(const ParticleSystem &a_other)          = default;        //! Copy assignment operator
+	FORCE_INLINE ParticleSystem &operator=(ParticleSystem &&a_other) noexcept      = default;        //! Move assignment operator
+	FORCE_INLINE ~ParticleSystem() noexcept                                        = default;        //! Destructor
+
+	explicit ParticleSystem(uint32_t a_capacity, uint32_t a_seed = 1u);
+
+	void reserve(uint32_t a_capacity);                                            // Drops all particles and reallocates the streams
+	void simulate(float32_t a_delta_seconds);                                     // integrate(), retire() and emit() in one go
+	void integrate(float32_t a_delta_seconds, uint32_t a_first, uint32_t a_last);   // Advances particles in [a_first, a_last), a_first must be a multiple of 4
+	void retire();                                                                // Removes all particles whose age has reached 1
+	void emit(float32_t a_delta_seconds);                                         // Emits as many particles as the rate allows in a_delta_seconds
+	void burst(uint32_t a_count);                                                 // Emits a_count particles right away, limited by capacity
+	void clear() noexcept;
+
+	static constexpr uint32_t simd_width{4};        //! Particles integrated together, streams are padded to a multiple of this
+
+	// clang-format off
+	FORCE_INLINE constexpr auto  size()                              const noexcept  { return this->m_size;                                                   }
+	FORCE_INLINE constexpr auto  capacity()                          const noexcept  { return this->m_capacity;                                               }
+	FORCE_INLINE constexpr auto &origin()                            const noexcept  { return this->m_origin;                                                 }
+	FORCE_INLINE constexpr auto &velocity()                          const noexcept  { return this->m_velocity;                                               }
+	FORCE_INLINE constexpr auto &velocity_spread()                   const noexcept  { return this->m_velocity_spread;                                        }
+	FORCE_INLINE constexpr auto &gravity()                           const noexcept  { return this->m_gravity;                                                }
+	FORCE_INLINE constexpr auto &start_color()                       const noexcept  { return this->m_start_color;                                            }
+	FORCE_INLINE constexpr auto &end_color()                         const noexcept  { return this->m_end_color;                                              }
+	FORCE_INLINE constexpr auto  rate()                              const noexcept  { return this->m_rate;                                                   }
+	FORCE_INLINE constexpr auto  life_time_min()                     const noexcept  { return this->m_life_time_min;                                          }
+	FORCE_INLINE constexpr auto  life_time_max()                     const noexcept  { return this->m_life_time_max;                                          }
+	FORCE_INLINE const float32_t *stream(Stream a_stream)            const noexcept  { return this->m_streams[static_cast<uint32_t>(a_stream)].data();        }
+
+	FORCE_INLINE constexpr void origin(Vector3f a_origin)                      noexcept  { this->m_origin = a_origin;                                        }
+	FORCE_INLINE constexpr void velocity(Vector3f a_velocity)                  noexcept  { this->m_velocity = a_velocity;                                    }
+	FORCE_INLINE constexpr void velocity_spread(Vector3f a_velocity_spread)    noexcept  { this->m_velocity_spread = a_velocity_spread;                      }
+	FORCE_INLINE constexpr void gravity(Vector3f a_gravity)                    noexcept  { this->m_gravity = a_gravity;                                      }
+	FORCE_INLINE constexpr void start_color(Vector4f a_color)                  noexcept  { this->m_start_color = a_color;                                    }
+	FORCE_INLINE constexpr void end_color(Vector4f a_color)                    noexcept  { this->m_end_color = a_color;                                      }
+	FORCE_INLINE constexpr void rate(float32_t a_rate)                         noexcept  { this->m_rate = a_rate;                                            }
+	FORCE_INLINE constexpr void life_time(float32_t a_min, float32_t a_max)    noexcept  { this->m_life_time_min = a_min; this->m_life_time_max = a_max;     }
+	// clang-format on
+
+  private:
+	FORCE_INLINE float32_t random() noexcept;        // Uniform in [0, 1)
+	FORCE_INLINE float32_t *stream_data(Stream a_stream) noexcept;
+
+	void spawn(uint32_t a_count);
+
+	using Streams = std::array<std::vector<float32_t>, static_cast<size_t>(Stream::max)>;
+
+	Streams   m_streams{};                                  //! All particle attributes, one contiguous float stream each
+	uint32_t  m_size{0};                                    //! Live particles are [0, m_size)
+	uint32_t  m_capacity{0};                                //! Maximum live particles, streams are this rounded up to simd_width
+	uint32_t  m_random_state{1u};                           //! Xorshift state, each emitter has its own so emitters can run in parallel
+	float32_t m_emit_accumulator{0.0f};                     //! Fraction of a particle carried over to the next emit
+	float32_t m_rate{100.0f};                               //! Particles emitted per second
+	float32_t m_life_time_min{1.0f};                        //! Shortest life time of a particle in seconds
+	float32_t m_life_time_max{2.0f};                        //! Longest life time of a particle in seconds
+	Vector3f  m_origin{0.0f, 0.0f, 0.0f};                   //! Where the particles are emitted from
+	Vector3f  m_velocity{0.0f, 1.0f, 0.0f};                 //! Initial velocity of the particles
+	Vector3f  m_velocity_spread{0.2f, 0.0f, 0.2f};          //! Random variation of initial velocity in each axis, +/- this much
+	Vector3f  m_gravity{0.0f, -9.8f, 0.0f};                 //! Constant acceleration applied to all particles
+	Vector4f  m_start_color{1.0f, 1.0f, 1.0f, 1.0f};        //! Color of newly emitted particles
+	Vector4f  m_end_color{1.0f, 1.0f, 1.0f, 0.0f};          //! Color of particles at the end of their life
+};
+
+}        // namespace ror
@@ -38,10 +38,12 @@
 #include "graphics/roranimation.hpp"
 #include "graphics/rordynamic_mesh.hpp"
 #include "graphics/rorline_soup.hpp"
+#include "graphics/rorlod_selector.hpp"
 #include "graphics/rormesh.hpp"
 #include "graphics/rormodel.hpp"
 #include "graphics/rornode.hpp"
 #include "graphics/rorscene.hpp"
+#include "graphics/rortransform_hierarchy.hpp"
 #include "gui/rorgui.hpp"
 #include "math/rormatrix3.hpp"
 #include "math/rormatrix3_functions.hpp"
@@ -53,6 +55,7 @@
 #include "math/rorvector4.hpp"
 #include "math/rorvector_functions.hpp"
 #include "profiling/rorlog.hpp"
+#include "profiling/rorprofiler.hpp"
 #include "profiling/rortimer.hpp"
 #include "renderer/rorrenderer.hpp"
 #include "resources/rorresource.hpp"
@@ -68,6 +71,7 @@
 #include "settings/rorsettings.hpp"
 #include "shader_system/rorshader_system.hpp"
 #include "shader_system/rorshader_update.hpp"
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cmath>
@@ -76,6 +80,7 @@
 #include <cstring>
 #include <filesystem>
 #include <mutex>
+#include <span>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -587,22 +592,43 @@ void Scene::SceneState::write_specific()
 	}
 }
 
-template <typename _node_type>
-FORCE_INLINE constexpr void copy_node(_node_type a_node, rhi::ShaderBuffer &a_shader_buffer, uint32_t a_node_index, uint32_t a_stride, size_t a_parent_offset, int32_t a_parent)
+// Resolved once per copy_node_transforms() instead of hashing the entry names for every node
+struct TRSHandles
 {
-	a_shader_buffer.update("rotation", &a_node.m_trs_transform.m_rotation.x, a_node_index, a_stride);
-	a_shader_buffer.update("translation", &a_node.m_trs_transform.m_translation.x, a_node_index, a_stride);
-	a_shader_buffer.update("scale", &a_node.m_trs_transform.m_scale.x, a_node_index, a_stride);
-	a_shader_buffer.update("scale_inverse", &a_node.m_trs_transform.m_scale.x, a_node_index, a_stride);
+	rhi::ShaderBufferTemplate::Handle m_rotation{};
+	rhi::ShaderBufferTemplate::Handle m_translation{};
+	rhi::ShaderBufferTemplate::Handle m_scale{};
+	rhi::ShaderBufferTemplate::Handle m_scale_inverse{};
+	rhi::ShaderBufferTemplate::Handle m_parent_index{};
+};
+
+template <typename _nodes_type>
+FORCE_INLINE void copy_nodes(const _nodes_type &a_nodes, rhi::ShaderBuffer &a_shader_buffer, const TRSHandles &a_handles, uint32_t a_first, uint32_t a_stride, size_t a_parent_offset, int32_t a_parent)
+{
+	if (a_nodes.empty())
+		return;
 
-	ror::Vector4i parent_index{a_node.m_parent, 0, 0, 0};
+	auto  count       = static_cast_safe<uint32_t>(a_nodes.size());
+	auto  node_stride = static_cast_safe<uint32_t>(sizeof(a_nodes[0]));
+	auto &transform   = a_nodes[0].m_trs_transform;
+
+	// Each of the TRS components is strided through all the nodes in one go
+	a_shader_buffer.update_strided(a_handles.m_rotation, &transform.m_rotation.x, a_first, count, a_stride, node_stride);
+	a_shader_buffer.update_strided(a_handles.m_translation, &transform.m_translation.x, a_first, count, a_stride, node_stride);
+	a_shader_buffer.update_strided(a_handles.m_scale, &transform.m_scale.x, a_first, count, a_stride, node_stride);
+	a_shader_buffer.update_strided(a_handles.m_scale_inverse, &transform.m_scale.x, a_first, count, a_stride, node_stride);
+
+	for (uint32_t node_index = 0; node_index < count; ++node_index)
+	{
+		ror::Vector4i parent_index{a_nodes[node_index].m_parent, 0, 0, 0};
 
-	if (parent_index.x != -1)
-		parent_index.x += static_cast_safe<int32_t>(a_parent_offset);
-	else if (a_parent_offset != 0)
-		parent_index.x = a_parent;
+		if (parent_index.x != -1)
+			parent_index.x += static_cast_safe<int32_t>(a_parent_offset);
+		else if (a_parent_offset != 0)
+			parent_index.x = a_parent;
 
-	a_shader_buffer.update("parent_index", &parent_index.x, a_node_index, a_stride);
+		a_shader_buffer.update(a_handles.m_parent_index, &parent_index.x, a_first + node_index, a_stride);
+	}
 }
 
 auto copy_node_transforms(ror::Scene &a_scene, rhi::ShaderBuffer &a_input_buffer)
@@ -614,29 +640,24 @@ auto copy_node_transforms(ror::Scene &a_scene, rhi::ShaderBuffer &a_input_buffer
 
 	auto stride = a_input_buffer.stride("trs_transform_input");
 
-	uint32_t node_index    = 0;
-	uint32_t parent_offset = 0;
-	for (auto &node : nodes)
-	{
-		copy_node(node, a_input_buffer, node_index, stride, parent_offset, -1);
-		node_index++;
-	}
+	TRSHandles handles{a_input_buffer.handle("rotation"),
+	                   a_input_buffer.handle("translation"),
+	                   a_input_buffer.handle("scale"),
+	                   a_input_buffer.handle("scale_inverse"),
+	                   a_input_buffer.handle("parent_index")};
+
+	copy_nodes(nodes, a_input_buffer, handles, 0u, stride, 0u, -1);
 
-	int32_t parent_index = 0;
+	uint32_t node_index   = static_cast_safe<uint32_t>(nodes.size());
+	int32_t  parent_index = 0;
 	for (auto &node : nodes_data)
 	{
 		if (node.m_model != -1)
 		{
-			parent_offset = node_index;
-
 			auto &model_nodes = a_scene.models()[static_cast_safe<size_t>(node.m_model)].nodes();
 
-			for (uint32_t model_node_index = 0; model_node_index < model_nodes.size(); ++model_node_index)
-			{
-				auto &n = model_nodes[model_node_index];
-				copy_node(n, a_input_buffer, node_index, stride, parent_offset, parent_index);
-				node_index++;
-			}
+			copy_nodes(model_nodes, a_input_buffer, handles, node_index, stride, node_index, parent_index);
+			node_index += static_cast_safe<uint32_t>(model_nodes.size());
 		}
 
 		parent_index++;
@@ -833,13 +854,43 @@ FORCE_INLINE void enable_material_component(const Material::Component<_type>
 	}
 };
 
-void render_mesh(const rhi::Device &a_device, ror::Model &a_model, ror::Mesh &a_mesh, DrawData &a_dd, const ror::Renderer &a_renderer, ror::Scene &a_scene, const rhi::Rendersubpass &subpass)
+// Returns true if any of the primitives of a_mesh transformed by a_xform is inside a_frustum
+bool mesh_visible(const ror::Frustum &a_frustum, const ror::Mesh &a_mesh, const ror::Matrix4f &a_xform)
+{
+	for (size_t prim_id = 0; prim_id < a_mesh.primitives_count(); ++prim_id)
+		if (a_frustum.visible(a_mesh.bounding_box(prim_id), a_xform))
+			return true;
+
+	return false;
+}
+
+// a_frustum can be null if no culling is required, a_lod_draws are the selector's draws of a_mesh whose first primitive was added at a_lod_first
+// With a_lod_first ~0u everything is drawn in full detail, otherwise the selector has done the culling already and only a_lod_draws are drawn
+void render_mesh(const rhi::Device &a_device, ror::Model &a_model, ror::Mesh &a_mesh, DrawData &a_dd, const ror::Renderer &a_renderer, ror::Scene &a_scene, const rhi::Rendersubpass &subpass,
+                 const ror::Frustum *a_frustum, const ror::Matrix4f &a_xform, std::span<const ror::LodDraw> a_lod_draws, uint32_t a_lod_first)
 {
 	auto &programs      = a_scene.programs();
 	auto &pass_programs = programs.at(subpass.type());
+	auto  lod_draw      = a_lod_draws.begin();
 
 	for (size_t prim_id = 0; prim_id < a_mesh.primitives_count(); ++prim_id)
 	{
+		const ror::MeshLod *lod{nullptr};
+		if (a_lod_first != ~0u)
+		{
+			// Draws are in primitive order, culled primitives don't have one
+			if (lod_draw == a_lod_draws.end() || lod_draw->m_primitive != a_lod_first + prim_id)
+				continue;
+
+			auto &lods = a_mesh.lods(prim_id);
+			if (lod_draw->m_lod < lods.size())
+				lod = &lods[lod_draw->m_lod];
+
+			++lod_draw;
+		}
+		else if (a_frustum && !a_frustum->visible(a_mesh.bounding_box(prim_id), a_xform))
+			continue;
+
 		auto material_index = a_mesh.material(prim_id);
 		assert(material_index != -1 && "Material index can't be -1");
 		auto &material         = a_model.materials()[static_cast<uint32_t>(material_index)];
@@ -1010,12 +1061,21 @@ void render_mesh(const rhi::Device &a_device, ror::Model &a_model, ror::Mesh &a_
 		{
 			auto &index_buffer_attribute = vertex_attributes.attribute(rhi::BufferSemantic::vertex_index);
 
-			if (index_buffer_attribute.count() > 0)
+			// Levels of detail live after the full detail indices in the same index buffer range
+			auto index_count  = index_buffer_attribute.count();
+			auto index_offset = index_buffer_attribute.buffer_offset() + index_buffer_attribute.offset();
+			if (lod)
+			{
+				index_count = lod->m_index_count;
+				index_offset += lod->m_index_offset * rhi::vertex_format_to_bytes(index_buffer_attribute.format());
+			}
+
+			if (index_count > 0)
 				a_dd.encoder->draw_indexed_primitives(a_mesh.primitive_type(prim_id),
-				                                      index_buffer_attribute.count(),
+				                                      index_count,
 				                                      index_buffer_attribute.format(),
 				                                      *a_dd.indices,
-				                                      index_buffer_attribute.buffer_offset() + index_buffer_attribute.offset());
+				                                      index_offset);
 		}
 		else
 		{
@@ -1389,6 +1449,15 @@ void Scene::pre_render(rhi::RenderCommandEncoder &a_encoder, rhi::BuffersPack &a
 						{
 							node_index.z = 0;
 						}
+
+						// Only read by shaders of quantized primitives, scale is left zero otherwise
+						auto &bounds = mesh.position_bounds();
+						if (bounds.extent().x >= 0.0f)
+						{
+							auto minimum = bounds.minimum();
+							auto extent  = bounds.extent();
+							model_nodes[model_node_index].update_position_decode({minimum.x, minimum.y, minimum.z, 0.0f}, {extent.x, extent.y, extent.z, 0.0f});
+						}
 					}
 					model_nodes[model_node_index].update_offsets(node_index);
 					node_index.x++;
@@ -1495,6 +1564,8 @@ const Light *Scene::area_light() const
 
 void Scene::render(const rhi::Device &a_device, rhi::RenderCommandEncoder &a_encoder, rhi::BuffersPack &a_buffers_pack, ror::Renderer &a_renderer, const rhi::Renderpass &a_pass, const rhi::Rendersubpass &a_subpass, ror::EventSystem &a_event_system)
 {
+	profile_zone("Scene::render");
+
 	(void) a_pass;
 	(void) a_event_system;
 	(void) a_device;
@@ -1565,7 +1636,21 @@ void Scene::render(const rhi::Device &a_device, rhi::RenderCommandEncoder &a_enc
 
 	this->pre_render(a_encoder, a_buffers_pack, a_renderer, a_subpass);
 
+	// Shadow casters outside the camera can still cast into it, so only cull for the camera's own passes.
+	// The frustum is built from a perspective projection only, so orthographic cameras are not culled either
+	const auto    &camera  = this->current_camera();
+	const Frustum *frustum = nullptr;
+	if (ror::settings().m_frustum_cull && a_subpass.type() != rhi::RenderpassType::shadow && camera.type() == CameraType::perspective)
+		frustum = &camera.frustum();
+
+	// Levels of detail picked in select_lods() are for the camera's own passes only, shadows are drawn in full detail
+	// Meshes are visited in the order their primitives were added to the selector, so the draws are walked along with them
+	const bool select_lods = !this->m_lod_firsts.empty() && a_subpass.type() != rhi::RenderpassType::shadow;
+	const auto lod_draws   = std::span<const ror::LodDraw>{this->m_lod_selector.draws()};
+	auto       lod_draw    = lod_draws.begin();
+
 	// Render the scene graph
+	size_t node_id = 0;
 	for (auto &node : this->m_nodes_data)
 	{
 		if (node.m_model != -1)
@@ -1575,12 +1660,46 @@ void Scene::render(const rhi::Device &a_device, rhi::RenderCommandEncoder &a_enc
 			auto &meshes           = model.meshes();
 			auto &model_nodes_data = model.nodes_side_data();
 
+			// Bounds are only known for the rest pose, animated node transforms, skins and morphs are applied on the GPU, so those are never culled
+			auto model_frustum = model.animations().empty() ? frustum : nullptr;
+
 			size_t node_data_index = 0;
 			for (auto &model_node : model.nodes())
 			{
 				if (model_node.m_mesh_index != -1 && model_node.m_visible)
 				{
 					auto &mesh = meshes[static_cast<size_t>(model_node.m_mesh_index)];
+
+					auto mesh_frustum = (mesh.skin_index() == -1 && !mesh.has_morphs()) ? model_frustum : nullptr;
+					auto lod_first    = select_lods ? this->m_lod_firsts[this->m_transform_offsets[node_id] + node_data_index] : ~0u;
+
+					ror::Matrix4f                 xform{};
+					std::span<const ror::LodDraw> mesh_draws{};
+					if (lod_first != ~0u)
+					{
+						auto lod_last = lod_first + static_cast_safe<uint32_t>(mesh.primitives_count());
+						auto first    = lod_draw;
+						while (lod_draw != lod_draws.end() && lod_draw->m_primitive < lod_last)
+							++lod_draw;
+
+						mesh_frustum = nullptr;
+						mesh_draws   = std::span<const ror::LodDraw>{first, lod_draw};
+						if (mesh_draws.empty())        // Every primitive of the mesh was culled
+						{
+							node_data_index++;
+							continue;
+						}
+					}
+					else if (mesh_frustum)
+					{
+						xform = this->node_global_transform(node_id, node_data_index);
+						if (!mesh_visible(*mesh_frustum, mesh, xform))
+						{
+							node_data_index++;
+							continue;
+						}
+					}
+
 					model_nodes_data[node_data_index].bind(a_encoder, rhi::ShaderStage::vertex);
 					if (mesh.skin_index() != -1 && model_node.m_skin_index != -1)
 					{
@@ -1597,11 +1716,12 @@ void Scene::render(const rhi::Device &a_device, rhi::RenderCommandEncoder &a_enc
 
 					a_encoder.front_facing_winding(model_node.m_winding);
 
-					render_mesh(a_device, model, mesh, dd, a_renderer, *this, a_subpass);
+					render_mesh(a_device, model, mesh, dd, a_renderer, *this, a_subpass, mesh_frustum, xform, mesh_draws, lod_first);
 				}
 				node_data_index++;
 			}
 		}
+		node_id++;
 	}
 
 	// Don't render dynamic meshes in shadow pass
@@ -1634,9 +1754,13 @@ void Scene::render(const rhi::Device &a_device, rhi::RenderCommandEncoder &a_enc
 
 void Scene::update(ror::Renderer &a_renderer, ror::Timer &a_timer)
 {
+	profile_zone("Scene::update");
+
 	(void) a_timer;
 	(void) a_renderer;
 
+	this->update_particles(ror::get_job_system(), static_cast<float32_t>(this->m_particles_timer.tick_seconds()));
+
 	// auto &camera = this->m_cameras[this->m_current_camera_index];
 	// camera.update(a_renderer);
 }
@@ -1648,7 +1772,7 @@ void Scene::update_bounding_box()
 	{
 		if (node.m_model != -1)
 		{
-			auto scene_node_xform = get_node_global_transform(*this, this->m_nodes[node_id]);
+			auto &scene_node_xform = this->node_global_transform(node_id);
 
 			auto &model = this->m_models[static_cast_safe<size_t>(node.m_model)];
 			auto  bbox  = model.bounding_box_scaled(scene_node_xform);
@@ -1864,6 +1988,7 @@ void Scene::generate_debug_model(size_t a_model_index, rhi::BuffersPack &a_buffe
 	// Add scene nodes for this model
 	auto node_index = this->m_nodes.size();
 	this->add_model_node(static_cast_safe<int32_t>(a_model_index));
+	this->build_transform_hierarchy();        // Debug model is still empty, its rebuilt again once all models are done in load_models
 
 	auto &setting = ror::settings();
 
@@ -1922,18 +2047,16 @@ void Scene::generate_debug_model(size_t a_model_index, rhi::BuffersPack &a_buffe
 		{
 			if (node.m_model != -1)
 			{
-				auto scene_node_xform = get_node_global_transform(*this, this->m_nodes[node_id]);
-
 				auto &model  = this->m_models[static_cast_safe<size_t>(node.m_model)];
 				auto &meshes = model.meshes();
 
-				for (auto &model_node : model.nodes())
+				for (size_t model_node_index = 0; model_node_index < model.nodes().size(); ++model_node_index)
 				{
+					auto &model_node = model.nodes()[model_node_index];
 					if (model_node.m_mesh_index != -1)
 					{
-						auto  node_xform = get_node_global_transform(model, model_node);
-						auto  xform      = scene_node_xform * node_xform;
-						auto &mesh       = meshes[static_cast<size_t>(model_node.m_mesh_index)];
+						auto &xform = this->node_global_transform(node_id, model_node_index);
+						auto &mesh  = meshes[static_cast<size_t>(model_node.m_mesh_index)];
 
 						for (size_t prim_index = 0; prim_index < mesh.primitives_count(); ++prim_index)
 						{
@@ -1973,6 +2096,8 @@ void Scene::generate_debug_model(size_t a_model_index, rhi::BuffersPack &a_buffe
 
 void Scene::load_models(ror::JobSystem &a_job_system, rhi::Device &a_device, const ror::Renderer &a_renderer, ror::EventSystem &a_event_system, rhi::BuffersPack &a_buffers_packs)
 {
+	profile_zone("Scene::load_models");
+
 	auto &setting = ror::settings();
 	auto  model_nodes{this->models_count()};
 
@@ -2022,6 +2147,8 @@ void Scene::load_models(ror::JobSystem &a_job_system, rhi::Device &a_device, con
 		assert(model_index == model_nodes && "Models count vs how many are queued and loaded doesn't match");
 	}
 
+	this->build_transform_hierarchy();
+
 	// Lets create and upload the stuff required for the UI as well
 	auto gui_gen_job_handle = a_job_system.push_job([&a_device, &a_event_system, &setting]() -> auto {if (setting.m_generate_gui_mesh) ror::gui().init(a_device, a_event_system); return true; });
 
@@ -2272,6 +2399,8 @@ auto Scene::find_global_program(rhi::RenderpassType a_passtype, uint32_t a_model
 
 void Scene::generate_shaders(const ror::Renderer &a_renderer, ror::JobSystem &a_job_system)
 {
+	profile_zone("Scene::generate_shaders");
+
 	const std::vector<rhi::RenderpassType> render_pass_types = a_renderer.render_pass_types();
 
 	size_t shaders_count = 0;
@@ -2623,6 +2752,8 @@ void Scene::deferred_upload(rhi::Device &a_device, ror::JobSystem &a_job_system,
 
 void Scene::upload(rhi::Device &a_device, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system, ror::Renderer &a_renderer, rhi::BuffersPack &a_buffers_packs)
 {
+	profile_zone("Scene::upload");
+
 	this->upload_models(a_job_system, a_device, a_renderer, a_buffers_packs);
 	this->init_upload_debug_geometry(a_device, a_renderer);
 
@@ -3109,6 +3240,69 @@ void Scene::read_probes()
 	}
 }
 
+void Scene::read_particle_emitters()
+{
+	if (this->m_json_file.contains("particle_emitters"))
+	{
+		auto     emitters = this->m_json_file["particle_emitters"];
+		uint32_t seed     = 1;
+
+		for (auto &emitter : emitters)
+		{
+			uint32_t capacity = emitter.contains("capacity") ? emitter["capacity"].get<uint32_t>() : 10000u;
+
+			ParticleSystem particles{capacity, seed++};
+
+			if (emitter.contains("origin"))
+			{
+				std::array<float32_t, 3> o = emitter["origin"];
+				particles.origin({o[0], o[1], o[2]});
+			}
+
+			if (emitter.contains("velocity"))
+			{
+				std::array<float32_t, 3> v = emitter["velocity"];
+				particles.velocity({v[0], v[1], v[2]});
+			}
+
+			if (emitter.contains("velocity_spread"))
+			{
+				std::array<float32_t, 3> v = emitter["velocity_spread"];
+				particles.velocity_spread({v[0], v[1], v[2]});
+			}
+
+			if (emitter.contains("gravity"))
+			{
+				std::array<float32_t, 3> g = emitter["gravity"];
+				particles.gravity({g[0], g[1], g[2]});
+			}
+
+			if (emitter.contains("start_color"))
+			{
+				std::array<float32_t, 4> c = emitter["start_color"];
+				particles.start_color({c[0], c[1], c[2], c[3]});
+			}
+
+			if (emitter.contains("end_color"))
+			{
+				std::array<float32_t, 4> c = emitter["end_color"];
+				particles.end_color({c[0], c[1], c[2], c[3]});
+			}
+
+			if (emitter.contains("rate"))
+				particles.rate(emitter["rate"]);
+
+			if (emitter.contains("life_time"))
+			{
+				std::array<float32_t, 2> l = emitter["life_time"];
+				particles.life_time(l[0], l[1]);
+			}
+
+			this->m_particles.emplace_back(std::move(particles));
+		}
+	}
+}
+
 void Scene::load_specific()
 {
 	this->read_nodes();
@@ -3117,6 +3311,7 @@ void Scene::load_specific()
 	// this->read_programs();        // I can only do this after the all the models are loaded and glslang is initialized
 	this->init_global_programs();
 	this->read_probes();
+	this->read_particle_emitters();
 }
 
 void Scene::unload()
@@ -3281,247 +3476,355 @@ void Scene::init_upload_debug_geometry(const rhi::Device &a_device, const ror::R
 	}
 }
 
-/*
-// Code for testing CPU walk, only works for one model at a time
-auto node_has_animation(ror::Model &a_model, uint32_t a_node_index, uint32_t a_animation_index)
-{
-    auto &model = a_model;
-    auto  current_anim{0u};
-    for (auto &anim : model.animations())
-    {
-        if (current_anim == a_animation_index)
-            for (auto &chanl : anim.m_channels)
-                if (chanl.m_target_node_index == a_node_index)
-                    return true;
-        current_anim++;
-    }
-
-    return false;
-}
-
-auto get_animated_trs(ror::Model &a_model, ror::Node &a_node, float32_t a_seconds, uint32_t a_node_index, uint32_t a_animation_index, size_t a_frame)
-{
-    ror::Transformf trs;
-    (void) a_seconds;
-
-    auto &model = a_model;
-    auto  current_anim{0u};
-    for (auto &anim : model.animations())
-    {
-        if (current_anim == a_animation_index)
-        {
-            const Animation::AnimationChannel *tc{nullptr};
-            const Animation::AnimationChannel *rc{nullptr};
-            const Animation::AnimationChannel *sc{nullptr};
-
-            for (auto &chanl : anim.m_channels)
-            {
-                if (chanl.m_target_node_index == a_node_index)
-                {
-                    if (chanl.m_target_node_path == AnimationTarget::translation)
-                    {
-                        assert(tc == nullptr);
-                        tc = &chanl;
-                    }
-                    else if (chanl.m_target_node_path == AnimationTarget::rotation)
-                    {
-                        assert(rc == nullptr);
-                        rc = &chanl;
-                    }
-                    else if (chanl.m_target_node_path == AnimationTarget::scale)
-                    {
-                        assert(sc == nullptr);
-                        sc = &chanl;
-                    }
-                }
-            }
-
-            if (tc != nullptr)
-            {
-                auto &anim_sampler = anim.m_samplers[tc->m_sampler_index];
-
-                size_t input_time_start = 0;
-                // size_t input_time_end   = anim_sampler.m_input.size();
-
-                // float time = std::fmodf(a_seconds, (anim_sampler.m_maximum.m_value - anim_sampler.m_minimum.m_value));
-
-                // while (input_time_start < input_time_end && anim_sampler.m_input[input_time_start].m_value < time)
-                // 	input_time_start++;
-
-                input_time_start++;
-
-                input_time_start = a_frame;
-                input_time_start = input_time_start % anim_sampler.m_input.size();
+// Parent first order of the model nodes, glTF doesn't guarantee parents come before children
+void model_nodes_order(const ror::Model &a_model, std::vector<uint32_t> &a_order)
+{
+	auto &model_nodes = a_model.nodes();
+
+	std::vector<uint32_t> depths(model_nodes.size(), 0u);
+	for (size_t index = 0; index < model_nodes.size(); ++index)
+	{
+		auto parent = model_nodes[index].m_parent;
+		while (parent != -1)
+		{
+			depths[index]++;
+			parent = model_nodes[static_cast_safe<size_t>(parent)].m_parent;
+		}
+	}
+
+	a_order.resize(model_nodes.size());
+	for (uint32_t index = 0; index < a_order.size(); ++index)
+		a_order[index] = index;
+
+	std::stable_sort(a_order.begin(), a_order.end(), [&depths](uint32_t a_left, uint32_t a_right) { return depths[a_left] < depths[a_right]; });
+}
+
+// Scene nodes are already parent first, model nodes are added in model_nodes_order() with the model roots parented to their scene node
+void Scene::build_transform_hierarchy()
+{
+	uint32_t nodes_count = static_cast_safe<uint32_t>(this->m_nodes.size());
+
+	this->m_transform_offsets.assign(this->m_nodes_data.size(), 0u);
+	for (size_t node_index = 0; node_index < this->m_nodes_data.size(); ++node_index)
+	{
+		auto &node = this->m_nodes_data[node_index];
+		if (node.m_model != -1)
+		{
+			this->m_transform_offsets[node_index] = nodes_count;
+			nodes_count += static_cast_safe<uint32_t>(this->m_models[static_cast_safe<size_t>(node.m_model)].nodes().size());
+		}
+	}
 
-                // input_time_start = 0;
-                size_t    cin = input_time_start * 3;
-                float32_t sx  = reinterpret_cast<const float32_t *>(anim_sampler.m_output.data())[cin + 0];
-                float32_t sy  = reinterpret_cast<const float32_t *>(anim_sampler.m_output.data())[cin + 1];
-                float32_t sz  = reinterpret_cast<const float32_t *>(anim_sampler.m_output.data())[cin + 2];
+	this->m_transform_hierarchy.clear();
+	this->m_transform_hierarchy.reserve(nodes_count);
+	this->m_transform_slots.resize(nodes_count);
 
-                trs.translation({sx, sy, sz});
-            }
-            if (rc != nullptr)
-            {
-                auto &anim_sampler = anim.m_samplers[rc->m_sampler_index];
+	for (size_t node_index = 0; node_index < this->m_nodes.size(); ++node_index)
+	{
+		auto &node   = this->m_nodes[node_index];
+		auto  parent = node.m_parent == -1 ? -1 : static_cast_safe<int32_t>(this->m_transform_slots[static_cast_safe<size_t>(node.m_parent)]);
 
-                size_t input_time_start = 0;
-                input_time_start = a_frame;
-                input_time_start = input_time_start % anim_sampler.m_input.size();
+		this->m_transform_slots[node_index] = this->m_transform_hierarchy.add(node.m_trs_transform, parent);
+	}
 
-                // input_time_start = 0;
-                size_t    cin = input_time_start * 4;
-                float32_t rx  = reinterpret_cast<const float32_t *>(anim_sampler.m_output.data())[cin + 0];
-                float32_t ry  = reinterpret_cast<const float32_t *>(anim_sampler.m_output.data())[cin + 1];
-                float32_t rz  = reinterpret_cast<const float32_t *>(anim_sampler.m_output.data())[cin + 2];
-                float32_t rw  = reinterpret_cast<const float32_t *>(anim_sampler.m_output.data())[cin + 3];
+	std::vector<uint32_t> order{};
+	for (size_t node_index = 0; node_index < this->m_nodes_data.size(); ++node_index)
+	{
+		auto &node = this->m_nodes_data[node_index];
+		if (node.m_model != -1)
+		{
+			auto &model_nodes = this->m_models[static_cast_safe<size_t>(node.m_model)].nodes();
+			auto *slots       = this->m_transform_slots.data() + this->m_transform_offsets[node_index];
 
-                trs.rotation({rx, ry, rz, rw});
-            }
-            if (sc != nullptr)
-            {
-                auto &anim_sampler = anim.m_samplers[sc->m_sampler_index];
-
-                size_t input_time_start = 0;
-                input_time_start++;
-
-                input_time_start = a_frame;
-                input_time_start = input_time_start % anim_sampler.m_input.size();
-                // input_time_start = 0;
-                size_t    cin = input_time_start * 3;
-                float32_t sx  = reinterpret_cast<const float32_t *>(anim_sampler.m_output.data())[cin + 0];
-                float32_t sy  = reinterpret_cast<const float32_t *>(anim_sampler.m_output.data())[cin + 1];
-                float32_t sz  = reinterpret_cast<const float32_t *>(anim_sampler.m_output.data())[cin + 2];
+			model_nodes_order(this->m_models[static_cast_safe<size_t>(node.m_model)], order);
 
-                trs.scale({sx, sy, sz});
-            }
-            break;
-        }
-        current_anim++;
-    }
+			for (auto model_node_index : order)
+			{
+				auto &model_node = model_nodes[model_node_index];
+				auto  parent     = model_node.m_parent == -1 ? this->m_transform_slots[node_index] : slots[static_cast_safe<size_t>(model_node.m_parent)];
 
-    (void) a_node;
-
-    return trs;
-}
-
-auto trs_to_matrix4(ror::Transformf& a_trs)
-{
-    ror::Matrix4f translation = ror::matrix4_translation(a_trs.translation());
-    ror::Matrix4f rotation    = ror::matrix4_rotation(a_trs.rotation());
-    ror::Matrix4f scale       = ror::matrix4_scaling(a_trs.scale());
+				slots[model_node_index] = this->m_transform_hierarchy.add(model_node.m_trs_transform, static_cast_safe<int32_t>(parent));
+			}
+		}
+	}
 
-    return translation * rotation * scale;
+	this->m_transform_hierarchy.update();
 }
 
-auto get_node_global_transform(ror::Model &a_model, ror::Node &a_node, const ror::SceneNodeData &a_scene_node_data, float32_t a_seconds, uint32_t a_node_index, size_t a_frame)
+void Scene::update_particles(ror::JobSystem &a_job_system, float32_t a_delta_seconds)
 {
-    (void) a_scene_node_data;
-    (void) a_seconds;
-    (void) a_node_index;
-    (void) a_frame;
+	if (this->m_particles.empty())
+		return;
+
+	profile_zone("Scene::update_particles");
+
+	// Emitters attached to nodes follow them
+	for (size_t node_index = 0; node_index < this->m_nodes_data.size() && node_index < this->m_transform_slots.size(); ++node_index)
+	{
+		auto particle_id = this->m_nodes_data[node_index].m_particle_id;
+		if (particle_id >= 0 && static_cast<size_t>(particle_id) < this->m_particles.size())
+			this->m_particles[static_cast<size_t>(particle_id)].origin(this->node_global_transform(node_index).origin());
+	}
+
+	// Big emitters are integrated in chunks on all workers, then each emitter retires and emits on its own job
+	constexpr uint32_t particles_per_job{32768};        // Must be a multiple of ParticleSystem::simd_width
 
-    ror::Matrix4f node_matrix{};
-    auto         &model_nodes = a_model.nodes();
+	static_assert(particles_per_job % ParticleSystem::simd_width == 0, "Particle jobs must start at simd boundaries");
 
-    // uint32_t        animation_index = a_scene_node_data.m_animation;
-    ror::Transformf trs{};
-    // if (node_has_animation(a_model, a_node_index, animation_index))
-    // 	trs = get_animated_trs(a_model, a_node, a_seconds, a_node_index, animation_index, a_frame);
-    // else
-    trs = a_node.m_trs_transform;
+	std::vector<ror::JobHandle<bool>> job_handles{};
 
-    node_matrix = trs_to_matrix4(trs);
+	for (auto &emitter : this->m_particles)
+		for (uint32_t first = 0; first < emitter.size(); first += particles_per_job)
+			job_handles.emplace_back(a_job_system.push_job([&emitter, a_delta_seconds, first]() -> auto {
+				emitter.integrate(a_delta_seconds, first, std::min(first + particles_per_job, emitter.size()));
+				return true;
+			}));
 
-    ror::Node *node = &a_node;
+	for (auto &handle : job_handles)
+		handle.wait();
 
-    while (node->m_parent != -1)
-    {
-        auto           &p = model_nodes[static_cast<size_t>(node->m_parent)];
-        ror::Transformf ptrs{};
-        // if (node_has_animation(a_model, static_cast<uint32_t>(node->m_parent), animation_index))
-        // 	ptrs = get_animated_trs(a_model, a_node, a_seconds, static_cast<uint32_t>(node->m_parent), animation_index, a_frame);
-        // else
-        ptrs = p.m_trs_transform;
+	job_handles.clear();
 
-        node_matrix = trs_to_matrix4(ptrs) * node_matrix;
+	for (auto &emitter : this->m_particles)
+		job_handles.emplace_back(a_job_system.push_job([&emitter, a_delta_seconds]() -> auto {
+			emitter.retire();
+			emitter.emit(a_delta_seconds);
+			return true;
+		}));
 
-        node = &p;
-    }
+	for (auto &handle : job_handles)
+		handle.wait();
+}
 
-    return node_matrix;
+const ror::Matrix4f &Scene::node_global_transform(size_t a_node_index) const
+{
+	assert(a_node_index < this->m_nodes.size() && a_node_index < this->m_transform_slots.size() && "Transform hierarchy is not built");
+	return this->m_transform_hierarchy.world(this->m_transform_slots[a_node_index]);
 }
 
-auto get_node_transforms(ror::Scene &a_scene, float32_t a_seconds)
+// Called once a frame by the renderer after the camera is updated, for both cpu and compute animation, render() then uses the draws for every pass of the camera
+// Adds every primitive of the meshes render() could cull to the selector in the order render() visits them and picks their levels
+// Same as culling, animated, skinned and morphed meshes are left out because their bounds are only known for the rest pose,
+// which also means the transforms of everything selected are the ones build_transform_hierarchy() cached at load
+void Scene::select_lods(ror::JobSystem &a_job_system)
 {
-    auto &nodes_data = a_scene.nodes_side_data();
+	profile_zone("Scene::select_lods");
 
-    std::vector<ror::Matrix4f> node_matrices{};
+	auto &setting = ror::settings();
+	auto &camera  = this->current_camera();
 
-    for (auto &node : a_scene.nodes())
-        node_matrices.emplace_back(trs_to_matrix4(node.m_trs_transform));
+	// The frustum is built from a perspective projection only, so orthographic cameras get full detail
+	if (!setting.m_select_lods || camera.type() != CameraType::perspective || this->m_transform_slots.empty())
+	{
+		this->m_lod_firsts.clear();
+		return;
+	}
 
-    static size_t    frame          = 0;
-    static float32_t frame_fraction = 0.0f;
+	this->m_lod_selector.m_pixel_error     = setting.m_lod_pixel_error;
+	this->m_lod_selector.m_triangle_budget = setting.m_lod_triangle_budget;
 
-    bool found_one = false;
-    for (auto &node : nodes_data)
-    {
-        if (node.m_model != -1)
-        {
-            assert(found_one == false);
-            found_one = true;
+	this->m_lod_selector.clear();
+	this->m_lod_firsts.assign(this->m_transform_slots.size(), ~0u);
 
-            auto &model       = a_scene.models()[ror::static_cast_safe<size_t>(node.m_model)];
-            auto &model_nodes = model.nodes();
+	size_t node_id = 0;
+	for (auto &node : this->m_nodes_data)
+	{
+		if (node.m_model != -1)
+		{
+			auto &model  = this->m_models[static_cast_safe<size_t>(node.m_model)];
+			auto &meshes = model.meshes();
 
-            node_matrices.reserve(node_matrices.size() + model_nodes.size());
+			if (model.animations().empty())
+			{
+				size_t node_data_index = 0;
+				for (auto &model_node : model.nodes())
+				{
+					if (model_node.m_mesh_index != -1 && model_node.m_visible)
+					{
+						auto &mesh = meshes[static_cast<size_t>(model_node.m_mesh_index)];
+						if (mesh.skin_index() == -1 && !mesh.has_morphs())
+						{
+							auto &xform = this->node_global_transform(node_id, node_data_index);
 
-            for (uint32_t model_node_index = 0; model_node_index < model_nodes.size(); ++model_node_index)
-            {
-                auto &n = model_nodes[model_node_index];
-                node_matrices.emplace_back(get_node_global_transform(model, n, node, a_seconds, model_node_index, frame));
-            }
-        }
-    }
+							this->m_lod_firsts[this->m_transform_offsets[node_id] + node_data_index] = this->m_lod_selector.size();
+							for (size_t prim_id = 0; prim_id < mesh.primitives_count(); ++prim_id)
+							{
+								auto &lods = mesh.lods(prim_id);
+								this->m_lod_selector.add({xform, &mesh.bounding_box(prim_id), lods.data(), static_cast_safe<uint32_t>(lods.size())});
+							}
+						}
+					}
+					node_data_index++;
+				}
+			}
+		}
+		node_id++;
+	}
 
-    frame_fraction += 0.5f;
+	this->m_lod_selector.select(a_job_system, camera, setting.m_frustum_cull ? &camera.frustum() : nullptr);
+}
 
-    frame = static_cast_safe<size_t>(frame_fraction);
+const ror::Matrix4f &Scene::node_global_transform(size_t a_node_index, size_t a_model_node_index) const
+{
+	auto index = this->m_transform_offsets[a_node_index] + a_model_node_index;
 
-    return node_matrices;
+	assert(index < this->m_transform_slots.size() && "Transform hierarchy is not built");
+	return this->m_transform_hierarchy.world(this->m_transform_slots[index]);
 }
 
-void Scene::cpu_walk_scene(rhi::ComputeCommandEncoder &a_command_encoder,
-                           rhi::Device                &a_device,
-                           rhi::BuffersPack           &a_buffers_pack,
-                           ror::Renderer              &a_renderer,
-                           const rhi::Rendersubpass   &a_subpass,
-                           Timer                      &a_timer,
-                           ror::EventSystem           &a_event_system)
+void Scene::cpu_walk_scene(ror::JobSystem &a_job_system, ror::Renderer &a_renderer, Timer &a_timer, ror::EventSystem &a_event_system)
 {
-    (void) a_device;
-    (void) a_buffers_pack;
-    (void) a_command_encoder;
-    (void) a_subpass;
-    (void) a_timer;
-    (void) a_event_system;
-    (void) a_renderer;
+	if (this->m_nodes.size() == 0)
+		return;
+
+	static float32_t seconds{0.0f};
+	seconds += static_cast<float32_t>(a_timer.tick_seconds());
+
+	// TODO: After some time reset the seconds
+	if (seconds > 1000.0f)        // TODO: Move the 1000 to settings
+		seconds = seconds - static_cast<float32_t>(static_cast<int32_t>(seconds));
+
+	static bool first_run = true;
+	if (first_run)
+	{
+		auto animation_start_stop_toggle_callback = [this](Event) {
+			this->m_pause_animation = !this->m_pause_animation;
+		};
+
+		a_event_system.subscribe(ror::keyboard_p_down, animation_start_stop_toggle_callback);
+		first_run = false;
+	}
+
+	// Same layout as copy_node_transforms() and fill_morph_weights(), scene nodes first then all model nodes of each scene node in order
+	std::vector<uint32_t> instances{};
+	std::vector<uint32_t> weights_offsets(this->m_nodes_data.size(), 0u);
+
+	uint32_t nodes_count   = static_cast_safe<uint32_t>(this->m_nodes.size());
+	uint32_t weights_count = 0u;
+
+	this->m_animation_states.resize(this->m_nodes_data.size());
+
+	for (uint32_t node_index = 0; node_index < this->m_nodes_data.size(); ++node_index)
+	{
+		auto &node = this->m_nodes_data[node_index];
+		if (node.m_model != -1)
+		{
+			auto &model = this->m_models[static_cast_safe<size_t>(node.m_model)];
+			auto &state = this->m_animation_states[node_index];
+
+			weights_offsets[node_index] = weights_count;
+
+			nodes_count += static_cast_safe<uint32_t>(model.nodes().size());
+
+			if (state.m_weights_offsets.size() != model.nodes().size())
+			{
+				state.m_weights_offsets.assign(model.nodes().size(), -1);
+
+				int32_t offset = 0;
+				for (size_t model_node_index = 0; model_node_index < model.nodes().size(); ++model_node_index)
+				{
+					auto &model_node = model.nodes()[model_node_index];
+					if (model_node.m_mesh_index != -1)
+					{
+						auto &mesh = model.meshes()[static_cast_safe<size_t>(model_node.m_mesh_index)];
+						if (mesh.has_morphs())
+						{
+							state.m_weights_offsets[model_node_index] = offset;
+							offset += static_cast_safe<int32_t>(mesh.weights_count());
+						}
+					}
+				}
+			}
+
+			for (size_t model_node_index = 0; model_node_index < model.nodes().size(); ++model_node_index)
+				if (state.m_weights_offsets[model_node_index] != -1)
+					weights_count += static_cast_safe<uint32_t>(model.meshes()[static_cast_safe<size_t>(model.nodes()[model_node_index].m_mesh_index)].weights_count());
+
+			instances.push_back(node_index);
+		}
+	}
+
+	if (this->m_transform_slots.size() != nodes_count)
+		this->build_transform_hierarchy();
+
+	this->m_node_matrices.resize(nodes_count);
+	this->m_morph_weights.resize(weights_count);
+
+	// Each instance writes to its own range of hierarchy nodes and weights, so they can all be animated in parallel
+	// Only the nodes targeted by the animation channels are marked dirty, everything else keeps its cached world matrix
+	auto animate_instance = [this, &instances, &weights_offsets](uint32_t a_instance) {
+		auto  node_index  = instances[a_instance];
+		auto &node        = this->m_nodes_data[node_index];
+		auto &model       = this->m_models[static_cast_safe<size_t>(node.m_model)];
+		auto &model_nodes = model.nodes();
+		auto &state       = this->m_animation_states[node_index];
+		auto *weights     = this->m_morph_weights.data() + weights_offsets[node_index];
+		auto *slots       = this->m_transform_slots.data() + this->m_transform_offsets[node_index];
+		auto &hierarchy   = this->m_transform_hierarchy;
+
+		state.m_transforms.resize(model_nodes.size());
+		for (size_t model_node_index = 0; model_node_index < model_nodes.size(); ++model_node_index)
+		{
+			state.m_transforms[model_node_index] = model_nodes[model_node_index].m_trs_transform;
+
+			auto offset = state.m_weights_offsets[model_node_index];
+			if (offset != -1)
+			{
+				auto &mesh = model.meshes()[static_cast_safe<size_t>(model_nodes[model_node_index].m_mesh_index)];
+				std::copy(mesh.weights().begin(), mesh.weights().end(), weights + offset);
+			}
+		}
+
+		auto &animations = model.animations();
+		if (!this->m_pause_animation && node.m_animation < animations.size())
+		{
+			auto &animation = animations[node.m_animation];
+
+			// Cursors of another animation are only bad hints, but they could be out of range, also nodes it animated needs to go back to rest pose
+			if (state.m_animation != node.m_animation)
+			{
+				state.m_animation = node.m_animation;
+				state.m_cursors.clear();
+
+				for (size_t model_node_index = 0; model_node_index < model_nodes.size(); ++model_node_index)
+					hierarchy.transform(slots[model_node_index], state.m_transforms[model_node_index]);
+			}
+
+			animation_animate(animation, animation_time(animation, seconds), state.m_cursors, state.m_transforms, weights, state.m_weights_offsets);
+
+			for (auto &channel : animation.m_channels)
+				if (channel.m_target_node_path != AnimationTarget::weight)
+					hierarchy.transform(slots[channel.m_target_node_index], state.m_transforms[channel.m_target_node_index]);
+		}
+		else if (state.m_animation != std::numeric_limits<uint32_t>::max())
+		{
+			// Stopped animating, back to rest pose
+			state.m_animation = std::numeric_limits<uint32_t>::max();
 
-    static float32_t seconds{0.0f};
-    seconds += static_cast<float32_t>(a_timer.tick_seconds());
+			for (size_t model_node_index = 0; model_node_index < model_nodes.size(); ++model_node_index)
+				hierarchy.transform(slots[model_node_index], state.m_transforms[model_node_index]);
+		}
+	};
+
+	a_job_system.parallel_for(0u, static_cast_safe<uint32_t>(instances.size()), animate_instance);
+
+	this->m_transform_hierarchy.update();
 
-    // TODO: After some time reset the seconds
-    if (seconds > 1000.0f)        // TODO: Move the 1000 to settings
-        seconds = seconds - static_cast<float32_t>(static_cast<int32_t>(seconds));
+	for (size_t index = 0; index < this->m_node_matrices.size(); ++index)
+		this->m_node_matrices[index] = this->m_transform_hierarchy.world(this->m_transform_slots[index]);
 
-    auto matrices  = get_node_transforms(*this, seconds);
-    auto model_ubo = a_renderer.shader_buffer("nodes_model");
+	auto nodes_models_uniform = a_renderer.shader_buffer("nodes_models");
+	nodes_models_uniform->buffer_map();
+	nodes_models_uniform->update("node_model", 0u, this->m_node_matrices.data(), static_cast_safe<uint32_t>(this->m_node_matrices.size() * sizeof(ror::Matrix4f)));
+	nodes_models_uniform->buffer_unmap();
 
-    model_ubo->buffer_map();
-    model_ubo->update("node_model_mat4", &matrices[0].m_values, static_cast_safe<uint32_t>(matrices.size() * sizeof(ror::Matrix4f)));
-    model_ubo->buffer_unmap();
+	if (weights_count > 0)
+	{
+		auto morphs_weights_uniform = a_renderer.shader_buffer("morphs_weights");
+		morphs_weights_uniform->buffer_map();
+		morphs_weights_uniform->update("morph_weights", 0u, this->m_morph_weights.data(), static_cast_safe<uint32_t>(this->m_morph_weights.size() * sizeof(float32_t)));
+		morphs_weights_uniform->buffer_unmap();
+	}
 }
-*/
 
 }        // namespace ror
@@ -31,10 +31,14 @@
 #include "foundation/rorjobsystem.hpp"
 #include "foundation/rormacros.hpp"
 #include "foundation/rortypes.hpp"
+#include "graphics/roranimation.hpp"
 #include "graphics/rordynamic_mesh.hpp"
 #include "graphics/rorlight.hpp"
+#include "graphics/rorlod_selector.hpp"
 #include "graphics/rormodel.hpp"
 #include "graphics/rornode.hpp"
+#include "graphics/rorparticle_system.hpp"
+#include "graphics/rortransform_hierarchy.hpp"
 #include "math/rormatrix4.hpp"
 #include "math/rortransform.hpp"
 #include "profiling/rortimer.hpp"
@@ -54,10 +58,6 @@
 
 namespace ror
 {
-// TODO: Define properly somewhere
-class ROAR_ENGINE_ITEM ParticleSystem
-{};
-
 class ROAR_ENGINE_ITEM SceneNode
 {
   public:
@@ -119,9 +119,11 @@ class ROAR_ENGINE_ITEM Scene : public Configuration<Scene>
 	void render(const rhi::Device &a_device, rhi::RenderCommandEncoder &a_encoder, rhi::BuffersPack &a_buffers_pack, ror::Renderer &a_renderer, const rhi::Renderpass &a_pass, const rhi::Rendersubpass &a_subpass, ror::EventSystem &a_event_system);
 	void pre_render(rhi::RenderCommandEncoder &a_encoder, rhi::BuffersPack &a_buffers_pack, ror::Renderer &a_renderer, const rhi::Rendersubpass &a_subpass);
 	void compute_pass_walk_scene(rhi::ComputeCommandEncoder &a_command_encoder, rhi::Device &a_device, rhi::BuffersPack &a_buffers_pack, ror::Renderer &a_renderer, const rhi::Rendersubpass &a_subpass, Timer &a_timer, ror::EventSystem &a_event_system);
-	// void cpu_walk_scene(rhi::ComputeCommandEncoder &a_command_encoder, rhi::Device &a_device, rhi::BuffersPack &a_buffers_pack, ror::Renderer &a_renderer, const rhi::Rendersubpass &a_subpass, Timer &a_timer, ror::EventSystem &a_event_system);
+	void cpu_walk_scene(ror::JobSystem &a_job_system, ror::Renderer &a_renderer, Timer &a_timer, ror::EventSystem &a_event_system);
 
 	void     update(ror::Renderer &a_renderer, ror::Timer &a_timer);
+	void     update_particles(ror::JobSystem &a_job_system, float32_t a_delta_seconds);
+	void     select_lods(ror::JobSystem &a_job_system);
 	void     update_from_scene_state();
 	void     update_camera_from_scene_state();
 	void     update_lights_from_scene_state();
@@ -157,6 +159,7 @@ class ROAR_ENGINE_ITEM Scene : public Configuration<Scene>
 	FORCE_INLINE constexpr const auto &bounding_box()     const noexcept   {  return this->m_bounding_box;    }
 	FORCE_INLINE constexpr       auto &dymanic_meshes()   const noexcept   {  return this->m_dynamic_meshes;  }
 	FORCE_INLINE constexpr       auto  has_shadows()      const noexcept   {  return this->m_has_shadows;     }
+	FORCE_INLINE constexpr const auto &lod_selector()     const noexcept   {  return this->m_lod_selector;    }
 
 	FORCE_INLINE constexpr const auto &current_camera()   const noexcept   {  return this->m_cameras[this->m_current_camera_index]; }
 	FORCE_INLINE constexpr       auto &current_camera()         noexcept   {  return this->m_cameras[this->m_current_camera_index]; }
@@ -230,8 +233,10 @@ class ROAR_ENGINE_ITEM Scene : public Configuration<Scene>
 	void read_programs();
 	void init_global_programs();
 	void read_probes();
+	void read_particle_emitters();
 	void generate_shaders(const ror::Renderer &a_renderer, ror::JobSystem &a_job_system);
 	void update_bounding_box();
+	void build_transform_hierarchy();
 	void generate_grid_model(ror::JobSystem &a_job_system, const std::function<bool(size_t)> &a_upload_job, std::vector<ror::JobHandle<bool>> &a_job_handles, size_t a_model_index, rhi::BuffersPack &a_buffer_pack);
 	void generate_debug_model(size_t a_model_index, rhi::BuffersPack &a_buffer_pack);
 	void add_model_node(int32_t a_model_index);
@@ -241,6 +246,9 @@ class ROAR_ENGINE_ITEM Scene : public Configuration<Scene>
 	void create_global_program(const char *a_vertex_shader, const char *a_fragment_shader, size_t a_node_id, size_t a_model_id);
 	auto find_global_program(rhi::RenderpassType a_passtype, uint32_t a_model_id, uint32_t a_mesh_id, size_t a_prim_id, Scene::GlobalProgram **a_global_program);
 
+	const ror::Matrix4f &node_global_transform(size_t a_node_index) const;
+	const ror::Matrix4f &node_global_transform(size_t a_node_index, size_t a_model_node_index) const;
+
 	using RenderpassPrograms = std::unordered_map<rhi::RenderpassType, std::vector<rhi::Program>>;
 	using GlobalPrograms     = std::unordered_map<rhi::RenderpassType, std::vector<GlobalProgram>>;
 
@@ -261,7 +269,16 @@ class ROAR_ENGINE_ITEM Scene : public Configuration<Scene>
 	bool                             m_has_shadows{false};                                     //! To tell any fragment shaders for any pass generated to use shadow mapping, this is NOT about shadow pass itself
 	rhi::TriangleFillMode            m_triangle_fill_mode{rhi::TriangleFillMode::fill};        //! Triangle fill mode, initially filled but could be lines too
 	std::vector<ror::DynamicMesh>    m_dynamic_meshes{};                                       //! All the dynamic meshes created in the scene could be rendererd at once in the end
+	std::vector<ror::AnimationState> m_animation_states{};                                     //! CPU animation playback state per node, only used by nodes with models when animating on the CPU
+	std::vector<ror::Matrix4f>       m_node_matrices{};                                        //! CPU evaluated global matrices of all scene and model nodes, in the nodes_models layout
+	std::vector<float32_t>           m_morph_weights{};                                        //! CPU animated morph weights of all models, in the morphs_weights layout
+	ror::TransformHierarchy          m_transform_hierarchy{};                                  //! All scene and model nodes in parent first order, caches their global matrices
+	std::vector<uint32_t>            m_transform_slots{};                                      //! Index into m_transform_hierarchy of each node in the nodes_models layout
+	std::vector<uint32_t>            m_transform_offsets{};                                    //! Offset of each scene node's model nodes in the nodes_models layout
+	ror::LodSelector                 m_lod_selector{};                                         //! Picks a level of detail for each static mesh primitive every frame
+	std::vector<uint32_t>            m_lod_firsts{};                                           //! Index in m_lod_selector of each node's first primitive in the nodes_models layout, ~0u if its mesh isn't selected, empty if nothing was selected this frame
 	SceneState                       m_scene_state;                                            //! All the scene data that can be saved and restored to and from disk
+	ror::Timer                       m_particles_timer{};                                      //! Particles have their own clock so they don't steal time from the animation timer
 	uint32_t                         m_current_camera_index{0};                                //! Camera to use to render the scene
 };
 
@@ -79,10 +79,9 @@ class ROAR_ENGINE_ITEM Skin
 
 	void update()
 	{
-		auto stride = this->m_joint_offset_shader_buffer.stride("joint_redirect");
+		auto handle = this->m_joint_offset_shader_buffer.handle("joint_redirect");
 		this->m_joint_offset_shader_buffer.buffer_map();
-		for (size_t joint_id = 0; joint_id < this->m_joints.size(); ++joint_id)
-			this->m_joint_offset_shader_buffer.update("joint_redirect", &this->m_joints[joint_id], static_cast<uint32_t>(joint_id), stride);
+		this->m_joint_offset_shader_buffer.update_strided(handle, this->m_joints.data(), 0u, static_cast_safe<uint32_t>(this->m_joints.size()), handle.m_stride, static_cast_safe<uint32_t>(sizeof(uint16_t)));
 		this->m_joint_offset_shader_buffer.buffer_unmap();
 
 		this->m_inverse_bind_shader_buffer.buffer_map();
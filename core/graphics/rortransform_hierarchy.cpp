@@ -0,0 +1,156 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "graphics/rortransform_hierarchy.hpp"
+#include "math/rormatrix4_functions.hpp"
+#include <algorithm>
+#include <cassert>
+
+namespace ror
+{
+namespace
+{
+// Same as matrix4_transformation(T, R, S) but scales the rotation columns in place instead of doing two matrix multiplies
+FORCE_INLINE void local_matrix(const Vector3f &a_translation, const Quaternionf &a_rotation, const Vector3f &a_scale, Matrix4f &a_matrix)
+{
+	a_matrix = matrix4_rotation(a_rotation);
+
+	a_matrix.m_values[0] *= a_scale.x;
+	a_matrix.m_values[1] *= a_scale.x;
+	a_matrix.m_values[2] *= a_scale.x;
+
+	a_matrix.m_values[4] *= a_scale.y;
+	a_matrix.m_values[5] *= a_scale.y;
+	a_matrix.m_values[6] *= a_scale.y;
+
+	a_matrix.m_values[8] *= a_scale.z;
+	a_matrix.m_values[9] *= a_scale.z;
+	a_matrix.m_values[10] *= a_scale.z;
+
+	a_matrix.m_values[12] = a_translation.x;
+	a_matrix.m_values[13] = a_translation.y;
+	a_matrix.m_values[14] = a_translation.z;
+}
+}        // namespace
+
+uint32_t TransformHierarchy::add(const Transformf &a_transform, int32_t a_parent)
+{
+	auto index = this->size();
+
+	assert(a_parent < static_cast<int32_t>(index) && "Parents must be added before their children");
+
+	this->m_translations.push_back(a_transform.m_translation);
+	this->m_rotations.push_back(a_transform.m_rotation);
+	this->m_scales.push_back(a_transform.m_scale);
+	this->m_parents.push_back(a_parent);
+	this->m_locals.emplace_back();
+	this->m_worlds.emplace_back();
+	this->m_dirty.push_back(local_dirty);
+
+	return index;
+}
+
+void TransformHierarchy::update()
+{
+	auto count   = this->m_parents.size();
+	auto parents = this->m_parents.data();
+	auto dirty   = this->m_dirty.data();
+	auto locals  = this->m_locals.data();
+	auto worlds  = this->m_worlds.data();
+
+	bool changed = false;
+	for (size_t index = 0; index < count; ++index)
+	{
+		auto parent       = parents[index];
+		bool parent_dirty = parent != -1 && (dirty[parent] & world_dirty);
+
+		if (dirty[index] & local_dirty)
+			local_matrix(this->m_translations[index], this->m_rotations[index], this->m_scales[index], locals[index]);
+		else if (!parent_dirty)
+			continue;
+
+		if (parent == -1)
+			worlds[index] = locals[index];
+		else
+			worlds[index] = worlds[parent] * locals[index];
+
+		dirty[index] = world_dirty;
+		changed      = true;
+	}
+
+	// Flags are only cleared once all children have seen their parents world_dirty flags
+	if (changed)
+		std::fill(this->m_dirty.begin(), this->m_dirty.end(), uint8_t{0});
+}
+
+void TransformHierarchy::reserve(size_t a_count)
+{
+	this->m_translations.reserve(a_count);
+	this->m_rotations.reserve(a_count);
+	this->m_scales.reserve(a_count);
+	this->m_parents.reserve(a_count);
+	this->m_locals.reserve(a_count);
+	this->m_worlds.reserve(a_count);
+	this->m_dirty.reserve(a_count);
+}
+
+void TransformHierarchy::clear() noexcept
+{
+	this->m_translations.clear();
+	this->m_rotations.clear();
+	this->m_scales.clear();
+	this->m_parents.clear();
+	this->m_locals.clear();
+	this->m_worlds.clear();
+	this->m_dirty.clear();
+}
+
+void TransformHierarchy::transform(uint32_t a_index, const Transformf &a_transform) noexcept
+{
+	this->m_translations[a_index] = a_transform.m_translation;
+	this->m_rotations[a_index]    = a_transform.m_rotation;
+	this->m_scales[a_index]       = a_transform.m_scale;
+	this->m_dirty[a_index]        = local_dirty;
+}
+
+void TransformHierarchy::translation(uint32_t a_index, const Vector3f &a_translation) noexcept
+{
+	this->m_translations[a_index] = a_translation;
+	this->m_dirty[a_index]        = local_dirty;
+}
+
+void TransformHierarchy::rotation(uint32_t a_index, const Quaternionf &a_rotation) noexcept
+{
+	this->m_rotations[a_index] = a_rotation;
+	this->m_dirty[a_index]     = local_dirty;
+}
+
+void TransformHierarchy::scale(uint32_t a_index, const Vector3f &a_scale) noexcept
+{
+	this->m_scales[a_index] = a_scale;
+	this->m_dirty[a_index]  = local_dirty;
+}
+
+}        // namespace ror
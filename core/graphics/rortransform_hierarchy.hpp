@@ -0,0 +1,92 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#pragma once
+
+#include "foundation/rormacros.hpp"
+#include "foundation/rortypes.hpp"
+#include "math/rormatrix4.hpp"
+#include "math/rorquaternion.hpp"
+#include "math/rortransform.hpp"
+#include "math/rorvector3.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace ror
+{
+/**
+ * Flat transform hierarchy, all the nodes are kept in parent first order as structure of arrays
+ * Each node has its own translation, rotation, scale, parent index, local matrix and world matrix, plus a dirty flag
+ * Changing a node only marks it dirty, update() then recomputes the world matrices in one linear pass touching only the dirty subtrees
+ * Since parents are always before their children a node's parent world matrix is always up to date by the time the node is visited
+ * Setters only touch the node they are called for, so different nodes can be changed from different jobs before calling update()
+ */
+class ROAR_ENGINE_ITEM TransformHierarchy final
+{
+  public:
+	FORCE_INLINE                     TransformHierarchy()                                      = default;        //! Default constructor
+	FORCE_INLINE                     TransformHierarchy(const TransformHierarchy &a_other)     = default;        //! Copy constructor
+	FORCE_INLINE                     TransformHierarchy(TransformHierarchy &&a_other) noexcept = default;        //! Move constructor
+	FORCE_INLINE TransformHierarchy &operator=(const TransformHierarchy &a_other)              = default;        //! Copy assignment operator
+	FORCE_INLINE TransformHierarchy &operator=(TransformHierarchy &&a_other) noexcept          = default;        //! Move assignment operator
+	FORCE_INLINE ~TransformHierarchy() noexcept                                                = default;        //! Destructor
+
+	uint32_t add(const Transformf &a_transform, int32_t a_parent = -1);        // Appends a node and returns its index, a_parent must be -1 or an already added node
+	void     update();                                                          // Recomputes local and world matrices of all dirty nodes and their children
+	void     reserve(size_t a_count);
+	void     clear() noexcept;
+
+	void transform(uint32_t a_index, const Transformf &a_transform) noexcept;
+	void translation(uint32_t a_index, const Vector3f &a_translation) noexcept;
+	void rotation(uint32_t a_index, const Quaternionf &a_rotation) noexcept;
+	void scale(uint32_t a_index, const Vector3f &a_scale) noexcept;
+
+	// clang-format off
+	FORCE_INLINE constexpr auto  size()                           const noexcept { return static_cast<uint32_t>(this->m_parents.size());  }
+	FORCE_INLINE constexpr auto &translation(uint32_t a_index)    const noexcept { return this->m_translations[a_index];                 }
+	FORCE_INLINE constexpr auto &rotation(uint32_t a_index)       const noexcept { return this->m_rotations[a_index];                    }
+	FORCE_INLINE constexpr auto &scale(uint32_t a_index)          const noexcept { return this->m_scales[a_index];                       }
+	FORCE_INLINE constexpr auto  parent(uint32_t a_index)         const noexcept { return this->m_parents[a_index];                      }
+	FORCE_INLINE constexpr auto &local(uint32_t a_index)          const noexcept { return this->m_locals[a_index];                       }
+	FORCE_INLINE constexpr auto &world(uint32_t a_index)          const noexcept { return this->m_worlds[a_index];                       }
+	FORCE_INLINE constexpr auto &worlds()                         const noexcept { return this->m_worlds;                                }
+	FORCE_INLINE constexpr auto  dirty(uint32_t a_index)          const noexcept { return (this->m_dirty[a_index] & local_dirty) != 0;   }
+	// clang-format on
+
+  protected:
+  private:
+	static constexpr uint8_t local_dirty{1 << 0};        //! TRS has changed since the last update
+	static constexpr uint8_t world_dirty{1 << 1};        //! World matrix changed in the current update, children needs updating too
+
+	std::vector<Vector3f>    m_translations{};        //! Local translation of each node
+	std::vector<Quaternionf> m_rotations{};           //! Local rotation of each node
+	std::vector<Vector3f>    m_scales{};              //! Local scale of each node
+	std::vector<int32_t>     m_parents{};             //! Parent index of each node, always less than the node index or -1 for roots
+	std::vector<Matrix4f>    m_locals{};              //! Local matrix of each node, T * R * S
+	std::vector<Matrix4f>    m_worlds{};              //! World matrix of each node, parent world * local
+	std::vector<uint8_t>     m_dirty{};               //! Dirty flags of each node
+};
+
+}        // namespace ror
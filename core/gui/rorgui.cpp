@@ -72,7 +72,7 @@ Gui::Gui()
 
 		if (e.is_compatible<ror::Vector2d>())
 		{
-			auto vec2   = std::any_cast<ror::Vector2d>(e.m_payload);
+			auto vec2   = e.get_payload<ror::Vector2d>();
 			io.MousePos = ImVec2{static_cast<float32_t>(vec2.x), static_cast<float32_t>(vec2.y)};
 		}
 	};
@@ -110,7 +110,7 @@ Gui::Gui()
 
 		if (e.is_compatible<ror::Vector2d>())
 		{
-			auto vec2 = std::any_cast<ror::Vector2d>(e.m_payload);
+			auto vec2 = e.get_payload<ror::Vector2d>();
 
 			io.AddMouseWheelEvent(static_cast<float32_t>(vec2.x), static_cast<float32_t>(vec2.y));
 		}
@@ -400,12 +400,22 @@ FORCE_INLINE bool mesa_glu_invert_matrix(const _type a_m[16], _type a_out[16])
 template <class _type>
 FORCE_INLINE bool Matrix4<_type>::inverse(Matrix4 &a_output_matrix) const
 {
+#if defined(ROR_MATH_SIMD)
+	if constexpr (std::is_same_v<_type, float32_t>)
+		return simd::matrix4_inverse(this->m_values, a_output_matrix.m_values);
+#endif
+
 	return mesa_glu_invert_matrix(this->m_values, a_output_matrix.m_values);
 }
 
 template <class _type>
 FORCE_INLINE bool Matrix4<_type>::invert()
 {
+#if defined(ROR_MATH_SIMD)
+	if constexpr (std::is_same_v<_type, float32_t>)
+		return simd::matrix4_inverse(this->m_values, this->m_values);
+#endif
+
 	return mesa_glu_invert_matrix(this->m_values, this->m_values);
 }
 
@@ -25,7 +25,9 @@
 
 #pragma once
 
+#include "math/rorsimd.hpp"
 #include "math/rorvector.hpp"
+#include <type_traits>
 
 namespace ror
 {
@@ -53,6 +53,15 @@ FORCE_INLINE Matrix4<_type> operator-(const Matrix4<_type> &a_lhs, const Matrix4
 template <class _type>
 FORCE_INLINE Matrix4<_type> operator*(const Matrix4<_type> &a_lhs, const Matrix4<_type> &a_rhs)
 {
+#if defined(ROR_MATH_SIMD)
+	if constexpr (std::is_same_v<_type, float32_t>)
+	{
+		Matrix4<_type> result;
+		simd::matrix4_multiply(a_lhs.m_values, a_rhs.m_values, result.m_values);
+		return result;
+	}
+#endif
+
 	return Matrix4<_type>(a_lhs.m_values[0] * a_rhs.m_values[0] + a_lhs.m_values[4] * a_rhs.m_values[1] + a_lhs.m_values[8] * a_rhs.m_values[2] + a_lhs.m_values[12] * a_rhs.m_values[3],
 	                      a_lhs.m_values[1] * a_rhs.m_values[0] + a_lhs.m_values[5] * a_rhs.m_values[1] + a_lhs.m_values[9] * a_rhs.m_values[2] + a_lhs.m_values[13] * a_rhs.m_values[3],
 	                      a_lhs.m_values[2] * a_rhs.m_values[0] + a_lhs.m_values[6] * a_rhs.m_values[1] + a_lhs.m_values[10] * a_rhs.m_values[2] + a_lhs.m_values[14] * a_rhs.m_values[3],
@@ -99,6 +108,15 @@ FORCE_INLINE bool operator!=(const Matrix4<_type> &a_left, const Matrix4<_type>
 template <class _type>
 FORCE_INLINE Vector3<_type> operator*(const Matrix4<_type> &a_matrix, const Vector3<_type> &a_vector)
 {
+#if defined(ROR_MATH_SIMD)
+	if constexpr (std::is_same_v<_type, float32_t>)
+	{
+		float32_t result[4];
+		simd::store(result, simd::matrix4_transform(a_matrix.m_values, simd::set(a_vector.x, a_vector.y, a_vector.z, 1.0f)));
+		return Vector3<_type>(result[0], result[1], result[2]);
+	}
+#endif
+
 	return Vector3<_type>(a_matrix.m_values[0] * a_vector.x + a_matrix.m_values[4] * a_vector.y + a_matrix.m_values[8] * a_vector.z + a_matrix.m_values[12],
 	                      a_matrix.m_values[1] * a_vector.x + a_matrix.m_values[5] * a_vector.y + a_matrix.m_values[9] * a_vector.z + a_matrix.m_values[13],
 	                      a_matrix.m_values[2] * a_vector.x + a_matrix.m_values[6] * a_vector.y + a_matrix.m_values[10] * a_vector.z + a_matrix.m_values[14]);
@@ -107,6 +125,15 @@ FORCE_INLINE Vector3<_type> operator*(const Matrix4<_type> &a_matrix, const Vect
 template <class _type>
 FORCE_INLINE Vector4<_type> operator*(const Matrix4<_type> &a_matrix, const Vector4<_type> &a_vector)
 {
+#if defined(ROR_MATH_SIMD)
+	if constexpr (std::is_same_v<_type, float32_t>)
+	{
+		float32_t result[4];
+		simd::store(result, simd::matrix4_transform(a_matrix.m_values, simd::set(a_vector.x, a_vector.y, a_vector.z, a_vector.w)));
+		return Vector4<_type>(result[0], result[1], result[2], result[3]);
+	}
+#endif
+
 	// TODO: Find out if this needs to be perspective corrected.
 	return Vector4<_type>(a_matrix.m_values[0] * a_vector.x + a_matrix.m_values[4] * a_vector.y + a_matrix.m_values[8] * a_vector.z + a_matrix.m_values[12] * a_vector.w,
 	                      a_matrix.m_values[1] * a_vector.x + a_matrix.m_values[5] * a_vector.y + a_matrix.m_values[9] * a_vector.z + a_matrix.m_values[13] * a_vector.w,
@@ -269,6 +296,15 @@ FORCE_INLINE Matrix4<_type> matrix4_rotation(const Quaternion<_type> &a_quaterni
 	// From http://www.euclideanspace.com/maths/geometry/rotations/conversions/quaternionToMatrix/index.htm
 	Quaternion<_type> q = a_quaternion.normalized();
 
+#if defined(ROR_MATH_SIMD)
+	if constexpr (std::is_same_v<_type, float32_t>)
+	{
+		Matrix4<_type> result;
+		simd::quaternion_matrix4(simd::set(q.x, q.y, q.z, q.w), result.m_values);
+		return result;
+	}
+#endif
+
 	_type x = q.x;
 	_type y = q.y;
 	_type z = q.z;
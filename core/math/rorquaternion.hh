@@ -347,6 +347,15 @@ FORCE_INLINE Quaternion<_type> &Quaternion<_type>::operator*=(_type a_scalar) no
 template <class _type>
 FORCE_INLINE Quaternion<_type> Quaternion<_type>::operator*(const Quaternion<_type> &a_rhs) const
 {
+#if defined(ROR_MATH_SIMD)
+	if constexpr (std::is_same_v<_type, float32_t>)
+	{
+		float32_t result[4];
+		simd::store(result, simd::quaternion_multiply(simd::set(this->x, this->y, this->z, this->w), simd::set(a_rhs.x, a_rhs.y, a_rhs.z, a_rhs.w)));
+		return Quaternion<_type>(result[0], result[1], result[2], result[3]);
+	}
+#endif
+
 	// q0q1 = (w0v1 + v0w1 + v0 X v1, w0w1 - v0 . v1)
 	return Quaternion<_type>(this->w * a_rhs.x + this->x * a_rhs.w + this->y * a_rhs.z - this->z * a_rhs.y,
 	                         this->w * a_rhs.y + this->y * a_rhs.w + this->z * a_rhs.x - this->x * a_rhs.z,
@@ -0,0 +1,313 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "foundation/rorutilities.hpp"
+#include "rorsimd.hpp"
+
+namespace ror
+{
+namespace simd
+{
+#if defined(ROR_MATH_SIMD_SSE)
+
+FORCE_INLINE float4 load(const float32_t *a_values) noexcept
+{
+	return _mm_loadu_ps(a_values);
+}
+
+FORCE_INLINE void store(float32_t *a_values, float4 a_vector) noexcept
+{
+	_mm_storeu_ps(a_values, a_vector);
+}
+
+FORCE_INLINE float4 set(float32_t a_x, float32_t a_y, float32_t a_z, float32_t a_w) noexcept
+{
+	return _mm_setr_ps(a_x, a_y, a_z, a_w);
+}
+
+FORCE_INLINE float4 splat(float32_t a_value) noexcept
+{
+	return _mm_set1_ps(a_value);
+}
+
+FORCE_INLINE float4 add(float4 a_left, float4 a_right) noexcept
+{
+	return _mm_add_ps(a_left, a_right);
+}
+
+FORCE_INLINE float4 sub(float4 a_left, float4 a_right) noexcept
+{
+	return _mm_sub_ps(a_left, a_right);
+}
+
+FORCE_INLINE float4 mul(float4 a_left, float4 a_right) noexcept
+{
+	return _mm_mul_ps(a_left, a_right);
+}
+
+FORCE_INLINE float4 div(float4 a_left, float4 a_right) noexcept
+{
+	return _mm_div_ps(a_left, a_right);
+}
+
+FORCE_INLINE float32_t first(float4 a_vector) noexcept
+{
+	return _mm_cvtss_f32(a_vector);
+}
+
+template <int32_t _x, int32_t _y, int32_t _z, int32_t _w>
+FORCE_INLINE float4 shuffle(float4 a_first, float4 a_second) noexcept
+{
+	return _mm_shuffle_ps(a_first, a_second, _MM_SHUFFLE(_w, _z, _y, _x));
+}
+
+#elif defined(ROR_MATH_SIMD_NEON)
+
+FORCE_INLINE float4 load(const float32_t *a_values) noexcept
+{
+	return vld1q_f32(a_values);
+}
+
+FORCE_INLINE void store(float32_t *a_values, float4 a_vector) noexcept
+{
+	vst1q_f32(a_values, a_vector);
+}
+
+FORCE_INLINE float4 set(float32_t a_x, float32_t a_y, float32_t a_z, float32_t a_w) noexcept
+{
+	const float32_t values[4]{a_x, a_y, a_z, a_w};
+	return vld1q_f32(values);
+}
+
+FORCE_INLINE float4 splat(float32_t a_value) noexcept
+{
+	return vdupq_n_f32(a_value);
+}
+
+FORCE_INLINE float4 add(float4 a_left, float4 a_right) noexcept
+{
+	return vaddq_f32(a_left, a_right);
+}
+
+FORCE_INLINE float4 sub(float4 a_left, float4 a_right) noexcept
+{
+	return vsubq_f32(a_left, a_right);
+}
+
+// Not using vmlaq/vfmaq anywhere, separate multiply and add keeps the results same as the scalar code
+FORCE_INLINE float4 mul(float4 a_left, float4 a_right) noexcept
+{
+	return vmulq_f32(a_left, a_right);
+}
+
+FORCE_INLINE float4 div(float4 a_left, float4 a_right) noexcept
+{
+#	if defined(__aarch64__)
+	return vdivq_f32(a_left, a_right);
+#	else
+	float32_t left[4], right[4];
+	vst1q_f32(left, a_left);
+	vst1q_f32(right, a_right);
+	return set(left[0] / right[0], left[1] / right[1], left[2] / right[2], left[3] / right[3]);
+#	endif
+}
+
+FORCE_INLINE float32_t first(float4 a_vector) noexcept
+{
+	return vgetq_lane_f32(a_vector, 0);
+}
+
+template <int32_t _x, int32_t _y, int32_t _z, int32_t _w>
+FORCE_INLINE float4 shuffle(float4 a_first, float4 a_second) noexcept
+{
+	return __builtin_shufflevector(a_first, a_second, _x, _y, _z + 4, _w + 4);
+}
+
+#endif
+
+template <int32_t _x, int32_t _y, int32_t _z, int32_t _w>
+FORCE_INLINE float4 swizzle(float4 a_vector) noexcept
+{
+	return shuffle<_x, _y, _z, _w>(a_vector, a_vector);
+}
+
+FORCE_INLINE float4 matrix4_transform(const float32_t *a_matrix, float4 a_vector) noexcept
+{
+	// Same order of operations as the scalar version so results are identical
+	float4 result = mul(load(a_matrix), swizzle<0, 0, 0, 0>(a_vector));
+	result        = add(result, mul(load(a_matrix + 4), swizzle<1, 1, 1, 1>(a_vector)));
+	result        = add(result, mul(load(a_matrix + 8), swizzle<2, 2, 2, 2>(a_vector)));
+	result        = add(result, mul(load(a_matrix + 12), swizzle<3, 3, 3, 3>(a_vector)));
+
+	return result;
+}
+
+FORCE_INLINE void matrix4_multiply(const float32_t *a_left, const float32_t *a_right, float32_t *a_out) noexcept
+{
+	const float4 column0 = load(a_left);
+	const float4 column1 = load(a_left + 4);
+	const float4 column2 = load(a_left + 8);
+	const float4 column3 = load(a_left + 12);
+
+	// Each column of a_right is only read before the same column of a_out is written, so a_out can alias either side
+	for (uint32_t i = 0; i < 16; i += 4)
+	{
+		const float4 right = load(a_right + i);
+
+		float4 result = mul(column0, swizzle<0, 0, 0, 0>(right));
+		result        = add(result, mul(column1, swizzle<1, 1, 1, 1>(right)));
+		result        = add(result, mul(column2, swizzle<2, 2, 2, 2>(right)));
+		result        = add(result, mul(column3, swizzle<3, 3, 3, 3>(right)));
+
+		store(a_out + i, result);
+	}
+}
+
+// 2x2 matrix helpers for the inverse below, a 2x2 matrix is stored in one float4 as (m00, m01, m10, m11)
+FORCE_INLINE float4 matrix2_multiply(float4 a_left, float4 a_right) noexcept        // left * right
+{
+	return add(mul(a_left, swizzle<0, 3, 0, 3>(a_right)),
+	           mul(swizzle<1, 0, 3, 2>(a_left), swizzle<2, 1, 2, 1>(a_right)));
+}
+
+FORCE_INLINE float4 matrix2_adjugate_multiply(float4 a_left, float4 a_right) noexcept        // adjugate(left) * right
+{
+	return sub(mul(swizzle<3, 3, 0, 0>(a_left), a_right),
+	           mul(swizzle<1, 1, 2, 2>(a_left), swizzle<2, 3, 0, 1>(a_right)));
+}
+
+FORCE_INLINE float4 matrix2_multiply_adjugate(float4 a_left, float4 a_right) noexcept        // left * adjugate(right)
+{
+	return sub(mul(a_left, swizzle<3, 0, 3, 0>(a_right)),
+	           mul(swizzle<1, 0, 3, 2>(a_left), swizzle<2, 1, 2, 1>(a_right)));
+}
+
+/**
+ * @brief      Inverse of a general 4x4 matrix using 2x2 blocks
+ * @details    Splits the matrix into 4 2x2 blocks and inverts using the block inverse formula, from Eric Zhang's "Fast 4x4 Matrix Inverse with SSE SIMD, Explained"
+               The formula is written for row-major matrices but inverse(transpose(M)) == transpose(inverse(M)) so it works for column-major as is
+ * @param      a_matrix    Column-major input matrix
+ * @param      a_out       Column-major output, can be same as a_matrix
+ * @return     return      False if the matrix is singular, same check as mesa_glu_invert_matrix
+ */
+FORCE_INLINE bool matrix4_inverse(const float32_t *a_matrix, float32_t *a_out) noexcept
+{
+	const float4 column0 = load(a_matrix);
+	const float4 column1 = load(a_matrix + 4);
+	const float4 column2 = load(a_matrix + 8);
+	const float4 column3 = load(a_matrix + 12);
+
+	const float4 a = shuffle<0, 1, 0, 1>(column0, column1);
+	const float4 b = shuffle<2, 3, 2, 3>(column0, column1);
+	const float4 c = shuffle<0, 1, 0, 1>(column2, column3);
+	const float4 d = shuffle<2, 3, 2, 3>(column2, column3);
+
+	// Determinants of the blocks as (|A|, |B|, |C|, |D|)
+	const float4 sub_determinants = sub(mul(shuffle<0, 2, 0, 2>(column0, column2), shuffle<1, 3, 1, 3>(column1, column3)),
+	                                    mul(shuffle<1, 3, 1, 3>(column0, column2), shuffle<0, 2, 0, 2>(column1, column3)));
+
+	const float4 determinant_a = swizzle<0, 0, 0, 0>(sub_determinants);
+	const float4 determinant_b = swizzle<1, 1, 1, 1>(sub_determinants);
+	const float4 determinant_c = swizzle<2, 2, 2, 2>(sub_determinants);
+	const float4 determinant_d = swizzle<3, 3, 3, 3>(sub_determinants);
+
+	const float4 d_c = matrix2_adjugate_multiply(d, c);
+	const float4 a_b = matrix2_adjugate_multiply(a, b);
+
+	float4 x = sub(mul(determinant_d, a), matrix2_multiply(b, d_c));
+	float4 w = sub(mul(determinant_a, d), matrix2_multiply(c, a_b));
+	float4 y = sub(mul(determinant_b, c), matrix2_multiply_adjugate(d, a_b));
+	float4 z = sub(mul(determinant_c, b), matrix2_multiply_adjugate(a, d_c));
+
+	// |M| = |A|*|D| + |B|*|C| - trace((A#B)(D#C))
+	float4 trace = mul(a_b, swizzle<0, 2, 1, 3>(d_c));
+	trace        = add(trace, swizzle<1, 0, 3, 2>(trace));
+	trace        = add(trace, swizzle<2, 3, 0, 1>(trace));
+
+	const float4 determinant = sub(add(mul(determinant_a, determinant_d), mul(determinant_b, determinant_c)), trace);
+
+	if (equal_zero(first(determinant)))
+		return false;
+
+	const float4 reciprocal = div(set(1.0f, -1.0f, -1.0f, 1.0f), determinant);
+
+	x = mul(x, reciprocal);
+	y = mul(y, reciprocal);
+	z = mul(z, reciprocal);
+	w = mul(w, reciprocal);
+
+	// Adjugate of each block and store back
+	store(a_out, shuffle<3, 1, 3, 1>(x, y));
+	store(a_out + 4, shuffle<2, 0, 2, 0>(x, y));
+	store(a_out + 8, shuffle<3, 1, 3, 1>(z, w));
+	store(a_out + 12, shuffle<2, 0, 2, 0>(z, w));
+
+	return true;
+}
+
+FORCE_INLINE float4 quaternion_multiply(float4 a_left, float4 a_right) noexcept
+{
+	// q0q1 = w0 * q1 + x0 * (w1, -z1, y1, -x1) + y0 * (z1, w1, -x1, -y1) + z0 * (-y1, x1, w1, -z1)
+	float4 result = mul(swizzle<3, 3, 3, 3>(a_left), a_right);
+	result        = add(result, mul(mul(swizzle<0, 0, 0, 0>(a_left), swizzle<3, 2, 1, 0>(a_right)), set(1.0f, -1.0f, 1.0f, -1.0f)));
+	result        = add(result, mul(mul(swizzle<1, 1, 1, 1>(a_left), swizzle<2, 3, 0, 1>(a_right)), set(1.0f, 1.0f, -1.0f, -1.0f)));
+	result        = add(result, mul(mul(swizzle<2, 2, 2, 2>(a_left), swizzle<1, 0, 3, 2>(a_right)), set(-1.0f, 1.0f, 1.0f, -1.0f)));
+
+	return result;
+}
+
+FORCE_INLINE void quaternion_matrix4(float4 a_quaternion, float32_t *a_out) noexcept
+{
+	// Products are arranged so each lane does exactly the same operations as the scalar matrix4_rotation(Quaternion)
+	const float4 q  = a_quaternion;
+	const float4 q2 = add(q, q);
+
+	const float4 a = mul(swizzle<1, 0, 0, 3>(q), swizzle<1, 1, 2, 3>(q2));        // 2yy, 2xy, 2xz
+	const float4 b = mul(swizzle<2, 3, 3, 3>(q), swizzle<2, 2, 1, 3>(q2));        // 2zz, 2zw, 2yw
+	const float4 c = mul(swizzle<0, 0, 1, 3>(q), swizzle<1, 0, 2, 3>(q2));        // 2xy, 2xx, 2yz
+	const float4 d = mul(swizzle<2, 2, 0, 3>(q), swizzle<3, 2, 3, 3>(q2));        // 2zw, 2zz, 2xw
+	const float4 e = mul(swizzle<0, 1, 0, 3>(q), swizzle<2, 2, 0, 3>(q2));        // 2xz, 2yz, 2xx
+	const float4 f = mul(swizzle<1, 0, 1, 3>(q), swizzle<3, 3, 1, 3>(q2));        // 2yw, 2xw, 2yy
+
+	store(a_out, add(add(mul(a, set(-1.0f, 1.0f, 1.0f, 0.0f)), mul(b, set(-1.0f, 1.0f, -1.0f, 0.0f))), set(1.0f, 0.0f, 0.0f, 0.0f)));
+	store(a_out + 4, add(add(mul(c, set(1.0f, -1.0f, 1.0f, 0.0f)), mul(d, set(-1.0f, -1.0f, 1.0f, 0.0f))), set(0.0f, 1.0f, 0.0f, 0.0f)));
+	store(a_out + 8, add(add(mul(e, set(1.0f, 1.0f, -1.0f, 0.0f)), mul(f, set(1.0f, -1.0f, -1.0f, 0.0f))), set(0.0f, 0.0f, 1.0f, 0.0f)));
+	store(a_out + 12, set(0.0f, 0.0f, 0.0f, 1.0f));
+}
+
+FORCE_INLINE float32_t vector4_dot(float4 a_left, float4 a_right) noexcept
+{
+	// Lanes are added one at a time instead of pairwise so the result is identical to the scalar version
+	const float4 products = mul(a_left, a_right);
+
+	float4 result = add(products, swizzle<1, 1, 1, 1>(products));
+	result        = add(result, swizzle<2, 2, 2, 2>(products));
+	result        = add(result, swizzle<3, 3, 3, 3>(products));
+
+	return first(result);
+}
+
+}        // namespace simd
+}        // namespace ror
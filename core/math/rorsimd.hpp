@@ -0,0 +1,93 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#pragma once
+
+#include "foundation/rormacros.hpp"
+#include "foundation/rortypes.hpp"
+
+// 128 bit SIMD backend for the float32_t instantiations of Matrix4, Vector4 and Quaternion.
+// SSE2 is the x86_64 baseline and NEON is always there on arm64, so no extra compile flags are required.
+// Define ROR_MATH_NO_SIMD to force the scalar template code everywhere.
+#if !defined(ROR_MATH_NO_SIMD)
+#	if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#		define ROR_MATH_SIMD_SSE
+#	elif defined(__ARM_NEON) && (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 12))        // Requires __builtin_shufflevector
+#		define ROR_MATH_SIMD_NEON
+#	endif
+#endif
+
+#if defined(ROR_MATH_SIMD_SSE) || defined(ROR_MATH_SIMD_NEON)
+#	define ROR_MATH_SIMD
+#endif
+
+#if defined(ROR_MATH_SIMD_SSE)
+#	include <emmintrin.h>
+#elif defined(ROR_MATH_SIMD_NEON)
+#	include <arm_neon.h>
+#endif
+
+#if defined(ROR_MATH_SIMD)
+
+namespace ror
+{
+namespace simd
+{
+#	if defined(ROR_MATH_SIMD_SSE)
+using float4 = __m128;
+#	else
+using float4 = float32x4_t;
+#	endif
+
+FORCE_INLINE float4    load(const float32_t *a_values) noexcept;                                         //! Unaligned load of 4 floats
+FORCE_INLINE void      store(float32_t *a_values, float4 a_vector) noexcept;                             //! Unaligned store of 4 floats
+FORCE_INLINE float4    set(float32_t a_x, float32_t a_y, float32_t a_z, float32_t a_w) noexcept;        //! a_x goes in the first lane
+FORCE_INLINE float4    splat(float32_t a_value) noexcept;
+FORCE_INLINE float4    add(float4 a_left, float4 a_right) noexcept;
+FORCE_INLINE float4    sub(float4 a_left, float4 a_right) noexcept;
+FORCE_INLINE float4    mul(float4 a_left, float4 a_right) noexcept;
+FORCE_INLINE float4    div(float4 a_left, float4 a_right) noexcept;
+FORCE_INLINE float32_t first(float4 a_vector) noexcept;
+
+template <int32_t _x, int32_t _y, int32_t _z, int32_t _w>
+FORCE_INLINE float4 shuffle(float4 a_first, float4 a_second) noexcept;        //! Returns (a_first[_x], a_first[_y], a_second[_z], a_second[_w])
+
+template <int32_t _x, int32_t _y, int32_t _z, int32_t _w>
+FORCE_INLINE float4 swizzle(float4 a_vector) noexcept;        //! Returns (a_vector[_x], a_vector[_y], a_vector[_z], a_vector[_w])
+
+// Kernels, matrices are column-major float32_t[16] like Matrix4::m_values, quaternions are (x, y, z, w)
+FORCE_INLINE void      matrix4_multiply(const float32_t *a_left, const float32_t *a_right, float32_t *a_out) noexcept;
+FORCE_INLINE float4    matrix4_transform(const float32_t *a_matrix, float4 a_vector) noexcept;        //! Matrix times column vector
+FORCE_INLINE bool      matrix4_inverse(const float32_t *a_matrix, float32_t *a_out) noexcept;         //! a_out is left untouched if a_matrix is singular, a_out can alias a_matrix
+FORCE_INLINE float4    quaternion_multiply(float4 a_left, float4 a_right) noexcept;
+FORCE_INLINE void      quaternion_matrix4(float4 a_quaternion, float32_t *a_out) noexcept;        //! a_quaternion must be normalized
+FORCE_INLINE float32_t vector4_dot(float4 a_left, float4 a_right) noexcept;                       //! Sums in x, y, z, w order like the scalar dot product
+
+}        // namespace simd
+}        // namespace ror
+
+#	include "rorsimd.hh"
+
+#endif
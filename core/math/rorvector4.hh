@@ -88,18 +88,45 @@ FORCE_INLINE _type &Vector4<_type>::operator[](int32_t a_index) noexcept
 template <class _type>
 FORCE_INLINE Vector4<_type> Vector4<_type>::operator+(const Vector4<_type> &a_right) const noexcept
 {
+#if defined(ROR_MATH_SIMD)
+	if constexpr (std::is_same_v<_type, float32_t>)
+	{
+		Vector4<_type> result;
+		simd::store(&result.x, simd::add(simd::load(&this->x), simd::load(&a_right.x)));
+		return result;
+	}
+#endif
+
 	return Vector4(a_right.x + x, a_right.y + y, a_right.z + z, a_right.w + w);
 }
 
 template <class _type>
 FORCE_INLINE Vector4<_type> Vector4<_type>::operator-(const Vector4<_type> &a_right) const noexcept
 {
+#if defined(ROR_MATH_SIMD)
+	if constexpr (std::is_same_v<_type, float32_t>)
+	{
+		Vector4<_type> result;
+		simd::store(&result.x, simd::sub(simd::load(&this->x), simd::load(&a_right.x)));
+		return result;
+	}
+#endif
+
 	return Vector4<_type>(-a_right.x + x, -a_right.y + y, -a_right.z + z, -a_right.w + w);
 }
 
 template <class _type>
 FORCE_INLINE Vector4<_type> Vector4<_type>::operator*(const Vector4<_type> &a_right) const noexcept
 {
+#if defined(ROR_MATH_SIMD)
+	if constexpr (std::is_same_v<_type, float32_t>)
+	{
+		Vector4<_type> result;
+		simd::store(&result.x, simd::mul(simd::load(&this->x), simd::load(&a_right.x)));
+		return result;
+	}
+#endif
+
 	return Vector4<_type>(x * a_right.x, y * a_right.y, z * a_right.z, w * a_right.w);
 }
 
@@ -115,6 +142,14 @@ FORCE_INLINE Vector4<_type> Vector4<_type>::operator/(const Vector4<_type> &a_ri
 template <class _type>
 FORCE_INLINE Vector4<_type> &Vector4<_type>::operator+=(const Vector4<_type> &a_right) noexcept
 {
+#if defined(ROR_MATH_SIMD)
+	if constexpr (std::is_same_v<_type, float32_t>)
+	{
+		simd::store(&this->x, simd::add(simd::load(&this->x), simd::load(&a_right.x)));
+		return *this;
+	}
+#endif
+
 	x += a_right.x;
 	y += a_right.y;
 	z += a_right.z;
@@ -126,6 +161,14 @@ FORCE_INLINE Vector4<_type> &Vector4<_type>::operator+=(const Vector4<_type> &a_
 template <class _type>
 FORCE_INLINE Vector4<_type> &Vector4<_type>::operator-=(const Vector4<_type> &a_right) noexcept
 {
+#if defined(ROR_MATH_SIMD)
+	if constexpr (std::is_same_v<_type, float32_t>)
+	{
+		simd::store(&this->x, simd::sub(simd::load(&this->x), simd::load(&a_right.x)));
+		return *this;
+	}
+#endif
+
 	x -= a_right.x;
 	y -= a_right.y;
 	z -= a_right.z;
@@ -137,6 +180,14 @@ FORCE_INLINE Vector4<_type> &Vector4<_type>::operator-=(const Vector4<_type> &a_
 template <class _type>
 FORCE_INLINE Vector4<_type> &Vector4<_type>::operator*=(const Vector4 &a_right) noexcept
 {
+#if defined(ROR_MATH_SIMD)
+	if constexpr (std::is_same_v<_type, float32_t>)
+	{
+		simd::store(&this->x, simd::mul(simd::load(&this->x), simd::load(&a_right.x)));
+		return *this;
+	}
+#endif
+
 	x *= a_right.x;
 	y *= a_right.y;
 	z *= a_right.z;
@@ -407,12 +458,25 @@ FORCE_INLINE auto Vector4<_type>::length() const -> precision
 template <class _type>
 FORCE_INLINE _type Vector4<_type>::length_squared() const
 {
+#if defined(ROR_MATH_SIMD)
+	if constexpr (std::is_same_v<_type, float32_t>)
+	{
+		const auto vector = simd::load(&this->x);
+		return simd::vector4_dot(vector, vector);
+	}
+#endif
+
 	return x * x + y * y + z * z + w * w;
 }
 
 template <class _type>
 FORCE_INLINE auto Vector4<_type>::dot_product(const Vector4<_type> &a_other) const -> precision
 {
+#if defined(ROR_MATH_SIMD)
+	if constexpr (std::is_same_v<_type, float32_t>)
+		return simd::vector4_dot(simd::load(&this->x), simd::load(&a_other.x));
+#endif
+
 	return static_cast<precision>(x * a_other.x + y * a_other.y + z * a_other.z + w * a_other.w);
 }
 
@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include "math/rorsimd.hpp"
 #include "rorvector3.hpp"
 
 namespace ror
@@ -345,8 +345,10 @@ void glfw_file_drop_callback(GLFWwindow *a_window, int a_count, const char **a_p
 	for (int i = 0; i < a_count; i++)
 		paths.emplace_back(a_paths[i]);
 
-	auto &event_system = glfw_event_system<_type>(a_window);
-	event_system.notify({ror::file_drop, true, paths});
+	// Payloads are stored inline in the event so the paths are sent as a pointer, only valid while notify is dispatching
+	auto                           &event_system = glfw_event_system<_type>(a_window);
+	const std::vector<std::string> *paths_ptr    = &paths;
+	event_system.notify({ror::file_drop, true, paths_ptr});
 }
 
 }        // namespace ror
@@ -94,12 +94,210 @@ void Log::set_level(LogLevel a_level)
 	}
 }
 
+bool Log::should_log(LogLevel a_level) const
+{
+	return this->m_logger != nullptr && this->m_logger->should_log(convert_to_spdlog_level(a_level));
+}
+
+void Log::flush()
+{
+	if (this->m_logger != nullptr)
+		this->m_logger->flush();
+}
+
+void Log::log(LogLevel a_level, std::string_view a_message, std::chrono::system_clock::time_point a_time)
+{
+	this->m_logger->log(a_time, spdlog::source_loc{}, convert_to_spdlog_level(a_level), spdlog::string_view_t{a_message.data(), a_message.size()});
+}
+
+namespace
+{
+struct ThreadLogRing
+{
+	~ThreadLogRing() noexcept
+	{
+		this->release();
+	}
+
+	// Gives the ring back to its logger for the next new thread, if the logger is already gone the ring goes with the last reference
+	void release() noexcept
+	{
+		if (this->m_ring)
+			this->m_ring->release();
+
+		this->m_ring.reset();
+		this->m_logger_id = 0;
+	}
+
+	uint64_t                 m_logger_id{0};
+	std::shared_ptr<LogRing> m_ring{};
+};
+
+std::atomic<uint64_t>     async_logger_ids{0};
+thread_local ThreadLogRing current_log_ring{};        // Ring of the last logger this thread logged to, usually there is only the global one
+}        // namespace
+
+AsyncLogger::AsyncLogger() :
+    m_id(++async_logger_ids)
+{}
+
+AsyncLogger::~AsyncLogger() noexcept
+{
+	this->stop();
+}
+
+bool AsyncLogger::running() const noexcept
+{
+	return this->m_running.load(std::memory_order_relaxed);
+}
+
+void AsyncLogger::start(Log &a_logger)
+{
+	if (this->running())
+		return;
+
+	this->m_logger = &a_logger;
+	this->m_running.store(true, std::memory_order_release);
+	this->m_thread = std::thread(&AsyncLogger::run, this);
+}
+
+void AsyncLogger::stop()
+{
+	if (!this->running())
+		return;
+
+	{
+		std::lock_guard<std::mutex> lock{this->m_mutex};
+		this->m_running.store(false, std::memory_order_release);
+	}
+
+	this->m_condition.notify_one();
+	this->m_thread.join();
+}
+
+void AsyncLogger::flush()
+{
+	{
+		std::unique_lock<std::mutex> lock{this->m_mutex};
+
+		// stop() clears running under the same lock, so a flush requested while running is always drained by the last drain in run()
+		if (!this->running())
+			return;
+
+		auto sequence = ++this->m_flush_requested;
+
+		this->m_condition.notify_one();
+		this->m_flushed_condition.wait(lock, [this, sequence]() { return this->m_flushed >= sequence; });
+	}
+
+	this->m_logger->flush();
+}
+
+size_t AsyncLogger::rings_count()
+{
+	std::lock_guard<std::mutex> lock{this->m_mutex};
+
+	return this->m_rings.size();
+}
+
+LogRing &AsyncLogger::thread_ring()
+{
+	if (current_log_ring.m_logger_id == this->m_id)
+		return *current_log_ring.m_ring;
+
+	// Logging into another logger than last time, the old ring is given back
+	current_log_ring.release();
+
+	std::lock_guard<std::mutex> lock{this->m_mutex};
+
+	// Rings of exited threads are taken over first, records still in them are written before the new ones so the order is kept
+	std::shared_ptr<LogRing> ring{};
+	for (auto &released : this->m_rings)
+		if (released->acquire())
+		{
+			ring = released;
+			break;
+		}
+
+	if (!ring)
+		ring = this->m_rings.emplace_back(std::make_shared<LogRing>(ring_capacity));
+
+	// Not assigned from a temporary ThreadLogRing, its destructor would release the ring straight away
+	current_log_ring.m_logger_id = this->m_id;
+	current_log_ring.m_ring      = ring;
+
+	return *ring;
+}
+
+bool AsyncLogger::drain(fmt::memory_buffer &a_buffer, std::vector<LogRing *> &a_rings)
+{
+	size_t   count{0};
+	uint64_t flush_requested{0};
+
+	// Rings are only ever added, never freed while the logger lives, so they are drained without the lock while the sinks write
+	{
+		std::lock_guard<std::mutex> lock{this->m_mutex};
+
+		flush_requested = this->m_flush_requested;
+
+		a_rings.clear();
+		for (auto &ring : this->m_rings)
+			a_rings.push_back(ring.get());
+	}
+
+	for (auto *ring : a_rings)
+		count += ring->consume([this, &a_buffer](LogRecord &a_record) {
+			a_buffer.clear();
+			a_record.m_format(a_record, a_buffer);
+			this->m_logger->log(a_record.m_level, std::string_view{a_buffer.data(), a_buffer.size()}, a_record.m_time);
+		});
+
+	// Everything published before the flush was requested is written by now
+	if (flush_requested != this->m_flushed)
+	{
+		{
+			std::lock_guard<std::mutex> lock{this->m_mutex};
+			this->m_flushed = flush_requested;
+		}
+
+		this->m_flushed_condition.notify_all();
+	}
+
+	return count > 0;
+}
+
+void AsyncLogger::run()
+{
+	fmt::memory_buffer     buffer;
+	std::vector<LogRing *> rings{};
+
+	while (this->running())
+	{
+		if (!this->drain(buffer, rings))
+		{
+			std::unique_lock<std::mutex> lock{this->m_mutex};
+			if (this->running() && this->m_flushed == this->m_flush_requested)
+				this->m_condition.wait_for(lock, std::chrono::milliseconds(10));
+		}
+	}
+
+	// Whatever was logged before stop
+	this->drain(buffer, rings);
+	this->m_logger->flush();
+}
+
 Log &get_logger()
 {
 	static Log logger;
 	return logger;
 }
 
+AsyncLogger &get_async_logger()
+{
+	static AsyncLogger logger;
+	return logger;
+}
+
 std::mutex &get_logger_lock()
 {
 	static std::mutex sync;
@@ -112,6 +310,22 @@ void log_set_level(LogLevel a_level)
 	get_logger().set_level(a_level);
 }
 
+void log_set_async(bool a_async)
+{
+	if (a_async)
+		get_async_logger().start(get_logger());
+	else
+		get_async_logger().stop();
+}
+
+void log_flush()
+{
+	get_async_logger().flush();
+
+	add_sync();
+	get_logger().flush();
+}
+
 /*
   Remember to print pointers in spd_log do the following
   log->info("hello from {:p}", (void*)this);
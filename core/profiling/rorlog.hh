@@ -24,7 +24,11 @@
 // Version: 1.0.0
 
 #include "rorlog.hpp"
+#include <cassert>
+#include <exception>
+#include <iterator>
 #include <mutex>
+#include <new>
 
 namespace ror
 {
@@ -64,10 +68,174 @@ void Log::critical(const char *a_format, const Args &...a_args)
 	this->m_logger->critical(a_format, a_args...);
 }
 
+spdlog::level::level_enum convert_to_spdlog_level(LogLevel a_level);
+
+template <typename... Args>
+void Log::log(LogLevel a_level, const char *a_format, const Args &...a_args)
+{
+	this->m_logger->log(convert_to_spdlog_level(a_level), a_format, a_args...);
+}
+
+FORCE_INLINE LogRing::LogRing(size_t a_capacity) :
+    m_data(std::make_unique<std::byte[]>(a_capacity)), m_mask(a_capacity - 1)
+{
+	assert(a_capacity >= record_alignment && (a_capacity & (a_capacity - 1)) == 0 && "LogRing capacity must be power of 2");
+}
+
+FORCE_INLINE std::byte *LogRing::reserve(size_t a_size) noexcept
+{
+	auto head       = this->m_head.load(std::memory_order_relaxed);
+	auto tail       = this->m_tail.load(std::memory_order_acquire);
+	auto offset     = static_cast<size_t>(head) & this->m_mask;
+	auto contiguous = this->capacity() - offset;
+	auto needed     = a_size > contiguous ? contiguous + a_size : a_size;
+
+	if (this->capacity() - static_cast<size_t>(head - tail) < needed)
+		return nullptr;
+
+	if (a_size > contiguous)
+	{
+		// Doesn't fit before the end, the rest is published as padding and the record starts at the beginning
+		new (&this->m_data[offset]) LogRecord{nullptr, static_cast<uint32_t>(contiguous)};
+		this->m_head.store(head + contiguous, std::memory_order_release);
+		offset = 0;
+	}
+
+	return &this->m_data[offset];
+}
+
+FORCE_INLINE void LogRing::commit(size_t a_size) noexcept
+{
+	this->m_head.store(this->m_head.load(std::memory_order_relaxed) + a_size, std::memory_order_release);
+}
+
+FORCE_INLINE void LogRing::release() noexcept
+{
+	// Release pairs with acquire() so the next producer sees the head this one left
+	this->m_released.store(true, std::memory_order_release);
+}
+
+FORCE_INLINE bool LogRing::acquire() noexcept
+{
+	bool released{true};
+	return this->m_released.compare_exchange_strong(released, false, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+FORCE_INLINE bool LogRing::empty() const noexcept
+{
+	return this->m_head.load(std::memory_order_acquire) == this->m_tail.load(std::memory_order_acquire);
+}
+
+FORCE_INLINE size_t LogRing::capacity() const noexcept
+{
+	return this->m_mask + 1;
+}
+
+template <typename _function>
+FORCE_INLINE size_t LogRing::consume(_function &&a_function)
+{
+	auto   tail = this->m_tail.load(std::memory_order_relaxed);
+	auto   head = this->m_head.load(std::memory_order_acquire);
+	size_t count{0};
+
+	while (tail != head)
+	{
+		auto &record = *std::launder(reinterpret_cast<LogRecord *>(&this->m_data[static_cast<size_t>(tail) & this->m_mask]));
+		tail += record.m_size;
+
+		if (record.m_format)
+		{
+			a_function(record);
+			count++;
+		}
+	}
+
+	// Space is only given back once the records are written, so an empty ring means everything in it is written
+	this->m_tail.store(tail, std::memory_order_release);
+
+	return count;
+}
+
+// Strings are copied, pointers into the callers memory might not live until the message is formatted
+template <typename _type>
+using log_argument_t = std::conditional_t<std::is_same_v<std::decay_t<_type>, const char *> ||
+                                              std::is_same_v<std::decay_t<_type>, char *> ||
+                                              std::is_same_v<std::decay_t<_type>, std::string_view>,
+                                          std::string, std::decay_t<_type>>;
+
+template <typename _arguments>
+void format_log_record(LogRecord &a_record, fmt::memory_buffer &a_buffer)
+{
+	auto *arguments = std::launder(reinterpret_cast<_arguments *>(&a_record + 1));
+
+	try
+	{
+		std::apply([&a_record, &a_buffer](const auto &...a_args) { fmt::format_to(std::back_inserter(a_buffer), fmt::runtime(a_record.m_format_string), a_args...); }, *arguments);
+	}
+	catch (const std::exception &a_exception)
+	{
+		fmt::format_to(std::back_inserter(a_buffer), "Can't format log message \"{}\", {}", a_record.m_format_string, a_exception.what());
+	}
+
+	arguments->~_arguments();
+}
+
+template <typename... Args>
+void AsyncLogger::push(LogLevel a_level, const char *a_format, const Args &...a_args)
+{
+	using Arguments = std::tuple<log_argument_t<Args>...>;
+
+	constexpr size_t alignment = LogRing::record_alignment;
+	constexpr size_t size      = (sizeof(LogRecord) + sizeof(Arguments) + alignment - 1) & ~(alignment - 1);
+
+	static_assert(alignof(Arguments) <= alignment, "Log arguments are over aligned for the async logger");
+	static_assert(size <= ring_capacity / 4, "Log arguments are too big for the async logger");
+
+	auto &ring   = this->thread_ring();
+	auto *memory = ring.reserve(size);
+
+	while (!memory)
+	{
+		// Ring is full, wait for the background thread to catch up
+		this->m_condition.notify_one();
+		std::this_thread::yield();
+		memory = ring.reserve(size);
+	}
+
+	auto *record = new (memory) LogRecord{&format_log_record<Arguments>, static_cast<uint32_t>(size), a_level, a_format, std::chrono::system_clock::now()};
+	new (record + 1) Arguments(a_args...);
+
+	ring.commit(size);
+
+	if (a_level >= LogLevel::error)
+		this->m_condition.notify_one();
+}
+
+FORCE_INLINE LogRateLimit::LogRateLimit(std::chrono::milliseconds a_interval) noexcept :
+    m_interval(std::chrono::duration_cast<std::chrono::nanoseconds>(a_interval).count())
+{}
+
+FORCE_INLINE bool LogRateLimit::allow(uint32_t &a_suppressed) noexcept
+{
+	auto now  = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+	auto next = this->m_next.load(std::memory_order_relaxed);
+
+	if (now < next || !this->m_next.compare_exchange_strong(next, now + this->m_interval, std::memory_order_relaxed))
+	{
+		this->m_suppressed.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	a_suppressed = this->m_suppressed.exchange(0, std::memory_order_relaxed);
+
+	return true;
+}
+
 // Have a global instance of the logger for easy access, its still thread safe if sync_logger is defined, defined by default
-Log        &get_logger();
-std::mutex &get_logger_lock();
-void        log_set_level(LogLevel a_level);
+Log         &get_logger();
+AsyncLogger &get_async_logger();
+std::mutex  &get_logger_lock();
+void         log_set_level(LogLevel a_level);
 
 #ifndef sync_logger
 #	define sync_logger
@@ -84,45 +252,61 @@ void        log_set_level(LogLevel a_level);
 #endif
 
 template <typename... Args>
-void log_trace(const char *a_format, const Args &...a_args)
+void log_message(LogLevel a_level, const char *a_format, const Args &...a_args)
 {
+	auto &async_logger = get_async_logger();
+	if (async_logger.running())
+	{
+		if (get_logger().should_log(a_level))
+			async_logger.push(a_level, a_format, a_args...);
+
+		return;
+	}
+
 	add_sync();
-	get_logger().trace(a_format, a_args...);
+	get_logger().log(a_level, a_format, a_args...);
+}
+
+template <typename... Args>
+void log_trace(const char *a_format, const Args &...a_args)
+{
+	if constexpr (compile_time_log_level <= LogLevel::trace)
+		log_message(LogLevel::trace, a_format, a_args...);
 }
 
 template <typename... Args>
 void log_debug(const char *a_format, const Args &...a_args)
 {
-	add_sync();
-	get_logger().debug(a_format, a_args...);
+	if constexpr (compile_time_log_level <= LogLevel::debug)
+		log_message(LogLevel::debug, a_format, a_args...);
 }
 
 template <typename... Args>
 void log_info(const char *a_format, const Args &...a_args)
 {
-	add_sync();
-	get_logger().info(a_format, a_args...);
+	if constexpr (compile_time_log_level <= LogLevel::info)
+		log_message(LogLevel::info, a_format, a_args...);
 }
 
 template <typename... Args>
 void log_warn(const char *a_format, const Args &...a_args)
 {
-	add_sync();
-	get_logger().warn(a_format, a_args...);
+	if constexpr (compile_time_log_level <= LogLevel::warn)
+		log_message(LogLevel::warn, a_format, a_args...);
 }
 
 template <typename... Args>
 void log_error(const char *a_format, const Args &...a_args)
 {
-	add_sync();
-	get_logger().error(a_format, a_args...);
+	if constexpr (compile_time_log_level <= LogLevel::error)
+		log_message(LogLevel::error, a_format, a_args...);
 }
 
 template <typename... Args>
 void log_critical(const char *a_format, const Args &...a_args)
 {
-	add_sync();
-	get_logger().critical(a_format, a_args...);
+	if constexpr (compile_time_log_level <= LogLevel::critical)
+		log_message(LogLevel::critical, a_format, a_args...);
 }
 
 }        // namespace ror
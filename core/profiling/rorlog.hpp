@@ -25,10 +25,22 @@
 
 #pragma once
 
+#include "foundation/rorconcurrent_queue.hpp"
 #include "roar.hpp"
 #include "spdlog/spdlog.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 
 #include "math/rormatrix4.hpp"
 
@@ -64,6 +76,13 @@ enum class LogLevel
 	critical,
 };
 
+// Define ROR_LOG_LEVEL to the number of the lowest LogLevel to keep, log calls below it compile to nothing
+#if !defined(ROR_LOG_LEVEL)
+#	define ROR_LOG_LEVEL 0
+#endif
+
+constexpr LogLevel compile_time_log_level = static_cast<LogLevel>(ROR_LOG_LEVEL);
+
 class ROAR_ENGINE_ITEM Log final
 {
   public:
@@ -92,15 +111,144 @@ class ROAR_ENGINE_ITEM Log final
 	template <typename... Args>
 	void critical(const char *a_format, const Args &...a_args);
 
+	template <typename... Args>
+	void log(LogLevel a_level, const char *a_format, const Args &...a_args);
+
+	// Writes an already formatted message, used by the async logger to keep the time the message was logged at
+	void log(LogLevel a_level, std::string_view a_message, std::chrono::system_clock::time_point a_time);
+
 	// Can be used to filter out unimporant messages
 	void set_level(LogLevel a_level);
+	bool should_log(LogLevel a_level) const;
+	void flush();
 
   protected:
   private:
 	std::unique_ptr<spdlog::logger> m_logger = nullptr;
 };
 
+/**
+ * Header of a deferred log call in a LogRing, the captured arguments follow it
+ * m_format formats the message into the buffer and destroys the arguments, nullptr marks padding at the end of the ring
+ */
+struct LogRecord
+{
+	using Formatter = void (*)(LogRecord &a_record, fmt::memory_buffer &a_buffer);
+
+	Formatter                             m_format{nullptr};                 //! Formats the captured arguments and destroys them
+	uint32_t                              m_size{0};                         //! Size of the record including the arguments
+	LogLevel                              m_level{LogLevel::info};           //! Level the message was logged at
+	const char                           *m_format_string{nullptr};          //! Format string, string literals are expected
+	std::chrono::system_clock::time_point m_time{};                          //! When the message was logged
+};
+
+/**
+ * Single producer single consumer ring of variable sized LogRecords
+ * Only the owning thread writes and only the async logger thread reads, so it needs no locks
+ * When the owning thread exits it releases the ring, the next new thread acquires it instead of creating another one
+ */
+class ROAR_ENGINE_ITEM LogRing final
+{
+  public:
+	FORCE_INLINE          LogRing()                            = delete;         //! Default constructor
+	FORCE_INLINE          LogRing(const LogRing &a_other)      = delete;         //! Copy constructor
+	FORCE_INLINE          LogRing(LogRing &&a_other) noexcept  = delete;         //! Move constructor
+	FORCE_INLINE LogRing &operator=(const LogRing &a_other)     = delete;         //! Copy assignment operator
+	FORCE_INLINE LogRing &operator=(LogRing &&a_other) noexcept = delete;         //! Move assignment operator
+	FORCE_INLINE ~LogRing() noexcept                            = default;        //! Destructor
+
+	FORCE_INLINE explicit LogRing(size_t a_capacity);
+
+	FORCE_INLINE std::byte *reserve(size_t a_size) noexcept;        // Producer, returns nullptr if there isn't enough space yet
+	FORCE_INLINE void       commit(size_t a_size) noexcept;         // Producer, publishes the reserved record
+	FORCE_INLINE void       release() noexcept;                     // Producer, gives the ring up, nothing is written into it after this
+	FORCE_INLINE bool       acquire() noexcept;                     // Becomes the producer of a released ring, returns false if its still owned
+	FORCE_INLINE bool       empty() const noexcept;
+	FORCE_INLINE size_t     capacity() const noexcept;
+
+	template <typename _function>
+	FORCE_INLINE size_t consume(_function &&a_function);        // Consumer, visits all published records oldest first
+
+	static constexpr size_t record_alignment = sizeof(LogRecord);        //! Every record starts at a multiple of this so a header always fits before the end
+
+  private:
+	std::unique_ptr<std::byte[]>                  m_data{};              //! Power of two sized ring
+	size_t                                        m_mask{0};             //! Capacity - 1
+	alignas(cache_line_size) std::atomic<uint64_t> m_head{0};            //! Bytes ever published, written by the producer
+	alignas(cache_line_size) std::atomic<uint64_t> m_tail{0};            //! Bytes ever consumed, written by the consumer
+	std::atomic<bool>                             m_released{false};     //! Set once the producer has gone, records already in it are still consumed
+};
+
+/**
+ * Asynchronous backend for the log_* functions, arguments are copied into a per thread LogRing and formatted on a background thread
+ * Strings are captured by value, everything else has to be copyable and formattable by fmt
+ * Messages of one thread keep their order, messages of different threads are written in the order the background thread finds them
+ */
+class ROAR_ENGINE_ITEM AsyncLogger final
+{
+  public:
+	AsyncLogger();                                                                          //! Default constructor
+	FORCE_INLINE              AsyncLogger(const AsyncLogger &a_other)     = delete;         //! Copy constructor
+	FORCE_INLINE              AsyncLogger(AsyncLogger &&a_other) noexcept = delete;         //! Move constructor
+	FORCE_INLINE AsyncLogger &operator=(const AsyncLogger &a_other)       = delete;         //! Copy assignment operator
+	FORCE_INLINE AsyncLogger &operator=(AsyncLogger &&a_other) noexcept   = delete;         //! Move assignment operator
+	~AsyncLogger() noexcept;                                                                //! Destructor
+
+	void   start(Log &a_logger);        // Starts the background thread writing into a_logger
+	void   stop();                      // Writes everything queued and joins the background thread
+	void   flush();                     // Blocks until everything logged before the call is written
+	bool   running() const noexcept;
+	size_t rings_count();               // Rings created so far, only grows with the most threads logging at the same time
+
+	template <typename... Args>
+	void push(LogLevel a_level, const char *a_format, const Args &...a_args);
+
+	static constexpr size_t ring_capacity{1 << 16};        //! Bytes per thread, callers wait for the background thread once full
+
+  private:
+	LogRing &thread_ring();
+	void     run();
+	bool     drain(fmt::memory_buffer &a_buffer, std::vector<LogRing *> &a_rings);
+
+	uint64_t                              m_id{0};                     //! Unique per instance, identifies which logger the thread_local ring belongs to
+	std::atomic<bool>                     m_running{false};            //! Checked by every log call with a relaxed load
+	Log                                  *m_logger{nullptr};           //! Where formatted messages are written
+	std::thread                           m_thread{};                  //! Background thread formatting and writing messages
+	std::mutex                            m_mutex{};                   //! Protects m_rings, the flush sequence numbers and the wake up condition
+	std::condition_variable               m_condition{};               //! Wakes the background thread up early
+	std::condition_variable               m_flushed_condition{};       //! Wakes up flush() callers once their sequence number is drained
+	uint64_t                              m_flush_requested{0};        //! Sequence number of the last flush() call
+	uint64_t                              m_flushed{0};                //! Sequence number of the last flush() call that has been drained
+	std::vector<std::shared_ptr<LogRing>> m_rings{};                   //! Rings of all threads logging, shared with the thread_local so either can go first
+};
+
+/**
+ * Per call site rate limit, used through log_rate_limited, lets through one message per interval and counts the rest
+ */
+class ROAR_ENGINE_ITEM LogRateLimit final
+{
+  public:
+	FORCE_INLINE               LogRateLimit(const LogRateLimit &a_other)     = delete;         //! Copy constructor
+	FORCE_INLINE               LogRateLimit(LogRateLimit &&a_other) noexcept = delete;         //! Move constructor
+	FORCE_INLINE LogRateLimit &operator=(const LogRateLimit &a_other)        = delete;         //! Copy assignment operator
+	FORCE_INLINE LogRateLimit &operator=(LogRateLimit &&a_other) noexcept    = delete;         //! Move assignment operator
+	FORCE_INLINE ~LogRateLimit() noexcept                                    = default;        //! Destructor
+
+	FORCE_INLINE explicit LogRateLimit(std::chrono::milliseconds a_interval = std::chrono::milliseconds(1000)) noexcept;
+
+	FORCE_INLINE bool allow(uint32_t &a_suppressed) noexcept;        // a_suppressed is how many calls were dropped since the last allowed one
+
+  private:
+	using Clock = std::chrono::steady_clock;
+
+	int64_t               m_interval{0};          //! Nanoseconds between allowed messages
+	std::atomic<int64_t>  m_next{0};              //! Nanoseconds since clock epoch when the next message is allowed
+	std::atomic<uint32_t> m_suppressed{0};        //! Calls dropped since the last allowed one
+};
+
 void log_set_level(LogLevel a_level);
+void log_set_async(bool a_async);        // Switches the log_* functions to and from the async logger, switching off writes everything queued
+void log_flush();
 
 template <typename... Args>
 void log_trace(const char *a_format, const Args &...a_args);
@@ -122,4 +270,18 @@ void log_critical(const char *a_format, const Args &...a_args);
 
 }        // namespace ror
 
+// Lets through one message per second from this call site, the rest are counted and reported with the next one that gets through
+#define log_rate_limited(_log_function, ...)                                                                  \
+	do                                                                                                        \
+	{                                                                                                         \
+		static ror::LogRateLimit ror_log_rate_limit{};                                                        \
+		uint32_t                 ror_log_suppressed{0};                                                       \
+		if (ror_log_rate_limit.allow(ror_log_suppressed))                                                     \
+		{                                                                                                     \
+			if (ror_log_suppressed)                                                                           \
+				_log_function("Suppressed {} repeats of the following message", ror_log_suppressed);          \
+			_log_function(__VA_ARGS__);                                                                       \
+		}                                                                                                     \
+	} while (false)
+
 #include "rorlog.hh"
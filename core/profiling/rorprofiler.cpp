@@ -0,0 +1,164 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "profiling/rorlog.hpp"
+#include "rorprofiler.hpp"
+#include <fstream>
+
+namespace ror
+{
+namespace
+{
+// Profiler is a singleton so a single per thread cache of the buffer is enough
+thread_local ProfileBuffer *current_profile_buffer{nullptr};
+thread_local std::string    current_thread_name{};        // Name set before the thread had a buffer, applied on registration
+
+void append_escaped(std::string &a_output, const char *a_string)
+{
+	for (const char *c = a_string; *c; ++c)
+	{
+		// clang-format off
+		switch (*c)
+		{
+			case '"':  a_output += "\\\""; break;
+			case '\\': a_output += "\\\\"; break;
+			case '\n': a_output += "\\n";  break;
+			case '\t': a_output += "\\t";  break;
+			default:
+				if (static_cast<unsigned char>(*c) >= 0x20)
+					a_output += *c;
+		}
+		// clang-format on
+	}
+}
+
+// Chrome trace wants microseconds, keeps nanosecond precision without going through floats
+void append_microseconds(std::string &a_output, int64_t a_nanoseconds)
+{
+	auto fraction = std::to_string(a_nanoseconds % 1000);
+
+	a_output += std::to_string(a_nanoseconds / 1000);
+	a_output += '.';
+	a_output.append(3 - fraction.size(), '0');
+	a_output += fraction;
+}
+}        // namespace
+
+ProfileBuffer &Profiler::thread_buffer()
+{
+	if (current_profile_buffer)
+		return *current_profile_buffer;
+
+	std::lock_guard<std::mutex> lock{this->m_mutex};
+
+	auto  thread_id = static_cast<uint32_t>(this->m_buffers.size());
+	auto &buffer    = this->m_buffers.emplace_back(std::make_unique<ProfileBuffer>(thread_id, ring_capacity));
+
+	buffer->m_name         = current_thread_name.empty() ? "thread " + std::to_string(thread_id) : current_thread_name;
+	current_profile_buffer = buffer.get();
+
+	return *buffer;
+}
+
+void Profiler::set_thread_name(const std::string &a_name)
+{
+	current_thread_name = a_name;
+
+	if (current_profile_buffer)
+	{
+		std::lock_guard<std::mutex> lock{this->m_mutex};
+		current_profile_buffer->m_name = a_name;
+	}
+}
+
+void Profiler::clear()
+{
+	std::lock_guard<std::mutex> lock{this->m_mutex};
+
+	for (auto &buffer : this->m_buffers)
+		buffer->clear();
+}
+
+std::string Profiler::chrome_trace()
+{
+	std::lock_guard<std::mutex> lock{this->m_mutex};
+
+	std::string trace{"{\"traceEvents\":["};
+	bool        first{true};
+
+	auto separator = [&trace, &first]() {
+		if (!first)
+			trace += ",\n";
+		first = false;
+	};
+
+	for (auto &buffer : this->m_buffers)
+	{
+		auto tid = std::to_string(buffer->thread_id());
+
+		separator();
+		trace += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" + tid + ",\"args\":{\"name\":\"";
+		append_escaped(trace, buffer->m_name.c_str());
+		trace += "\"}}";
+
+		buffer->for_each([&trace, &tid, &separator](const ProfileEvent &a_event) {
+			separator();
+			trace += "{\"name\":\"";
+			append_escaped(trace, a_event.m_name);
+			trace += "\",\"cat\":\"roar\",\"ph\":\"X\",\"pid\":0,\"tid\":" + tid + ",\"ts\":";
+			append_microseconds(trace, a_event.m_start);
+			trace += ",\"dur\":";
+			append_microseconds(trace, a_event.m_end - a_event.m_start);
+			trace += ",\"args\":{\"depth\":" + std::to_string(a_event.m_depth) + "}}";
+		});
+	}
+
+	trace += "],\"displayTimeUnit\":\"ms\"}\n";
+
+	return trace;
+}
+
+bool Profiler::write_chrome_trace(const std::filesystem::path &a_path)
+{
+	std::ofstream file{a_path, std::ios::out | std::ios::trunc};
+	if (!file.is_open())
+	{
+		ror::log_error("Can't open profile trace file {} for writing", a_path.string());
+		return false;
+	}
+
+	file << this->chrome_trace();
+	ror::log_info("Written profile trace to {}", a_path.string());
+
+	return file.good();
+}
+
+Profiler &profiler() noexcept
+{
+	static Profiler profiler_instance{};
+	return profiler_instance;
+}
+
+}        // namespace ror
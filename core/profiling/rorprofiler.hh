@@ -0,0 +1,114 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "rorprofiler.hpp"
+#include <cassert>
+
+namespace ror
+{
+FORCE_INLINE ProfileBuffer::ProfileBuffer(uint32_t a_thread_id, size_t a_capacity) :
+    m_thread_id(a_thread_id)
+{
+	assert(a_capacity && (a_capacity & (a_capacity - 1)) == 0 && "Profile buffer capacity must be a power of two");
+
+	this->m_events.resize(a_capacity);
+	this->m_mask = a_capacity - 1;
+}
+
+FORCE_INLINE void ProfileBuffer::push(const ProfileEvent &a_event) noexcept
+{
+	auto head                           = this->m_head.load(std::memory_order_relaxed);        // Only the owner writes head
+	this->m_events[head & this->m_mask] = a_event;
+	this->m_head.store(head + 1, std::memory_order_release);
+}
+
+FORCE_INLINE void ProfileBuffer::clear() noexcept
+{
+	this->m_head.store(0, std::memory_order_release);
+}
+
+FORCE_INLINE size_t ProfileBuffer::size() const noexcept
+{
+	auto head = this->m_head.load(std::memory_order_acquire);
+	return static_cast<size_t>(std::min<uint64_t>(head, this->m_events.size()));
+}
+
+FORCE_INLINE uint32_t ProfileBuffer::thread_id() const noexcept
+{
+	return this->m_thread_id;
+}
+
+template <typename _function>
+FORCE_INLINE void ProfileBuffer::for_each(_function &&a_function) const
+{
+	auto head  = this->m_head.load(std::memory_order_acquire);
+	auto count = std::min<uint64_t>(head, this->m_events.size());
+
+	for (auto i = head - count; i < head; ++i)
+		a_function(this->m_events[i & this->m_mask]);
+}
+
+FORCE_INLINE Profiler::Profiler() :
+    m_epoch(Clock::now())
+{}
+
+FORCE_INLINE void Profiler::enable(bool a_enable) noexcept
+{
+	this->m_enabled.store(a_enable, std::memory_order_relaxed);
+}
+
+FORCE_INLINE bool Profiler::enabled() const noexcept
+{
+	return this->m_enabled.load(std::memory_order_relaxed);
+}
+
+FORCE_INLINE int64_t Profiler::now() const noexcept
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - this->m_epoch).count();
+}
+
+FORCE_INLINE ProfileZone::ProfileZone(const char *a_name)
+{
+	auto &prof = profiler();
+	if (!prof.enabled())
+		return;
+
+	this->m_buffer = &prof.thread_buffer();
+	this->m_name   = a_name;
+	this->m_depth  = this->m_buffer->m_depth++;
+	this->m_start  = prof.now();
+}
+
+FORCE_INLINE ProfileZone::~ProfileZone() noexcept
+{
+	if (!this->m_buffer)
+		return;
+
+	auto end = profiler().now();
+	this->m_buffer->m_depth--;
+	this->m_buffer->push({this->m_name, this->m_start, end, this->m_depth});
+}
+
+}        // namespace ror
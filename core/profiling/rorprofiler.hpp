@@ -0,0 +1,156 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#pragma once
+
+#include "foundation/rormacros.hpp"
+#include "foundation/rortypes.hpp"
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ror
+{
+/**
+ * A single closed zone, m_name must outlive the profiler since only the pointer is stored, string literals are expected
+ * Times are in nanoseconds since the profiler epoch
+ */
+struct ProfileEvent
+{
+	const char *m_name{nullptr};        //! Static name of the zone
+	int64_t     m_start{0};             //! Start of the zone in nanoseconds since profiler epoch
+	int64_t     m_end{0};               //! End of the zone in nanoseconds since profiler epoch
+	uint32_t    m_depth{0};             //! Nesting depth of the zone on its thread
+};
+
+/**
+ * Per thread ring buffer of profile events, only the owning thread writes into it so it needs no locks
+ * When full, oldest events are overwritten, reading is only safe once the writing thread is quiescent
+ */
+class ROAR_ENGINE_ITEM ProfileBuffer final
+{
+  public:
+	FORCE_INLINE                ProfileBuffer()                                 = delete;         //! Default constructor
+	FORCE_INLINE                ProfileBuffer(const ProfileBuffer &a_other)     = delete;         //! Copy constructor
+	FORCE_INLINE                ProfileBuffer(ProfileBuffer &&a_other) noexcept = delete;         //! Move constructor
+	FORCE_INLINE ProfileBuffer &operator=(const ProfileBuffer &a_other)         = delete;         //! Copy assignment operator
+	FORCE_INLINE ProfileBuffer &operator=(ProfileBuffer &&a_other) noexcept     = delete;         //! Move assignment operator
+	FORCE_INLINE ~ProfileBuffer() noexcept                                      = default;        //! Destructor
+
+	FORCE_INLINE ProfileBuffer(uint32_t a_thread_id, size_t a_capacity);
+
+	FORCE_INLINE void     push(const ProfileEvent &a_event) noexcept;
+	FORCE_INLINE void     clear() noexcept;
+	FORCE_INLINE size_t   size() const noexcept;
+	FORCE_INLINE uint32_t thread_id() const noexcept;
+
+	template <typename _function>
+	FORCE_INLINE void for_each(_function &&a_function) const;        // Visits events oldest to newest
+
+	uint32_t    m_depth{0};        //! Current zone depth, only touched by the owning thread
+	std::string m_name{};          //! Thread name used in the trace, protected by the profiler mutex
+
+  private:
+	std::vector<ProfileEvent> m_events{};            //! Power of two sized ring of events
+	size_t                    m_mask{0};             //! Capacity - 1 for cheap wrap around
+	std::atomic<uint64_t>     m_head{0};             //! Total number of events ever pushed, published with release
+	uint32_t                  m_thread_id{0};        //! Sequential id used as tid in the trace
+};
+
+class ROAR_ENGINE_ITEM Profiler final
+{
+  public:
+	FORCE_INLINE           Profiler();                                                    //! Default constructor
+	FORCE_INLINE           Profiler(const Profiler &a_other)            = delete;         //! Copy constructor
+	FORCE_INLINE           Profiler(Profiler &&a_other) noexcept        = delete;         //! Move constructor
+	FORCE_INLINE Profiler &operator=(const Profiler &a_other)           = delete;         //! Copy assignment operator
+	FORCE_INLINE Profiler &operator=(Profiler &&a_other) noexcept       = delete;         //! Move assignment operator
+	FORCE_INLINE ~Profiler() noexcept                                   = default;        //! Destructor
+
+	FORCE_INLINE void    enable(bool a_enable) noexcept;
+	FORCE_INLINE bool    enabled() const noexcept;
+	FORCE_INLINE int64_t now() const noexcept;
+
+	ProfileBuffer &thread_buffer();                                        // Returns calling threads buffer, creates and registers one on first call
+	void           set_thread_name(const std::string &a_name);             // Names the calling thread in the trace, cheap to call while disabled
+	void           clear();                                                // Drops all recorded events, all threads must be quiescent
+	std::string    chrome_trace();                                         // All recorded events as Chrome trace event JSON, all threads must be quiescent
+	bool           write_chrome_trace(const std::filesystem::path &a_path);
+
+	static constexpr size_t ring_capacity{1 << 15};        //! Events per thread, oldest are dropped once full
+
+  private:
+	using Clock = std::chrono::steady_clock;
+
+	std::atomic<bool>                           m_enabled{false};        //! Runtime switch, checked by every zone with a relaxed load
+	Clock::time_point                           m_epoch{};               //! All timestamps are relative to this
+	std::mutex                                  m_mutex{};               //! Protects m_buffers and thread names
+	std::vector<std::unique_ptr<ProfileBuffer>> m_buffers{};             //! Buffers of all threads that ever recorded, owned here so they outlive their threads
+};
+
+ROAR_ENGINE_ITEM Profiler &profiler() noexcept;
+
+/**
+ * RAII zone, records its lifetime into the calling threads profile buffer
+ * When the profiler is disabled this is a relaxed load and a branch
+ */
+class ROAR_ENGINE_ITEM ProfileZone final
+{
+  public:
+	FORCE_INLINE              ProfileZone()                               = delete;         //! Default constructor
+	FORCE_INLINE              ProfileZone(const ProfileZone &a_other)     = delete;         //! Copy constructor
+	FORCE_INLINE              ProfileZone(ProfileZone &&a_other) noexcept = delete;         //! Move constructor
+	FORCE_INLINE ProfileZone &operator=(const ProfileZone &a_other)       = delete;         //! Copy assignment operator
+	FORCE_INLINE ProfileZone &operator=(ProfileZone &&a_other) noexcept   = delete;         //! Move assignment operator
+
+	FORCE_INLINE explicit ProfileZone(const char *a_name);        // Not noexcept, first zone on a thread allocates and registers its buffer
+	FORCE_INLINE ~ProfileZone() noexcept;
+
+  private:
+	ProfileBuffer *m_buffer{nullptr};        //! Null when profiler was disabled at zone start
+	const char    *m_name{nullptr};          //! Static name of the zone
+	int64_t        m_start{0};               //! Start time in nanoseconds since profiler epoch
+	uint32_t       m_depth{0};               //! Depth of this zone on its thread
+};
+
+}        // namespace ror
+
+#define ror_profile_concat_helper(_a, _b) _a##_b
+#define ror_profile_concat(_a, _b) ror_profile_concat_helper(_a, _b)
+
+// Compiling with ROR_PROFILER_DISABLED removes the zones completely
+#if defined(ROR_PROFILER_DISABLED)
+#	define profile_zone(_name)
+#	define profile_function()
+#else
+#	define profile_zone(_name) ror::ProfileZone ror_profile_concat(profile_zone_, __LINE__)(_name)
+#	define profile_function() profile_zone(__func__)
+#endif
+
+#include "rorprofiler.hh"
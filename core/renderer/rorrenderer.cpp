@@ -47,6 +47,7 @@
 #include "math/rorvector4.hpp"
 #include "math/rorvector_functions.hpp"
 #include "profiling/rorlog.hpp"
+#include "profiling/rorprofiler.hpp"
 #include "profiling/rortimer.hpp"
 #include "renderer/rorrenderer.hpp"
 #include "resources/rorresource.hpp"
@@ -1217,6 +1218,8 @@ void Renderer::load_specific()
 // This is the entry into rendering
 void Renderer::render(ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system, rhi::BuffersPack &a_buffer_pack, rhi::Device &a_device, ror::Timer &a_timer)
 {
+	profile_zone("Renderer::render");
+
 	(void) a_job_system;
 	(void) a_event_system;
 	(void) a_buffer_pack;
@@ -1226,6 +1229,7 @@ void Renderer::render(ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::Ev
 	this->m_frames.begin_frame();
 
 	a_scene.current_camera().update();
+	a_scene.select_lods(a_job_system);
 
 	rhi::Swapchain surface = a_device.platform_swapchain();
 
@@ -2113,6 +2117,8 @@ void push_brdf_integration_lut_binding(rhi::Device &a_device, ror::Renderer &a_r
 
 void Renderer::upload(rhi::Device &a_device, ror::Scene &a_scene, ror::EventSystem &a_event_system, const ror::Vector4f &a_dimensions, rhi::BuffersPack &a_buffer_pack)
 {
+	profile_zone("Renderer::upload");
+
 	this->dimensions(a_dimensions, a_device);
 	for (auto &shader : this->m_shaders)
 	{
@@ -27,9 +27,11 @@
 #include "foundation/rorhash.hpp"
 #include "foundation/rormacros.hpp"
 #include "foundation/rorrandom.hpp"
+#include "foundation/rorsystem.hpp"
 #include "foundation/rorutilities.hpp"
 #include "profiling/rorlog.hpp"
 #include "resources/rorprojectroot.hpp"
+#include "resources/rorresource_index.hpp"
 #include "rhi/rortypes.hpp"
 #include "rorresource.hpp"
 #include "settings/rorsettings.hpp"
@@ -49,6 +51,13 @@
 #include <utility>
 #include <vector>
 
+#if !defined(ROR_OS_TYPE_WINDOWS)
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
 namespace ror
 {
 std::string get_resource_semantic_string(ResourceSemantic a_semantic)
@@ -150,6 +159,66 @@ ResourceExtension get_resource_extension(const std::filesystem::path &a_path)
  project_root/textures/astro_boy/misc/boy10.jpg
 */
 
+// Walks the candidate locations in the order documented above, returns the first one a_exists accepts relative to the project root
+template <class _predicate>
+static std::filesystem::path probe_resource(const std::filesystem::path &a_path, const std::filesystem::path &a_semantic_path, _predicate &&a_exists)
+{
+	std::filesystem::path resource_semantic_path{a_semantic_path / a_path};
+
+	// Is it at the root of the project?
+	if (a_exists(a_path))
+		return a_path;
+
+	// Try to find it on the filesystem inside the project root
+	if (a_exists(resource_semantic_path))
+		return resource_semantic_path;
+
+	// Some times projects have "assets" folder, lets search that too
+	std::filesystem::path r{std::filesystem::path{"assets"} / a_path};
+	if (a_exists(r))
+		return r;
+
+	std::filesystem::path s{std::filesystem::path{"assets"} / resource_semantic_path};
+	if (a_exists(s))
+		return s;
+
+	// Split the path for parent and file name, its ok if these don't exist and return ""
+	auto parent_path = a_path.parent_path();
+	auto file_name   = a_path.filename();
+
+	std::filesystem::path t{parent_path / "assets" / file_name};
+	if (a_exists(t))
+		return t;
+
+	std::filesystem::path u{parent_path / "assets" / resource_semantic_path};
+	if (a_exists(u))
+		return u;
+
+	std::filesystem::path v{parent_path / a_semantic_path / file_name};
+	if (a_exists(v))
+		return v;
+
+	// Now we are desperate, trying hard to find this resource
+	for (auto item : {ResourceSemantic::materials,
+	                  ResourceSemantic::textures,
+	                  ResourceSemantic::shaders,
+	                  ResourceSemantic::scripts,
+	                  ResourceSemantic::objects,
+	                  ResourceSemantic::configs,
+	                  ResourceSemantic::models,
+	                  ResourceSemantic::scenes,
+	                  ResourceSemantic::misc})        // Different way of dealing with caches and logs
+	{
+		auto items_path = get_resource_semantic_string(item);
+
+		std::filesystem::path w{a_semantic_path / parent_path / items_path / file_name};
+		if (a_exists(w))
+			return w;
+	}
+
+	return {};
+}
+
 std::filesystem::path find_resource(const std::filesystem::path &a_path, ResourceSemantic a_semantic)
 {
 	// If absolute path or has no filename, just return as it is
@@ -163,100 +232,41 @@ std::filesystem::path find_resource(const std::filesystem::path &a_path, Resourc
 	std::filesystem::path semantic_path{get_resource_semantic_string(a_semantic)};
 	std::filesystem::path resource_semantic_path{semantic_path / a_path};
 
-	auto project_root_path = get_project_root().path();        // Here calling get_project_root without any arguments relies on clients who must have called and initalized project_root
+	auto  project_root_path = get_project_root().path();        // Here calling get_project_root without any arguments relies on clients who must have called and initalized project_root
+	auto &index             = get_resource_index();
 
-	// Is it at the root of the project?
-	std::filesystem::path p{project_root_path / a_path};
+	// Resolved before and nothing has changed since
+	auto resolved = index.resolved(a_path, a_semantic);
+	if (!resolved.empty())
+		return resolved;
 
-	// If the file exists don't muck around just return
-	if (std::filesystem::exists(p))
-	{
-		return p;
-	}
-	else        // Try to find it on the filesystem inside the project root
+	// Probe the index first, no syscalls. If that fails the file might have been created outside the engine and not reported yet
+	// so probe the filesystem as well before giving up, this is what the index replaced, so only the first miss pays for it
+	// After that the miss is remembered until something is added, by the engine or WatchCat if the index is watched
+	std::filesystem::path found{};
+	if (!index.missing(a_path, a_semantic))
 	{
-		std::filesystem::path q{project_root_path / resource_semantic_path};
+		found = probe_resource(a_path, semantic_path, [&index](const std::filesystem::path &a_relative) { return index.contains(a_relative); });
 
-		if (std::filesystem::exists(q))
+		if (found.empty())
 		{
-			return q;
-		}
-		else
-		{
-			// Some times projects have "assets" folder, lets search that too
-			std::filesystem::path r{project_root_path / "assets" / a_path};
+			found = probe_resource(a_path, semantic_path, [&project_root_path](const std::filesystem::path &a_relative) { return std::filesystem::exists(project_root_path / a_relative); });
 
-			if (std::filesystem::exists(r))
-			{
-				return r;
-			}
+			if (!found.empty())
+				index.add(project_root_path / found);
 			else
-			{
-				std::filesystem::path s{project_root_path / "assets" / resource_semantic_path};
-
-				if (std::filesystem::exists(s))
-				{
-					return s;
-				}
-				else
-				{
-					// Split the path for parent and file name, its ok if these don't exist and return ""
-					auto parent_path = a_path.parent_path();
-					auto file_name   = a_path.filename();
-
-					std::filesystem::path t{project_root_path / parent_path / "assets" / file_name};
-
-					if (std::filesystem::exists(t))
-					{
-						return t;
-					}
-					else
-					{
-						std::filesystem::path u{project_root_path / parent_path / "assets" / resource_semantic_path};
-
-						if (std::filesystem::exists(u))
-						{
-							return u;
-						}
-						else
-						{
-							std::filesystem::path v{project_root_path / parent_path / semantic_path / file_name};
-
-							if (std::filesystem::exists(v))
-							{
-								return v;
-							}
-							else
-							{
-								// Now we are desperate, trying hard to find this resource
-								for (auto item : {ResourceSemantic::materials,
-								                  ResourceSemantic::textures,
-								                  ResourceSemantic::shaders,
-								                  ResourceSemantic::scripts,
-								                  ResourceSemantic::objects,
-								                  ResourceSemantic::configs,
-								                  ResourceSemantic::models,
-								                  ResourceSemantic::scenes,
-								                  ResourceSemantic::misc})        // Different way of dealing with caches and logs
-								{
-									auto items_path = get_resource_semantic_string(item);
-
-									std::filesystem::path w{project_root_path /
-									                        semantic_path / parent_path / items_path / file_name};
-
-									if (std::filesystem::exists(w))
-									{
-										return w;
-									}
-								}
-							}
-						}
-					}
-				}
-			}
+				index.remember_missing(a_path, a_semantic);
 		}
 	}
 
+	if (!found.empty())
+	{
+		auto absolute_path = project_root_path / found;
+		index.remember(a_path, a_semantic, absolute_path);
+
+		return absolute_path;
+	}
+
 	// TODO: Try a recursive search if still hasnt' found the resource
 
 	// If no valid path provided and we have exhausted all posibilites just create a file with current time
@@ -377,6 +387,17 @@ Resource &make_resource(const std::filesystem::path &a_path, ResourceSemantic a_
 	return resource;
 }
 
+/**
+ * Can be used to map big read only resources like models and textures without copying them into memory first
+ * Use data_span() to access the mapped data, falls back to normal loading if the file can't be mapped
+ */
+Resource &map_resource(const std::filesystem::path &a_path, ResourceSemantic a_semantic)
+{
+	auto &resource = get_resource(a_path, a_semantic);
+	resource.map();
+	return resource;
+}
+
 /**
  * Can be used to check if a resource in exits in the project folders or not
  */
@@ -400,6 +421,8 @@ Resource &resource(const std::filesystem::path &a_path, ResourceSemantic a_seman
 			return create_resource(a_path, a_semantic, a_parent_path);
 		case ResourceAction::make:
 			return make_resource(a_path, a_semantic, a_parent_path);
+		case ResourceAction::map:
+			return map_resource(a_path, a_semantic);
 	}
 
 	return load_resource(a_path, a_semantic);
@@ -449,6 +472,7 @@ void Resource::create()
 		else
 			std::filesystem::create_directories(this->m_absolute_path);
 
+		get_resource_index().add(this->m_absolute_path);
 		this->update_hashes();
 	}
 	else
@@ -471,11 +495,15 @@ void Resource::remove()
 		assert(project_root.is_absolute() && "Project root isn't absolute, can't delete files in this path");
 		assert(this->m_absolute_path.is_absolute() && "Resource path isn't absolute");
 		if (this->m_absolute_path.string().find(project_root) != std::string::npos)        // Make sure its relative to the project we are working in
+		{
 			std::filesystem::remove_all(this->m_absolute_path);
+			get_resource_index().remove(this->m_absolute_path);
+		}
 		else
 			log_critical("Trying to delete folder {} which is outside project {}", this->m_absolute_path.c_str(), project_root.c_str());
 	}
 
+	this->unmap();
 	this->m_data.clear();
 	this->update_hashes();
 	this->m_dirty = false;
@@ -487,11 +515,53 @@ void Resource::load()
 
 	std::lock_guard<std::mutex> lock(this->m_mutex);
 
-	this->load_or_mmap();
+	// Someone has already mapped this resource, data() users need a copy but the mapping stays alive for data_span() users
+	if (this->m_mapped_data)
+		this->m_data.assign(this->m_mapped_data, this->m_mapped_data + this->m_mapped_size);
+	else
+		this->load_or_mmap();
+
 	this->update_hashes();
 	ror::log_info("Loaded cached resource file {}", this->m_absolute_path.c_str());
 }
 
+void Resource::map()
+{
+	std::lock_guard<std::mutex> lock(this->m_mutex);
+
+	// Already mapped by an earlier map() or map_resource(), nothing has changed since
+	if (this->m_mapped_data)
+		return;
+
+	this->m_mapped = true;
+	this->load_or_mmap();
+	this->update_hashes();
+	ror::log_info("Mapped cached resource file {}", this->m_absolute_path.c_str());
+}
+
+bool Resource::mapped() const
+{
+	return this->m_mapped_data != nullptr;
+}
+
+hash_64_t Resource::data_hash() const
+{
+	std::lock_guard<std::mutex> lock(this->m_mutex);
+
+	if (!this->m_data_hashed)
+	{
+		auto data = this->data_span();
+		if (!data.empty())
+			this->m_data_hash = ror::hash_64(data.data(), data.size());
+		else
+			this->m_data_hash = 0;
+
+		this->m_data_hashed = true;
+	}
+
+	return this->m_data_hash;
+}
+
 void Resource::update_hashes()
 {
 	this->generate_uuid();
@@ -499,51 +569,48 @@ void Resource::update_hashes()
 	// Create Path hash from absolute path as compared to cached path
 	this->m_path_hash = std::filesystem::hash_value(this->m_absolute_path);
 
-	// Create Data hash from cached data as compared to actual file data
-	if (!this->m_data.empty())
-		this->m_data_hash = ror::hash_64(this->m_data.data(), this->m_data.size());
-	else
-		this->m_data_hash = 0;
+	// Data hash is worked out by data_hash() only if someone asks for it, most resources are never hashed
+	this->m_data_hashed = false;
 }
 
 void Resource::load_or_mmap()
 {
-	// If we are asked to create mmaped file or the resource is readonly, lets mmap it
-	if (this->m_mapped)        // || this->m_read_only)
+	// If we are asked to create mmaped file and the resource is readonly, lets mmap it
+	if (this->m_mapped && this->m_read_only)
 	{
-		assert(0 && "mmap me and consider m_read_only");
-	}
-	else
-	{
-		this->m_read_only            = true;        // TODO: Remove, although already true its here because its not used otherwise and I get warnings
-		std::ios_base::openmode mode = std::ios::ate | std::ios::in;
+		if (this->m_mapped_data || this->map_file())
+			return;
 
-		if (this->m_binary_file)
-			mode |= std::ios::binary;
+		ror::log_warn("Can't map file {}, loading it instead", this->m_absolute_path.c_str());
+	}
 
-		std::ifstream as_file(this->m_absolute_path, mode);
-		if (!as_file.is_open())
-		{
-			ror::log_critical("Can't open file, it probably doesn't exist {}", this->m_absolute_path.c_str());
-			return;
-		}
+	std::ios_base::openmode mode = std::ios::ate | std::ios::in;
 
-		// No point to synchronise here because some other process might be writing into the file
-		std::streampos bytes_count = as_file.tellg();
-		as_file.seekg(0, std::ios::beg);
+	if (this->m_binary_file)
+		mode |= std::ios::binary;
 
-		if (bytes_count <= 0)
-		{
-			ror::log_critical("Error! reading file size, it seems to be empty {}", this->m_absolute_path.c_str());
-			return;
-		}
+	std::ifstream as_file(this->m_absolute_path, mode);
+	if (!as_file.is_open())
+	{
+		ror::log_critical("Can't open file, it probably doesn't exist {}", this->m_absolute_path.c_str());
+		return;
+	}
 
-		// Cast is ok because if byte_count is bigger than size_t range, we have a bigger problem
-		this->m_data.resize(static_cast<size_t>(bytes_count));                           // std::streampos has "operator long log" so this works fine, here I am just making it unsigned
-		as_file.read(reinterpret_cast<char *>(this->m_data.data()), bytes_count);        // Weird that int8_t is 'signed char' and can't be converted to 'char'
+	// No point to synchronise here because some other process might be writing into the file
+	std::streampos bytes_count = as_file.tellg();
+	as_file.seekg(0, std::ios::beg);
 
-		as_file.close();
+	if (bytes_count <= 0)
+	{
+		ror::log_critical("Error! reading file size, it seems to be empty {}", this->m_absolute_path.c_str());
+		return;
 	}
+
+	// Cast is ok because if byte_count is bigger than size_t range, we have a bigger problem
+	this->m_data.resize(static_cast<size_t>(bytes_count));                           // std::streampos has "operator long log" so this works fine, here I am just making it unsigned
+	as_file.read(reinterpret_cast<char *>(this->m_data.data()), bytes_count);        // Weird that int8_t is 'signed char' and can't be converted to 'char'
+
+	as_file.close();
 }
 
 void Resource::write_or_unmap()
@@ -571,7 +638,55 @@ void Resource::write_or_unmap()
 		this->m_dirty = false;
 	}
 
-	// TODO: Use the mmap feature too if (this->m_maped == true)
+	this->unmap();
+}
+
+bool Resource::map_file()
+{
+#if defined(ROR_OS_TYPE_WINDOWS)
+	return false;        // TODO: Use CreateFileMapping/MapViewOfFile
+#else
+	int file_descriptor = ::open(this->m_absolute_path.c_str(), O_RDONLY | O_CLOEXEC);
+	if (file_descriptor < 0)
+		return false;
+
+	struct stat file_stat{};
+
+	// Only regular non-empty files can be mapped, mmap of zero bytes fails anyway
+	if (::fstat(file_descriptor, &file_stat) != 0 || !S_ISREG(file_stat.st_mode) || file_stat.st_size <= 0)
+	{
+		::close(file_descriptor);
+		return false;
+	}
+
+	auto  size    = static_cast<size_t>(file_stat.st_size);
+	void *address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+
+	::close(file_descriptor);        // The mapping keeps its own reference to the file
+
+	if (address == MAP_FAILED)
+		return false;
+
+	// Resources are mostly parsed front to back once, ask for aggressive read ahead and start paging in now
+	::madvise(address, size, MADV_SEQUENTIAL);
+	::madvise(address, size, MADV_WILLNEED);
+
+	this->m_mapped_data = static_cast<const uint8_t *>(address);
+	this->m_mapped_size = size;
+
+	return true;
+#endif
+}
+
+void Resource::unmap()
+{
+#if !defined(ROR_OS_TYPE_WINDOWS)
+	if (this->m_mapped_data)
+		::munmap(const_cast<uint8_t *>(this->m_mapped_data), this->m_mapped_size);
+#endif
+
+	this->m_mapped_data = nullptr;
+	this->m_mapped_size = 0;
 }
 
 void Resource::flush()
@@ -597,17 +712,27 @@ const std::vector<uint8_t> &Resource::data(bool a_force) const
 	(void) a_force;
 
 	assert(this->m_semantic != ror::ResourceSemantic::shaders || a_force && "Data can't be returned by reference for shaders and its not forced");
+	assert((this->m_mapped_data == nullptr || !this->m_data.empty()) && "Resource is mapped, use data_span() instead");
 
 	return this->m_data;
 }
 
+bytes_span Resource::data_span() const
+{
+	if (this->m_mapped_data)
+		return {this->m_mapped_data, this->m_mapped_size};
+
+	return {this->m_data.data(), this->m_data.size()};
+}
+
 std::string Resource::data_copy()
 {
 	assert(this->m_semantic == ror::ResourceSemantic::shaders || this->m_semantic == ror::ResourceSemantic::misc);        // This is not strictly necessary but could be costly otherwise
 
 	std::lock_guard<std::mutex> lock(this->m_mutex);
 
-	return {this->m_data.begin(), this->m_data.end()};
+	auto data = this->data_span();
+	return {data.begin(), data.end()};
 }
 
 const std::filesystem::path &Resource::absolute_path() const
@@ -639,6 +764,16 @@ void Resource::update(bytes_vector &&a_data, bool a_force, bool a_append, bool a
 
 	std::lock_guard<std::mutex> lock(this->m_mutex);
 
+	// Updated resources can't stay mapped, the mapping is read only
+	if (this->m_mapped_data)
+	{
+		if (this->m_data.empty())
+			this->m_data.assign(this->m_mapped_data, this->m_mapped_data + this->m_mapped_size);
+
+		this->unmap();
+		this->m_mapped = false;
+	}
+
 	if (a_append)
 	{
 		auto psize = this->m_data.size();
@@ -35,6 +35,7 @@
 #include <istream>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -101,7 +102,8 @@ enum class ResourceAction
 {
 	load,          // Load action to load an existing resource
 	create,        // Create action to create a resource on disk
-	make           // Make action creates a resource in memory, that needs to be flushed later
+	make,          // Make action creates a resource in memory, that needs to be flushed later
+	map            // Map action maps an existing resource read only, use data_span() to access it
 };
 
 std::string       get_resource_semantic_string(ResourceSemantic a_semantic);
@@ -119,6 +121,8 @@ struct PathHash
 using bytes_vector = std::vector<uint8_t>;
 static_assert(alignof(bytes_vector) == 8, "Bytes vector not aligned to 8 bytes");
 
+using bytes_span = std::span<const uint8_t>;
+
 std::filesystem::path get_cache_path();
 std::filesystem::path find_resource(const std::filesystem::path &, ResourceSemantic);        // Tries very hard to find the resource in the paths it knows, it has an order to it
 
@@ -144,6 +148,7 @@ class ROAR_ENGINE_ITEM Resource final
 
 	// What will be the best way to send it back in to update data, maybe a string_view
 	const bytes_vector          &data(bool a_force = false) const;
+	bytes_span                   data_span() const;        // Zero copy view of the mapped memory if mapped otherwise of data(), valid until unmapped or updated
 	std::string                  data_copy();
 	const std::filesystem::path &absolute_path() const;
 	ResourceSemantic             semantic() const;
@@ -151,6 +156,9 @@ class ROAR_ENGINE_ITEM Resource final
 	void                         create();
 	void                         remove();
 	void                         load();
+	void                         map();
+	bool                         mapped() const;
+	hash_64_t                    data_hash() const;        // Hashes the contents on first use after they change
 	void                         flush();
 	void                         update(bytes_vector &&a_data, bool a_force, bool a_append, bool a_mark_dirty);
 
@@ -159,7 +167,9 @@ class ROAR_ENGINE_ITEM Resource final
 	void load_or_mmap();          // Loads or mmaps the resource depending on whether its read only or not
 	void write_or_unmap();        // Writes or unmaps the resource to persistent media
 	void generate_uuid();         // Generates or Reads UUID for the resource
-	void update_hashes();         // Updates hashes for data and path
+	void update_hashes();         // Updates hash for path, data hash is only invalidated
+	bool map_file();              // Maps the file read only, returns false if the file can't be mapped
+	void unmap();                 // Unmaps the file if mapped
 
 	std::filesystem::path m_absolute_path{};                              // Path to the resource
 	ResourceExtension     m_extension{ResourceExtension::unknown};        // Extension of the resource loaded for further processing down the pipeline
@@ -167,12 +177,15 @@ class ROAR_ENGINE_ITEM Resource final
 	bytes_vector          m_data{};                                       // Pointer to its data
 	bool                  m_binary_file{false};                           // True if its a binary file and false if its text file
 	bool                  m_read_only{true};                              // If readonly we can optimise synchronisation and perhaps map it instead
-	bool                  m_mapped{false};                                // True if data is mmapped
+	bool                  m_mapped{false};                                // True if data should be mmapped when loaded
 	bool                  m_dirty{false};                                 // True if data is updated while read or while created
 	hash_64_t             m_path_hash{0};                                 // Hash of the path of the resource
-	hash_64_t             m_data_hash{0};                                 // Hash of the contents of the resource
+	mutable hash_64_t     m_data_hash{0};                                 // Hash of the contents of the resource, only valid if m_data_hashed
+	mutable bool          m_data_hashed{false};                           // True if m_data_hash is up to date with the contents
 	hash_128_t            m_uuid{0, 0};                                   // The UUID of the resource, if it doesn't have one, one will be generated for it
-	std::mutex            m_mutex{};                                      // Mutux used to lock when synchronising
+	const uint8_t        *m_mapped_data{nullptr};                         // Read only mapping of the file, nullptr if not mapped
+	size_t                m_mapped_size{0};                               // Size of the mapping in bytes
+	mutable std::mutex    m_mutex{};                                      // Mutux used to lock when synchronising
 };
 
 /**
@@ -187,10 +200,11 @@ Resource &load_resource(const std::filesystem::path &a_path, ResourceSemantic a_
 Resource &get_resource(const std::filesystem::path &a_path, ResourceSemantic a_semantic);
 Resource &create_resource(const std::filesystem::path &a_path, ResourceSemantic a_semantic, const std::filesystem::path &a_parent_path = {});
 Resource &make_resource(const std::filesystem::path &a_path, ResourceSemantic a_semantic, const std::filesystem::path &a_parent_path = {});
+Resource &map_resource(const std::filesystem::path &a_path, ResourceSemantic a_semantic);
 bool      check_resource(const std::filesystem::path &a_path, ResourceSemantic a_semantic, const std::filesystem::path &a_parent_path = {});
 
 /**
- * Uses the above 3 methods based on a_action
+ * Uses the above methods based on a_action
  */
 Resource &resource(const std::filesystem::path &a_path, ResourceSemantic a_semantic, ResourceAction a_action, const std::filesystem::path &a_parent_path = {});
 
@@ -0,0 +1,297 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "profiling/rorlog.hpp"
+#include "resources/rorprojectroot.hpp"
+#include "rorresource_index.hpp"
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <system_error>
+#include <unordered_set>
+#include <vector>
+
+namespace ror
+{
+namespace
+{
+// Entries are stored normalised with generic separators so "a/./b" and "a/b" are the same entry
+FORCE_INLINE std::string entry_key(const std::filesystem::path &a_relative_path)
+{
+	return a_relative_path.lexically_normal().generic_string();
+}
+
+FORCE_INLINE std::string resolved_key(const std::filesystem::path &a_path, ResourceSemantic a_semantic)
+{
+	return std::to_string(static_cast<uint32_t>(a_semantic)) + ":" + a_path.generic_string();
+}
+
+// Relative path of a_absolute_path inside a_root, empty if its outside
+FORCE_INLINE std::filesystem::path relative_to(const std::filesystem::path &a_absolute_path, const std::filesystem::path &a_root)
+{
+	auto relative = a_absolute_path.lexically_normal().lexically_relative(a_root);
+
+	if (relative.empty() || *relative.begin() == "..")
+		return {};
+
+	return relative;
+}
+
+// Version control, build and cache folders never hold assets but can be huge, hidden ones include .git and the roar cache
+FORCE_INLINE bool skipped_folder(const std::filesystem::path &a_path)
+{
+	auto name = a_path.filename().string();
+
+	return name.starts_with('.') || name == "build" || name == "cache";
+}
+
+constexpr auto directory_options = std::filesystem::directory_options::follow_directory_symlink | std::filesystem::directory_options::skip_permission_denied;        // Project assets are symlinks
+}        // namespace
+
+ResourceIndex::ResourceIndex(std::filesystem::path a_root)
+{
+	this->build(a_root);
+}
+
+void ResourceIndex::build(std::filesystem::path a_root)
+{
+	std::unique_lock<std::shared_mutex> lock{this->m_mutex};
+
+	this->m_root = a_root.lexically_normal();
+	this->m_entries.clear();
+	this->m_resolved.clear();
+	this->m_missing.clear();
+
+	this->scan(this->m_root);
+
+	ror::log_info("Resource index created for {} with {} entries", this->m_root.c_str(), this->m_entries.size());
+}
+
+void ResourceIndex::root(const std::filesystem::path &a_root)
+{
+	auto root = a_root.lexically_normal();
+
+	{
+		std::shared_lock<std::shared_mutex> lock{this->m_mutex};
+		if (this->m_root == root)
+			return;
+	}
+
+	std::unique_ptr<WatchCat> watcher{nullptr};
+	{
+		std::unique_lock<std::shared_mutex> lock{this->m_mutex};
+		if (this->m_root == root)
+			return;
+
+		watcher = std::move(this->m_watcher);
+	}
+
+	// The old watcher's callback takes the lock, so its stopped outside of it
+	auto watched = watcher != nullptr;
+	watcher.reset();
+
+	this->build(root);
+
+	if (watched)
+		this->watch(this->m_latency);
+}
+
+void ResourceIndex::scan(const std::filesystem::path &a_folder)
+{
+	// Symlinked folders are followed, so the same real folder can be reached again, possibly from inside itself
+	std::unordered_set<std::string> visited{};
+	std::error_code                 error;
+
+	visited.emplace(std::filesystem::canonical(a_folder, error).string());
+
+	for (auto iterator = std::filesystem::recursive_directory_iterator{a_folder, directory_options, error};
+	     !error && iterator != std::filesystem::recursive_directory_iterator{};
+	     iterator.increment(error))
+	{
+		std::error_code entry_error;
+		if (iterator->is_directory(entry_error))
+		{
+			if (skipped_folder(iterator->path()))
+			{
+				iterator.disable_recursion_pending();
+				continue;
+			}
+
+			auto canonical = std::filesystem::canonical(iterator->path(), entry_error);
+			if (entry_error || !visited.emplace(canonical.string()).second)
+				iterator.disable_recursion_pending();
+		}
+
+		this->insert(iterator->path());
+	}
+
+	if (error)
+		ror::log_warn("Resource index for {} is incomplete {}", a_folder.c_str(), error.message());
+}
+
+void ResourceIndex::insert(const std::filesystem::path &a_absolute_path)
+{
+	auto relative = relative_to(a_absolute_path, this->m_root);
+
+	// Parents are inserted as well, so adding a file in a new folder also adds the folder
+	while (!relative.empty())
+	{
+		if (!this->m_entries.emplace(entry_key(relative)).second)
+			break;
+
+		relative = relative.parent_path();
+	}
+}
+
+void ResourceIndex::erase(const std::filesystem::path &a_absolute_path)
+{
+	auto relative = relative_to(a_absolute_path, this->m_root);
+	if (relative.empty())
+		return;
+
+	auto key    = entry_key(relative);
+	auto prefix = key + "/";
+
+	this->m_entries.erase(key);
+
+	// Events don't say if it was a folder, so anything inside it goes as well
+	std::erase_if(this->m_entries, [&prefix](const std::string &a_entry) { return a_entry.starts_with(prefix); });
+}
+
+bool ResourceIndex::contains(const std::filesystem::path &a_relative_path) const
+{
+	std::shared_lock<std::shared_mutex> lock{this->m_mutex};
+
+	return this->m_entries.contains(entry_key(a_relative_path));
+}
+
+std::filesystem::path ResourceIndex::resolved(const std::filesystem::path &a_path, ResourceSemantic a_semantic) const
+{
+	std::shared_lock<std::shared_mutex> lock{this->m_mutex};
+
+	auto found = this->m_resolved.find(resolved_key(a_path, a_semantic));
+	if (found != this->m_resolved.end())
+		return found->second;
+
+	return {};
+}
+
+void ResourceIndex::remember(const std::filesystem::path &a_path, ResourceSemantic a_semantic, const std::filesystem::path &a_absolute)
+{
+	std::unique_lock<std::shared_mutex> lock{this->m_mutex};
+
+	this->m_resolved.insert_or_assign(resolved_key(a_path, a_semantic), a_absolute);
+}
+
+bool ResourceIndex::missing(const std::filesystem::path &a_path, ResourceSemantic a_semantic) const
+{
+	std::shared_lock<std::shared_mutex> lock{this->m_mutex};
+
+	return this->m_missing.contains(resolved_key(a_path, a_semantic));
+}
+
+void ResourceIndex::remember_missing(const std::filesystem::path &a_path, ResourceSemantic a_semantic)
+{
+	std::unique_lock<std::shared_mutex> lock{this->m_mutex};
+
+	this->m_missing.emplace(resolved_key(a_path, a_semantic));
+}
+
+void ResourceIndex::add(const std::filesystem::path &a_absolute_path)
+{
+	this->update({WatchCatEvent{WatchCatEventType::add, a_absolute_path}});
+}
+
+void ResourceIndex::remove(const std::filesystem::path &a_absolute_path)
+{
+	this->update({WatchCatEvent{WatchCatEventType::remove, a_absolute_path}});
+}
+
+void ResourceIndex::update(const std::vector<WatchCatEvent> &a_events)
+{
+	std::unique_lock<std::shared_mutex> lock{this->m_mutex};
+
+	for (auto &event : a_events)
+	{
+		if (event.m_type == WatchCatEventType::add)
+		{
+			this->insert(event.m_path);
+
+			// Folders moved in come with their contents
+			std::error_code error;
+			if (std::filesystem::is_directory(event.m_path, error) && !skipped_folder(event.m_path))
+				this->scan(event.m_path);
+
+			// Anything added could be what an earlier lookup was missing
+			this->m_missing.clear();
+		}
+		else if (event.m_type == WatchCatEventType::remove)
+			this->erase(event.m_path);
+	}
+
+	// Any change could make an earlier location in the search order valid or a resolved one invalid
+	this->m_resolved.clear();
+}
+
+void ResourceIndex::watch(float32_t a_latency)
+{
+	std::unique_lock<std::shared_mutex> lock{this->m_mutex};
+
+	if (this->m_watcher)
+		return;
+
+	this->m_latency = a_latency;
+	this->m_watcher = std::make_unique<WatchCat>(
+	    std::vector<std::filesystem::path>{this->m_root}, [this](const std::vector<WatchCatEvent> &a_events) { this->update(a_events); }, a_latency);
+}
+
+size_t ResourceIndex::size() const
+{
+	std::shared_lock<std::shared_mutex> lock{this->m_mutex};
+
+	return this->m_entries.size();
+}
+
+std::filesystem::path ResourceIndex::root() const
+{
+	std::shared_lock<std::shared_mutex> lock{this->m_mutex};
+
+	return this->m_root;
+}
+
+ResourceIndex &get_resource_index()
+{
+	static ResourceIndex index{};
+
+	// Here calling get_project_root without any arguments relies on clients who must have called and initalized project_root
+	// Only the first call and a changed project root build anything, otherwise its a shared lock and a path compare
+	index.root(get_project_root().path());
+
+	return index;
+}
+
+}        // namespace ror
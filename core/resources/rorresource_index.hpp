@@ -0,0 +1,95 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#pragma once
+
+#include "foundation/rormacros.hpp"
+#include "resources/rorresource.hpp"
+#include "watchcat/rorwatchcat.hpp"
+#include <filesystem>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace ror
+{
+/**
+ * Index of every file and folder inside the project root, built once and kept up to date incrementally
+ * Lets find_resource() check candidate locations with hash lookups instead of stat syscalls
+ * Also remembers previously resolved relative path and semantic pairs, so repeated lookups are a single hash lookup
+ * Pairs that couldn't be found are remembered as well, until something is added to the index by the engine or WatchCat
+ * Hidden, build and cache folders are not indexed, symlinked folders are followed but each real folder is only scanned once
+ * The index is thread safe, lookups take a shared lock and updates an exclusive one
+ */
+class ROAR_ENGINE_ITEM ResourceIndex final
+{
+  public:
+	FORCE_INLINE                ResourceIndex()                                 = default;        //! Default constructor
+	FORCE_INLINE                ResourceIndex(const ResourceIndex &a_other)     = delete;         //! Copy constructor
+	FORCE_INLINE                ResourceIndex(ResourceIndex &&a_other) noexcept = delete;         //! Move constructor
+	FORCE_INLINE ResourceIndex &operator=(const ResourceIndex &a_other)         = delete;         //! Copy assignment operator
+	FORCE_INLINE ResourceIndex &operator=(ResourceIndex &&a_other) noexcept     = delete;         //! Move assignment operator
+	FORCE_INLINE ~ResourceIndex() noexcept                                      = default;        //! Destructor
+
+	explicit ResourceIndex(std::filesystem::path a_root);
+
+	void                  build(std::filesystem::path a_root);                                                                                        // Scans everything inside a_root, replaces existing entries
+	void                  root(const std::filesystem::path &a_root);                                                                                  // Rebuilds the index for a_root unless its already built for it, moves the watcher along
+	bool                  contains(const std::filesystem::path &a_relative_path) const;                                                               // Is there a file or folder at a_relative_path inside root
+	std::filesystem::path resolved(const std::filesystem::path &a_path, ResourceSemantic a_semantic) const;                                           // Previously resolved absolute path or empty
+	void                  remember(const std::filesystem::path &a_path, ResourceSemantic a_semantic, const std::filesystem::path &a_absolute);        // Remembers a resolved path
+	bool                  missing(const std::filesystem::path &a_path, ResourceSemantic a_semantic) const;                                            // Was a_path not found last time and nothing added since
+	void                  remember_missing(const std::filesystem::path &a_path, ResourceSemantic a_semantic);                                         // Remembers a path that couldn't be found
+	void                  add(const std::filesystem::path &a_absolute_path);                                                                          // Adds a_absolute_path, and its contents if its a folder
+	void                  remove(const std::filesystem::path &a_absolute_path);                                                                       // Removes a_absolute_path, and its contents if its a folder
+	void                  update(const std::vector<WatchCatEvent> &a_events);                                                                         // Applies filesystem events
+	void                  watch(float32_t a_latency = 1.0f);                                                                                          // Keeps the index up to date via a WatchCat on root
+	size_t                size() const;
+	std::filesystem::path root() const;
+
+  protected:
+  private:
+	void insert(const std::filesystem::path &a_absolute_path);        // Unsynchronised add
+	void erase(const std::filesystem::path &a_absolute_path);         // Unsynchronised remove
+	void scan(const std::filesystem::path &a_folder);                 // Unsynchronised add of everything inside a_folder
+
+	std::filesystem::path                                  m_root{};               // Project root all entries are relative to
+	std::unordered_set<std::string>                        m_entries{};            // Relative paths of all files and folders in root
+	std::unordered_map<std::string, std::filesystem::path> m_resolved{};           // Relative path and semantic to absolute path, cleared whenever entries change
+	std::unordered_set<std::string>                        m_missing{};            // Relative path and semantic pairs that couldn't be found, cleared whenever entries are added
+	std::unique_ptr<WatchCat>                              m_watcher{nullptr};     // Watches root for changes if requested
+	float32_t                                              m_latency{1.0f};        // Latency the watcher was created with, used when root changes
+	mutable std::shared_mutex                              m_mutex{};              // Lookups are shared, updates are exclusive
+};
+
+/**
+ * Index of the project root, built the first time its requested and rebuilt if the project root changes
+ */
+ROAR_ENGINE_ITEM ResourceIndex &get_resource_index();
+
+}        // namespace ror
@@ -32,6 +32,7 @@
 #include "graphics/rorscene.hpp"
 #include "math/rorvector2.hpp"
 #include "math/rorvector4.hpp"
+#include "profiling/rorprofiler.hpp"
 #include "profiling/rortimer.hpp"
 #include "renderer/rorrenderer.hpp"
 #include "rhi/rorbuffers_pack.hpp"
@@ -54,6 +55,12 @@ class ContextCrtp : public ror::Crtp<_type, ContextCrtp>
 
 	FORCE_INLINE void init(std::any a_platform_window, void *a_window, ror::Vector4f a_dimensions)
 	{
+		ror::profiler().enable(ror::settings().m_profile);
+		ror::profiler().set_thread_name("main");
+		ror::log_set_async(ror::settings().m_log_async);
+
+		profile_zone("ContextCrtp::init");
+
 		this->m_current_device->init(a_platform_window, a_window, this->m_event_system, ror::Vector2ui{static_cast<uint32_t>(a_dimensions.x), static_cast<uint32_t>(a_dimensions.y)});
 		ror::settings().setup_generic_numbers(this->m_event_system);
 
@@ -85,6 +92,11 @@ class ContextCrtp : public ror::Crtp<_type, ContextCrtp>
 		auto &renderer     = this->renderer();
 		auto &timer        = this->timer();
 
+		profile_zone("frame");
+
+		// Delivers everything posted from other threads since last frame on this thread
+		event_system.dispatch_queued();
+
 		scene.update(renderer, timer);
 		renderer.render(scene, job_system, event_system, buffer_pack, device, timer);
 
@@ -115,10 +127,17 @@ class ContextCrtp : public ror::Crtp<_type, ContextCrtp>
 		this->m_buffer_pack->free();
 		this->m_job_system->stop();
 
+		// All workers are stopped by now so its safe to read their profile buffers
+		if (ror::profiler().enabled())
+			ror::profiler().write_chrome_trace(ror::settings().m_profile_trace);
+
 		this->underlying().shutdown_derived();
 
 		for (auto &device : this->m_devices)        // will include m_current_device
 			device->shutdown();
+
+		// Writes everything still queued, anything logged from here on is synchronous again
+		ror::log_set_async(false);
 	}
 
   protected:
@@ -114,7 +114,7 @@ void lut_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::Scene &a_scene,
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Render pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Render pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void main_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system,
@@ -125,7 +125,7 @@ void main_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::Scene &a_scene
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Render pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Render pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void depth_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -135,7 +135,7 @@ void depth_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::Scene &a_scen
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Render pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Render pass {} not implemented, implement me", __FUNCTION__);
 }
 
 //--------------------------------------------------------------------------------------
@@ -632,7 +632,7 @@ void light_bin_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::Scene &a_
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Render pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Render pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void reflection_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -642,7 +642,7 @@ void reflection_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::Scene &a
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Render pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Render pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void refraction_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -652,7 +652,7 @@ void refraction_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::Scene &a
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Render pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Render pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void pre_process_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -662,7 +662,7 @@ void pre_process_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::Scene &
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Render pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Render pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void post_process_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -672,7 +672,7 @@ void post_process_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::Scene
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Render pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Render pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void tone_mapping_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -709,7 +709,7 @@ void node_transform_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::Scen
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Render pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Render pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void deferred_gbuffer_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -719,7 +719,7 @@ void deferred_gbuffer_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::Sc
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Render pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Render pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void reflection_probes_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -729,7 +729,7 @@ void reflection_probes_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::S
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Render pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Render pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void image_based_light_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -739,7 +739,7 @@ void image_based_light_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::S
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Render pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Render pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void image_based_light_lut_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -749,7 +749,7 @@ void image_based_light_lut_pass(rhi::RenderCommandEncoder &a_command_encoder, ro
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Render pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Render pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void ambient_occlusion_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -759,7 +759,7 @@ void ambient_occlusion_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::S
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Render pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Render pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void skeletal_transform_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -769,7 +769,7 @@ void skeletal_transform_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Render pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Render pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void deferred_clustered_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -779,7 +779,7 @@ void deferred_clustered_pass(rhi::RenderCommandEncoder &a_command_encoder, ror::
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Render pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Render pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void lut_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -789,7 +789,7 @@ void lut_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &a_scene
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Compute pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Compute pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void main_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system,
@@ -800,7 +800,7 @@ void main_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &a_scen
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Compute pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Compute pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void depth_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -810,7 +810,7 @@ void depth_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &a_sce
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Compute pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Compute pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void shadow_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -820,7 +820,7 @@ void shadow_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &a_sc
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Compute pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Compute pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void light_bin_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -830,7 +830,7 @@ void light_bin_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &a
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Compute pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Compute pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void reflection_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -840,7 +840,7 @@ void reflection_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Compute pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Compute pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void refraction_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -850,7 +850,7 @@ void refraction_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Compute pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Compute pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void pre_process_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -860,7 +860,7 @@ void pre_process_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Compute pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Compute pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void post_process_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -870,7 +870,7 @@ void post_process_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Compute pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Compute pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void tone_mapping_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -880,7 +880,7 @@ void tone_mapping_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Compute pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Compute pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void forward_light_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -890,7 +890,7 @@ void forward_light_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scen
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Compute pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Compute pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void node_transform_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -900,10 +900,10 @@ void node_transform_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Sce
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	// if (ror::settings().m_animate_cpu)
-	// 	a_scene.cpu_walk_scene(a_command_encoder, a_device, a_buffer_pack, a_renderer, a_subpass, a_timer, a_event_system);
-	// else
-	a_scene.compute_pass_walk_scene(a_command_encoder, a_device, a_buffer_pack, a_renderer, a_subpass, a_timer, a_event_system);
+	if (ror::settings().m_animate_cpu)
+		a_scene.cpu_walk_scene(a_job_system, a_renderer, a_timer, a_event_system);
+	else
+		a_scene.compute_pass_walk_scene(a_command_encoder, a_device, a_buffer_pack, a_renderer, a_subpass, a_timer, a_event_system);
 }
 
 void deferred_gbuffer_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -913,7 +913,7 @@ void deferred_gbuffer_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::S
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Compute pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Compute pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void reflection_probes_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -923,7 +923,7 @@ void reflection_probes_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Compute pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Compute pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void reflection_probes_pass_lut(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -933,7 +933,7 @@ void reflection_probes_pass_lut(rhi::ComputeCommandEncoder &a_command_encoder, r
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Compute pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Compute pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void image_based_light_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -943,7 +943,7 @@ void image_based_light_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Compute pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Compute pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void image_based_light_lut_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -982,7 +982,7 @@ void ambient_occlusion_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Compute pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Compute pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void skeletal_transform_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -992,7 +992,7 @@ void skeletal_transform_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror:
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Compute pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Compute pass {} not implemented, implement me", __FUNCTION__);
 }
 
 void deferred_clustered_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system,
@@ -1002,7 +1002,7 @@ void deferred_clustered_pass(rhi::ComputeCommandEncoder &a_command_encoder, ror:
 	(void) a_command_encoder; (void) a_scene; (void) a_job_system; (void) a_event_system; (void) a_buffer_pack; (void) a_device; (void) a_timer; (void) a_renderer; (void) a_pass; (void) a_subpass;
 	// clang-format on
 
-	ror::log_critical("Compute pass {} not implemented, implement me", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Compute pass {} not implemented, implement me", __FUNCTION__);
 }
 
 }        // namespace rhi
@@ -23,8 +23,17 @@
 //
 // Version: 1.0.0
 
+#include "foundation/rorhash.hpp"
+#include "profiling/rorlog.hpp"
+#include "resources/rorresource.hpp"
 #include "rhi/crtp_interfaces/rorshader.hpp"
 #include "rhi/rortypes.hpp"
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <system_error>
+#include <thread>
 #include <glslang/SPIRV/GlslangToSpv.h>
 #include <glslang/SPIRV/Logger.h>
 #include <glslang/glslang/Public/ResourceLimits.h>
@@ -32,6 +41,16 @@
 
 namespace rhi
 {
+namespace
+{
+// Everything compile_to_spirv passes to glslang apart from the source and entry point, these are part of the SPIR-V cache key
+constexpr EShMessages                       spirv_messages{static_cast<EShMessages>(EShMsgDefault | EShMsgVulkanRules | EShMsgSpvRules)};        // | EShMsgDebugInfo);
+constexpr glslang::EShTargetLanguage        spirv_target_language{glslang::EShTargetLanguage::EShTargetSpv};
+constexpr glslang::EShTargetLanguageVersion spirv_target_version{glslang::EShTargetSpv_1_5};        // Could be 1_6
+constexpr int                               spirv_default_version{110};
+constexpr uint32_t                          spirv_cache_version{1};                // Bump this whenever the way shaders are compiled changes in a way the key doesn't capture
+constexpr uint32_t                          spirv_magic_number{0x07230203};        // First word of every SPIR-V module
+}        // namespace
 
 void glslang_wrapper_initialize_process()
 {
@@ -74,11 +93,11 @@ bool compile_to_spirv(const std::string          &a_glsl_source,
                       std::vector<std::uint32_t> &spirv,
                       std::string                &info_log)
 {
-	EShMessages messages = static_cast<EShMessages>(EShMsgDefault | EShMsgVulkanRules | EShMsgSpvRules);        // | EShMsgDebugInfo);
+	EShMessages messages = spirv_messages;
 
 	EShLanguage                       language        = shader_type_to_language(a_shader_type);
-	glslang::EShTargetLanguage        target_language = glslang::EShTargetLanguage::EShTargetSpv;
-	glslang::EShTargetLanguageVersion version         = glslang::EShTargetSpv_1_5;        // Could be 1_6
+	glslang::EShTargetLanguage        target_language = spirv_target_language;
+	glslang::EShTargetLanguageVersion version         = spirv_target_version;
 
 	const char *shader_source = reinterpret_cast<const char *>(a_glsl_source.data());
 
@@ -93,7 +112,7 @@ bool compile_to_spirv(const std::string          &a_glsl_source,
 	// shader.addProcesses();        // Should be something like -DSkinning=ON or -USkinning=Off, not sure
 
 	// TODO: Find out what does this 100 or 110 mean here some people use it like ((EOptionNone & EOptionDefaultDesktop) ? 110 : 100, false)
-	if (!shader.parse(GetDefaultResources(), 110, false, messages))
+	if (!shader.parse(GetDefaultResources(), spirv_default_version, false, messages))
 	{
 		info_log += a_glsl_source;
 		info_log += std::string(shader.getInfoLog()) + "\n" + std::string(shader.getInfoDebugLog());
@@ -141,4 +160,100 @@ bool compile_to_spirv(const std::string          &a_glsl_source,
 	return true;
 }
 
+hash_64_t spirv_cache_key(const std::string &a_glsl_source, rhi::ShaderType a_shader_type, const std::string &a_entry_point)
+{
+	auto glslang_version = glslang::GetVersion();
+
+	hash_64_t key = ror::hash_64(a_glsl_source);
+
+	ror::hash_combine_64(key, ror::hash_64(a_entry_point));
+	ror::hash_combine_64(key, static_cast<hash_64_t>(a_shader_type));
+	ror::hash_combine_64(key, static_cast<hash_64_t>(glslang_version.major));
+	ror::hash_combine_64(key, static_cast<hash_64_t>(glslang_version.minor));
+	ror::hash_combine_64(key, static_cast<hash_64_t>(glslang_version.patch));
+	ror::hash_combine_64(key, ror::hash_64(std::string{glslang_version.flavor ? glslang_version.flavor : ""}));
+	ror::hash_combine_64(key, static_cast<hash_64_t>(spirv_messages));
+	ror::hash_combine_64(key, static_cast<hash_64_t>(spirv_target_language));
+	ror::hash_combine_64(key, static_cast<hash_64_t>(spirv_target_version));
+	ror::hash_combine_64(key, static_cast<hash_64_t>(spirv_default_version));
+	ror::hash_combine_64(key, static_cast<hash_64_t>(spirv_cache_version));
+
+	return key;
+}
+
+std::filesystem::path spirv_cache_path(hash_64_t a_key)
+{
+	return ror::get_cache_path() / "spirv" / (std::to_string(a_key) + ".spv");
+}
+
+bool spirv_cache_load(hash_64_t a_key, std::vector<std::uint32_t> &a_spirv)
+{
+	auto            spirv_path = spirv_cache_path(a_key);
+	std::error_code error;
+
+	auto size = std::filesystem::file_size(spirv_path, error);
+	if (error || size < sizeof(std::uint32_t) || size % sizeof(std::uint32_t) != 0)
+		return false;
+
+	std::vector<std::uint32_t> spirv(size / sizeof(std::uint32_t));
+
+	std::ifstream spirv_file(spirv_path, std::ios::in | std::ios::binary);
+	if (!spirv_file.read(reinterpret_cast<char *>(spirv.data()), static_cast<std::streamsize>(size)))
+		return false;
+
+	if (spirv[0] != spirv_magic_number)
+	{
+		ror::log_warn("Ignoring corrupt cached SPIR-V {}", spirv_path.c_str());
+		return false;
+	}
+
+	a_spirv = std::move(spirv);
+
+	return true;
+}
+
+bool spirv_cache_save(hash_64_t a_key, const std::vector<std::uint32_t> &a_spirv)
+{
+	if (a_spirv.empty())
+		return false;
+
+	auto            spirv_path = spirv_cache_path(a_key);
+	std::error_code error;
+
+	// Shaders are compiled from many threads, the same key could be saved by two of them at once so each gets its own temporary
+	auto temp_path = std::filesystem::path{spirv_path}.concat("." + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id())) + ".tmp");
+
+	std::filesystem::create_directories(spirv_path.parent_path(), error);
+
+	// Written to a temporary and renamed so readers never see a half written module
+	{
+		std::ofstream spirv_file(temp_path, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!spirv_file.is_open())
+		{
+			ror::log_error("Can't open cached SPIR-V {} for writing", temp_path.c_str());
+			return false;
+		}
+
+		spirv_file.write(reinterpret_cast<const char *>(a_spirv.data()), static_cast<std::streamsize>(a_spirv.size() * sizeof(std::uint32_t)));
+
+		if (!spirv_file.good())
+		{
+			ror::log_error("Writing cached SPIR-V {} failed", temp_path.c_str());
+			spirv_file.close();
+			std::filesystem::remove(temp_path, error);
+			return false;
+		}
+	}
+
+	std::filesystem::rename(temp_path, spirv_path, error);
+	if (error)
+	{
+		ror::log_error("Can't move cached SPIR-V into {}, {}", spirv_path.c_str(), error.message());
+		std::filesystem::remove(temp_path, error);
+		return false;
+	}
+
+	return true;
+}
+
 }        // namespace rhi
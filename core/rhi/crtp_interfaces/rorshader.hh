@@ -58,10 +58,22 @@ FORCE_INLINE void ShaderCrtp<_type>::compile()
 	this->m_includes.clear();
 	ror::resolve_includes(shader_source, ror::ResourceSemantic::shaders, false, this->m_includes);
 
-	if (!compile_to_spirv(shader_source, this->m_type, "main", this->m_spirv, info_log))
+	// The key is taken from the resolved source so editing any of the includes misses the cache
+	bool cache_spirv = ror::settings().m_cache_spirv;
+	auto spirv_key   = spirv_cache_key(shader_source, this->m_type, "main");
+
+	if (cache_spirv && spirv_cache_load(spirv_key, this->m_spirv))
+	{
+		ror::log_info("Using cached SPIR-V for shader {}", this->shader_path().c_str());
+	}
+	else if (!compile_to_spirv(shader_source, this->m_type, "main", this->m_spirv, info_log))
 	{
 		ror::log_critical("Shader to SPIR-V conversion failed shader :{}\n \n{}", this->shader_path().c_str(), info_log.c_str());
 	}
+	else if (cache_spirv)
+	{
+		spirv_cache_save(spirv_key, this->m_spirv);
+	}
 
 	this->platform_source();
 }
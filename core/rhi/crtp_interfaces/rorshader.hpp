@@ -32,6 +32,7 @@
 #include "rhi/rordevice.hpp"
 #include "rhi/rortypes.hpp"
 #include <cassert>
+#include <filesystem>
 #include <vector>
 
 namespace rhi
@@ -99,6 +100,16 @@ bool compile_to_spirv(const std::string          &a_glsl_source,
                       std::vector<std::uint32_t> &spirv,
                       std::string                &info_log);
 
+/**
+ * SPIR-V cache in the project cache directory, modules are content addressed by spirv_cache_key()
+ * The key covers the fully resolved source, so any change in any of the includes is a different key
+ * it also covers the stage, entry point, glslang version and all the options compile_to_spirv uses
+ */
+hash_64_t             spirv_cache_key(const std::string &a_glsl_source, rhi::ShaderType a_shader_type, const std::string &a_entry_point);
+std::filesystem::path spirv_cache_path(hash_64_t a_key);
+bool                  spirv_cache_load(hash_64_t a_key, std::vector<std::uint32_t> &a_spirv);              // Returns false on a miss or if the cached module is corrupt
+bool                  spirv_cache_save(hash_64_t a_key, const std::vector<std::uint32_t> &a_spirv);        // Returns false if the module can't be written
+
 void glslang_wrapper_initialize_process();
 void glslang_wrapper_finalize_process();
 
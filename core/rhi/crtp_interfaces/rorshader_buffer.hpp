@@ -224,6 +224,53 @@ class ShaderBufferCrtp : public ror::Crtp<_type, ShaderBufferCrtp>
 		this->buffer_copy(a_value, entry->m_offset + a_offset, a_size);
 	}
 
+	FORCE_INLINE auto handle(const std::string &a_variable) const
+	{
+		auto entry = this->m_variables.find(a_variable);
+		assert(entry != this->m_variables.end() && entry->second && "Entry is null");
+		return rhi::ShaderBufferTemplate::Handle{entry->second->m_offset, entry->second->m_size, entry->second->m_stride};
+	}
+
+	// Same as the std::string versions above but with a handle resolved once via handle()
+	template <typename _data_type>
+	FORCE_INLINE constexpr void update(const rhi::ShaderBufferTemplate::Handle &a_handle, const _data_type *a_value, uint32_t a_index, uint32_t a_stride)
+	{
+		this->buffer_copy(reinterpret_cast<const uint8_t *>(a_value), (a_stride * a_index) + a_handle.m_offset, a_handle.m_size);
+	}
+
+	template <typename _data_type>
+	FORCE_INLINE constexpr void update(const rhi::ShaderBufferTemplate::Handle &a_handle, const _data_type *a_value)
+	{
+		this->buffer_copy(reinterpret_cast<const uint8_t *>(a_value), a_handle.m_offset, a_handle.m_size);
+	}
+
+	template <typename _data_type>
+	FORCE_INLINE constexpr void update(const rhi::ShaderBufferTemplate::Handle &a_handle, uint32_t a_offset, const _data_type *a_value, uint32_t a_size)
+	{
+		this->buffer_copy(reinterpret_cast<const uint8_t *>(a_value), a_handle.m_offset + a_offset, a_size);
+	}
+
+	/**
+	 * Bulk update of a_count elements starting at element a_first, elements are a_stride apart in the buffer and a_source_stride apart in a_value
+	 * a_stride is the entry stride for arrays or the struct stride for entries inside an array of structs
+	 * If both strides are the same as the element size, the whole range is copied with a single memcpy
+	 */
+	template <typename _data_type>
+	FORCE_INLINE constexpr void update_strided(const rhi::ShaderBufferTemplate::Handle &a_handle, const _data_type *a_value, uint32_t a_first, uint32_t a_count, uint32_t a_stride, uint32_t a_source_stride)
+	{
+		auto source = reinterpret_cast<const uint8_t *>(a_value);
+		auto offset = a_handle.m_offset + (a_stride * a_first);
+
+		if (a_stride == a_handle.m_size && a_source_stride == a_handle.m_size)
+		{
+			this->buffer_copy(source, offset, a_handle.m_size * a_count);
+			return;
+		}
+
+		for (uint32_t i = 0; i < a_count; ++i)
+			this->buffer_copy(source + (a_source_stride * i), offset + (a_stride * i), a_handle.m_size);
+	}
+
 	void upload(const rhi::Device &a_device, rhi::ResourceStorageOption a_mode = rhi::ResourceStorageOption::managed)
 	{
 		// Alignment on size is Metal requirement but won't hurt in Vulkan either (https://github.com/gpuweb/gpuweb/issues/425)
@@ -24,6 +24,7 @@
 // Version: 1.0.0
 
 #include "core/renderer/rorrenderer.hpp"
+#include "profiling/rorprofiler.hpp"
 #include "rhi/rorcommand_buffer.hpp"
 #include "rhi/rorrenderpass.hpp"
 
@@ -42,10 +43,44 @@ const rhi::RenderTarget &subpass_render_target(const rhi::Renderpass &a_renderpa
 	return renderpass_rts[renderpass_index];
 }
 
+// Profile zones only keep the pointer so these need to be static strings
+constexpr const char *pass_zone_name(rhi::RenderpassType a_type)
+{
+	// clang-format off
+	switch (a_type)
+	{
+	case rhi::RenderpassType::lut:                     return "lut_pass";
+	case rhi::RenderpassType::main:                    return "main_pass";
+	case rhi::RenderpassType::depth:                   return "depth_pass";
+	case rhi::RenderpassType::shadow:                  return "shadow_pass";
+	case rhi::RenderpassType::light_bin:               return "light_bin_pass";
+	case rhi::RenderpassType::reflection:              return "reflection_pass";
+	case rhi::RenderpassType::refraction:              return "refraction_pass";
+	case rhi::RenderpassType::pre_process:             return "pre_process_pass";
+	case rhi::RenderpassType::post_process:            return "post_process_pass";
+	case rhi::RenderpassType::tone_mapping:            return "tone_mapping_pass";
+	case rhi::RenderpassType::forward_light:           return "forward_light_pass";
+	case rhi::RenderpassType::node_transform:          return "node_transform_pass";
+	case rhi::RenderpassType::deferred_gbuffer:        return "deferred_gbuffer_pass";
+	case rhi::RenderpassType::reflection_probes:       return "reflection_probes_pass";
+	case rhi::RenderpassType::image_based_light:       return "image_based_light_pass";
+	case rhi::RenderpassType::ambient_occlusion:       return "ambient_occlusion_pass";
+	case rhi::RenderpassType::skeletal_transform:      return "skeletal_transform_pass";
+	case rhi::RenderpassType::deferred_clustered:      return "deferred_clustered_pass";
+	case rhi::RenderpassType::image_based_light_lut:   return "image_based_light_lut_pass";
+	case rhi::RenderpassType::max:                     break;
+	}
+	// clang-format on
+
+	return "unknown_pass";
+}
+
 template <typename _type>
-FORCE_INLINE constexpr void pass_by_type(_type &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system, rhi::BuffersPack &a_buffer_pack,
-                                         rhi::Device &a_device, ror::Timer &a_timer, ror::Renderer &a_renderer, rhi::Renderpass &a_pass, rhi::Rendersubpass &a_subpass)
+FORCE_INLINE void pass_by_type(_type &a_command_encoder, ror::Scene &a_scene, ror::JobSystem &a_job_system, ror::EventSystem &a_event_system, rhi::BuffersPack &a_buffer_pack,
+                               rhi::Device &a_device, ror::Timer &a_timer, ror::Renderer &a_renderer, rhi::Renderpass &a_pass, rhi::Rendersubpass &a_subpass)
 {
+	profile_zone(pass_zone_name(a_subpass.type()));
+
 	// clang-format off
 	switch (a_subpass.type())
 	{
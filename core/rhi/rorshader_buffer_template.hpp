@@ -152,6 +152,17 @@ class ROAR_ENGINE_ITEM ShaderBufferTemplate final
 		declare_translation_unit_vtable() override;
 	};
 
+	/**
+	 * Resolved location of an entry, ShaderBuffer::handle() looks it up once by name and updates can use it afterwards without hashing the name
+	 * Only valid as long as the layout doesn't change, add_entry(), add_struct() and update_count() invalidates it
+	 */
+	struct Handle
+	{
+		uint32_t m_offset{0};        //! Where in the buffer is this entry, offset from start of the ShaderBuffer
+		uint32_t m_size{0};          //! Size of one element of this entry in machine units
+		uint32_t m_stride{0};        //! Gap between elements if its an array
+	};
+
 	FORCE_INLINE ShaderBufferTemplate(const std::string &a_name, ShaderBufferType a_type = ShaderBufferType::ubo, ShaderBufferFrequency a_frequency = ShaderBufferFrequency::per_frame, Layout a_layout = rhi::Layout::std140, uint32_t a_set = 0, uint32_t a_binding = 0) :
 	    m_type(a_type), m_frequency(a_frequency), m_layout(a_layout), m_set(a_set), m_binding(a_binding), m_toplevel(a_name, 1)
 	{}
@@ -37,7 +37,7 @@ namespace rhi
 
 FORCE_INLINE void read_texture_from_resource(ror::Resource &a_texture_resource, TextureImage &a_texture, bool a_is_hdr)
 {
-	auto &resource_data = a_texture_resource.data();
+	auto resource_data = a_texture_resource.data_span();
 	read_texture_from_memory(resource_data.data(), resource_data.size(), a_texture, a_is_hdr);
 }
 
@@ -80,7 +80,7 @@ static rhi::PixelFormat basis_to_format(basist::transcoder_texture_format a_fmt)
 
 FORCE_INLINE static void read_texture_basis_universal(ror::Resource &a_texture_resource, TextureImage &a_texture)
 {
-	const std::vector<uint8_t> &ktx2_file_data = a_texture_resource.data();
+	auto ktx2_file_data = a_texture_resource.data_span();
 
 	basist::ktx2_transcoder dec;
 
@@ -258,7 +258,7 @@ FORCE_INLINE TextureImage read_texture_from_file(const std::filesystem::path &a_
 {
 	TextureImage texture;
 
-	auto &texture_resource = ror::load_resource(a_absolute_file_name, ror::ResourceSemantic::textures);
+	auto &texture_resource = ror::map_resource(a_absolute_file_name, ror::ResourceSemantic::textures);
 
 	// assumes ktx file is basisu ktx. TODO: Should also add support for normal ktx files
 	if (a_absolute_file_name.extension() == ".ktx2")
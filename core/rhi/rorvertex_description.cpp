@@ -66,6 +66,12 @@ void VertexDescriptor::add(std::vector<VertexAttribute> a_attribute, std::vector
 }
 
 void VertexDescriptor::upload(const std::unordered_map<rhi::BufferSemantic, std::tuple<uint8_t *, uint32_t, uint32_t>> &a_attrib_data, rhi::BuffersPack *a_buffers_pack)
+{
+	this->allocate(a_attrib_data, a_buffers_pack);
+	this->fill(a_attrib_data, a_buffers_pack);
+}
+
+void VertexDescriptor::allocate(const std::unordered_map<rhi::BufferSemantic, std::tuple<uint8_t *, uint32_t, uint32_t>> &a_attrib_data, rhi::BuffersPack *a_buffers_pack)
 {
 	assert(a_attrib_data.size() == this->m_attributes.size() && "Uploading partial attributes not supported");
 	std::unordered_map<size_t, size_t> buffer_to_size_map{};
@@ -87,26 +93,41 @@ void VertexDescriptor::upload(const std::unordered_map<rhi::BufferSemantic, std:
 		attr_data.second    = buffer_offset;                          // This is the offset not the size anymore
 	}
 
-	// Upload the data into the allocated space
+	// Hand out the allocated space to the attributes
 	for (auto &attrib_data : a_attrib_data)
 	{
 		auto &attribute    = this->attribute(attrib_data.first);
 		auto &layout       = this->layout(attrib_data.first);
-		auto  stride       = layout.stride();
 		auto  buffer_index = attribute.buffer_index();
 		auto  format_bytes = rhi::format_to_bytes(attribute.format()) * layout.format_multiplier();
 		auto &buffer       = a_buffers_pack->buffer(buffer_index);
 		auto &real_offset  = buffer_to_size_map[buffer_index];
-		auto  attrib_offset{0UL};
 
 		auto [buffer_pointer, buffer_size, buffer_stride] = attrib_data.second;
 
 		attribute.buffer_offset(real_offset);
-		attrib_offset = real_offset + attribute.offset();
 
 		if (!buffer.interleaved())
 			real_offset += buffer_size;
 
+		attribute.count(buffer_size / format_bytes);
+	}
+}
+
+void VertexDescriptor::fill(const std::unordered_map<rhi::BufferSemantic, std::tuple<uint8_t *, uint32_t, uint32_t>> &a_attrib_data, rhi::BuffersPack *a_buffers_pack)
+{
+	// Upload the data into the space allocated by allocate()
+	for (auto &attrib_data : a_attrib_data)
+	{
+		auto &attribute     = this->attribute(attrib_data.first);
+		auto &layout        = this->layout(attrib_data.first);
+		auto  stride        = layout.stride();
+		auto  format_bytes  = rhi::format_to_bytes(attribute.format()) * layout.format_multiplier();
+		auto &buffer        = a_buffers_pack->buffer(attribute.buffer_index());
+		auto  attrib_offset = attribute.buffer_offset() + attribute.offset();
+
+		auto [buffer_pointer, buffer_size, buffer_stride] = attrib_data.second;
+
 		auto element_count = buffer_size / format_bytes;
 		if (stride == format_bytes && buffer_stride == format_bytes)        // Case 1: both source and destination strides are equal to format_bytes, everything is packed
 		{
@@ -121,8 +142,6 @@ void VertexDescriptor::upload(const std::unordered_map<rhi::BufferSemantic, std:
 			for (size_t i = 0; i < element_count; ++i)
 				buffer.copy(buffer_pointer + i * buffer_stride, format_bytes, attrib_offset + stride * i);
 		}
-
-		attribute.count(element_count);
 	}
 }
 
@@ -152,6 +152,13 @@ class ROAR_ENGINE_ITEM VertexDescriptor final
 	 * This is because the data might be interleaved. In which case the buffer_size for both attributes will be added up using stride.
 	 */
 	void upload(const std::unordered_map<rhi::BufferSemantic, std::tuple<uint8_t *, uint32_t, uint32_t>> &a_attrib_data, rhi::BuffersPack *a_buffers_pack);
+
+	/**
+	 * upload() split in two, allocate() reserves the space in the buffers and sets offsets and counts of the attributes, fill() copies the data into it
+	 * Allocations happen in call order so the layout is deterministic, once all allocations are done fill() of different descriptors can run in parallel
+	 */
+	void allocate(const std::unordered_map<rhi::BufferSemantic, std::tuple<uint8_t *, uint32_t, uint32_t>> &a_attrib_data, rhi::BuffersPack *a_buffers_pack);
+	void fill(const std::unordered_map<rhi::BufferSemantic, std::tuple<uint8_t *, uint32_t, uint32_t>> &a_attrib_data, rhi::BuffersPack *a_buffers_pack);
 	void update(const std::unordered_map<rhi::BufferSemantic, std::tuple<uint8_t *, uint32_t, uint32_t>> &a_attrib_data, rhi::BuffersPack *a_buffers_pack);
 
 	FORCE_INLINE const auto &attributes() const;
@@ -80,7 +80,7 @@ FORCE_INLINE void RenderCommandEncoder::front_facing_winding(rhi::PrimitiveWindi
 FORCE_INLINE void RenderCommandEncoder::depth_stencil_state(const rhi::RenderstateDepth &a_depth_stencil) const noexcept
 {
 	(void) a_depth_stencil;
-	ror::log_critical("Not sure what to do with {}", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Not sure what to do with {}", __FUNCTION__);
 	// this->m_encoder->setDepthStencilState(a_depth_stencil.depth_state());
 }
 
@@ -99,7 +99,7 @@ FORCE_INLINE void RenderCommandEncoder::vertex_buffer(const rhi::BufferHybrid<rh
 	(void) a_offset;
 	(void) a_index;
 
-	ror::log_critical("Not sure what to do with this yet {}", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Not sure what to do with this yet {}", __FUNCTION__);
 }
 
 FORCE_INLINE void RenderCommandEncoder::fragment_buffer(const rhi::BufferHybrid<rhi::Buffer, rhi::Static> &a_buffer, uintptr_t a_offset, uint32_t a_index) const noexcept
@@ -108,7 +108,7 @@ FORCE_INLINE void RenderCommandEncoder::fragment_buffer(const rhi::BufferHybrid<
 	(void) a_offset;
 	(void) a_index;
 
-	ror::log_critical("Not sure what to do with this yet {}", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Not sure what to do with this yet {}", __FUNCTION__);
 }
 
 FORCE_INLINE void RenderCommandEncoder::tile_buffer(const rhi::BufferHybrid<rhi::Buffer, rhi::Static> &a_buffer, uintptr_t a_offset, uint32_t a_index) const noexcept
@@ -117,7 +117,7 @@ FORCE_INLINE void RenderCommandEncoder::tile_buffer(const rhi::BufferHybrid<rhi:
 	(void) a_offset;
 	(void) a_index;
 
-	ror::log_critical("Not sure what to do with this yet {}", __FUNCTION__);
+	log_rate_limited(ror::log_critical, "Not sure what to do with this yet {}", __FUNCTION__);
 }
 
 FORCE_INLINE void RenderCommandEncoder::vertex_buffer(const rhi::Buffer &a_buffer, uintptr_t a_offset, uint32_t a_index) const noexcept
@@ -43,9 +43,11 @@ Settings::Settings()
 	this->m_application_name   = setting.get<std::string>("application_name");
 	this->m_engine_name        = setting.get<std::string>("engine_name");
 	this->m_shaders_watch_path = setting.get<std::string>("shaders_watch_path");
+	this->m_profile_trace      = setting.get<std::string>("profile_trace");
 
-	this->m_zoom_speed  = setting.get<float32_t>("zoom_speed");
-	this->m_depth_clear = setting.get<float32_t>("depth");
+	this->m_zoom_speed      = setting.get<float32_t>("zoom_speed");
+	this->m_depth_clear     = setting.get<float32_t>("depth");
+	this->m_lod_pixel_error = setting.get<float32_t>("lod_pixel_error");
 
 	this->m_unit                      = setting.get<uint32_t>("unit");
 	this->m_threads_multiplier        = setting.get<uint32_t>("threads_multiplier");
@@ -56,6 +58,7 @@ Settings::Settings()
 	this->m_gui_primitives_index_size = setting.get<uint32_t>("gui_primitives_index_size");
 	this->m_gui_primitives_size       = setting.get<uint32_t>("gui_primitives_size");
 	this->m_resolve_includes_depth    = setting.get<uint32_t>("resolve_includes_depth");
+	this->m_lod_triangle_budget       = setting.get<uint32_t>("lod_triangle_budget");
 
 	auto av = setting.get<std::vector<uint32_t>>("application_version");
 	if (av.size() >= 3)
@@ -86,10 +89,20 @@ Settings::Settings()
 	this->m_background_srgb_to_linear = setting.get<bool>("background_to_srgb");
 	this->m_force_linear_textures     = setting.get<bool>("force_linear_textures");
 	this->m_force_mipmapped_textures  = setting.get<bool>("force_mipmapped_textures");
+	this->m_cook_models               = setting.get<bool>("cook_models");
+	this->m_parallel_model_decode     = setting.get<bool>("parallel_model_decode");
+	this->m_optimize_meshes           = setting.get<bool>("optimize_meshes");
+	this->m_generate_lods             = setting.get<bool>("generate_lods");
+	this->m_select_lods               = setting.get<bool>("select_lods");
+	this->m_quantize_vertices         = setting.get<bool>("quantize_vertices");
+	this->m_cache_spirv               = setting.get<bool>("cache_spirv");
+	this->m_frustum_cull              = setting.get<bool>("frustum_cull");
 	this->m_animate_cpu               = setting.get<bool>("animate_cpu");
 	this->m_clamp_material_roughness  = setting.get<bool>("clamp_material_roughness");
 	this->m_clamp_material_metallic   = setting.get<bool>("clamp_material_metallic");
 	this->m_show_axis                 = setting.get<bool>("show_axis");
+	this->m_profile                   = setting.get<bool>("profile");
+	this->m_log_async                 = setting.get<bool>("log_async");
 
 	auto amc = setting.get<std::vector<float32_t>>("debug_mesh_color");
 	if (amc.size() >= 4)
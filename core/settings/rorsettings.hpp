@@ -132,6 +132,7 @@ class ROAR_ENGINE_ITEM Settings final
 	std::string m_application_name{"Roar Editor"};
 	std::string m_engine_name{"Roar"};
 	std::string m_shaders_watch_path{};
+	std::string m_profile_trace{"roar_trace.json"};
 
 	std::vector<std::string> m_clean_dirs{};        //! Directories to clean on boot
 
@@ -139,6 +140,7 @@ class ROAR_ENGINE_ITEM Settings final
 	float32_t m_fog_start{0.0f};
 	float32_t m_fog_end{500.0f};
 	float32_t m_depth_clear{1.0f};
+	float32_t m_lod_pixel_error{1.0f};        //! Largest geometric error in pixels a picked level of detail should have
 
 	uint32_t m_unit{1};                      //! 1 == meter, 1000 == km etc, to use the unit multiply it with your quantities
 	uint32_t m_threads_multiplier{2};        //! How many more threads should the job system create on top of available cores. Remember this is a multiplier
@@ -153,6 +155,7 @@ class ROAR_ENGINE_ITEM Settings final
 	uint32_t m_application_version{0};
 	uint32_t m_engine_version{0};
 	uint32_t m_resolve_includes_depth{10};        //! How many levels deep should the includes searching go
+	uint32_t m_lod_triangle_budget{0};            //! Most triangles levels of detail are picked for per pass, 0 means no budget
 
 	bool m_save_scene_state{false};
 	bool m_load_scene_state{false};
@@ -189,10 +192,20 @@ class ROAR_ENGINE_ITEM Settings final
 	bool m_background_srgb_to_linear{false};
 	bool m_force_linear_textures{false};
 	bool m_force_mipmapped_textures{false};
+	bool m_cook_models{false};
+	bool m_parallel_model_decode{true};
+	bool m_optimize_meshes{true};
+	bool m_generate_lods{true};
+	bool m_select_lods{true};
+	bool m_quantize_vertices{false};
+	bool m_cache_spirv{false};
+	bool m_frustum_cull{false};
 	bool m_animate_cpu{false};
 	bool m_clamp_material_roughness{false};
 	bool m_clamp_material_metallic{false};
 	bool m_show_axis{false};
+	bool m_profile{false};
+	bool m_log_async{false};
 
 	ror::Vector4f m_debug_mesh_color{1.0f, 0.2f, 0.2f, 0.5f};
 	ror::Vector4f m_ambient_light_color{0.2f, 0.2f, 0.2f, 1.0f};
@@ -66,6 +66,7 @@ std::string attribute_format(rhi::VertexFormat a_format)
 	// mat3x4
 	// mat4x4
 
+	// Normalized and half float attributes are converted to floats by vertex fetch
 	// TODO: Support 16bit_storage_input_output like https://github.com/KhronosGroup/Vulkan-Samples/tree/master/samples/performance/16bit_storage_input_output
 	// TODO: Support mesh quantisation https://github.com/KhronosGroup/glTF/tree/master/extensions/2.0/Khronos/KHR_mesh_quantization
 	// clang-format off
@@ -89,10 +90,10 @@ std::string attribute_format(rhi::VertexFormat a_format)
 		case rhi::VertexFormat::int32_2:         return " ivec2";
 		case rhi::VertexFormat::int32_3:         return " ivec3";
 		case rhi::VertexFormat::int32_4:         return " ivec4";
-		case rhi::VertexFormat::half16_1:        return " int";
-		case rhi::VertexFormat::half16_2:        return " ivec2";
-		case rhi::VertexFormat::half16_3:        return " ivec3";
-		case rhi::VertexFormat::half16_4:        return " ivec4";
+		case rhi::VertexFormat::half16_1:        return " float";
+		case rhi::VertexFormat::half16_2:        return " vec2";
+		case rhi::VertexFormat::half16_3:        return " vec3";
+		case rhi::VertexFormat::half16_4:        return " vec4";
 
 		case rhi::VertexFormat::float32_1:       return " float";
 		case rhi::VertexFormat::float32_2:       return " vec2";
@@ -111,22 +112,22 @@ std::string attribute_format(rhi::VertexFormat a_format)
 		case rhi::VertexFormat::uint32_3:        return " uvec3";
 		case rhi::VertexFormat::uint32_4:        return " uvec4";
 
-		case rhi::VertexFormat::int8_1_norm:     return " int";
-		case rhi::VertexFormat::int8_2_norm:     return " ivec2";
-		case rhi::VertexFormat::int8_3_norm:     return " ivec3";
-		case rhi::VertexFormat::int8_4_norm:     return " ivec4";
-		case rhi::VertexFormat::int16_1_norm:    return " int";
-		case rhi::VertexFormat::int16_2_norm:    return " ivec2";
-		case rhi::VertexFormat::int16_3_norm:    return " ivec3";
-		case rhi::VertexFormat::int16_4_norm:    return " ivec4";
-		case rhi::VertexFormat::uint8_1_norm:    return " uint";
-		case rhi::VertexFormat::uint8_2_norm:    return " uvec2";
-		case rhi::VertexFormat::uint8_3_norm:    return " uvec3";
-		case rhi::VertexFormat::uint8_4_norm:    return " uvec4";
-		case rhi::VertexFormat::uint16_1_norm:   return " uint";
-		case rhi::VertexFormat::uint16_2_norm:   return " uvec2";
-		case rhi::VertexFormat::uint16_3_norm:   return " uvec3";
-		case rhi::VertexFormat::uint16_4_norm:   return " uvec4";
+		case rhi::VertexFormat::int8_1_norm:     return " float";
+		case rhi::VertexFormat::int8_2_norm:     return " vec2";
+		case rhi::VertexFormat::int8_3_norm:     return " vec3";
+		case rhi::VertexFormat::int8_4_norm:     return " vec4";
+		case rhi::VertexFormat::int16_1_norm:    return " float";
+		case rhi::VertexFormat::int16_2_norm:    return " vec2";
+		case rhi::VertexFormat::int16_3_norm:    return " vec3";
+		case rhi::VertexFormat::int16_4_norm:    return " vec4";
+		case rhi::VertexFormat::uint8_1_norm:    return " float";
+		case rhi::VertexFormat::uint8_2_norm:    return " vec2";
+		case rhi::VertexFormat::uint8_3_norm:    return " vec3";
+		case rhi::VertexFormat::uint8_4_norm:    return " vec4";
+		case rhi::VertexFormat::uint16_1_norm:   return " float";
+		case rhi::VertexFormat::uint16_2_norm:   return " vec2";
+		case rhi::VertexFormat::uint16_3_norm:   return " vec3";
+		case rhi::VertexFormat::uint16_4_norm:   return " vec4";
 
 		case rhi::VertexFormat::uint8_custom:    return " uint";
 		case rhi::VertexFormat::uint16_custom:   return " uint";
@@ -464,6 +465,19 @@ void set_normal()
 }
 )snor";
 
+// Decodes of attributes quantized at import, must match the dequantize functions in rorvertex_quantizer.hpp
+const std::string vs_octahedral_decode_str = R"oct(
+vec3 octahedral_decode(vec2 encoded)
+{
+	vec3  normal = vec3(encoded, 1.0 - abs(encoded.x) - abs(encoded.y));
+	float t      = max(-normal.z, 0.0);
+
+	normal.xy += mix(vec2(t), vec2(-t), greaterThanEqual(normal.xy, vec2(0.0)));
+
+	return normalize(normal);
+}
+)oct";
+
 // Unlike normals tangents can be xforms just like positions using 'skin_position' and 'world_transform_position'
 const std::string vs_set_tangent_str = R"stan(
 void set_tangent()
@@ -629,7 +643,12 @@ std::string vertex_shader_input_output(const rhi::VertexDescriptor &a_vertex_des
 				std::string middle_half{precision + in_out_format_str};
 				std::string second_half{(a_prefix != "" ? "_" + a_prefix : "") + "_" + semantic_str + (a_prefix != "" ? std::to_string(a_target_offset) : "") + ";\n"};
 
-				std::string line{first_half + in + middle_half + in + second_half};
+				// Octahedral normals come in as two components and are decoded in set_normal()
+				std::string in_middle_half{middle_half};
+				if (semantic == rhi::BufferSemantic::vertex_normal && attrib.format() == rhi::VertexFormat::int16_2_norm)
+					in_middle_half = precision + attribute_format(rhi::VertexFormat::float32_2);
+
+				std::string line{first_half + in + in_middle_half + in + second_half};
 
 				result.append(line);
 
@@ -664,6 +683,9 @@ std::string generate_primitive_vertex_shader(const ror::Model &a_model, uint32_t
 	auto        has_morphs_normal        = mesh.has_morphs(rhi::BufferSemantic::vertex_normal);
 	auto        has_morphs_tangent       = mesh.has_morphs(rhi::BufferSemantic::vertex_tangent);
 	auto        is_depth_shadow          = (a_renderpass_type == rhi::RenderpassType::depth || a_renderpass_type == rhi::RenderpassType::shadow);
+	auto        quantized_position       = mesh.has_quantized_positions(a_primitive_index);
+	auto        octahedral_normal        = has_normal && vertex_descriptor.attribute(rhi::BufferSemantic::vertex_normal).format() == rhi::VertexFormat::int16_2_norm;
+	auto        octahedral_tangent       = has_tangent && vertex_descriptor.attribute(rhi::BufferSemantic::vertex_tangent).format() == rhi::VertexFormat::int16_4_norm;
 
 	std::unordered_map<rhi::BufferSemantic, std::pair<uint32_t, bool>> targets_count{
 	    {rhi::BufferSemantic::vertex_position, {0, true}},
@@ -750,10 +772,17 @@ std::string generate_primitive_vertex_shader(const ror::Model &a_model, uint32_t
 	else                                \
 		replace_next_at("//", tmp)
 
+	if ((octahedral_normal || octahedral_tangent) && !is_depth_shadow)
+		result.append(vs_octahedral_decode_str);
+
 	{
 		auto tmp{vs_set_position_str};
 		setup_for_depth_shadow(true);
 
+		// Offset and scale are per mesh and come from the node's nodes_offsets, so they don't select the shader
+		if (quantized_position)
+			replace_first("= in_vertex_position;", "= vec4(in_nodes_offsets.position_offset.xyz + in_vertex_position.xyz * in_nodes_offsets.position_scale.xyz, 1.0);", tmp);
+
 		if (is_depth_shadow)
 			replace_next_at("//", tmp);        // Final @ to enable disable out_vertex_position
 		else
@@ -769,6 +798,9 @@ std::string generate_primitive_vertex_shader(const ror::Model &a_model, uint32_t
 			auto tmp{vs_set_normal_str};
 			setup_for_depth_shadow(has_morphs_normal);
 
+			if (octahedral_normal)
+				replace_first("= in_vertex_normal;", "= octahedral_decode(in_vertex_normal);", tmp);
+
 			result.append(tmp);        // Add set_normal
 		}
 
@@ -776,6 +808,9 @@ std::string generate_primitive_vertex_shader(const ror::Model &a_model, uint32_t
 		{
 			auto tmp{vs_set_tangent_str};
 			setup_for_depth_shadow(has_morphs_tangent);
+
+			if (octahedral_tangent)
+				replace_first("= in_vertex_tangent;", "= vec4(octahedral_decode(in_vertex_tangent.xy), in_vertex_tangent.w);", tmp);
 			result.append(tmp);        // Add set_tangent
 		}
 	}
@@ -31,6 +31,7 @@
 #include "platform/rorapplication.hpp"
 #include "project_setup.hpp"
 #include "resources/rorprojectroot.hpp"
+#include "resources/rorresource_index.hpp"
 #include "roreditor.hpp"
 #include "settings/rorsettings.hpp"
 #include <any>
@@ -59,6 +60,9 @@ int main(int argc, char *argv[])
 	// This is required before anything else so we load settings.json, buffers_format.json etc from the right path
 	ror::setup_project_root(editor_default_project, "editor");
 
+	// Keep the resource index up to date with assets added or removed while the editor is running
+	ror::get_resource_index().watch();
+
 	// Command line argument has preference over settings in this case
 	if (ror::settings().m_default_scene != editor_default_scene)
 	{
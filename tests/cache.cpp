@@ -0,0 +1,205 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "foundation/rorcache.hpp"
+#include "profiling/rortimer.hpp"
+#include <algorithm>
+#include <atomic>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace ror_test
+{
+TEST(CacheTest, insert_find_remove)
+{
+	ror::Cache<std::string, int32_t> cache{};
+
+	EXPECT_TRUE(cache.insert("one", 1));
+	EXPECT_TRUE(cache.insert("two", 2));
+	EXPECT_FALSE(cache.insert("one", 10));        // Existing value is kept
+
+	EXPECT_EQ(cache.find("one"), std::make_pair(1, true));
+	EXPECT_EQ(cache.find("two"), std::make_pair(2, true));
+	EXPECT_EQ(cache.find("three"), std::make_pair(0, false));
+	EXPECT_EQ(cache.size(), 2u);
+
+	EXPECT_EQ(cache.remove("one"), std::make_pair(1, true));
+	EXPECT_EQ(cache.remove("one"), std::make_pair(0, false));
+	EXPECT_EQ(cache.find("one"), std::make_pair(0, false));
+	EXPECT_EQ(cache.size(), 1u);
+
+	cache.clear();
+	EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST(CacheTest, byte_budget_evicts_least_recently_used)
+{
+	std::vector<int32_t> evicted{};
+
+	// Single shard so the whole budget applies to all keys
+	ror::Cache<int32_t, int32_t, std::hash<int32_t>, 1> cache{100, [&evicted](const int32_t &a_key, int32_t &a_value) {
+		                                                          EXPECT_EQ(a_key * 10, a_value);
+		                                                          evicted.push_back(a_key);
+	                                                          }};
+
+	for (int32_t i = 0; i < 10; ++i)
+		EXPECT_TRUE(cache.insert(i, i * 10, 10));
+
+	EXPECT_EQ(cache.bytes(), 100u);
+	EXPECT_TRUE(evicted.empty());
+
+	// 0 is used so 1 is the least recently used and goes first
+	EXPECT_TRUE(cache.find(0).second);
+	EXPECT_TRUE(cache.insert(10, 100, 10));
+
+	EXPECT_EQ(evicted, std::vector<int32_t>{1});
+	EXPECT_TRUE(cache.find(0).second);
+	EXPECT_FALSE(cache.find(1).second);
+	EXPECT_EQ(cache.bytes(), 100u);
+
+	// Big value pushes out as many as needed
+	EXPECT_TRUE(cache.insert(11, 110, 35));
+	EXPECT_EQ(evicted, (std::vector<int32_t>{1, 2, 3, 4, 5}));
+	EXPECT_LE(cache.bytes(), 100u);
+
+	// Removing doesn't evict
+	EXPECT_TRUE(cache.remove(11).second);
+	EXPECT_EQ(evicted.size(), 5u);
+	EXPECT_EQ(cache.bytes(), 60u);
+}
+
+TEST(CacheTest, concurrent_insert_find)
+{
+	const uint32_t threads_count = 8;
+	const int32_t  keys_count    = 10000;
+
+	ror::Cache<int32_t, int32_t> cache{};
+	std::atomic<uint32_t>        misses{0};
+	std::vector<std::thread>     threads{};
+
+	for (uint32_t t = 0; t < threads_count; ++t)
+		threads.emplace_back([&cache, &misses, t, keys_count]() {
+			for (int32_t i = static_cast<int32_t>(t); i < keys_count; i += static_cast<int32_t>(threads_count))
+				cache.insert(i, i * 2);
+
+			for (int32_t i = 0; i < keys_count; ++i)
+			{
+				auto result = cache.find(i);
+				if (result.second && result.first != i * 2)
+					misses++;
+			}
+		});
+
+	for (auto &thread : threads)
+		thread.join();
+
+	EXPECT_EQ(misses.load(), 0u);
+	EXPECT_EQ(cache.size(), static_cast<size_t>(keys_count));
+
+	for (int32_t i = 0; i < keys_count; ++i)
+		EXPECT_EQ(cache.find(i), std::make_pair(i * 2, true));
+}
+
+// What ror::Cache used to be, one map behind one mutex
+class SingleMutexCache
+{
+  public:
+	bool insert(int32_t a_key, int32_t a_value)
+	{
+		std::lock_guard<std::mutex> mtx(this->m_mutex);
+		return this->m_cache.emplace(a_key, a_value).second;
+	}
+
+	std::pair<int32_t, bool> find(int32_t a_key)
+	{
+		std::lock_guard<std::mutex> mtx(this->m_mutex);
+
+		auto iter = this->m_cache.find(a_key);
+		return iter != this->m_cache.end() ? std::make_pair(iter->second, true) : std::make_pair(0, false);
+	}
+
+  private:
+	std::unordered_map<int32_t, int32_t> m_cache{};
+	std::mutex                           m_mutex{};
+};
+
+template <typename _cache>
+double64_t contended_operations_per_second(_cache &a_cache, uint32_t a_threads_count)
+{
+	const int32_t  keys_count       = 100000;
+	const uint32_t operations_count = 1000000;
+
+	for (int32_t i = 0; i < keys_count; i += 2)
+		a_cache.insert(i, i);
+
+	std::vector<std::thread> threads{};
+	ror::Timer               timer;
+
+	// 90% finds and 10% inserts over the same key range
+	for (uint32_t t = 0; t < a_threads_count; ++t)
+		threads.emplace_back([&a_cache, t, keys_count, operations_count]() {
+			uint32_t state = t + 1;
+			for (uint32_t i = 0; i < operations_count; ++i)
+			{
+				state ^= state << 13;
+				state ^= state >> 17;
+				state ^= state << 5;
+
+				auto key = static_cast<int32_t>(state % static_cast<uint32_t>(keys_count));
+				if (state % 10 == 0)
+					a_cache.insert(key, key);
+				else
+					a_cache.find(key);
+			}
+		});
+
+	for (auto &thread : threads)
+		thread.join();
+
+	return static_cast<double64_t>(a_threads_count * operations_count) / (static_cast<double64_t>(timer.tick()) / 1000000000.0);
+}
+
+TEST(CacheTest, DISABLED_cache_contention_performance)
+{
+	auto max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+	for (uint32_t threads_count = 1; threads_count <= max_threads; threads_count *= 2)
+	{
+		SingleMutexCache             single{};
+		ror::Cache<int32_t, int32_t> sharded{};
+
+		auto single_ops  = contended_operations_per_second(single, threads_count);
+		auto sharded_ops = contended_operations_per_second(sharded, threads_count);
+
+		std::cout << threads_count << " threads, single mutex: " << single_ops / 1000000.0 << " Mops/s, sharded: " << sharded_ops / 1000000.0 << " Mops/s" << std::endl;
+	}
+}
+
+}        // namespace ror_test
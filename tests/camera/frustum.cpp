@@ -0,0 +1,166 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "bounds/rorbounding.hpp"
+#include "camera/rorfrustum.hpp"
+#include "common.hpp"
+#include "foundation/rorrandom.hpp"
+#include "math/rormatrix4.hpp"
+#include "math/rormatrix4_functions.hpp"
+#include "math/rorvector3.hpp"
+#include <gtest/gtest.h>
+
+namespace ror_test
+{
+// Brute force reference, a box is outside if all of its corners are behind any one of the frustum planes
+bool reference_visible(const ror::Frustum &a_frustum, const ror::Vector3f (&a_corners)[8])
+{
+	const uint32_t planes_count = a_frustum.infinite() ? 5u : 6u;
+	for (uint32_t i = 0; i < planes_count; ++i)
+	{
+		uint32_t behind = 0;
+		for (auto &corner : a_corners)
+			if (a_frustum.planes()[i].distance_to_point(corner) < 0.0f)
+				behind++;
+
+		if (behind == 8)
+			return false;
+	}
+
+	return true;
+}
+
+void box_corners(const ror::Vector3f &a_min, const ror::Vector3f &a_max, const ror::Matrix4f &a_xform, ror::Vector3f (&a_corners)[8])
+{
+	for (uint32_t i = 0; i < 8; ++i)
+		a_corners[i] = a_xform * ror::Vector3f{i & 1 ? a_max.x : a_min.x, i & 2 ? a_max.y : a_min.y, i & 4 ? a_max.z : a_min.z};
+}
+
+ror::Matrix4f frustum_look_at(const ror::Vector3f &a_eye, const ror::Vector3f &a_target)
+{
+	return ror::make_look_at(a_eye, a_target, ror::Vector3f{0.0f, 1.0f, 0.0f}, ror::Vector3f{0.0f, 1.0f, 0.0f}, ror::Vector3f{1.0f, 0.0f, 0.0f});
+}
+
+ror::Frustum random_frustum(ror::Random<float32_t> &a_random, bool a_infinite)
+{
+	ror::Frustum frustum;
+	frustum.fov(30.0f + (a_random.next() + 1.0f) * 30.0f);
+	frustum.aspect(1.0f + (a_random.next() + 1.0f) * 0.5f);
+	frustum.near(0.1f);
+	frustum.far(50.0f);
+	frustum.infinite(a_infinite);
+
+	ror::Vector3f eye{a_random.next() * 20.0f, a_random.next() * 20.0f, a_random.next() * 20.0f};
+	ror::Vector3f target{a_random.next() * 5.0f, a_random.next() * 5.0f, a_random.next() * 5.0f};
+	frustum.setup(frustum_look_at(eye, target));
+
+	return frustum;
+}
+
+TEST(FrustumTest, planes_face_inwards)
+{
+	ror::Frustum frustum;
+	frustum.fov(60.0f);
+	frustum.aspect(1.5f);
+	frustum.near(1.0f);
+	frustum.far(100.0f);
+	frustum.setup(frustum_look_at(ror::Vector3f{0.0f, 0.0f, 10.0f}, ror::Vector3f{0.0f, 0.0f, 0.0f}));
+
+	// Setting up again shouldn't move anything
+	auto center = frustum.center();
+	frustum.setup(frustum_look_at(ror::Vector3f{0.0f, 0.0f, 10.0f}, ror::Vector3f{0.0f, 0.0f, 0.0f}));
+	EXPECT_NEAR(center.x, frustum.center().x, test_epsilon);
+	EXPECT_NEAR(center.y, frustum.center().y, test_epsilon);
+	EXPECT_NEAR(center.z, frustum.center().z, test_epsilon);
+
+	for (auto &plane : frustum.planes())
+	{
+		EXPECT_GT(plane.distance_to_point(frustum.center()), 0.0f);
+		EXPECT_GT(plane.distance_to_point(ror::Vector3f{0.0f, 0.0f, 0.0f}), 0.0f);
+	}
+
+	EXPECT_TRUE(frustum.visible(ror::BoundingSpheref{ror::Vector3f{0.0f, 0.0f, 0.0f}, 1.0f}));
+	EXPECT_FALSE(frustum.visible(ror::BoundingSpheref{ror::Vector3f{0.0f, 0.0f, 20.0f}, 1.0f}));         // Behind the camera
+	EXPECT_FALSE(frustum.visible(ror::BoundingSpheref{ror::Vector3f{100.0f, 0.0f, 0.0f}, 1.0f}));        // Far to the right
+	EXPECT_TRUE(frustum.visible(ror::BoundingSpheref{ror::Vector3f{0.0f, 0.0f, 9.5f}, 1.0f}));           // Cutting the near plane
+	EXPECT_FALSE(frustum.visible(ror::BoundingSpheref{ror::Vector3f{0.0f, 0.0f, -200.0f}, 1.0f}));       // Beyond far
+
+	frustum.infinite(true);
+	EXPECT_TRUE(frustum.visible(ror::BoundingSpheref{ror::Vector3f{0.0f, 0.0f, -200.0f}, 1.0f}));
+
+	EXPECT_TRUE(frustum.visible(ror::BoundingBoxf{}));        // Empty boxes are never culled
+}
+
+TEST(FrustumTest, box_culling_matches_reference)
+{
+	ror::Random<float32_t> random{-1.0f, 1.0f};
+
+	for (uint32_t f = 0; f < 64; ++f)
+	{
+		auto frustum = random_frustum(random, f % 2 == 0);
+
+		for (uint32_t b = 0; b < 256; ++b)
+		{
+			ror::Vector3f center{random.next() * 40.0f, random.next() * 40.0f, random.next() * 40.0f};
+			ror::Vector3f half{(random.next() + 1.0f) * 4.0f, (random.next() + 1.0f) * 4.0f, (random.next() + 1.0f) * 4.0f};
+			ror::Vector3f minimum{center - half};
+			ror::Vector3f maximum{center + half};
+
+			ror::Vector3f corners[8];
+			box_corners(minimum, maximum, ror::Matrix4f{}, corners);
+
+			// World space boxes should match the reference exactly
+			EXPECT_EQ(frustum.visible(ror::BoundingBoxf{minimum, maximum}), reference_visible(frustum, corners));
+
+			// Transformed boxes are tested against a box around them so can only be conservative, it should never cull a visible box
+			auto xform = ror::matrix4_translation(center) *
+			             ror::matrix4_rotation_around_y(random.next() * 3.14f) *
+			             ror::matrix4_rotation_around_x(random.next() * 3.14f) *
+			             ror::matrix4_scaling((random.next() + 1.5f), (random.next() + 1.5f), (random.next() + 1.5f));
+
+			box_corners(-half, half, xform, corners);
+			if (reference_visible(frustum, corners))
+			{
+				EXPECT_TRUE(frustum.visible(ror::BoundingBoxf{-half, half}, xform));
+			}
+
+			// Spheres can't be culled if any of the points on it is inside all planes
+			ror::BoundingSpheref sphere{center, half.x};
+			if (!frustum.visible(sphere))
+			{
+				for (auto &plane : frustum.planes())
+				{
+					if (plane.distance_to_point(center) < -half.x)
+					{
+						EXPECT_LT(plane.distance_to_point(center + plane.normal() * half.x), 0.0f);
+						break;
+					}
+				}
+			}
+		}
+	}
+}
+
+}        // namespace ror_test
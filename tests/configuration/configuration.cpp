@@ -5,8 +5,10 @@
 #include "profiling/rorlog.hpp"
 #include "resources/rorprojectroot.hpp"
 #include "resources/rorresource.hpp"
+#include "resources/rorresource_index.hpp"
 #include "rhi/rorbuffers_format.hpp"
 #include "rhi/rortypes.hpp"
+#include <algorithm>
 #include <cstddef>
 #include <filesystem>
 #include <fstream>
@@ -14,6 +16,7 @@
 #include <gtest/gtest.h>
 #include <iostream>
 #include <utility>
+#include <vector>
 
 namespace ror_test
 {
@@ -191,4 +194,191 @@ TEST(ResourcesTest, resouce_load_upload_write)
 	parent.remove();
 }
 
+TEST(ResourcesTest, resource_mmap)
+{
+	auto             &parent = ror::create_resource("my_mapped_assets", ror::ResourceSemantic::caches);
+	auto             &binary = ror::create_resource("my_mapped_assets/my_buffer.bin", ror::ResourceSemantic::caches);
+	ror::bytes_vector bytes(1024 * 1024 + 17);        // Not page aligned on purpose
+
+	for (size_t i = 0; i < bytes.size(); ++i)
+		bytes[i] = static_cast<uint8_t>(i * 31);
+
+	binary.update(ror::bytes_vector{bytes}, true, false, true);
+	binary.flush();
+
+	if constexpr (ror::get_os() < ror::OsType::os_android)        // This means all Host OSes
+	{
+		// Mapping and partial access
+		{
+			ror::Resource mapped{binary.absolute_path(), ror::ResourceSemantic::caches, true, true, true};
+			mapped.load();
+
+			auto view = mapped.data_span();
+
+			EXPECT_TRUE(mapped.mapped());
+			ASSERT_EQ(view.size(), bytes.size());
+			EXPECT_TRUE(std::equal(view.begin(), view.end(), bytes.begin()));
+
+			auto middle = view.subspan(4096 + 3, 100);
+			EXPECT_TRUE(std::equal(middle.begin(), middle.end(), bytes.begin() + 4096 + 3));
+			EXPECT_EQ(view.back(), bytes.back());
+
+			// Unmapping via write_or_unmap
+			mapped.flush();
+			EXPECT_FALSE(mapped.mapped());
+			EXPECT_TRUE(mapped.data_span().empty());
+		}
+
+		// Mapping via the cache and loading the same resource afterwards still gives a copy to data() users
+		{
+			auto &mapped = ror::map_resource("my_mapped_assets/my_buffer.bin", ror::ResourceSemantic::caches);
+			EXPECT_TRUE(mapped.mapped());
+			EXPECT_EQ(&mapped, &binary);
+
+			auto view = mapped.data_span();
+			EXPECT_TRUE(std::equal(view.begin(), view.end(), bytes.begin(), bytes.end()));
+
+			auto &loaded = ror::load_resource("my_mapped_assets/my_buffer.bin", ror::ResourceSemantic::caches);
+			EXPECT_EQ(loaded.data(), bytes);
+			EXPECT_EQ(loaded.data_span().data(), view.data());        // Mapping stays alive for existing spans
+
+			// Updating drops the mapping since its read only
+			loaded.update(ror::bytes_vector{1, 2, 3}, true, true, false);
+			EXPECT_FALSE(loaded.mapped());
+			EXPECT_EQ(loaded.data().size(), bytes.size() + 3);
+		}
+
+		// Files that can't be mapped fall back to normal loading
+		{
+			auto &empty = ror::create_resource("my_mapped_assets/my_empty.bin", ror::ResourceSemantic::caches);
+			empty.flush();
+
+			ror::Resource empty_mapped{empty.absolute_path(), ror::ResourceSemantic::caches, true, true, true};
+			empty_mapped.load();
+
+			EXPECT_FALSE(empty_mapped.mapped());
+			EXPECT_TRUE(empty_mapped.data_span().empty());
+
+			ror::Resource writable{binary.absolute_path(), ror::ResourceSemantic::caches, true, false, true};
+			writable.load();
+
+			EXPECT_FALSE(writable.mapped());
+			EXPECT_EQ(writable.data(), bytes);
+			EXPECT_EQ(writable.data_span().size(), bytes.size());
+
+			empty.remove();
+		}
+	}
+
+	binary.remove();
+	parent.remove();
+}
+
+TEST(ResourcesTest, resource_index_search_order)
+{
+	auto  root  = ror::get_project_root().path();
+	auto &index = ror::get_resource_index();
+
+	std::filesystem::path resource_path{"index_test/boy10.jpg"};
+
+	// In the same order find_resource searches, without the assets ones because assets is a symlink into the repo
+	std::vector<std::filesystem::path> candidates{
+	    "index_test/boy10.jpg",
+	    "textures/index_test/boy10.jpg",
+	    "index_test/assets/boy10.jpg",
+	    "index_test/assets/textures/index_test/boy10.jpg",
+	    "index_test/textures/boy10.jpg",
+	    "textures/index_test/materials/boy10.jpg",
+	    "textures/index_test/textures/boy10.jpg",
+	    "textures/index_test/shaders/boy10.jpg",
+	    "textures/index_test/scripts/boy10.jpg",
+	    "textures/index_test/objects/boy10.jpg",
+	    "textures/index_test/configs/boy10.jpg",
+	    "textures/index_test/models/boy10.jpg",
+	    "textures/index_test/scenes/boy10.jpg",
+	    "textures/index_test/misc/boy10.jpg"};
+
+	auto write = [&root](const std::filesystem::path &a_relative) {
+		std::filesystem::create_directories((root / a_relative).parent_path());
+		std::ofstream file{root / a_relative};
+		file << "boy10";
+	};
+
+	// Files created behind the index's back are still found and indexed
+	write(candidates.back());
+	EXPECT_EQ(ror::find_resource(resource_path, ror::ResourceSemantic::textures), root / candidates.back());
+	EXPECT_TRUE(index.contains(candidates.back()));
+
+	// Now the rest, reported the same way WatchCat would
+	for (auto &candidate : candidates)
+	{
+		write(candidate);
+		index.update({ror::WatchCatEvent{ror::WatchCatEventType::add, root / candidate}});
+	}
+
+	for (auto &candidate : candidates)
+	{
+		EXPECT_EQ(ror::find_resource(resource_path, ror::ResourceSemantic::textures), root / candidate);
+		EXPECT_EQ(ror::find_resource(resource_path, ror::ResourceSemantic::textures), root / candidate);        // Resolved from the index this time
+
+		std::filesystem::remove(root / candidate);
+		index.update({ror::WatchCatEvent{ror::WatchCatEventType::remove, root / candidate}});
+	}
+
+	// Nothing left, so a new file name is generated inside the semantic folder
+	auto generated = ror::find_resource(resource_path, ror::ResourceSemantic::textures);
+	EXPECT_FALSE(std::filesystem::exists(generated));
+	EXPECT_EQ(generated.parent_path(), root / "textures/index_test");
+
+	// The miss is remembered, so a file created behind the index's back now needs reporting
+	write(candidates.front());
+	EXPECT_NE(ror::find_resource(resource_path, ror::ResourceSemantic::textures), root / candidates.front());
+
+	index.update({ror::WatchCatEvent{ror::WatchCatEventType::add, root / candidates.front()}});
+	EXPECT_EQ(ror::find_resource(resource_path, ror::ResourceSemantic::textures), root / candidates.front());
+
+	// Removing a folder removes everything inside it
+	std::filesystem::remove_all(root / "index_test");
+	std::filesystem::remove_all(root / "textures/index_test");
+	index.remove(root / "index_test");
+	index.remove(root / "textures/index_test");
+
+	EXPECT_FALSE(index.contains("index_test/assets"));
+	EXPECT_FALSE(index.contains("textures/index_test/misc"));
+
+	// Absolute paths are not touched
+	EXPECT_EQ(ror::find_resource(root / "some/absolute.jpg", ror::ResourceSemantic::textures), root / "some/absolute.jpg");
+}
+
+TEST(ResourcesTest, resource_index_scan)
+{
+	auto root = std::filesystem::temp_directory_path() / "roar_resource_index_scan";
+
+	std::filesystem::remove_all(root);
+	std::filesystem::create_directories(root / "models/loop");
+	std::filesystem::create_directories(root / "build/models");
+	std::filesystem::create_directories(root / ".git/objects");
+	std::filesystem::create_directory_symlink(root / "models", root / "models/loop/back");        // models/loop/back/loop/back/... for ever
+
+	ror::ResourceIndex index{root};
+
+	// Each real folder is only scanned once and build or hidden folders not at all
+	EXPECT_TRUE(index.contains("models/loop/back"));
+	EXPECT_FALSE(index.contains("models/loop/back/loop"));
+	EXPECT_FALSE(index.contains("build"));
+	EXPECT_FALSE(index.contains(".git/objects"));
+	EXPECT_EQ(index.size(), 3u);
+
+	// Same root is a no-op, a different one rebuilds
+	index.root(root);
+	EXPECT_EQ(index.size(), 3u);
+
+	index.root(root / "models");
+	EXPECT_EQ(index.root(), root / "models");
+	EXPECT_TRUE(index.contains("loop/back"));
+	EXPECT_FALSE(index.contains("models"));
+
+	std::filesystem::remove_all(root);
+}
+
 }        // namespace ror_test
@@ -29,8 +29,11 @@
 #include "math/rorvector2.hpp"
 #include "math/rorvector3.hpp"
 #include "math/rorvector4.hpp"
+#include "profiling/rortimer.hpp"
 #include <gtest/gtest.h>
-#include <typeindex>
+#include <iostream>
+#include <memory>
+#include <thread>
 #include <vector>
 
 namespace ror_test
@@ -102,15 +105,15 @@ class Counter
 	{
 		this->m_value++;
 
-		if (e.m_payload.has_value())
-			this->m_value += static_cast<uint32_t>(std::any_cast<int32_t>(e.m_payload));
+		if (e.is_compatible<int32_t>())
+			this->m_value += static_cast<uint32_t>(e.get_payload<int32_t>());
 	}
 
 	void add_vector2(ror::Event e)
 	{
 		if (e.is_compatible<ror::Vector2f>())
 		{
-			auto vec2 = std::any_cast<ror::Vector2f>(e.m_payload);
+			auto vec2 = e.get_payload<ror::Vector2f>();
 			this->m_value += static_cast<uint32_t>(vec2.x + vec2.y);
 		}
 	}
@@ -120,7 +123,7 @@ class Counter
 	{
 		if (e.is_compatible<ror::Vector4f>())
 		{
-			auto vec = std::any_cast<_type>(e.m_payload);
+			auto vec = e.get_payload<_type>();
 			this->m_value += static_cast<uint32_t>(vec.x + vec.y);
 		}
 	}
@@ -257,4 +260,208 @@ TEST(EventSystemTest, different_payload)
 	event_system.notify({keyboard_b_click, true, ror::Vector3f(1.0, 2.0, 3.0)});
 	EXPECT_EQ(count.m_value, 639);
 }
+
+TEST(EventSystemTest, dense_dispatch)
+{
+	uint32_t         count{0};
+	ror::EventSystem event_system;
+
+	auto increment = [&count](ror::Event &) { count++; };
+	auto consume   = [](ror::Event &e) { e.m_live = false; };
+
+	// Handles at the edges of the table, application_event uses EventState::max
+	auto last_handle = create_event_handle(ror::EventType::max, ror::EventCode::max, ror::EventModifier::max, ror::EventState::max);
+
+	event_system.subscribe(application_event, increment);
+	event_system.subscribe(last_handle, increment);
+	event_system.subscribe(keyboard_z_click, increment);
+
+	event_system.notify({application_event, true});
+	event_system.notify({last_handle, true});
+	event_system.notify({keyboard_z_click, true});
+	event_system.notify({keyboard_a_click, true});        // Nothing subscribed to this one
+	EXPECT_EQ(count, 3u);
+
+	event_system.subscribe_early(keyboard_z_click, consume);
+	event_system.notify({keyboard_z_click, true});
+	EXPECT_EQ(count, 3u);
+
+	event_system.unsubscribe(keyboard_z_click, consume);
+	event_system.notify({keyboard_z_click, true});
+	EXPECT_EQ(count, 4u);
+
+	event_system.unsubscribe(keyboard_z_click, increment);
+	event_system.notify({keyboard_z_click, true});
+	EXPECT_EQ(count, 4u);
+}
+
+TEST(EventSystemTest, payload_types)
+{
+	ror::Event event{keyboard_a_click, true, ror::Vector2d(1.0, 2.0)};
+
+	EXPECT_TRUE(event.is_compatible<ror::Vector2d>());
+	EXPECT_FALSE(event.is_compatible<ror::Vector2f>());
+	EXPECT_FALSE(event.is_compatible<int32_t>());
+
+	EXPECT_EQ(event.get_payload<ror::Vector2d>(), ror::Vector2d(1.0, 2.0));
+	EXPECT_EQ(event.get_payload<ror::Vector2f>(), ror::Vector2f(0.0f, 0.0f));
+
+	ror::Event default_event{keyboard_a_click, true};
+	EXPECT_TRUE(default_event.is_compatible<int32_t>());
+	EXPECT_EQ(default_event.get_payload<int32_t>(), 0);
+}
+
+TEST(EventSystemTest, delegate_copies_callable)
+{
+	auto     shared = std::make_shared<uint32_t>(0u);
+	uint32_t calls{0};
+
+	{
+		ror::EventCallback callback = [shared, &calls](ror::Event &) { (*shared)++; calls++; };
+		EXPECT_EQ(shared.use_count(), 2);
+
+		ror::EventCallback copy{callback};
+		EXPECT_EQ(shared.use_count(), 3);
+		EXPECT_TRUE(copy.same_target(callback));
+
+		ror::EventCallback moved{std::move(copy)};
+		EXPECT_EQ(shared.use_count(), 3);
+		EXPECT_FALSE(static_cast<bool>(copy));
+
+		ror::Event event{};
+		callback(event);
+		moved(event);
+
+		ror::EventCallback other = [](ror::Event &) {};
+		EXPECT_FALSE(other.same_target(callback));
+	}
+
+	EXPECT_EQ(shared.use_count(), 1);
+	EXPECT_EQ(*shared, 2u);
+	EXPECT_EQ(calls, 2u);
+}
+
+TEST(EventSystemTest, queued_coalescing)
+{
+	ror::EventSystem event_system;
+
+	std::vector<ror::Vector2d> moves;
+	uint32_t                   clicks{0};
+	uint32_t                   resizes{0};
+	ror::Vector2ui             last_size{};
+
+	event_system.subscribe(mouse_move, [&moves](ror::Event &e) { moves.push_back(e.get_payload<ror::Vector2d>()); });
+	event_system.subscribe(mouse_left_mouse_click, [&clicks](ror::Event &) { clicks++; });
+	event_system.subscribe(buffer_resize, [&resizes, &last_size](ror::Event &e) { resizes++; last_size = e.get_payload<ror::Vector2ui>(); });
+
+	for (uint32_t i = 0; i < 10; ++i)
+		event_system.post({mouse_move, true, ror::Vector2d(static_cast<double64_t>(i), 0.0)});
+
+	event_system.post({mouse_left_mouse_click, true});
+	event_system.post({mouse_left_mouse_click, true});
+
+	for (uint32_t i = 0; i < 5; ++i)
+		event_system.post({mouse_move, true, ror::Vector2d(0.0, static_cast<double64_t>(i))});
+
+	for (uint32_t i = 1; i <= 3; ++i)
+		event_system.post({buffer_resize, true, ror::Vector2ui(i * 100, i * 10)});
+
+	EXPECT_TRUE(moves.empty());        // Nothing is delivered until dispatched
+
+	event_system.dispatch_queued();
+
+	ASSERT_EQ(moves.size(), 2u);
+	EXPECT_EQ(moves[0], ror::Vector2d(9.0, 0.0));
+	EXPECT_EQ(moves[1], ror::Vector2d(0.0, 4.0));
+	EXPECT_EQ(clicks, 2u);        // Clicks are never coalesced
+	EXPECT_EQ(resizes, 1u);
+	EXPECT_EQ(last_size, ror::Vector2ui(300, 30));
+
+	event_system.dispatch_queued();
+	EXPECT_EQ(moves.size(), 2u);
+}
+
+TEST(EventSystemTest, queued_from_many_threads)
+{
+	const uint32_t threads_count = 8;
+	const uint32_t events_count  = 250000;
+
+	ror::EventSystem      event_system;
+	std::vector<uint32_t> next(threads_count, 0);
+	uint32_t              out_of_order{0};
+	uint32_t              delivered{0};
+	std::thread::id       main_thread = std::this_thread::get_id();
+	bool                  other_thread{false};
+
+	event_system.subscribe(keyboard_a_click, [&](ror::Event &e) {
+		auto payload = e.get_payload<ror::Vector2ui>();
+		if (payload.y != next[payload.x])
+			out_of_order++;
+
+		next[payload.x] = payload.y + 1;
+		delivered++;
+		other_thread |= std::this_thread::get_id() != main_thread;
+	});
+
+	std::atomic<uint32_t>    finished{0};
+	std::vector<std::thread> threads;
+	threads.reserve(threads_count);
+
+	for (uint32_t i = 0; i < threads_count; ++i)
+		threads.emplace_back([&event_system, &finished, i]() {
+			for (uint32_t j = 0; j < events_count; ++j)
+				event_system.post({keyboard_a_click, true, ror::Vector2ui(i, j)});
+
+			finished++;
+		});
+
+	// Main thread keeps dispatching like a frame loop while the workers post
+	while (finished.load() < threads_count)
+		event_system.dispatch_queued();
+
+	for (auto &thread : threads)
+		thread.join();
+
+	event_system.dispatch_queued();
+
+	EXPECT_EQ(delivered, threads_count * events_count);
+	EXPECT_EQ(out_of_order, 0u);
+	EXPECT_FALSE(other_thread);
+
+	for (auto count : next)
+		EXPECT_EQ(count, events_count);
+}
+
+TEST(EventSystemTest, DISABLED_event_system_performance)
+{
+	const uint32_t creations_count = 1000;
+	const uint32_t notify_count    = 10000000;
+
+	ror::Timer timer;
+
+	for (uint32_t i = 0; i < creations_count; ++i)
+	{
+		ror::EventSystem event_system;
+		(void) event_system;
+	}
+
+	auto creation_time = timer.tick();
+
+	uint32_t         count{0};
+	ror::EventSystem event_system;
+	event_system.subscribe(mouse_move, [&count](ror::Event &e) { count += static_cast<uint32_t>(e.get_payload<ror::Vector2d>().x); });
+
+	timer.tick();
+
+	for (uint32_t i = 0; i < notify_count; ++i)
+		event_system.notify({mouse_move, true, ror::Vector2d(1.0, 1.0)});
+
+	auto notify_time = timer.tick();
+
+	EXPECT_EQ(count, notify_count);
+
+	std::cout << "EventSystem creation: " << static_cast<double64_t>(creation_time) / creations_count << " ns, "
+	          << "size: " << sizeof(ror::EventSystem) << " bytes, "
+	          << "notify: " << static_cast<double64_t>(notify_time) / notify_count << " ns" << std::endl;
+}
 }        // namespace ror_test
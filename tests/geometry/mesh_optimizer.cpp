@@ -0,0 +1,207 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "common.hpp"
+#include "geometry/rormesh_optimizer.hpp"
+#include "math/rorvector2.hpp"
+#include "math/rorvector3.hpp"
+#include <algorithm>
+#include <array>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace ror_test
+{
+// Indexed grid of a_size x a_size quads with two triangles each
+static void make_grid(uint32_t a_size, std::vector<ror::Vector3f> &a_positions, std::vector<uint32_t> &a_indices)
+{
+	for (uint32_t y = 0; y <= a_size; ++y)
+		for (uint32_t x = 0; x <= a_size; ++x)
+			a_positions.push_back({static_cast<float32_t>(x), static_cast<float32_t>(y), 0.0f});
+
+	for (uint32_t y = 0; y < a_size; ++y)
+	{
+		for (uint32_t x = 0; x < a_size; ++x)
+		{
+			uint32_t v0 = y * (a_size + 1) + x;
+			uint32_t v1 = v0 + 1;
+			uint32_t v2 = v0 + a_size + 1;
+			uint32_t v3 = v2 + 1;
+
+			a_indices.insert(a_indices.end(), {v0, v1, v2, v2, v1, v3});
+		}
+	}
+}
+
+// Shuffles triangles, keeps the winding of each
+static void shuffle_triangles(std::vector<uint32_t> &a_indices, uint32_t a_seed)
+{
+	std::vector<std::array<uint32_t, 3>> triangles(a_indices.size() / 3);
+	for (size_t i = 0; i < triangles.size(); ++i)
+		triangles[i] = {a_indices[i * 3 + 0], a_indices[i * 3 + 1], a_indices[i * 3 + 2]};
+
+	std::mt19937 generator{a_seed};
+	std::shuffle(triangles.begin(), triangles.end(), generator);
+
+	for (size_t i = 0; i < triangles.size(); ++i)
+		std::copy(triangles[i].begin(), triangles[i].end(), a_indices.begin() + static_cast<std::ptrdiff_t>(i * 3));
+}
+
+// Triangles rotated to start at their smallest index and sorted, equal for two index buffers with the same triangles and windings in any order
+static std::vector<std::array<uint32_t, 3>> canonical_triangles(const std::vector<uint32_t> &a_indices)
+{
+	std::vector<std::array<uint32_t, 3>> triangles(a_indices.size() / 3);
+	for (size_t i = 0; i < triangles.size(); ++i)
+	{
+		std::array<uint32_t, 3> t{a_indices[i * 3 + 0], a_indices[i * 3 + 1], a_indices[i * 3 + 2]};
+		std::rotate(t.begin(), std::min_element(t.begin(), t.end()), t.end());
+		triangles[i] = t;
+	}
+
+	std::sort(triangles.begin(), triangles.end());
+
+	return triangles;
+}
+
+TEST(MeshOptimizerTest, vertex_remap_welds_duplicates)
+{
+	std::vector<ror::Vector3f> positions{};
+	std::vector<uint32_t>      indices{};
+	make_grid(8, positions, indices);
+
+	// Unweld into a triangle soup, then give one copy of a shared vertex a different uv so it must stay separate
+	std::vector<ror::Vector3f> soup_positions{};
+	std::vector<ror::Vector2f> soup_uvs{};
+	std::vector<uint32_t>      soup_indices{};
+	for (auto index : indices)
+	{
+		soup_indices.push_back(static_cast<uint32_t>(soup_positions.size()));
+		soup_positions.push_back(positions[index]);
+		soup_uvs.push_back({positions[index].x, positions[index].y});
+	}
+
+	soup_uvs[1].x = -1.0f;
+
+	std::vector<ror::VertexStream> streams{{reinterpret_cast<const uint8_t *>(soup_positions.data()), sizeof(ror::Vector3f), sizeof(ror::Vector3f)},
+	                                       {reinterpret_cast<const uint8_t *>(soup_uvs.data()), sizeof(ror::Vector2f), sizeof(ror::Vector2f)}};
+
+	std::vector<uint32_t> remap{};
+	auto                  unique_count = ror::generate_vertex_remap(remap, soup_indices, static_cast<uint32_t>(soup_positions.size()), streams);
+
+	EXPECT_EQ(unique_count, positions.size() + 1);
+
+	ror::remap_indices(soup_indices, remap);
+
+	std::vector<ror::Vector3f> welded_positions(unique_count);
+	ror::remap_vertices(reinterpret_cast<uint8_t *>(welded_positions.data()), streams[0], remap);
+
+	// Same triangles as before, position for position
+	ASSERT_EQ(soup_indices.size(), indices.size());
+	for (size_t i = 0; i < indices.size(); ++i)
+		EXPECT_EQ(welded_positions[soup_indices[i]], positions[indices[i]]);
+}
+
+TEST(MeshOptimizerTest, vertex_cache_improves_acmr)
+{
+	std::vector<ror::Vector3f> positions{};
+	std::vector<uint32_t>      indices{};
+	make_grid(64, positions, indices);
+	shuffle_triangles(indices, 7u);
+
+	auto vertex_count = static_cast<uint32_t>(positions.size());
+	auto before       = ror::analyze_vertex_cache(indices, vertex_count);
+	auto triangles    = canonical_triangles(indices);
+
+	ror::optimize_vertex_cache(indices, vertex_count);
+	auto after = ror::analyze_vertex_cache(indices, vertex_count);
+
+	EXPECT_EQ(canonical_triangles(indices), triangles);
+	EXPECT_LT(after.m_acmr, before.m_acmr);
+	EXPECT_LT(after.m_acmr, 1.0f);
+	EXPECT_LT(after.m_atvr, before.m_atvr);
+
+	std::string stats{"ACMR " + std::to_string(before.m_acmr) + " -> " + std::to_string(after.m_acmr) + ", ATVR " + std::to_string(before.m_atvr) + " -> " + std::to_string(after.m_atvr)};
+	print_with_gtest_header(stats.c_str(), green);
+}
+
+TEST(MeshOptimizerTest, overdraw_keeps_triangles_and_cache_locality)
+{
+	std::vector<ror::Vector3f> positions{};
+	std::vector<uint32_t>      indices{};
+	make_grid(32, positions, indices);
+
+	// Fold the grid into a tube so clusters face different directions
+	for (auto &p : positions)
+		p = {std::cos(p.x * 0.2f), std::sin(p.x * 0.2f), p.y};
+
+	shuffle_triangles(indices, 11u);
+
+	auto vertex_count = static_cast<uint32_t>(positions.size());
+	auto triangles    = canonical_triangles(indices);
+	auto shuffled     = ror::analyze_vertex_cache(indices, vertex_count);
+
+	ror::optimize_vertex_cache(indices, vertex_count);
+	ror::optimize_overdraw(indices, &positions[0].x, sizeof(ror::Vector3f), vertex_count);
+
+	auto after = ror::analyze_vertex_cache(indices, vertex_count);
+
+	EXPECT_EQ(canonical_triangles(indices), triangles);
+	EXPECT_LT(after.m_acmr, shuffled.m_acmr * 0.5f);
+}
+
+TEST(MeshOptimizerTest, vertex_fetch_follows_first_use)
+{
+	std::vector<ror::Vector3f> positions{};
+	std::vector<uint32_t>      indices{};
+	make_grid(16, positions, indices);
+	shuffle_triangles(indices, 3u);
+
+	auto vertex_count = static_cast<uint32_t>(positions.size());
+	auto original     = indices;
+
+	std::vector<uint32_t> remap{};
+	auto                  referenced_count = ror::optimize_vertex_fetch_remap(remap, indices, vertex_count);
+	EXPECT_EQ(referenced_count, vertex_count);
+
+	ror::remap_indices(indices, remap);
+
+	std::vector<ror::Vector3f> fetched_positions(referenced_count);
+	ror::remap_vertices(reinterpret_cast<uint8_t *>(fetched_positions.data()), {reinterpret_cast<const uint8_t *>(positions.data()), sizeof(ror::Vector3f), sizeof(ror::Vector3f)}, remap);
+
+	// Every index is either one already seen or the next new one
+	uint32_t next = 0;
+	for (size_t i = 0; i < indices.size(); ++i)
+	{
+		EXPECT_LE(indices[i], next);
+		if (indices[i] == next)
+			++next;
+
+		EXPECT_EQ(fetched_positions[indices[i]], positions[original[i]]);
+	}
+}
+
+}        // namespace ror_test
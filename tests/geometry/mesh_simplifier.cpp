@@ -0,0 +1,211 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "common.hpp"
+#include "geometry/rormesh_simplifier.hpp"
+#include "math/rorvector2.hpp"
+#include "math/rorvector3.hpp"
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ror_test
+{
+// Indexed grid of a_size x a_size quads in the xy plane, column a_seam is split into two copies of its vertices like a uv seam would
+static void make_grid(uint32_t a_size, uint32_t a_seam, std::vector<ror::Vector3f> &a_positions, std::vector<ror::Vector2f> &a_uvs, std::vector<uint32_t> &a_indices)
+{
+	auto row = a_size + 2;
+	for (uint32_t y = 0; y <= a_size; ++y)
+	{
+		for (uint32_t x = 0; x <= a_size + 1; ++x)
+		{
+			auto column = x > a_seam ? x - 1 : x;
+			a_positions.push_back({static_cast<float32_t>(column), static_cast<float32_t>(y), 0.0f});
+			a_uvs.push_back({static_cast<float32_t>(x), static_cast<float32_t>(y)});
+		}
+	}
+
+	for (uint32_t y = 0; y < a_size; ++y)
+	{
+		for (uint32_t x = 0; x <= a_size; ++x)
+		{
+			if (x == a_seam)
+				continue;
+
+			uint32_t v0 = y * row + x;
+			uint32_t v1 = v0 + 1;
+			uint32_t v2 = v0 + row;
+			uint32_t v3 = v2 + 1;
+
+			a_indices.insert(a_indices.end(), {v0, v1, v2, v2, v1, v3});
+		}
+	}
+}
+
+// Closed sphere with a_rings latitudes and a_segments longitudes, no seams
+static void make_sphere(uint32_t a_rings, uint32_t a_segments, float32_t a_radius, std::vector<ror::Vector3f> &a_positions, std::vector<uint32_t> &a_indices)
+{
+	const float32_t pi = 3.14159265358979f;
+
+	a_positions.push_back({0.0f, a_radius, 0.0f});
+	for (uint32_t ring = 1; ring < a_rings; ++ring)
+	{
+		auto theta = pi * static_cast<float32_t>(ring) / static_cast<float32_t>(a_rings);
+		for (uint32_t segment = 0; segment < a_segments; ++segment)
+		{
+			auto phi = 2.0f * pi * static_cast<float32_t>(segment) / static_cast<float32_t>(a_segments);
+			a_positions.push_back({a_radius * std::sin(theta) * std::cos(phi), a_radius * std::cos(theta), a_radius * std::sin(theta) * std::sin(phi)});
+		}
+	}
+	a_positions.push_back({0.0f, -a_radius, 0.0f});
+
+	auto bottom = static_cast<uint32_t>(a_positions.size() - 1);
+	auto vertex = [a_segments](uint32_t a_ring, uint32_t a_segment) { return 1 + (a_ring - 1) * a_segments + a_segment % a_segments; };
+
+	for (uint32_t segment = 0; segment < a_segments; ++segment)
+	{
+		a_indices.insert(a_indices.end(), {0u, vertex(1, segment + 1), vertex(1, segment)});
+		a_indices.insert(a_indices.end(), {bottom, vertex(a_rings - 1, segment), vertex(a_rings - 1, segment + 1)});
+	}
+
+	for (uint32_t ring = 1; ring < a_rings - 1; ++ring)
+	{
+		for (uint32_t segment = 0; segment < a_segments; ++segment)
+		{
+			auto v0 = vertex(ring, segment);
+			auto v1 = vertex(ring, segment + 1);
+			auto v2 = vertex(ring + 1, segment);
+			auto v3 = vertex(ring + 1, segment + 1);
+
+			a_indices.insert(a_indices.end(), {v0, v1, v2, v2, v1, v3});
+		}
+	}
+}
+
+// Edges used by one triangle only, by position so both sides of a seam count as one edge
+static size_t open_edge_count(const std::vector<uint32_t> &a_indices, const std::vector<ror::Vector3f> &a_positions)
+{
+	auto key = [&a_positions](uint32_t a_vertex) { return std::make_pair(a_positions[a_vertex].x, a_positions[a_vertex].y); };
+
+	std::map<std::pair<std::pair<float32_t, float32_t>, std::pair<float32_t, float32_t>>, uint32_t> edges{};
+	for (size_t i = 0; i < a_indices.size(); i += 3)
+	{
+		for (size_t e = 0; e < 3; ++e)
+		{
+			auto a = key(a_indices[i + e]);
+			auto b = key(a_indices[i + (e + 1) % 3]);
+			edges[std::minmax(a, b)]++;
+		}
+	}
+
+	return static_cast<size_t>(std::count_if(edges.begin(), edges.end(), [](auto &a_edge) { return a_edge.second == 1; }));
+}
+
+static float32_t triangle_area(const std::vector<uint32_t> &a_indices, const std::vector<ror::Vector3f> &a_positions, size_t a_first)
+{
+	auto &p0 = a_positions[a_indices[a_first + 0]];
+	auto &p1 = a_positions[a_indices[a_first + 1]];
+	auto &p2 = a_positions[a_indices[a_first + 2]];
+
+	return (p1 - p0).cross_product(p2 - p0).z * 0.5f;
+}
+
+TEST(MeshSimplifierTest, flat_grid_keeps_borders_and_seams)
+{
+	std::vector<ror::Vector3f> positions{};
+	std::vector<ror::Vector2f> uvs{};
+	std::vector<uint32_t>      indices{};
+	make_grid(32, 16, positions, uvs, indices);
+
+	auto original_count = indices.size();
+	auto open_edges     = open_edge_count(indices, positions);
+
+	std::vector<ror::SimplifyAttribute> attributes{{&uvs[0].x, sizeof(ror::Vector2f), 2, 1.0f}};
+
+	auto error = ror::simplify(indices, &positions[0].x, sizeof(ror::Vector3f), static_cast<uint32_t>(positions.size()), 0, 0.01f, attributes);
+
+	// A plane can lose everything inside its border and seam without any error
+	EXPECT_LT(indices.size() * 4, original_count);
+	EXPECT_LT(error, 1e-4f);
+
+	// Same area and no triangle turned over
+	float32_t area = 0.0f;
+	for (size_t i = 0; i < indices.size(); i += 3)
+	{
+		auto triangle = triangle_area(indices, positions, i);
+		EXPECT_GT(triangle, 0.0f);
+		area += triangle;
+	}
+	EXPECT_NEAR(area, 32.0f * 32.0f, 1e-2f);
+
+	// Borders stay where they were and the seam didn't crack open
+	EXPECT_EQ(open_edge_count(indices, positions), open_edges);
+}
+
+TEST(MeshSimplifierTest, sphere_lod_chain)
+{
+	const float32_t radius = 10.0f;
+
+	std::vector<ror::Vector3f> positions{};
+	std::vector<uint32_t>      indices{};
+	make_sphere(48, 96, radius, positions, indices);
+
+	auto vertex_count = static_cast<uint32_t>(positions.size());
+	auto lods         = ror::generate_lods(indices, &positions[0].x, sizeof(ror::Vector3f), vertex_count, 6, 0.5f, radius * 0.05f);
+
+	ASSERT_GE(lods.size(), 4u);
+	EXPECT_EQ(lods[0].m_indices, indices);
+	EXPECT_EQ(lods[0].m_error, 0.0f);
+
+	std::string stats{"Sphere LODs"};
+	for (size_t level = 1; level < lods.size(); ++level)
+	{
+		auto &lod = lods[level];
+
+		EXPECT_LE(lod.m_indices.size() * 10, lods[level - 1].m_indices.size() * 9);
+		EXPECT_GE(lod.m_error, lods[level - 1].m_error);
+		EXPECT_LE(lod.m_error, radius * 0.05f);
+
+		// Vertices never move, so how far triangle centres sink below the sphere is how far the surface moved
+		float32_t deviation = 0.0f;
+		for (size_t i = 0; i < lod.m_indices.size(); i += 3)
+		{
+			auto centre = (positions[lod.m_indices[i]] + positions[lod.m_indices[i + 1]] + positions[lod.m_indices[i + 2]]) / 3.0f;
+			deviation   = std::max(deviation, radius - centre.length());
+		}
+
+		EXPECT_LE(deviation, lod.m_error * 2.0f + radius * 0.001f);
+
+		stats += ", " + std::to_string(lod.m_indices.size() / 3) + " triangles error " + std::to_string(lod.m_error) + " deviation " + std::to_string(deviation);
+	}
+
+	print_with_gtest_header(stats.c_str(), green);
+}
+
+}        // namespace ror_test
@@ -0,0 +1,236 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "bounds/rorbounding.hpp"
+#include "common.hpp"
+#include "geometry/rorvertex_quantizer.hpp"
+#include "math/rorvector2.hpp"
+#include "math/rorvector3.hpp"
+#include "math/rorvector4.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace ror_test
+{
+// Random unit vectors, including the axes and the octahedron's folds which are the hardest to encode
+static std::vector<ror::Vector3f> make_unit_vectors(uint32_t a_count, uint32_t a_seed)
+{
+	std::vector<ror::Vector3f> vectors{{1.0f, 0.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, -1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, -1.0f},
+	                                   ror::Vector3f{1.0f, 1.0f, 0.0f}.normalized(), ror::Vector3f{-1.0f, 0.0f, -1.0f}.normalized(), ror::Vector3f{1.0f, -1.0f, -1.0f}.normalized()};
+
+	std::mt19937                              generator{a_seed};
+	std::uniform_real_distribution<float32_t> distribution{-1.0f, 1.0f};
+
+	while (vectors.size() < a_count)
+	{
+		ror::Vector3f v{distribution(generator), distribution(generator), distribution(generator)};
+		if (v.length() > 0.01f)
+			vectors.push_back(v.normalized());
+	}
+
+	return vectors;
+}
+
+// Largest angle in degrees between a unit vector and its decoded quantized version
+static float32_t angle_degrees(const ror::Vector3f &a_first, const ror::Vector3f &a_second)
+{
+	auto dot = std::clamp(a_first.dot_product(a_second), -1.0f, 1.0f);
+
+	return std::acos(dot) * 180.0f / 3.14159265f;
+}
+
+TEST(VertexQuantizerTest, half_floats)
+{
+	// Exactly representable values survive the round trip
+	for (auto value : {0.0f, -0.0f, 1.0f, -2.0f, 0.5f, 65504.0f, std::ldexp(1.0f, -14), std::ldexp(1.0f, -24)})
+		EXPECT_EQ(ror::half_to_float(ror::float_to_half(value)), value);
+
+	EXPECT_EQ(ror::float_to_half(1.0f), 0x3c00u);
+	EXPECT_EQ(ror::float_to_half(-2.0f), 0xc000u);
+	EXPECT_EQ(ror::float_to_half(65520.0f), 0x7c00u);        // Rounds up to infinity
+	EXPECT_EQ(ror::float_to_half(1.0f + std::ldexp(1.0f, -11)), 0x3c00u);        // Ties go to even
+	EXPECT_EQ(ror::float_to_half(std::ldexp(1.0f, -26)), 0x0000u);
+	EXPECT_TRUE(std::isinf(ror::half_to_float(ror::float_to_half(std::numeric_limits<float32_t>::infinity()))));
+	EXPECT_TRUE(std::isnan(ror::half_to_float(ror::float_to_half(std::numeric_limits<float32_t>::quiet_NaN()))));
+
+	// Every half converts back to itself
+	for (uint32_t bits = 0; bits < 0x10000u; ++bits)
+	{
+		auto half  = static_cast<uint16_t>(bits);
+		auto value = ror::half_to_float(half);
+		if (!std::isnan(value))
+		{
+			ASSERT_EQ(ror::float_to_half(value), half);
+		}
+	}
+}
+
+TEST(VertexQuantizerTest, positions)
+{
+	ror::BoundingBoxf bounds{{-3.0f, 0.0f, 10.0f}, {5.0f, 0.0f, 110.0f}};        // Flat on y
+
+	std::mt19937                              generator{7};
+	std::uniform_real_distribution<float32_t> distribution{0.0f, 1.0f};
+
+	std::vector<ror::Vector3f> positions{bounds.minimum(), bounds.maximum()};
+	for (uint32_t i = 0; i < 10000; ++i)
+		positions.push_back(bounds.minimum() + bounds.extent() * ror::Vector3f{distribution(generator), distribution(generator), distribution(generator)});
+
+	std::vector<uint16_t> quantized{};
+	ror::quantize_positions(quantized, {reinterpret_cast<const uint8_t *>(positions.data()), sizeof(ror::Vector3f), sizeof(ror::Vector3f)}, static_cast<uint32_t>(positions.size()), bounds);
+
+	ASSERT_EQ(quantized.size(), positions.size() * 4);
+
+	auto step = bounds.extent() / 65535.0f;
+	for (size_t i = 0; i < positions.size(); ++i)
+	{
+		auto decoded = ror::dequantize_position(&quantized[i * 4], bounds);
+
+		EXPECT_LE(std::abs(decoded.x - positions[i].x), step.x * 0.5f + 1e-5f);
+		EXPECT_EQ(decoded.y, 0.0f);
+		EXPECT_LE(std::abs(decoded.z - positions[i].z), step.z * 0.5f + 1e-4f);
+		EXPECT_EQ(quantized[i * 4 + 3], 65535u);
+	}
+}
+
+TEST(VertexQuantizerTest, normals)
+{
+	auto normals = make_unit_vectors(20000, 11);
+
+	std::vector<int16_t> quantized{};
+	ror::quantize_normals(quantized, {reinterpret_cast<const uint8_t *>(normals.data()), sizeof(ror::Vector3f), sizeof(ror::Vector3f)}, static_cast<uint32_t>(normals.size()));
+
+	ASSERT_EQ(quantized.size(), normals.size() * 2);
+
+	float32_t worst{0.0f};
+	for (size_t i = 0; i < normals.size(); ++i)
+	{
+		auto decoded = ror::dequantize_normal(&quantized[i * 2]);
+
+		EXPECT_NEAR(decoded.length(), 1.0f, 1e-5f);
+		worst = std::max(worst, angle_degrees(decoded, normals[i]));
+	}
+
+	// 16 bit octahedral stays within a few hundredths of a degree
+	EXPECT_LT(worst, 0.05f);
+}
+
+TEST(VertexQuantizerTest, tangents)
+{
+	auto directions = make_unit_vectors(5000, 13);
+
+	std::vector<ror::Vector4f> tangents{};
+	for (size_t i = 0; i < directions.size(); ++i)
+		tangents.push_back({directions[i].x, directions[i].y, directions[i].z, i % 3 ? 1.0f : -1.0f});
+
+	std::vector<int16_t> quantized{};
+	ror::quantize_tangents(quantized, {reinterpret_cast<const uint8_t *>(tangents.data()), sizeof(ror::Vector4f), sizeof(ror::Vector4f)}, static_cast<uint32_t>(tangents.size()));
+
+	ASSERT_EQ(quantized.size(), tangents.size() * 4);
+
+	for (size_t i = 0; i < tangents.size(); ++i)
+	{
+		auto decoded = ror::dequantize_tangent(&quantized[i * 4]);
+
+		EXPECT_LT(angle_degrees({decoded.x, decoded.y, decoded.z}, directions[i]), 0.05f);
+		EXPECT_EQ(decoded.w, tangents[i].w);
+	}
+}
+
+TEST(VertexQuantizerTest, texture_coordinates)
+{
+	std::mt19937                              generator{17};
+	std::uniform_real_distribution<float32_t> distribution{-4.0f, 4.0f};
+
+	std::vector<ror::Vector2f> uvs{{0.0f, 1.0f}, {0.5f, 0.25f}};
+	for (uint32_t i = 0; i < 10000; ++i)
+		uvs.push_back({distribution(generator), distribution(generator)});
+
+	std::vector<uint16_t> quantized{};
+	ror::quantize_texture_coordinates(quantized, {reinterpret_cast<const uint8_t *>(uvs.data()), sizeof(ror::Vector2f), sizeof(ror::Vector2f)}, static_cast<uint32_t>(uvs.size()));
+
+	ASSERT_EQ(quantized.size(), uvs.size() * 2);
+
+	for (size_t i = 0; i < uvs.size(); ++i)
+	{
+		auto decoded = ror::dequantize_texture_coordinate(&quantized[i * 2]);
+
+		// Half floats have 11 significant bits, rounding is off by at most half of the last one
+		for (int32_t c = 0; c < 2; ++c)
+			EXPECT_LE(std::abs(decoded[c] - uvs[i][c]), std::max(std::abs(uvs[i][c]) * std::ldexp(1.0f, -11), std::ldexp(1.0f, -25)));
+	}
+
+	// Within a 0 to 1 texture that's well below a texel of a 2048 texture
+	EXPECT_LE(std::abs(ror::dequantize_texture_coordinate(&quantized[2])[0] - 0.5f), 1.0f / 4096.0f);
+}
+
+TEST(VertexQuantizerTest, weights)
+{
+	std::mt19937                              generator{19};
+	std::uniform_real_distribution<float32_t> distribution{0.0f, 1.0f};
+
+	std::vector<ror::Vector4f> weights{{1.0f, 0.0f, 0.0f, 0.0f}, {0.25f, 0.25f, 0.25f, 0.25f}, {1.0f / 3.0f, 1.0f / 3.0f, 1.0f / 3.0f, 0.0f}};
+	for (uint32_t i = 0; i < 10000; ++i)
+	{
+		ror::Vector4f w{distribution(generator), distribution(generator), i % 2 ? distribution(generator) : 0.0f, i % 4 ? distribution(generator) : 0.0f};
+		weights.push_back(w / (w.x + w.y + w.z + w.w));
+	}
+
+	std::vector<uint16_t> weights_unorm16{};
+	for (auto &w : weights)
+		for (int32_t c = 0; c < 4; ++c)
+			weights_unorm16.push_back(static_cast<uint16_t>(std::lround(w[c] * 65535.0f)));
+
+	std::vector<uint8_t> quantized{}, quantized_unorm16{};
+	ror::quantize_weights(quantized, {reinterpret_cast<const uint8_t *>(weights.data()), sizeof(ror::Vector4f), sizeof(ror::Vector4f)}, static_cast<uint32_t>(weights.size()));
+	ror::quantize_weights(quantized_unorm16, {reinterpret_cast<const uint8_t *>(weights_unorm16.data()), sizeof(uint16_t) * 4, sizeof(uint16_t) * 4}, static_cast<uint32_t>(weights.size()));
+
+	ASSERT_EQ(quantized.size(), weights.size() * 4);
+	ASSERT_EQ(quantized_unorm16.size(), weights.size() * 4);
+
+	for (size_t i = 0; i < weights.size(); ++i)
+	{
+		auto decoded = ror::dequantize_weights(&quantized[i * 4]);
+
+		EXPECT_EQ(quantized[i * 4] + quantized[i * 4 + 1] + quantized[i * 4 + 2] + quantized[i * 4 + 3], 255);
+		EXPECT_EQ(quantized_unorm16[i * 4] + quantized_unorm16[i * 4 + 1] + quantized_unorm16[i * 4 + 2] + quantized_unorm16[i * 4 + 3], 255);
+
+		for (int32_t c = 0; c < 4; ++c)
+		{
+			EXPECT_LT(std::abs(decoded[c] - weights[i][c]), 1.0f / 255.0f);
+			if (weights[i][c] == 0.0f)
+			{
+				EXPECT_EQ(decoded[c], 0.0f);        // Influences that aren't there don't appear
+			}
+		}
+	}
+}
+
+}        // namespace ror_test
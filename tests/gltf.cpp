@@ -8,6 +8,9 @@
 #include "foundation/rorjobsystem.hpp"
 #include "foundation/rormacros.hpp"
 #include "foundation/rortypes.hpp"
+#include "geometry/rormesh_optimizer.hpp"
+#include "geometry/rormesh_simplifier.hpp"
+#include "graphics/roranimation.hpp"
 #include "graphics/rorlight.hpp"
 #include "graphics/rormaterial.hpp"
 #include "graphics/rormesh.hpp"
@@ -16,23 +19,30 @@
 #include "math/rorvector3.hpp"
 #include "profiling/rorlog.hpp"
 #include "profiling/rortimer.hpp"
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <filesystem>
 #include <gtest/gtest-death-test.h>
 #include <gtest/gtest.h>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <ostream>
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "couldron_0.hpp"
 #include "fox.h"
 #include "graphics/rormodel.hpp"
 #include "renderer/rorrenderer.hpp"
+#include "resources/rorresource.hpp"
 #include "rhi/rorbuffer.hpp"
 #include "rhi/rorbuffer_allocator.hpp"
 #include "rhi/rorbuffers_pack.hpp"
@@ -40,6 +50,7 @@
 #include "rhi/rortypes.hpp"
 #include "rhi/rorvertex_attribute.hpp"
 #include "rhi/rorvertex_description.hpp"
+#include "settings/rorsettings.hpp"
 #include "shader_system/rorshader_system.hpp"
 
 #include "gltf.hpp"
@@ -207,7 +218,13 @@ TEST_F(GLTFTest, couldron0_gltf_loader_test)
 	std::vector<ror::OrbitCamera> couldron0_cameras;
 	std::vector<ror::Light>       couldron0_lights;
 
+	// Reference data below is as authored, mesh optimizer would weld and reorder it
+	auto &setting         = ror::settings();
+	auto  optimize_meshes = setting.m_optimize_meshes;
+
+	setting.m_optimize_meshes = false;
 	this->couldron0_model->load_from_gltf_file("baba_yagas_hut/scene.gltf", couldron0_cameras, couldron0_lights, true, *this->bp);
+	setting.m_optimize_meshes = optimize_meshes;
 
 	EXPECT_EQ(couldron0_cameras.size(), 0);
 
@@ -257,6 +274,698 @@ TEST_F(GLTFTest, couldron0_gltf_loader_test)
 	compare_attribute_values<float32_t>(tvd[2], rhi::BufferSemantic::vertex_tangent, rhi::VertexFormat::float32_3, 3, couldron0_target_TANGENT2, couldron0_attrib_count, this->bp, __LINE__);
 }
 
+// Compares every attribute of a cold loaded vertex descriptor with its cooked warm loaded counterpart byte by byte
+static void compare_cooked_descriptors(const rhi::VertexDescriptor &a_cold, const rhi::VertexDescriptor &a_warm, rhi::BuffersPack *a_bp)
+{
+	auto &cold_attributes = a_cold.attributes();
+	auto &warm_attributes = a_warm.attributes();
+
+	ASSERT_EQ(cold_attributes.size(), warm_attributes.size());
+
+	for (size_t i = 0; i < cold_attributes.size(); ++i)
+	{
+		auto &cold = cold_attributes[i];
+		auto &warm = warm_attributes[i];
+
+		EXPECT_EQ(cold.semantics(), warm.semantics());
+		EXPECT_EQ(cold.format(), warm.format());
+		EXPECT_EQ(cold.count(), warm.count());
+		EXPECT_EQ(cold.location(), warm.location());
+
+		auto          &buffer      = a_bp->buffer(cold.semantics());
+		auto           cold_stride = a_cold.layout(cold.semantics()).stride();
+		auto           warm_stride = a_warm.layout(warm.semantics()).stride();
+		auto           size        = rhi::vertex_format_to_bytes(cold.format());
+		const uint8_t *cold_data   = buffer.data().data() + cold.buffer_offset() + cold.offset();
+		const uint8_t *warm_data   = buffer.data().data() + warm.buffer_offset() + warm.offset();
+
+		uint32_t mismatches = 0;
+		for (size_t j = 0; j < cold.count(); ++j)
+			if (std::memcmp(cold_data + j * cold_stride, warm_data + j * warm_stride, size) != 0)
+				++mismatches;
+
+		EXPECT_EQ(mismatches, 0);
+	}
+}
+
+static void compare_cooked_models(ror::Model &a_cold, ror::Model &a_warm, rhi::BuffersPack *a_bp)
+{
+	ASSERT_EQ(a_cold.meshes().size(), a_warm.meshes().size());
+	for (size_t i = 0; i < a_cold.meshes().size(); ++i)
+	{
+		auto &cold = a_cold.meshes()[i];
+		auto &warm = a_warm.meshes()[i];
+
+		ASSERT_EQ(cold.primitives_count(), warm.primitives_count());
+		for (size_t j = 0; j < cold.primitives_count(); ++j)
+		{
+			EXPECT_EQ(cold.has_indices(j), warm.has_indices(j));
+			EXPECT_EQ(cold.material(j), warm.material(j));
+			EXPECT_EQ(cold.vertex_hash(j), warm.vertex_hash(j));
+			EXPECT_EQ(cold.fragment_hash(j), warm.fragment_hash(j));
+
+			compare_cooked_descriptors(cold.vertex_descriptor(j), warm.vertex_descriptor(j), a_bp);
+
+			ASSERT_EQ(cold.target_descriptor(j).size(), warm.target_descriptor(j).size());
+			for (size_t k = 0; k < cold.target_descriptor(j).size(); ++k)
+				compare_cooked_descriptors(cold.target_descriptor(j)[k], warm.target_descriptor(j)[k], a_bp);
+		}
+	}
+
+	ASSERT_EQ(a_cold.skins().size(), a_warm.skins().size());
+	for (size_t i = 0; i < a_cold.skins().size(); ++i)
+	{
+		auto &cold = a_cold.skins()[i].inverse_bind_matrices();
+		auto &warm = a_warm.skins()[i].inverse_bind_matrices();
+
+		ASSERT_EQ(cold.size(), warm.size());
+		EXPECT_EQ(std::memcmp(cold.data(), warm.data(), cold.size() * sizeof(ror::Matrix4f)), 0);
+		EXPECT_EQ(a_cold.skins()[i].joints(), a_warm.skins()[i].joints());
+	}
+
+	ASSERT_EQ(a_cold.animations().size(), a_warm.animations().size());
+	for (size_t i = 0; i < a_cold.animations().size(); ++i)
+	{
+		auto &cold = a_cold.animations()[i];
+		auto &warm = a_warm.animations()[i];
+
+		ASSERT_EQ(cold.m_samplers.size(), warm.m_samplers.size());
+		for (size_t j = 0; j < cold.m_samplers.size(); ++j)
+		{
+			auto &cold_sampler = cold.m_samplers[j];
+			auto &warm_sampler = warm.m_samplers[j];
+
+			EXPECT_EQ(cold_sampler.m_output_format, warm_sampler.m_output_format);
+			ASSERT_EQ(cold_sampler.m_input.size(), warm_sampler.m_input.size());
+			ASSERT_EQ(cold_sampler.m_output.size(), warm_sampler.m_output.size());
+			EXPECT_EQ(std::memcmp(cold_sampler.m_input.data(), warm_sampler.m_input.data(), cold_sampler.m_input.size() * sizeof(ror::Animation::AnimationInput)), 0);
+			EXPECT_EQ(std::memcmp(cold_sampler.m_output.data(), warm_sampler.m_output.data(), cold_sampler.m_output.size()), 0);
+		}
+	}
+}
+
+TEST_F(GLTFTest, cooked_model_round_trip_test)
+{
+	auto &setting    = ror::settings();
+	auto  cook_model = setting.m_cook_models;
+
+	setting.m_cook_models = true;
+
+	// Make sure the first load of each model is cold and cooks it, while the second one is warm
+	auto            cooked_models_path = ror::get_cache_path() / "models";
+	std::error_code error;
+	std::filesystem::remove_all(cooked_models_path, error);
+
+	for (const char *path : {"Fox/Fox.gltf", "baba_yagas_hut/scene.gltf"})
+	{
+		std::vector<ror::OrbitCamera> cameras;
+		std::vector<ror::Light>       lights;
+
+		ror::Model cold_model;
+		cold_model.load_from_gltf_file(path, cameras, lights, true, *this->bp);
+
+		ror::Model warm_model;
+		warm_model.load_from_gltf_file(path, cameras, lights, true, *this->bp);
+
+		compare_cooked_models(cold_model, warm_model, this->bp);
+	}
+
+	auto blobs = std::distance(std::filesystem::directory_iterator{cooked_models_path, error}, std::filesystem::directory_iterator{});
+	EXPECT_EQ(blobs, 2);
+
+	setting.m_cook_models = cook_model;
+}
+
+// Offset of every attribute from where the model starts in its buffer, two loads only match if they allocated in the same order
+static std::vector<size_t> relative_buffer_offsets(ror::Model &a_model)
+{
+	std::vector<const rhi::VertexAttribute *> attributes;
+	for (auto &mesh : a_model.meshes())
+	{
+		for (size_t j = 0; j < mesh.primitives_count(); ++j)
+		{
+			for (auto &attribute : mesh.vertex_descriptor(j).attributes())
+				attributes.emplace_back(&attribute);
+
+			for (auto &target : mesh.target_descriptor(j))
+				for (auto &attribute : target.attributes())
+					attributes.emplace_back(&attribute);
+		}
+	}
+
+	std::unordered_map<size_t, size_t> buffer_starts;
+	for (auto *attribute : attributes)
+	{
+		auto [start, inserted] = buffer_starts.emplace(attribute->buffer_index(), attribute->buffer_offset());
+		start->second          = std::min(start->second, attribute->buffer_offset());
+	}
+
+	std::vector<size_t> offsets;
+	offsets.reserve(attributes.size());
+	for (auto *attribute : attributes)
+		offsets.emplace_back(attribute->buffer_offset() - buffer_starts[attribute->buffer_index()]);
+
+	return offsets;
+}
+
+TEST_F(GLTFTest, parallel_decode_matches_serial_test)
+{
+	auto &setting         = ror::settings();
+	auto  cook_model      = setting.m_cook_models;
+	auto  parallel_decode = setting.m_parallel_model_decode;
+
+	setting.m_cook_models = false;        // Both loads have to decode the glTF buffers
+
+	for (const char *path : {"Fox/Fox.gltf", "baba_yagas_hut/scene.gltf"})
+	{
+		std::vector<ror::OrbitCamera> cameras;
+		std::vector<ror::Light>       lights;
+
+		setting.m_parallel_model_decode = false;
+		ror::Model serial_model;
+		serial_model.load_from_gltf_file(path, cameras, lights, true, *this->bp);
+
+		setting.m_parallel_model_decode = true;
+		ror::Model parallel_model;
+		parallel_model.load_from_gltf_file(path, cameras, lights, true, *this->bp);
+
+		compare_cooked_models(serial_model, parallel_model, this->bp);
+		EXPECT_EQ(relative_buffer_offsets(serial_model), relative_buffer_offsets(parallel_model));
+	}
+
+	setting.m_cook_models           = cook_model;
+	setting.m_parallel_model_decode = parallel_decode;
+}
+
+TEST_F(GLTFTest, DISABLED_parallel_decode_performance)
+{
+	const uint32_t loads_count = 3;
+
+	auto &setting         = ror::settings();
+	auto  cook_model      = setting.m_cook_models;
+	auto  parallel_decode = setting.m_parallel_model_decode;
+
+	setting.m_cook_models = false;
+
+	std::vector<ror::OrbitCamera> cameras;
+	std::vector<ror::Light>       lights;
+	ror::Timer                    timer;
+	uint64_t                      load_times[2]{};
+
+	for (bool parallel : {false, true})
+	{
+		setting.m_parallel_model_decode = parallel;
+
+		for (uint32_t i = 0; i < loads_count; ++i)
+		{
+			ror::Model model;
+
+			timer.tick();
+			model.load_from_gltf_file("baba_yagas_hut/scene.gltf", cameras, lights, false, *this->bp);
+			load_times[parallel] += timer.tick();
+		}
+	}
+
+	std::cout << "glTF load serial decode: " << static_cast<double64_t>(load_times[0]) / loads_count / 1000000.0 << " ms, "
+	          << "parallel decode: " << static_cast<double64_t>(load_times[1]) / loads_count / 1000000.0 << " ms" << std::endl;
+
+	setting.m_cook_models           = cook_model;
+	setting.m_parallel_model_decode = parallel_decode;
+}
+
+// Indices of a primitive read back from the buffers pack, uint16_t or uint32_t
+static std::vector<uint32_t> read_indices(const rhi::VertexDescriptor &a_vd, rhi::BuffersPack *a_bp, size_t a_first, size_t a_count)
+{
+	auto          &attrib = a_vd.attribute(rhi::BufferSemantic::vertex_index);
+	auto          &buffer = a_bp->buffer(rhi::BufferSemantic::vertex_index);
+	auto           stride = a_vd.layout(rhi::BufferSemantic::vertex_index).stride();
+	const uint8_t *data   = buffer.data().data() + attrib.buffer_offset() + attrib.offset() + a_first * stride;
+
+	std::vector<uint32_t> indices(a_count);
+	for (size_t i = 0; i < indices.size(); ++i)
+	{
+		if (attrib.format() == rhi::VertexFormat::uint16_1)
+			indices[i] = *reinterpret_cast<const uint16_t *>(data + i * stride);
+		else
+			indices[i] = *reinterpret_cast<const uint32_t *>(data + i * stride);
+	}
+
+	return indices;
+}
+
+static std::vector<uint32_t> read_indices(const rhi::VertexDescriptor &a_vd, rhi::BuffersPack *a_bp)
+{
+	return read_indices(a_vd, a_bp, 0, a_vd.attribute(rhi::BufferSemantic::vertex_index).count());
+}
+
+// Indices of one level of detail, these follow the full detail indices in the same index buffer
+static std::vector<uint32_t> read_indices(const rhi::VertexDescriptor &a_vd, rhi::BuffersPack *a_bp, const ror::MeshLod &a_lod)
+{
+	return read_indices(a_vd, a_bp, a_lod.m_index_offset, a_lod.m_index_count);
+}
+
+// Float positions of a primitive read back from the buffers pack
+static std::vector<ror::Vector3f> read_positions(const rhi::VertexDescriptor &a_vd, rhi::BuffersPack *a_bp)
+{
+	auto          &attrib = a_vd.attribute(rhi::BufferSemantic::vertex_position);
+	auto          &buffer = a_bp->buffer(rhi::BufferSemantic::vertex_position);
+	auto           stride = a_vd.layout(rhi::BufferSemantic::vertex_position).stride();
+	const uint8_t *data   = buffer.data().data() + attrib.buffer_offset() + attrib.offset();
+
+	std::vector<ror::Vector3f> positions(attrib.count());
+	for (size_t i = 0; i < positions.size(); ++i)
+		std::memcpy(&positions[i].x, data + i * stride, sizeof(float32_t) * 3);
+
+	return positions;
+}
+
+// Triangles as positions, rotated to start at the smallest vertex and sorted so the same triangles with any indices and order compare equal
+static std::vector<std::array<float32_t, 9>> triangle_positions(const rhi::VertexDescriptor &a_vd, const std::vector<uint32_t> &a_indices, rhi::BuffersPack *a_bp)
+{
+	auto          &attrib = a_vd.attribute(rhi::BufferSemantic::vertex_position);
+	auto          &buffer = a_bp->buffer(rhi::BufferSemantic::vertex_position);
+	auto           stride = a_vd.layout(rhi::BufferSemantic::vertex_position).stride();
+	const uint8_t *data   = buffer.data().data() + attrib.buffer_offset() + attrib.offset();
+
+	std::vector<std::array<float32_t, 9>> triangles(a_indices.size() / 3);
+	for (size_t i = 0; i < triangles.size(); ++i)
+	{
+		std::array<std::array<float32_t, 3>, 3> corners{};
+		for (size_t j = 0; j < 3; ++j)
+			std::memcpy(corners[j].data(), data + a_indices[i * 3 + j] * stride, sizeof(float32_t) * 3);
+
+		std::rotate(corners.begin(), std::min_element(corners.begin(), corners.end()), corners.end());
+
+		for (size_t j = 0; j < 3; ++j)
+			std::copy(corners[j].begin(), corners[j].end(), triangles[i].begin() + static_cast<std::ptrdiff_t>(j * 3));
+	}
+
+	std::sort(triangles.begin(), triangles.end());
+
+	return triangles;
+}
+
+TEST_F(GLTFTest, mesh_optimizer_improves_vertex_cache_test)
+{
+	auto &setting         = ror::settings();
+	auto  cook_model      = setting.m_cook_models;
+	auto  optimize_meshes = setting.m_optimize_meshes;
+
+	setting.m_cook_models = false;
+
+	std::vector<ror::OrbitCamera> cameras;
+	std::vector<ror::Light>       lights;
+
+	setting.m_optimize_meshes = false;
+	ror::Model authored_model;
+	authored_model.load_from_gltf_file("baba_yagas_hut/scene.gltf", cameras, lights, false, *this->bp);
+
+	setting.m_optimize_meshes = true;
+	ror::Model optimized_model;
+	optimized_model.load_from_gltf_file("baba_yagas_hut/scene.gltf", cameras, lights, false, *this->bp);
+
+	ASSERT_EQ(authored_model.meshes().size(), optimized_model.meshes().size());
+
+	uint64_t authored_transformed{0}, optimized_transformed{0}, authored_vertices{0}, optimized_vertices{0}, triangles_count{0};
+	for (size_t i = 0; i < authored_model.meshes().size(); ++i)
+	{
+		auto &authored  = authored_model.meshes()[i];
+		auto &optimized = optimized_model.meshes()[i];
+
+		ASSERT_EQ(authored.primitives_count(), optimized.primitives_count());
+		for (size_t j = 0; j < authored.primitives_count(); ++j)
+		{
+			if (!authored.has_indices(j))
+				continue;
+
+			auto &authored_vd  = authored.vertex_descriptor(j);
+			auto &optimized_vd = optimized.vertex_descriptor(j);
+
+			auto authored_indices  = read_indices(authored_vd, this->bp);
+			auto optimized_indices = read_indices(optimized_vd, this->bp);
+
+			ASSERT_EQ(authored_indices.size(), optimized_indices.size());
+			EXPECT_LE(optimized_vd.attribute(rhi::BufferSemantic::vertex_position).count(), authored_vd.attribute(rhi::BufferSemantic::vertex_position).count());
+			EXPECT_TRUE(triangle_positions(authored_vd, authored_indices, this->bp) == triangle_positions(optimized_vd, optimized_indices, this->bp));
+
+			auto authored_vertex_count  = authored_vd.attribute(rhi::BufferSemantic::vertex_position).count();
+			auto optimized_vertex_count = optimized_vd.attribute(rhi::BufferSemantic::vertex_position).count();
+			auto authored_stats         = ror::analyze_vertex_cache(authored_indices, static_cast<uint32_t>(authored_vertex_count));
+			auto optimized_stats        = ror::analyze_vertex_cache(optimized_indices, static_cast<uint32_t>(optimized_vertex_count));
+
+			authored_transformed += authored_stats.m_vertices_transformed;
+			optimized_transformed += optimized_stats.m_vertices_transformed;
+			authored_vertices += authored_vertex_count;
+			optimized_vertices += optimized_vertex_count;
+			triangles_count += authored_indices.size() / 3;
+		}
+	}
+
+	ASSERT_GT(triangles_count, 0);
+	EXPECT_LT(optimized_transformed, authored_transformed);
+
+	auto acmr = [triangles_count](uint64_t a_transformed) { return static_cast<double64_t>(a_transformed) / static_cast<double64_t>(triangles_count); };
+	auto atvr = [](uint64_t a_transformed, uint64_t a_vertices) { return static_cast<double64_t>(a_transformed) / static_cast<double64_t>(a_vertices); };
+
+	std::cout << "ACMR authored: " << acmr(authored_transformed) << ", optimized: " << acmr(optimized_transformed)
+	          << ", ATVR authored: " << atvr(authored_transformed, authored_vertices) << ", optimized: " << atvr(optimized_transformed, optimized_vertices) << std::endl;
+
+	setting.m_cook_models     = cook_model;
+	setting.m_optimize_meshes = optimize_meshes;
+}
+
+// Distance from a_point to the closest point on triangle a_a, a_b, a_c, from "Real-Time Collision Detection" by Christer Ericson
+static float32_t point_triangle_distance(const ror::Vector3f &a_point, const ror::Vector3f &a_a, const ror::Vector3f &a_b, const ror::Vector3f &a_c)
+{
+	auto ab = a_b - a_a;
+	auto ac = a_c - a_a;
+	auto ap = a_point - a_a;
+
+	auto d1 = ab.dot_product(ap);
+	auto d2 = ac.dot_product(ap);
+	if (d1 <= 0.0f && d2 <= 0.0f)
+		return ap.length();
+
+	auto bp = a_point - a_b;
+	auto d3 = ab.dot_product(bp);
+	auto d4 = ac.dot_product(bp);
+	if (d3 >= 0.0f && d4 <= d3)
+		return bp.length();
+
+	auto vc = d1 * d4 - d3 * d2;
+	if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+		return (a_point - (a_a + ab * (d1 / (d1 - d3)))).length();
+
+	auto cp = a_point - a_c;
+	auto d5 = ab.dot_product(cp);
+	auto d6 = ac.dot_product(cp);
+	if (d6 >= 0.0f && d5 <= d6)
+		return cp.length();
+
+	auto vb = d5 * d2 - d1 * d6;
+	if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+		return (a_point - (a_a + ac * (d2 / (d2 - d6)))).length();
+
+	auto va = d3 * d6 - d5 * d4;
+	if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
+		return (a_point - (a_b + (a_c - a_b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6))))).length();
+
+	auto denominator = 1.0f / (va + vb + vc);
+	return (a_point - (a_a + ab * (vb * denominator) + ac * (vc * denominator))).length();
+}
+
+// One sided Hausdorff distance from the vertices a_reference uses to the surface of a_indices, every a_step'th index is checked
+static float32_t hausdorff_distance(const std::vector<ror::Vector3f> &a_positions, const std::vector<uint32_t> &a_reference, const std::vector<uint32_t> &a_indices, size_t a_step = 1)
+{
+	float32_t distance = 0.0f;
+	for (size_t i = 0; i < a_reference.size(); i += a_step)
+	{
+		auto &point   = a_positions[a_reference[i]];
+		auto  closest = std::numeric_limits<float32_t>::max();
+
+		for (size_t j = 0; j < a_indices.size(); j += 3)
+			closest = std::min(closest, point_triangle_distance(point, a_positions[a_indices[j]], a_positions[a_indices[j + 1]], a_positions[a_indices[j + 2]]));
+
+		distance = std::max(distance, closest);
+	}
+
+	return distance;
+}
+
+static float32_t largest_extent(const std::vector<ror::Vector3f> &a_positions)
+{
+	ror::BoundingBoxf box{};
+	for (auto &position : a_positions)
+		box.add_point(position);
+
+	return box.extent().maximum();
+}
+
+TEST_F(GLTFTest, fox_lods_test)
+{
+	// Fox isn't indexed so the loader doesn't optimise or simplify it, weld it here and simplify it directly
+	std::vector<uint32_t> indices(fox_attrib_count);
+	for (uint32_t i = 0; i < fox_attrib_count; ++i)
+		indices[i] = i;
+
+	ror::VertexStream     stream{reinterpret_cast<const uint8_t *>(fox_positions), sizeof(float32_t) * 3, sizeof(float32_t) * 3};
+	std::vector<uint32_t> remap{};
+	auto                  vertex_count = ror::generate_vertex_remap(remap, indices, fox_attrib_count, {stream});
+
+	std::vector<ror::Vector3f> positions(vertex_count);
+	ror::remap_vertices(reinterpret_cast<uint8_t *>(positions.data()), stream, remap);
+	ror::remap_indices(indices, remap);
+
+	auto max_error = largest_extent(positions) * 0.05f;
+	auto lods      = ror::generate_lods(indices, &positions[0].x, sizeof(ror::Vector3f), vertex_count, 5, 0.5f, max_error);
+
+	ASSERT_GE(lods.size(), 3u);
+
+	for (size_t level = 1; level < lods.size(); ++level)
+	{
+		auto &lod       = lods[level];
+		auto  reduction = static_cast<float32_t>(lod.m_indices.size()) / static_cast<float32_t>(indices.size());
+		auto  hausdorff = hausdorff_distance(positions, indices, lod.m_indices);
+
+		EXPECT_LE(lod.m_indices.size() * 10, lods[level - 1].m_indices.size() * 9);
+		EXPECT_GE(lod.m_error, lods[level - 1].m_error);
+		EXPECT_LE(lod.m_error, max_error);
+		EXPECT_LE(hausdorff, max_error * 2.0f);
+
+		std::cout << "Fox LOD " << level << " triangles: " << lod.m_indices.size() / 3 << ", reduction: " << reduction << ", error: " << lod.m_error << ", Hausdorff: " << hausdorff << std::endl;
+	}
+}
+
+TEST_F(GLTFTest, baba_yagas_hut_lods_test)
+{
+	auto &setting         = ror::settings();
+	auto  cook_model      = setting.m_cook_models;
+	auto  optimize_meshes = setting.m_optimize_meshes;
+	auto  generate_lods   = setting.m_generate_lods;
+
+	setting.m_cook_models     = false;
+	setting.m_optimize_meshes = true;
+	setting.m_generate_lods   = true;
+
+	std::vector<ror::OrbitCamera> cameras;
+	std::vector<ror::Light>       lights;
+
+	ror::Model model;
+	model.load_from_gltf_file("baba_yagas_hut/scene.gltf", cameras, lights, false, *this->bp);
+
+	uint64_t  full_triangles{0}, coarsest_triangles{0}, primitives_simplified{0};
+	float32_t worst_hausdorff_ratio{0.0f};
+
+	for (auto &mesh : model.meshes())
+	{
+		for (size_t j = 0; j < mesh.primitives_count(); ++j)
+		{
+			if (!mesh.has_indices(j))
+				continue;
+
+			auto &lods = mesh.lods(j);
+			auto &vd   = mesh.vertex_descriptor(j);
+
+			ASSERT_FALSE(lods.empty());
+			EXPECT_EQ(lods[0].m_index_offset, 0u);
+			EXPECT_EQ(lods[0].m_error, 0.0f);
+			EXPECT_EQ(vd.attribute(rhi::BufferSemantic::vertex_index).count(), lods[0].m_index_count);
+
+			auto positions = read_positions(vd, this->bp);
+			auto full      = read_indices(vd, this->bp, lods[0]);
+			auto max_error = largest_extent(positions) * 0.05f;
+
+			full_triangles += full.size() / 3;
+			coarsest_triangles += lods.back().m_index_count / 3;
+
+			if (lods.size() > 1)
+				primitives_simplified++;
+
+			for (size_t level = 1; level < lods.size(); ++level)
+			{
+				auto &lod     = lods[level];
+				auto  indices = read_indices(vd, this->bp, lod);
+
+				EXPECT_EQ(lod.m_index_offset, lods[level - 1].m_index_offset + lods[level - 1].m_index_count);
+				EXPECT_LE(lod.m_index_count * 10, lods[level - 1].m_index_count * 9);
+				EXPECT_GE(lod.m_error, lods[level - 1].m_error);
+				EXPECT_LE(lod.m_error, max_error * 1.001f);
+
+				// Big primitives are sampled, every vertex against every triangle would take too long
+				auto hausdorff = hausdorff_distance(positions, full, indices, std::max<size_t>(full.size() / 512, 1));
+				EXPECT_LE(hausdorff, max_error * 2.0f);
+
+				if (max_error > 0.0f)
+					worst_hausdorff_ratio = std::max(worst_hausdorff_ratio, hausdorff / max_error);
+			}
+		}
+	}
+
+	ASSERT_GT(full_triangles, 0);
+	EXPECT_GT(primitives_simplified, 0);
+	EXPECT_LT(coarsest_triangles * 10, full_triangles * 9);
+
+	std::cout << "baba_yagas_hut triangles: " << full_triangles << ", coarsest LODs: " << coarsest_triangles << ", reduction: " << static_cast<double64_t>(coarsest_triangles) / static_cast<double64_t>(full_triangles)
+	          << ", primitives simplified: " << primitives_simplified << ", worst Hausdorff / max error: " << worst_hausdorff_ratio << std::endl;
+
+	setting.m_cook_models     = cook_model;
+	setting.m_optimize_meshes = optimize_meshes;
+	setting.m_generate_lods   = generate_lods;
+}
+
+// Reference slerp in double precision, taking the shortest path as required by glTF
+static void reference_slerp(const float32_t *a_from, const float32_t *a_to, double a_t, double *a_output)
+{
+	double dot = 0.0;
+	for (size_t i = 0; i < 4; ++i)
+		dot += static_cast<double>(a_from[i]) * static_cast<double>(a_to[i]);
+
+	double sign = dot < 0.0 ? -1.0 : 1.0;
+	dot         = std::abs(dot);
+
+	double from_scale = 1.0 - a_t;
+	double to_scale   = a_t;
+
+	if (dot < 0.9999)
+	{
+		double angle = std::acos(dot);
+		from_scale   = std::sin(angle * (1.0 - a_t)) / std::sin(angle);
+		to_scale     = std::sin(angle * a_t) / std::sin(angle);
+	}
+
+	double length = 0.0;
+	for (size_t i = 0; i < 4; ++i)
+	{
+		a_output[i] = from_scale * static_cast<double>(a_from[i]) + sign * to_scale * static_cast<double>(a_to[i]);
+		length += a_output[i] * a_output[i];
+	}
+
+	for (size_t i = 0; i < 4; ++i)
+		a_output[i] /= std::sqrt(length);
+}
+
+TEST_F(GLTFTest, fox_animation_sampler_test)
+{
+	std::vector<ror::OrbitCamera> cameras;
+	std::vector<ror::Light>       lights;
+
+	ror::Model model;
+	model.load_from_gltf_file("Fox/Fox.gltf", cameras, lights, true, *this->bp);
+
+	ASSERT_EQ(model.animations().size(), 3);
+
+	auto &animation = model.animations()[0];
+	auto &channel   = animation.m_channels[0];
+	auto &sampler   = animation.m_samplers[channel.m_sampler_index];
+
+	ASSERT_EQ(channel.m_target_node_path, ror::AnimationTarget::rotation);
+	ASSERT_EQ(sampler.m_interpolation, ror::AnimationInterpolation::linear);
+	ASSERT_EQ(sampler.m_input.size(), fox_sampler0_count);
+	EXPECT_EQ(ror::animation_sampler_components(sampler), 4u);
+
+	const float epsilon = 0.0001f;
+
+	// Exactly at keyframes sampled rotations are the keyframe values
+	uint32_t cursor = 0;
+	for (uint32_t key = 0; key < fox_sampler0_count; ++key)
+	{
+		float32_t rotation[4];
+		ror::animation_sample(sampler, channel.m_target_node_path, fox_sampler0_input[key], cursor, rotation);
+		EXPECT_EQ(cursor, std::min(key, fox_sampler0_count - 2));
+
+		float32_t sign = (rotation[0] * fox_sampler0_output[key * 4] + rotation[1] * fox_sampler0_output[key * 4 + 1] +
+		                  rotation[2] * fox_sampler0_output[key * 4 + 2] + rotation[3] * fox_sampler0_output[key * 4 + 3]) < 0.0f ?
+		                     -1.0f :
+		                     1.0f;
+
+		for (uint32_t i = 0; i < 4; ++i)
+			EXPECT_NEAR(sign * rotation[i], fox_sampler0_output[key * 4 + i], epsilon);
+	}
+
+	// In between keyframes they are slerped, sampled backwards so the cursor hint is always wrong and binary search is used
+	for (uint32_t key = fox_sampler0_count - 1; key-- > 0;)
+	{
+		for (double fraction : {0.25, 0.5, 0.75})
+		{
+			auto time = static_cast<float32_t>(fox_sampler0_input[key] + fraction * (fox_sampler0_input[key + 1] - fox_sampler0_input[key]));
+			auto t    = (time - fox_sampler0_input[key]) / (fox_sampler0_input[key + 1] - fox_sampler0_input[key]);
+
+			float32_t rotation[4];
+			double    reference[4];
+			ror::animation_sample(sampler, channel.m_target_node_path, time, cursor, rotation);
+			reference_slerp(&fox_sampler0_output[key * 4], &fox_sampler0_output[(key + 1) * 4], t, reference);
+
+			EXPECT_EQ(cursor, key);
+			for (uint32_t i = 0; i < 4; ++i)
+				EXPECT_NEAR(rotation[i], reference[i], epsilon);
+		}
+	}
+
+	// Monotonic playback with cached cursors gives the same result as searching from scratch
+	std::vector<uint32_t>        cursors;
+	std::vector<ror::Transformf> transforms(model.nodes().size());
+	std::vector<int32_t>         no_weights;
+	for (float32_t seconds = 0.0f; seconds < 10.0f; seconds += 1.0f / 60.0f)
+	{
+		auto time = ror::animation_time(animation, seconds);
+		EXPECT_GE(time, sampler.m_minimum.m_value);
+		EXPECT_LE(time, sampler.m_maximum.m_value);
+
+		for (size_t i = 0; i < transforms.size(); ++i)
+			transforms[i] = model.nodes()[i].m_trs_transform;
+
+		ror::animation_animate(animation, time, cursors, transforms, nullptr, no_weights);
+
+		uint32_t  fresh_cursor = 0;
+		float32_t rotation[4];
+		ror::animation_sample(sampler, channel.m_target_node_path, time, fresh_cursor, rotation);
+
+		auto &animated = transforms[channel.m_target_node_index].m_rotation;
+		EXPECT_EQ(animated.x, rotation[0]);
+		EXPECT_EQ(animated.y, rotation[1]);
+		EXPECT_EQ(animated.z, rotation[2]);
+		EXPECT_EQ(animated.w, rotation[3]);
+	}
+}
+
+TEST(AnimationSampler, step_and_cubicspline)
+{
+	ror::Animation::AnimationSampler sampler;
+
+	const float32_t step_output[]{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f};
+
+	sampler.m_interpolation = ror::AnimationInterpolation::step;
+	sampler.m_output_format = rhi::VertexFormat::float32_3;
+	sampler.m_input         = {{0.0f}, {1.0f}, {2.0f}};
+	sampler.m_output.resize(sizeof(step_output));
+	std::memcpy(sampler.m_output.data(), step_output, sizeof(step_output));
+
+	uint32_t  cursor = 0;
+	float32_t output[3];
+	for (auto [time, expected] : {std::pair{-1.0f, 1.0f}, {0.5f, 1.0f}, {1.0f, 4.0f}, {1.99f, 4.0f}, {2.0f, 7.0f}, {3.0f, 7.0f}})
+	{
+		ror::animation_sample(sampler, ror::AnimationTarget::translation, time, cursor, output);
+		EXPECT_EQ(output[0], expected);
+	}
+
+	// In-tangent, value and out-tangent per keyframe, tangents of 1 per second between 0 and 2 is a straight line
+	const float32_t cubic_output[]{0.0f, 0.0f, 1.0f, 1.0f, 2.0f, 0.0f};
+
+	sampler.m_interpolation = ror::AnimationInterpolation::cubicspline;
+	sampler.m_output_format = rhi::VertexFormat::float32_1;
+	sampler.m_input         = {{0.0f}, {2.0f}};
+	sampler.m_output.resize(sizeof(cubic_output));
+	std::memcpy(sampler.m_output.data(), cubic_output, sizeof(cubic_output));
+
+	EXPECT_EQ(ror::animation_sampler_components(sampler), 1u);
+
+	for (float32_t time = 0.0f; time <= 2.0f; time += 0.25f)
+	{
+		ror::animation_sample(sampler, ror::AnimationTarget::weight, time, cursor, output);
+		EXPECT_NEAR(output[0], time, 0.00001f);
+	}
+}
+
 TEST_F(GLTFTest, gltf_assert_test)
 {
 	// Since I can only call "free()" once on buffer_pack otherwise it asserts (a good thing)
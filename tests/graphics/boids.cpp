@@ -0,0 +1,155 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "foundation/rorjobsystem.hpp"
+#include "geometry/rorspatial_grid.hpp"
+#include "graphics/rorboids.hpp"
+#include "profiling/rortimer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <vector>
+
+namespace ror_test
+{
+TEST(BoidsTest, spatial_grid_matches_brute_force)
+{
+	const uint32_t  count  = 5000;
+	const float32_t radius = 1.5f;
+
+	// Reuse the boids random placement for points, a few clusters in a small box to get collisions and negative cells
+	ror::Boids boids{count, {-10.0f, -10.0f, -10.0f}, {10.0f, 10.0f, 10.0f}, 7u};
+
+	auto &x = boids.positions_x();
+	auto &y = boids.positions_y();
+	auto &z = boids.positions_z();
+
+	ror::SpatialGrid grid{radius};
+	grid.build(x.data(), y.data(), z.data(), count);
+	EXPECT_EQ(grid.size(), count);
+
+	for (uint32_t i = 0; i < count; i += 7)
+	{
+		ror::Vector3f point{x[i], y[i], z[i]};
+
+		std::vector<uint32_t> expected{};
+		for (uint32_t j = 0; j < count; ++j)
+		{
+			auto dx = x[j] - point.x, dy = y[j] - point.y, dz = z[j] - point.z;
+			if (dx * dx + dy * dy + dz * dz <= radius * radius)
+				expected.push_back(j);
+		}
+
+		std::vector<uint32_t> found{};
+		grid.query(point, radius, [&found](uint32_t a_index, const ror::Vector3f &, float32_t) { found.push_back(a_index); });
+		std::sort(found.begin(), found.end());
+
+		EXPECT_EQ(found, expected);
+	}
+}
+
+TEST(BoidsTest, deterministic_across_job_splits)
+{
+	const uint32_t  count = 20000;
+	const float32_t delta = 1.0f / 60.0f;
+
+	ror::Boids serial{count, {-20.0f, 0.0f, -20.0f}, {20.0f, 20.0f, 20.0f}, 3u};
+	ror::Boids parallel{count, {-20.0f, 0.0f, -20.0f}, {20.0f, 20.0f, 20.0f}, 3u};
+
+	ror::JobSystem js(ror::get_hardware_threads());
+
+	for (uint32_t i = 0; i < 10; ++i)
+	{
+		serial.update(delta);
+		parallel.update(js, delta);
+	}
+
+	// Bitwise equal, steering only reads the previous frame so the split of work can't change results
+	EXPECT_EQ(serial.positions_x(), parallel.positions_x());
+	EXPECT_EQ(serial.positions_y(), parallel.positions_y());
+	EXPECT_EQ(serial.positions_z(), parallel.positions_z());
+	EXPECT_EQ(serial.velocities_x(), parallel.velocities_x());
+	EXPECT_EQ(serial.velocities_y(), parallel.velocities_y());
+	EXPECT_EQ(serial.velocities_z(), parallel.velocities_z());
+
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		ror::Vector3f velocity{serial.velocities_x()[i], serial.velocities_y()[i], serial.velocities_z()[i]};
+		EXPECT_LE(velocity.length(), serial.m_max_speed * 1.0001f);
+	}
+}
+
+TEST(BoidsTest, DISABLED_boids_scaling_performance)
+{
+	const uint32_t  iterations = 10;
+	const float32_t delta      = 1.0f / 60.0f;
+
+	ror::JobSystem js(ror::get_hardware_threads());
+
+	for (uint32_t count : {1000u, 10000u, 100000u})
+	{
+		// Constant density of about 1 boid per cubic unit
+		auto       half = 0.5f * std::cbrt(static_cast<float32_t>(count));
+		ror::Boids boids{count, {-half, -half, -half}, {half, half, half}};
+
+		if (count <= 10000)
+		{
+			// What the old all pairs loop had to do per update, just counting neighbours
+			ror::Timer timer;
+			uint32_t   neighbours{0};
+
+			auto &x = boids.positions_x();
+			auto &y = boids.positions_y();
+			auto &z = boids.positions_z();
+			auto  r = boids.m_neighbour_radius * boids.m_neighbour_radius;
+
+			for (uint32_t i = 0; i < count; ++i)
+				for (uint32_t j = 0; j < count; ++j)
+				{
+					auto dx = x[j] - x[i], dy = y[j] - y[i], dz = z[j] - z[i];
+					neighbours += (dx * dx + dy * dy + dz * dz <= r);
+				}
+
+			std::cout << "All pairs neighbours of " << count << " boids: " << static_cast<double64_t>(timer.tick()) / 1000000.0 << "ms (" << neighbours << ")" << std::endl;
+		}
+		{
+			ror::Timer timer;
+			for (uint32_t i = 0; i < iterations; ++i)
+				boids.update(delta);
+
+			std::cout << "Grid update of " << count << " boids: " << static_cast<double64_t>(timer.tick()) / (1000000.0 * iterations) << "ms" << std::endl;
+		}
+		{
+			ror::Timer timer;
+			for (uint32_t i = 0; i < iterations; ++i)
+				boids.update(js, delta);
+
+			std::cout << "Grid job system update of " << count << " boids: " << static_cast<double64_t>(timer.tick()) / (1000000.0 * iterations) << "ms" << std::endl;
+		}
+	}
+}
+
+}        // namespace ror_test
@@ -0,0 +1,191 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "bounds/rorbounding.hpp"
+#include "foundation/rorjobsystem.hpp"
+#include "graphics/rorlod_selector.hpp"
+#include "math/rormatrix4_functions.hpp"
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <vector>
+
+namespace ror_test
+{
+// Levels of a unit sized primitive with 4096 triangles, halving triangles and roughly doubling error each level like the glTF loader generates
+static std::vector<ror::MeshLod> make_lods()
+{
+	std::vector<ror::MeshLod> lods{};
+
+	uint32_t  offset = 0;
+	uint32_t  count  = 4096 * 3;
+	float32_t error  = 0.0f;
+	for (uint32_t level = 0; level < 5; ++level)
+	{
+		lods.push_back({offset, count, error});
+		offset += count;
+		count /= 2;
+		error = error == 0.0f ? 0.002f : error * 2.2f;
+	}
+
+	return lods;
+}
+
+// a_size x a_size unit primitives on the xz plane two units apart
+static void add_grid(ror::LodSelector &a_selector, uint32_t a_size, const ror::BoundingBoxf &a_bounds, const std::vector<ror::MeshLod> &a_lods)
+{
+	for (uint32_t z = 0; z < a_size; ++z)
+		for (uint32_t x = 0; x < a_size; ++x)
+			a_selector.add({ror::matrix4_translation(static_cast<float32_t>(x) * 2.0f, 0.0f, static_cast<float32_t>(z) * -2.0f), &a_bounds, a_lods.data(), static_cast<uint32_t>(a_lods.size())});
+}
+
+TEST(LodSelectorTest, camera_path_reduces_triangles)
+{
+	const uint32_t size = 64;
+
+	ror::BoundingBoxf bounds{{-0.5f, -0.5f, -0.5f}, {0.5f, 0.5f, 0.5f}};
+	auto              lods = make_lods();
+
+	ror::JobSystem    js(ror::get_hardware_threads());
+	ror::JobSystem    single(1);
+	ror::LodSelector  selector{};
+	ror::LodSelector  serial{};
+	ror::OrbitCamera  camera{};
+	uint64_t          full_triangles{0}, submitted_triangles{0};
+
+	// Fly low over the grid from one corner to the other, looking along it
+	for (uint32_t frame = 0; frame < 100; ++frame)
+	{
+		auto t = static_cast<float32_t>(frame) / 99.0f;
+		camera.eye({t * size * 2.0f, 2.0f + 6.0f * t, 4.0f - t * size});
+
+		selector.clear();
+		serial.clear();
+		add_grid(selector, size, bounds, lods);
+		add_grid(serial, size, bounds, lods);
+
+		selector.select(js, camera);
+		serial.select(single, camera);
+
+		ASSERT_EQ(selector.draws().size(), size * size);
+		EXPECT_EQ(selector.triangles(), serial.triangles());
+
+		full_triangles += static_cast<uint64_t>(size) * size * (lods[0].m_index_count / 3);
+		submitted_triangles += selector.triangles();
+
+		// Closer primitives never get coarser levels than further ones along the same row
+		for (uint32_t z = 0; z < size; ++z)
+		{
+			for (uint32_t x = 0; x + 1 < size; ++x)
+			{
+				auto eye_x = camera.eye().x;
+				auto near  = std::abs(static_cast<float32_t>(x) * 2.0f - eye_x) < std::abs(static_cast<float32_t>(x + 1) * 2.0f - eye_x) ? x : x + 1;
+				auto far   = near == x ? x + 1 : x;
+
+				EXPECT_LE(serial.lod(z * size + near), serial.lod(z * size + far) + 1);
+			}
+		}
+	}
+
+	auto reduction = static_cast<double64_t>(full_triangles) / static_cast<double64_t>(submitted_triangles);
+	EXPECT_GT(reduction, 4.0);
+
+	std::cout << "Full detail triangles per frame: " << full_triangles / 100 << ", submitted: " << submitted_triangles / 100 << ", reduction: " << reduction << "x" << std::endl;
+}
+
+TEST(LodSelectorTest, hysteresis_stops_popping)
+{
+	ror::BoundingBoxf bounds{{-0.5f, -0.5f, -0.5f}, {0.5f, 0.5f, 0.5f}};
+	auto              lods = make_lods();
+
+	ror::JobSystem js(ror::get_hardware_threads());
+
+	auto projection = ror::LodSelector::projection_scale(60.0f, 768.0f);
+	auto radius     = bounds.diagonal() * 0.5f;
+
+	// Distance at which the error of level 1 covers exactly one pixel, the camera wobbles a little around it
+	auto switch_distance = lods[1].m_error * projection + radius;
+
+	auto count_switches = [&](float32_t a_hysteresis) {
+		ror::LodSelector selector{};
+		selector.m_hysteresis = a_hysteresis;
+
+		uint32_t switches{0};
+		uint32_t previous{0};
+		for (uint32_t frame = 0; frame < 200; ++frame)
+		{
+			auto wobble = switch_distance * 0.05f * std::sin(static_cast<float32_t>(frame) * 0.3f);
+
+			selector.clear();
+			selector.add({ror::Matrix4f{}, &bounds, lods.data(), static_cast<uint32_t>(lods.size())});
+			selector.select(js, {0.0f, 0.0f, switch_distance + wobble}, projection);
+
+			if (frame > 0 && selector.lod(0) != previous)
+				switches++;
+
+			previous = selector.lod(0);
+		}
+
+		return switches;
+	};
+
+	EXPECT_GT(count_switches(0.0f), 10u);
+	EXPECT_EQ(count_switches(0.25f), 0u);
+}
+
+TEST(LodSelectorTest, triangle_budget)
+{
+	const uint32_t size = 32;
+
+	ror::BoundingBoxf bounds{{-0.5f, -0.5f, -0.5f}, {0.5f, 0.5f, 0.5f}};
+	auto              lods = make_lods();
+
+	ror::JobSystem   js(ror::get_hardware_threads());
+	ror::LodSelector selector{};
+
+	add_grid(selector, size, bounds, lods);
+	selector.select(js, {size * 1.0f, 3.0f, 2.0f}, ror::LodSelector::projection_scale(60.0f, 1080.0f));
+
+	auto unlimited = selector.triangles();
+	auto coarsest  = static_cast<uint64_t>(size) * size * (lods.back().m_index_count / 3);
+	auto budget    = coarsest + (unlimited - coarsest) / 4;
+
+	ASSERT_GT(unlimited, coarsest);
+
+	selector.m_triangle_budget = budget;
+	selector.select(js, {size * 1.0f, 3.0f, 2.0f}, ror::LodSelector::projection_scale(60.0f, 1080.0f));
+
+	EXPECT_LE(selector.triangles(), budget);
+	EXPECT_GT(selector.triangles(), coarsest);
+
+	// A budget that can't be met ends with every primitive at its coarsest level
+	selector.m_triangle_budget = 1;
+	selector.select(js, {size * 1.0f, 3.0f, 2.0f}, ror::LodSelector::projection_scale(60.0f, 1080.0f));
+
+	EXPECT_EQ(selector.triangles(), coarsest);
+}
+
+}        // namespace ror_test
@@ -0,0 +1,178 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "foundation/rorjobsystem.hpp"
+#include "graphics/rorparticle_system.hpp"
+#include "profiling/rortimer.hpp"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <vector>
+
+namespace ror_test
+{
+using Stream = ror::ParticleSystem::Stream;
+
+std::vector<float32_t> stream_copy(const ror::ParticleSystem &a_particles, Stream a_stream)
+{
+	auto *data = a_particles.stream(a_stream);
+	return {data, data + a_particles.size()};
+}
+
+TEST(ParticleSystemTest, emits_at_rate)
+{
+	ror::ParticleSystem particles{1000};
+	particles.rate(100.0f);
+
+	particles.emit(0.5f);
+	EXPECT_EQ(particles.size(), 50u);
+
+	// Fractions are carried over
+	for (uint32_t i = 0; i < 10; ++i)
+		particles.emit(0.005f);
+	EXPECT_EQ(particles.size(), 55u);
+
+	// Never goes over capacity
+	particles.burst(10000);
+	EXPECT_EQ(particles.size(), 1000u);
+
+	particles.clear();
+	EXPECT_EQ(particles.size(), 0u);
+}
+
+TEST(ParticleSystemTest, retires_at_end_of_life)
+{
+	ror::ParticleSystem particles{1000};
+	particles.rate(0.0f);
+	particles.life_time(1.0f, 2.0f);
+	particles.burst(1000);
+
+	particles.simulate(0.9f);
+	EXPECT_EQ(particles.size(), 1000u);
+
+	particles.simulate(0.5f);
+	EXPECT_GT(particles.size(), 0u);
+	EXPECT_LT(particles.size(), 1000u);
+
+	// Everything left must still be alive and ages must be valid
+	auto ages = stream_copy(particles, Stream::age);
+	for (auto age : ages)
+		EXPECT_LT(age, 1.0f);
+
+	particles.simulate(0.7f);
+	EXPECT_EQ(particles.size(), 0u);
+}
+
+TEST(ParticleSystemTest, integration_matches_reference)
+{
+	const float32_t delta = 1.0f / 60.0f;
+
+	ror::ParticleSystem particles{1001};
+	particles.rate(0.0f);
+	particles.life_time(100.0f, 200.0f);
+	particles.velocity_spread({1.0f, 1.0f, 1.0f});
+	particles.gravity({0.5f, -9.8f, 0.25f});
+	particles.start_color({1.0f, 0.5f, 0.25f, 1.0f});
+	particles.end_color({0.0f, 0.0f, 1.0f, 0.0f});
+	particles.burst(1001);        // Not a multiple of simd width
+
+	auto px = stream_copy(particles, Stream::position_x);
+	auto py = stream_copy(particles, Stream::position_y);
+	auto vx = stream_copy(particles, Stream::velocity_x);
+	auto vy = stream_copy(particles, Stream::velocity_y);
+	auto ag = stream_copy(particles, Stream::age);
+	auto ar = stream_copy(particles, Stream::age_rate);
+
+	// Integrated in two ranges, like jobs do
+	particles.integrate(delta, 0, 512);
+	particles.integrate(delta, 512, particles.size());
+
+	auto *npx = particles.stream(Stream::position_x);
+	auto *npy = particles.stream(Stream::position_y);
+	auto *nag = particles.stream(Stream::age);
+	auto *ncb = particles.stream(Stream::color_b);
+
+	for (uint32_t i = 0; i < particles.size(); ++i)
+	{
+		vx[i] += 0.5f * delta;
+		vy[i] += -9.8f * delta;
+		px[i] += vx[i] * delta;
+		py[i] += vy[i] * delta;
+		ag[i] += ar[i] * delta;
+
+		EXPECT_FLOAT_EQ(npx[i], px[i]);
+		EXPECT_FLOAT_EQ(npy[i], py[i]);
+		EXPECT_FLOAT_EQ(nag[i], ag[i]);
+		EXPECT_FLOAT_EQ(ncb[i], 0.25f + 0.75f * ag[i]);
+	}
+}
+
+TEST(ParticleSystemTest, DISABLED_particle_system_performance)
+{
+	const uint32_t  count      = 1000000;
+	const uint32_t  iterations = 100;
+	const uint32_t  chunk      = 32768;
+	const float32_t delta      = 1.0f / 60.0f;
+
+	ror::ParticleSystem particles{count};
+	particles.life_time(1000.0f, 2000.0f);
+	particles.rate(0.0f);
+	particles.burst(count);
+
+	{
+		ror::Timer timer;
+		for (uint32_t i = 0; i < iterations; ++i)
+			particles.simulate(delta);
+
+		std::cout << "Single thread simulation of " << particles.size() << " particles: " << static_cast<double64_t>(timer.tick()) / (1000000.0 * iterations) << "ms" << std::endl;
+	}
+	{
+		ror::JobSystem                    js(ror::get_hardware_threads());
+		std::vector<ror::JobHandle<bool>> handles{};
+
+		ror::Timer timer;
+		for (uint32_t i = 0; i < iterations; ++i)
+		{
+			handles.clear();
+			for (uint32_t first = 0; first < particles.size(); first += chunk)
+				handles.emplace_back(js.push_job([&particles, first, chunk, delta]() -> auto {
+					particles.integrate(delta, first, std::min(first + chunk, particles.size()));
+					return true;
+				}));
+
+			for (auto &handle : handles)
+				handle.wait();
+
+			particles.retire();
+			particles.emit(delta);
+		}
+
+		std::cout << "Job system simulation of " << particles.size() << " particles: " << static_cast<double64_t>(timer.tick()) / (1000000.0 * iterations) << "ms" << std::endl;
+	}
+
+	EXPECT_EQ(particles.size(), count);
+}
+
+}        // namespace ror_test
@@ -0,0 +1,198 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "foundation/rorrandom.hpp"
+#include "graphics/rormodel.hpp"
+#include "graphics/rortransform_hierarchy.hpp"
+#include "math/rormatrix4.hpp"
+#include "math/rortransform.hpp"
+#include "profiling/rortimer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <vector>
+
+namespace ror_test
+{
+struct HierarchyNode
+{
+	int32_t         m_parent{-1};
+	ror::Transformf m_trs_transform{};
+};
+
+struct HierarchyNodes
+{
+	std::vector<HierarchyNode> m_nodes{};
+
+	auto &nodes()
+	{
+		return this->m_nodes;
+	}
+};
+
+ror::Transformf random_transform(ror::Random<float32_t> &a_random)
+{
+	ror::Quaternionf rotation{a_random.next(), a_random.next(), a_random.next(), a_random.next()};
+	rotation.normalize();
+
+	return ror::Transformf{rotation,
+	                       ror::Vector3f{a_random.next(), a_random.next(), a_random.next()},
+	                       ror::Vector3f{1.0f + a_random.next() * 0.2f, 1.0f + a_random.next() * 0.2f, 1.0f + a_random.next() * 0.2f}};
+}
+
+// Parents are picked randomly from the nodes already added, with a few extra roots, so the hierarchy is parent first like the scene ones
+void random_hierarchy(ror::Random<float32_t> &a_random, uint32_t a_count, HierarchyNodes &a_nodes, ror::TransformHierarchy &a_hierarchy)
+{
+	a_nodes.m_nodes.resize(a_count);
+	a_hierarchy.clear();
+	a_hierarchy.reserve(a_count);
+
+	for (uint32_t index = 0; index < a_count; ++index)
+	{
+		auto &node = a_nodes.m_nodes[index];
+
+		node.m_trs_transform = random_transform(a_random);
+		node.m_parent        = -1;
+
+		if (index > 0 && index % 64 != 0)
+			node.m_parent = std::min(static_cast<int32_t>((a_random.next() + 1.0f) * 0.5f * static_cast<float32_t>(index)), static_cast<int32_t>(index) - 1);
+
+		a_hierarchy.add(node.m_trs_transform, node.m_parent);
+	}
+}
+
+void test_hierarchy_matches_reference(HierarchyNodes &a_nodes, const ror::TransformHierarchy &a_hierarchy)
+{
+	ASSERT_EQ(a_hierarchy.size(), a_nodes.m_nodes.size());
+
+	uint32_t mismatches = 0;
+	for (uint32_t index = 0; index < a_hierarchy.size(); ++index)
+	{
+		auto  reference = ror::get_node_global_transform(a_nodes, a_nodes.m_nodes[index]);
+		auto &world     = a_hierarchy.world(index);
+
+		for (uint32_t i = 0; i < 16; ++i)
+			if (std::abs(world.m_values[i] - reference.m_values[i]) > 1e-3f * std::max(1.0f, std::abs(reference.m_values[i])))
+				mismatches++;
+	}
+
+	EXPECT_EQ(mismatches, 0u);
+}
+
+TEST(TransformHierarchyTest, matches_recursive_reference)
+{
+	ror::Random<float32_t>  random{-1.0f, 1.0f};
+	HierarchyNodes          nodes{};
+	ror::TransformHierarchy hierarchy{};
+
+	random_hierarchy(random, 100000, nodes, hierarchy);
+	hierarchy.update();
+
+	test_hierarchy_matches_reference(nodes, hierarchy);
+}
+
+TEST(TransformHierarchyTest, only_dirty_subtrees_update)
+{
+	ror::Random<float32_t>  random{-1.0f, 1.0f};
+	HierarchyNodes          nodes{};
+	ror::TransformHierarchy hierarchy{};
+
+	random_hierarchy(random, 10000, nodes, hierarchy);
+	hierarchy.update();
+
+	for (uint32_t index = 0; index < hierarchy.size(); ++index)
+		EXPECT_FALSE(hierarchy.dirty(index));
+
+	for (uint32_t index = 2; index < hierarchy.size(); index += 97)
+	{
+		auto &node           = nodes.m_nodes[index];
+		node.m_trs_transform = random_transform(random);
+
+		if (index % 2)
+			hierarchy.transform(index, node.m_trs_transform);
+		else
+		{
+			hierarchy.translation(index, node.m_trs_transform.m_translation);
+			hierarchy.rotation(index, node.m_trs_transform.m_rotation);
+			hierarchy.scale(index, node.m_trs_transform.m_scale);
+		}
+
+		EXPECT_TRUE(hierarchy.dirty(index));
+	}
+
+	hierarchy.update();
+	test_hierarchy_matches_reference(nodes, hierarchy);
+}
+
+TEST(TransformHierarchyTest, DISABLED_transform_hierarchy_performance)
+{
+	const uint32_t count      = 100000;
+	const uint32_t iterations = 100;
+
+	ror::Random<float32_t>  random{-1.0f, 1.0f};
+	HierarchyNodes          nodes{};
+	ror::TransformHierarchy hierarchy{};
+
+	random_hierarchy(random, count, nodes, hierarchy);
+
+	std::vector<ror::Matrix4f> reference(count);
+	{
+		ror::Timer timer;
+		for (uint32_t j = 0; j < iterations; ++j)
+			for (uint32_t index = 0; index < count; ++index)
+				reference[index] = ror::get_node_global_transform(nodes, nodes.m_nodes[index]);
+
+		std::cout << "Recursive update of " << count << " nodes: " << static_cast<double64_t>(timer.tick()) / (1000000.0 * iterations) << "ms" << std::endl;
+	}
+	{
+		ror::Timer timer;
+		for (uint32_t j = 0; j < iterations; ++j)
+		{
+			for (uint32_t index = 0; index < count; ++index)
+				hierarchy.transform(index, nodes.m_nodes[index].m_trs_transform);
+
+			hierarchy.update();
+		}
+
+		std::cout << "Flat update of all " << count << " nodes: " << static_cast<double64_t>(timer.tick()) / (1000000.0 * iterations) << "ms" << std::endl;
+	}
+	{
+		ror::Timer timer;
+		for (uint32_t j = 0; j < iterations; ++j)
+		{
+			for (uint32_t index = j; index < count; index += 100)
+				hierarchy.transform(index, nodes.m_nodes[index].m_trs_transform);
+
+			hierarchy.update();
+		}
+
+		std::cout << "Flat update of 1% dirty of " << count << " nodes: " << static_cast<double64_t>(timer.tick()) / (1000000.0 * iterations) << "ms" << std::endl;
+	}
+
+	test_hierarchy_matches_reference(nodes, hierarchy);
+}
+
+}        // namespace ror_test
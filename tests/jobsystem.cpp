@@ -35,13 +35,98 @@
 #include <gtest/gtest.h>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <profiling/rortimer.hpp>
+#include <random>
 #include <string>
 #include <thread>
 #include <vector>
 
+#include "foundation/rorconcurrent_queue.hpp"
 #include "foundation/rorjobsystem.hpp"
 
+// Global allocation counting, only counts while counting_allocations is set, used to verify the job system doesn't allocate in steady state
+namespace
+{
+std::atomic_bool     counting_allocations{false};
+std::atomic_uint64_t allocations_count{0};
+
+void *counted_allocation(std::size_t a_size, std::size_t a_alignment)
+{
+	if (counting_allocations.load(std::memory_order_relaxed))
+		allocations_count.fetch_add(1, std::memory_order_relaxed);
+
+	void *pointer = a_alignment > alignof(std::max_align_t) ?
+	                    std::aligned_alloc(a_alignment, (a_size + a_alignment - 1) & ~(a_alignment - 1)) :
+	                    std::malloc(a_size == 0 ? 1 : a_size);
+
+	if (!pointer)
+		throw std::bad_alloc{};
+
+	return pointer;
+}
+}        // namespace
+
+void *operator new(std::size_t a_size)
+{
+	return counted_allocation(a_size, alignof(std::max_align_t));
+}
+
+void *operator new[](std::size_t a_size)
+{
+	return counted_allocation(a_size, alignof(std::max_align_t));
+}
+
+void *operator new(std::size_t a_size, std::align_val_t a_alignment)
+{
+	return counted_allocation(a_size, static_cast<std::size_t>(a_alignment));
+}
+
+void *operator new[](std::size_t a_size, std::align_val_t a_alignment)
+{
+	return counted_allocation(a_size, static_cast<std::size_t>(a_alignment));
+}
+
+void operator delete(void *a_pointer) noexcept
+{
+	std::free(a_pointer);
+}
+
+void operator delete[](void *a_pointer) noexcept
+{
+	std::free(a_pointer);
+}
+
+void operator delete(void *a_pointer, std::size_t) noexcept
+{
+	std::free(a_pointer);
+}
+
+void operator delete[](void *a_pointer, std::size_t) noexcept
+{
+	std::free(a_pointer);
+}
+
+void operator delete(void *a_pointer, std::align_val_t) noexcept
+{
+	std::free(a_pointer);
+}
+
+void operator delete[](void *a_pointer, std::align_val_t) noexcept
+{
+	std::free(a_pointer);
+}
+
+void operator delete(void *a_pointer, std::size_t, std::align_val_t) noexcept
+{
+	std::free(a_pointer);
+}
+
+void operator delete[](void *a_pointer, std::size_t, std::align_val_t) noexcept
+{
+	std::free(a_pointer);
+}
+
 namespace ror_test
 {
 
@@ -76,23 +161,23 @@ TEST(JobSystemTest, create_many_jobs)
 	ror::Dependencies deps{jh0.job(), jh1.job(), jh2.job(), jh3.job(), jh4.job()};
 
 	auto jh = js.push_job([&]() -> bool {
-		auto &o0 = jh0.future();
-		auto &o1 = jh1.future();
-		auto &o2 = jh2.future();
-		auto &o3 = jh3.future();
-		auto &o4 = jh4.future();
-
-		EXPECT_TRUE(o0.valid());
-		EXPECT_TRUE(o1.valid());
-		EXPECT_TRUE(o2.valid());
-		EXPECT_TRUE(o3.valid());
-		EXPECT_TRUE(o4.valid());
-
-		auto res0 = o0.get();
-		auto res1 = o1.get();
-		auto res2 = o2.get();
-		auto res3 = o3.get();
-		auto res4 = o4.get();
+		EXPECT_TRUE(jh0.valid());
+		EXPECT_TRUE(jh1.valid());
+		EXPECT_TRUE(jh2.valid());
+		EXPECT_TRUE(jh3.valid());
+		EXPECT_TRUE(jh4.valid());
+
+		EXPECT_TRUE(jh0.finished());
+		EXPECT_TRUE(jh1.finished());
+		EXPECT_TRUE(jh2.finished());
+		EXPECT_TRUE(jh3.finished());
+		EXPECT_TRUE(jh4.finished());
+
+		auto res0 = jh0.data();
+		auto res1 = jh1.data();
+		auto res2 = jh2.data();
+		auto res3 = jh3.data();
+		auto res4 = jh4.data();
 
 		std::string res{"AA0BB1CC2DD3EE4FF5"};
 		EXPECT_STREQ(res.c_str(), res0.c_str());
@@ -149,23 +234,23 @@ TEST(JobSystemTest, create_ordered_jobs)
 	ror::Dependencies deps{jh4.job()};
 
 	auto jh = js.push_job([&]() -> bool {
-		auto &o0 = jh0.future();
-		auto &o1 = jh1.future();
-		auto &o2 = jh2.future();
-		auto &o3 = jh3.future();
-		auto &o4 = jh4.future();
-
-		EXPECT_TRUE(o0.valid());
-		EXPECT_TRUE(o1.valid());
-		EXPECT_TRUE(o2.valid());
-		EXPECT_TRUE(o3.valid());
-		EXPECT_TRUE(o4.valid());
-
-		auto res0 = o0.get();
-		auto res1 = o1.get();
-		auto res2 = o2.get();
-		auto res3 = o3.get();
-		auto res4 = o4.get();
+		EXPECT_TRUE(jh0.valid());
+		EXPECT_TRUE(jh1.valid());
+		EXPECT_TRUE(jh2.valid());
+		EXPECT_TRUE(jh3.valid());
+		EXPECT_TRUE(jh4.valid());
+
+		EXPECT_TRUE(jh0.finished());
+		EXPECT_TRUE(jh1.finished());
+		EXPECT_TRUE(jh2.finished());
+		EXPECT_TRUE(jh3.finished());
+		EXPECT_TRUE(jh4.finished());
+
+		auto res0 = jh0.data();
+		auto res1 = jh1.data();
+		auto res2 = jh2.data();
+		auto res3 = jh3.data();
+		auto res4 = jh4.data();
 
 		EXPECT_TRUE(res0);
 		EXPECT_TRUE(res1);
@@ -226,23 +311,23 @@ TEST(JobSystemTest, create_out_of_ordered_jobs)
 	ror::Dependencies deps{jh0.job(), jh1.job(), jh2.job(), jh3.job(), jh4.job()};
 
 	auto jh = js.push_job([&]() -> bool {
-		auto &o0 = jh0.future();
-		auto &o1 = jh1.future();
-		auto &o2 = jh2.future();
-		auto &o3 = jh3.future();
-		auto &o4 = jh4.future();
-
-		EXPECT_TRUE(o0.valid());
-		EXPECT_TRUE(o1.valid());
-		EXPECT_TRUE(o2.valid());
-		EXPECT_TRUE(o3.valid());
-		EXPECT_TRUE(o4.valid());
-
-		auto res0 = o0.get();
-		auto res1 = o1.get();
-		auto res2 = o2.get();
-		auto res3 = o3.get();
-		auto res4 = o4.get();
+		EXPECT_TRUE(jh0.valid());
+		EXPECT_TRUE(jh1.valid());
+		EXPECT_TRUE(jh2.valid());
+		EXPECT_TRUE(jh3.valid());
+		EXPECT_TRUE(jh4.valid());
+
+		EXPECT_TRUE(jh0.finished());
+		EXPECT_TRUE(jh1.finished());
+		EXPECT_TRUE(jh2.finished());
+		EXPECT_TRUE(jh3.finished());
+		EXPECT_TRUE(jh4.finished());
+
+		auto res0 = jh0.data();
+		auto res1 = jh1.data();
+		auto res2 = jh2.data();
+		auto res3 = jh3.data();
+		auto res4 = jh4.data();
 
 		EXPECT_TRUE(res0);
 		EXPECT_TRUE(res1);
@@ -274,6 +359,191 @@ TEST(JobSystemTest, create_out_of_ordered_jobs)
 	js.stop();
 }
 
+TEST(JobSystemTest, work_stealing_deque)
+{
+	const uint32_t items_count   = 100000;
+	const uint32_t thieves_count = 3;
+
+	ror::WorkStealingDeque<uint32_t *> deque{16};        // Small capacity so it has to grow while thieves are stealing
+	std::vector<uint32_t>              items(items_count, 0);
+	std::vector<std::atomic_uint32_t>  taken(items_count);
+	std::atomic_uint32_t               taken_count{0};
+	std::atomic_bool                   done{false};
+
+	auto take = [&](uint32_t *a_item) {
+		taken[static_cast<size_t>(a_item - items.data())].fetch_add(1);
+		taken_count.fetch_add(1);
+	};
+
+	std::vector<std::thread> thieves;
+	for (uint32_t i = 0; i < thieves_count; ++i)
+		thieves.emplace_back([&]() {
+			while (!done.load())
+				if (auto *item = deque.steal())
+					take(item);
+		});
+
+	for (uint32_t i = 0; i < items_count; ++i)
+	{
+		deque.push(&items[i]);
+		if (i % 3 == 0)
+			if (auto *item = deque.pop())
+				take(item);
+	}
+
+	while (auto *item = deque.pop())
+		take(item);
+
+	while (taken_count.load() < items_count)
+		std::this_thread::yield();
+
+	done.store(true);
+	for (auto &thief : thieves)
+		thief.join();
+
+	EXPECT_TRUE(deque.empty());
+	for (auto &t : taken)
+		EXPECT_EQ(t.load(), 1u);
+}
+
+TEST(JobSystemTest, concurrent_queue)
+{
+	const uint32_t producers_count = 4;
+	const uint32_t items_count     = 50000;
+
+	ror::ConcurrentQueue<uint32_t> queue{1024};
+	std::atomic_uint64_t           sum{0};
+	std::atomic_uint32_t           popped{0};
+
+	std::vector<std::thread> threads;
+	for (uint32_t p = 0; p < producers_count; ++p)
+		threads.emplace_back([&]() {
+			for (uint32_t i = 1; i <= items_count; ++i)
+				while (!queue.push(i))
+					std::this_thread::yield();
+		});
+
+	for (uint32_t c = 0; c < 2; ++c)
+		threads.emplace_back([&]() {
+			uint32_t item{0};
+			while (popped.load() < producers_count * items_count)
+				if (queue.pop(item))
+				{
+					sum.fetch_add(item);
+					popped.fetch_add(1);
+				}
+				else
+					std::this_thread::yield();
+		});
+
+	for (auto &t : threads)
+		t.join();
+
+	EXPECT_TRUE(queue.empty());
+	EXPECT_EQ(sum.load(), static_cast<uint64_t>(producers_count) * (static_cast<uint64_t>(items_count) * (items_count + 1) / 2));
+}
+
+// Jobs pushed from inside jobs go to the worker's own deque, the parent waits on them which makes it run or steal other jobs meanwhile
+TEST(JobSystemTest, nested_jobs)
+{
+	ror::JobSystem js(ror::get_hardware_threads());
+
+	std::atomic_uint32_t leaves{0};
+	const uint32_t       fan_out = 8;
+
+	auto leaf = [&leaves]() -> uint32_t {
+		leaves.fetch_add(1);
+		return 1u;
+	};
+
+	auto branch = [&js, &leaf, fan_out]() -> uint32_t {
+		std::vector<ror::JobHandle<uint32_t>> children;
+		children.reserve(fan_out);
+
+		for (uint32_t i = 0; i < fan_out; ++i)
+			children.emplace_back(js.push_job(leaf));
+
+		uint32_t sum{0};
+		for (auto &child : children)
+			sum += child.data();
+
+		return sum;
+	};
+
+	auto root = [&js, &branch, fan_out]() -> uint32_t {
+		std::vector<ror::JobHandle<uint32_t>> children;
+		children.reserve(fan_out);
+
+		for (uint32_t i = 0; i < fan_out; ++i)
+			children.emplace_back(js.push_job(branch));
+
+		uint32_t sum{0};
+		for (auto &child : children)
+			sum += child.data();
+
+		return sum;
+	};
+
+	std::vector<ror::JobHandle<uint32_t>> roots;
+	for (uint32_t i = 0; i < fan_out; ++i)
+		roots.emplace_back(js.push_job(root));
+
+	uint32_t total{0};
+	for (auto &r : roots)
+		total += r.data();
+
+	EXPECT_EQ(total, fan_out * fan_out * fan_out);
+	EXPECT_EQ(leaves.load(), fan_out * fan_out * fan_out);
+
+	js.stop();
+}
+
+TEST(JobSystemTest, allocation_free_jobs)
+{
+	const uint32_t jobs_count = 1000000;
+
+	ror::JobSystem       js(ror::get_hardware_threads());
+	std::atomic_uint32_t counter{0};
+
+	// Enough jobs for a full injection queue plus whatever the workers and this thread are holding on to
+	ror::job_pool().reserve((1u << 16) + js.workers_count() + ror::JobPool::block_size);
+
+	auto payload = [&counter](uint32_t a_value) {
+		counter.fetch_add(a_value, std::memory_order_relaxed);
+	};
+
+	auto push_all = [&]() {
+		counter.store(0);
+
+		for (uint32_t i = 0; i < jobs_count; ++i)
+			js.push_job(payload, 1u);        // Handle is dropped straight away, the job goes back to the pool once its ran
+
+		while (counter.load() != jobs_count)
+			std::this_thread::yield();
+	};
+
+	// Warm up, lets all the thread locals and queues settle
+	push_all();
+
+	allocations_count.store(0);
+	counting_allocations.store(true);
+
+	push_all();
+
+	counting_allocations.store(false);
+
+	EXPECT_EQ(counter.load(), jobs_count);
+	EXPECT_EQ(allocations_count.load(), 0u);
+
+	// Results still flow back through handles without std::future
+	auto handle = js.push_job([](uint32_t a_value) { return std::string(a_value, 'a'); }, 64u);
+	EXPECT_TRUE(handle.valid());
+	EXPECT_EQ(handle.data(), std::string(64, 'a'));
+	EXPECT_FALSE(handle.valid());
+
+	js.stop();
+}
+
 // Performance tests
 // From the excellent https://wickedengine.net/2018/11/24/simple-job-system-using-standard-c/
 float spin(float milliseconds)
@@ -330,6 +600,174 @@ void test_spin_ms(float a_ms)
 	js.stop();
 }
 
+TEST(JobSystemTest, dependency_chain)
+{
+	ror::JobSystem js;
+
+	const uint32_t      chain_length = 10000;
+	std::atomic_uint32_t counter{0};
+	std::atomic_uint32_t violations{0};
+
+	// Each job must see exactly its index in the counter, meaning all previous links have ran
+	ror::JobRef previous{};
+	for (uint32_t i = 0; i < chain_length; ++i)
+	{
+		auto handle = js.push_job(
+		    [&counter, &violations](uint32_t a_index) {
+			    if (counter.fetch_add(1) != a_index)
+				    violations.fetch_add(1);
+		    },
+		    ror::Dependencies{previous}, i);
+		previous = handle.job();
+	}
+
+	ror::JobHandle<void> last{previous};
+	last.wait();
+
+	EXPECT_EQ(counter.load(), chain_length);
+	EXPECT_EQ(violations.load(), 0u);
+
+	js.stop();
+}
+
+TEST(JobSystemTest, dependency_graph)
+{
+	ror::JobSystem js;
+
+	const uint32_t jobs_count       = 100000;
+	const uint32_t max_predecessors = 4;
+
+	std::mt19937                            generator{1234};        // Fixed seed so failures are reproducible
+	std::vector<std::vector<uint32_t>>      predecessors(jobs_count);
+	std::unique_ptr<std::atomic_uint32_t[]> finished{new std::atomic_uint32_t[jobs_count]{}};
+	std::atomic_uint32_t                    violations{0};
+	size_t                                  edges_count{0};
+
+	for (uint32_t i = 1; i < jobs_count; ++i)
+	{
+		std::uniform_int_distribution<uint32_t> count_distribution{0, std::min(i, max_predecessors)};
+		std::uniform_int_distribution<uint32_t> predecessor_distribution{0, i - 1};
+
+		auto count = count_distribution(generator);
+		for (uint32_t j = 0; j < count; ++j)
+			predecessors[i].push_back(predecessor_distribution(generator));
+
+		edges_count += count;
+	}
+
+	std::vector<ror::JobHandle<void>> handles;
+	handles.reserve(jobs_count);
+
+	ror::Timer timer;
+	timer.tick_nanoseconds();
+
+	for (uint32_t i = 0; i < jobs_count; ++i)
+	{
+		ror::Dependencies dependencies;
+		dependencies.reserve(predecessors[i].size());
+
+		for (auto predecessor : predecessors[i])
+			dependencies.emplace_back(handles[predecessor].job());
+
+		handles.emplace_back(js.push_job(
+		    [&predecessors, &finished, &violations](uint32_t a_index) {
+			    for (auto predecessor : predecessors[a_index])
+				    if (finished[predecessor].load(std::memory_order_acquire) == 0)
+					    violations.fetch_add(1);
+
+			    finished[a_index].store(1, std::memory_order_release);
+		    },
+		    std::move(dependencies), i));
+	}
+
+	for (auto &handle : handles)
+		handle.wait();
+
+	auto time = timer.tick_nanoseconds();
+
+	EXPECT_EQ(violations.load(), 0u);
+
+	for (uint32_t i = 0; i < jobs_count; ++i)
+		EXPECT_EQ(finished[i].load(), 1u);
+
+	std::cout << "Jobs: " << jobs_count << " edges: " << edges_count << " time: " << time / 1000000.0 << " ms, "
+	          << time / static_cast<double>(jobs_count + edges_count) << " ns per job or edge" << std::endl;
+
+	js.stop();
+}
+
+TEST(JobSystemTest, parallel_for)
+{
+	ror::JobSystem js;
+
+	const uint32_t                          data_count = 100003;        // Not a power of 2 so the last chunk is uneven
+	std::unique_ptr<std::atomic_uint32_t[]> visits{new std::atomic_uint32_t[data_count]{}};
+
+	js.parallel_for(0, data_count, [&visits](uint32_t a_index) { visits[a_index].fetch_add(1, std::memory_order_relaxed); });
+
+	for (uint32_t i = 0; i < data_count; ++i)
+		EXPECT_EQ(visits[i].load(), 1u);
+
+	// Explicit grain size and empty range
+	js.parallel_for(10, 10, [](uint32_t) { EXPECT_TRUE(false); });
+	js.parallel_for(0, data_count, [&visits](uint32_t a_index) { visits[a_index].fetch_add(1, std::memory_order_relaxed); }, 1);
+
+	for (uint32_t i = 0; i < data_count; ++i)
+		EXPECT_EQ(visits[i].load(), 2u);
+
+	js.stop();
+}
+
+TEST(JobSystemTest, parallel_reduce)
+{
+	ror::JobSystem js;
+
+	const uint32_t data_count = 1000000;
+
+	auto sum = js.parallel_reduce(
+	    0u, data_count, uint64_t{0}, [](uint32_t a_index) { return static_cast<uint64_t>(a_index); }, [](uint64_t a_left, uint64_t a_right) { return a_left + a_right; });
+
+	EXPECT_EQ(sum, static_cast<uint64_t>(data_count) * (data_count - 1) / 2);
+
+	// Non commutative reduction, partial results must be combined in index order
+	auto digits = js.parallel_reduce(
+	    0u, 1000u, std::string{}, [](uint32_t a_index) { return std::to_string(a_index % 10); }, [](std::string a_left, const std::string &a_right) { return a_left + a_right; }, 7);
+
+	std::string expected{};
+	for (uint32_t i = 0; i < 1000; ++i)
+		expected += std::to_string(i % 10);
+
+	EXPECT_EQ(digits, expected);
+
+	auto empty = js.parallel_reduce(
+	    5u, 5u, 42, [](uint32_t) { return 1; }, [](int a_left, int a_right) { return a_left + a_right; });
+
+	EXPECT_EQ(empty, 42);
+
+	js.stop();
+}
+
+TEST(JobSystemTest, nested_parallel_for)
+{
+	ror::JobSystem js;
+
+	const uint32_t       outer_count = 64;
+	const uint32_t       inner_count = 1000;
+	std::atomic_uint32_t counter{0};
+
+	auto handle = js.push_job([&js, &counter]() {
+		js.parallel_for(0, outer_count, [&js, &counter](uint32_t) {
+			js.parallel_for(0, inner_count, [&counter](uint32_t) { counter.fetch_add(1, std::memory_order_relaxed); });
+		});
+	});
+
+	handle.wait();
+
+	EXPECT_EQ(counter.load(), outer_count * inner_count);
+
+	js.stop();
+}
+
 TEST(JobSystemTest, performance_test)
 {
 	for (float i = 0.01f; i < 1.0f; i += 0.1f)
@@ -428,8 +866,7 @@ TEST(JobSystemTest, job_group_test)
 
 		auto jh = js.push_job_group(f, dataCount, dataCount / threads_count);
 
-		if (jh.future().valid())
-			jh.future().get();
+		jh.wait();
 
 		group_time = timer.tick();
 
@@ -445,4 +882,64 @@ TEST(JobSystemTest, job_group_test)
 	EXPECT_TRUE(group_time < threads_time);
 	EXPECT_TRUE(threads_time > loop_time);
 }
+
+TEST(JobSystemTest, DISABLED_scaling_test)
+{
+	const uint32_t jobs_count    = 200000;
+	const uint32_t threads_count = ror::get_hardware_threads();
+
+	auto payload = [](uint32_t a_value) -> uint32_t {
+		spin(0.001f);
+		return a_value;
+	};
+
+	for (uint32_t workers = 1; workers <= threads_count; workers *= 2)
+	{
+		ror::JobSystem                        js{workers};
+		std::vector<ror::JobHandle<uint32_t>> handles;
+		handles.reserve(jobs_count);
+
+		ror::Timer timer;
+		timer.tick();
+
+		for (uint32_t i = 0; i < jobs_count; ++i)
+			handles.emplace_back(js.push_job(payload, i));
+
+		uint64_t sum{0};
+		for (auto &h : handles)
+			sum += h.data();
+
+		auto time = timer.tick();
+
+		EXPECT_EQ(sum, static_cast<uint64_t>(jobs_count) * (jobs_count - 1) / 2);
+		std::cout << "Workers: " << workers << " jobs: " << jobs_count << " time: " << time << " ticks" << std::endl;
+
+		js.stop();
+	}
+}
+
+TEST(JobSystemTest, DISABLED_irregular_parallel_for_test)
+{
+	const uint32_t data_count    = 20000;
+	const uint32_t threads_count = ror::get_hardware_threads();
+
+	// Cost grows with the index, so equal sized groups are badly balanced, the last group does most of the work
+	auto payload = [](uint32_t a_index) {
+		spin(0.002f * static_cast<float>(a_index * 4 / data_count));
+	};
+
+	ror::JobSystem js{threads_count};
+	ror::Timer     timer;
+
+	timer.tick();
+	js.push_job_group(payload, data_count, data_count / threads_count).wait();
+	auto group_time = timer.tick_milliseconds();
+
+	js.parallel_for(0, data_count, payload);
+	auto parallel_for_time = timer.tick_milliseconds();
+
+	std::cout << "Workers: " << threads_count << " push_job_group: " << group_time << " ms parallel_for: " << parallel_for_time << " ms" << std::endl;
+
+	js.stop();
+}
 }        // namespace ror_test
@@ -1,8 +1,11 @@
 #include "common.hpp"
 #include "profiling/rorlog.hpp"
+#include "profiling/rortimer.hpp"
 #include <gtest/gtest.h>
 
 #include <fstream>
+#include <thread>
+#include <vector>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string>
@@ -171,4 +174,180 @@ TEST(StreamRedirectTest, StreamRedirectTest_cout_capture)
 	ASSERT_STREQ(msgs.c_str(), "Created some objects\nCreated a lot of objects\n");
 }
 
+std::vector<std::string> read_log_messages(const std::string &a_log_file)
+{
+	std::vector<std::string> messages;
+	std::ifstream            log_file(a_log_file);
+	std::string              line;
+
+	while (std::getline(log_file, line))
+		messages.emplace_back(line.substr(40));
+
+	return messages;
+}
+
+TEST(LogTest, async_logger_keeps_order)
+{
+	const uint32_t messages_count = 1000;
+	{
+		ror::Log logger("./roar_async.log");
+		logger.set_level(ror::LogLevel::trace);
+
+		ror::AsyncLogger async_logger;
+		async_logger.start(logger);
+		EXPECT_TRUE(async_logger.running());
+
+		for (uint32_t i = 0; i < messages_count; ++i)
+		{
+			// Temporary strings must be captured by value, they are gone by the time the message is formatted
+			std::string name{"message " + std::to_string(i)};
+			async_logger.push(ror::LogLevel::info, "Async {} {} {}", name, name.c_str(), 0.5f);
+		}
+
+		async_logger.push(ror::LogLevel::error, "Async {}", "done");
+		async_logger.stop();
+		EXPECT_FALSE(async_logger.running());
+	}
+
+	auto messages = read_log_messages("./roar_async.log");
+	ASSERT_EQ(messages.size(), messages_count + 1);
+
+	for (uint32_t i = 0; i < messages_count; ++i)
+		EXPECT_EQ(messages[i], "] [info] Async message " + std::to_string(i) + " message " + std::to_string(i) + " 0.5");
+
+	EXPECT_EQ(messages.back(), "] [error] Async done");
+}
+
+TEST(LogTest, async_logger_many_threads)
+{
+	const uint32_t threads_count  = 4;
+	const uint32_t messages_count = 20000;        // More than fits in a ring, so producers have to wait for the background thread too
+	{
+		ror::Log logger("./roar_async_threads.log");
+		logger.set_level(ror::LogLevel::trace);
+
+		ror::AsyncLogger async_logger;
+		async_logger.start(logger);
+
+		std::vector<std::thread> threads;
+		for (uint32_t t = 0; t < threads_count; ++t)
+			threads.emplace_back([&async_logger, t]() {
+				for (uint32_t i = 0; i < messages_count; ++i)
+					async_logger.push(ror::LogLevel::trace, "{} {}", t, i);
+			});
+
+		for (auto &thread : threads)
+			thread.join();
+
+		async_logger.flush();
+		async_logger.stop();
+	}
+
+	auto messages = read_log_messages("./roar_async_threads.log");
+	ASSERT_EQ(messages.size(), threads_count * messages_count);
+
+	std::vector<uint32_t> next(threads_count, 0);
+	for (auto &message : messages)
+	{
+		uint32_t thread{0}, index{0};
+		ASSERT_EQ(sscanf(message.c_str(), "] [trace] %u %u", &thread, &index), 2);
+		ASSERT_LT(thread, threads_count);
+		EXPECT_EQ(index, next[thread]++);
+	}
+}
+
+TEST(LogTest, async_logger_recycles_rings)
+{
+	const uint32_t threads_count = 16;
+	{
+		ror::Log logger("./roar_async_recycle.log");
+		logger.set_level(ror::LogLevel::trace);
+
+		ror::AsyncLogger async_logger;
+		async_logger.start(logger);
+
+		// One thread after the other, each takes over the ring the previous one released on exit
+		for (uint32_t t = 0; t < threads_count; ++t)
+			std::thread([&async_logger, t]() { async_logger.push(ror::LogLevel::info, "Thread {}", t); }).join();
+
+		async_logger.flush();
+		EXPECT_EQ(async_logger.rings_count(), 1u);
+
+		async_logger.stop();
+	}
+
+	auto messages = read_log_messages("./roar_async_recycle.log");
+	ASSERT_EQ(messages.size(), threads_count);
+
+	for (uint32_t t = 0; t < threads_count; ++t)
+		EXPECT_EQ(messages[t], "] [info] Thread " + std::to_string(t));
+}
+
+TEST(LogTest, rate_limit)
+{
+	ror::LogRateLimit limit{std::chrono::milliseconds(50)};
+	uint32_t          suppressed{0};
+
+	EXPECT_TRUE(limit.allow(suppressed));
+	EXPECT_EQ(suppressed, 0);
+
+	for (uint32_t i = 0; i < 10; ++i)
+		EXPECT_FALSE(limit.allow(suppressed));
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(60));
+
+	EXPECT_TRUE(limit.allow(suppressed));
+	EXPECT_EQ(suppressed, 10);
+
+	uint32_t allowed{0};
+	for (uint32_t i = 0; i < 100; ++i)
+		log_rate_limited([&allowed](const char *, auto &&...) { allowed++; }, "Called {} times", i);
+
+	EXPECT_EQ(allowed, 1);
+}
+
+TEST(LogTest, DISABLED_async_logger_performance)
+{
+	const uint32_t messages_count = 200000;
+	const uint32_t burst_count    = 256;        // Fits in a ring, so the caller never waits for the background thread
+
+	ror::Log   logger("./roar_performance.log");
+	ror::Timer timer;
+
+	for (uint32_t i = 0; i < messages_count; ++i)
+		logger.info("Frame {} took {} ms in {}", i, 16.6f, "render");
+
+	logger.flush();
+	auto sync_time = timer.tick();
+
+	ror::AsyncLogger async_logger;
+	async_logger.start(logger);
+
+	timer.tick();
+
+	for (uint32_t i = 0; i < messages_count; ++i)
+		async_logger.push(ror::LogLevel::info, "Frame {} took {} ms in {}", i, 16.6f, "render");
+
+	async_logger.flush();
+	auto async_time = timer.tick();
+
+	uint64_t burst_time{0};
+	for (uint32_t i = 0; i < messages_count; i += burst_count)
+	{
+		timer.tick();
+
+		for (uint32_t j = 0; j < burst_count; ++j)
+			async_logger.push(ror::LogLevel::info, "Frame {} took {} ms in {}", i + j, 16.6f, "render");
+
+		burst_time += timer.tick();
+		async_logger.flush();
+	}
+
+	async_logger.stop();
+
+	std::cout << "Sync log: " << static_cast<double64_t>(sync_time) / messages_count << " ns per call, "
+	          << "async log: " << static_cast<double64_t>(async_time) / messages_count << " ns per call, "
+	          << "async log caller in bursts: " << static_cast<double64_t>(burst_time) / messages_count << " ns per call" << std::endl;
+}
+
 }        // namespace ror_test
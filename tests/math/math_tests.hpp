@@ -40,6 +40,7 @@
 #include "ray.hpp"
 
 #include "segment.hpp"
+#include "simd.hpp"
 #include "bounds/bounds.hpp"
 
 namespace ror
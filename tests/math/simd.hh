@@ -0,0 +1,270 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "profiling/rortimer.hpp"
+#include "simd.hpp"
+#include <iostream>
+
+namespace ror_test
+{
+void scalar_matrix4_multiply(const ror::Matrix4f &a_left, const ror::Matrix4f &a_right, ror::Matrix4f &a_out)
+{
+	for (uint32_t column = 0; column < 4; ++column)
+		for (uint32_t row = 0; row < 4; ++row)
+			a_out.m_values[column * 4 + row] = a_left.m_values[row] * a_right.m_values[column * 4] +
+			                                   a_left.m_values[4 + row] * a_right.m_values[column * 4 + 1] +
+			                                   a_left.m_values[8 + row] * a_right.m_values[column * 4 + 2] +
+			                                   a_left.m_values[12 + row] * a_right.m_values[column * 4 + 3];
+}
+
+void scalar_quaternion_multiply(const ror::Quaternionf &a_left, const ror::Quaternionf &a_right, ror::Quaternionf &a_out)
+{
+	a_out.x = a_left.w * a_right.x + a_left.x * a_right.w + a_left.y * a_right.z - a_left.z * a_right.y;
+	a_out.y = a_left.w * a_right.y + a_left.y * a_right.w + a_left.z * a_right.x - a_left.x * a_right.z;
+	a_out.z = a_left.w * a_right.z + a_left.z * a_right.w + a_left.x * a_right.y - a_left.y * a_right.x;
+	a_out.w = a_left.w * a_right.w - a_left.x * a_right.x - a_left.y * a_right.y - a_left.z * a_right.z;
+}
+
+ror::Matrix4f random_matrix4(ror::Random<float32_t> &a_random)
+{
+	ror::Matrix4f matrix;
+	for (auto &value : matrix.m_values)
+		value = a_random.next();
+
+	return matrix;
+}
+
+template <class _type>
+ror::Matrix4d to_double(const ror::Matrix4<_type> &a_matrix)
+{
+	ror::Matrix4d matrix;
+	for (uint32_t i = 0; i < 16; ++i)
+		matrix.m_values[i] = static_cast<double64_t>(a_matrix.m_values[i]);
+
+	return matrix;
+}
+
+TEST(SIMDTest, matrix4_multiply_matches_scalar)
+{
+	ror::Random<float32_t> random{-10.0f, 10.0f};
+
+	for (uint32_t i = 0; i < 1000; ++i)
+	{
+		auto left  = random_matrix4(random);
+		auto right = random_matrix4(random);
+
+		ror::Matrix4f reference;
+		scalar_matrix4_multiply(left, right, reference);
+
+		auto result = left * right;
+		for (uint32_t j = 0; j < 16; ++j)
+			EXPECT_FLOAT_EQ(result.m_values[j], reference.m_values[j]);
+
+		// Aliasing output with input
+		left *= right;
+		for (uint32_t j = 0; j < 16; ++j)
+			EXPECT_FLOAT_EQ(left.m_values[j], reference.m_values[j]);
+
+		ror::Vector4f vector{random.next(), random.next(), random.next(), random.next()};
+		auto          vector_result = right * vector;
+		auto          vector_double = to_double(right) * ror::Vector4d{vector.x, vector.y, vector.z, vector.w};
+
+		EXPECT_NEAR(vector_result.x, vector_double.x, 1e-3);
+		EXPECT_NEAR(vector_result.y, vector_double.y, 1e-3);
+		EXPECT_NEAR(vector_result.z, vector_double.z, 1e-3);
+		EXPECT_NEAR(vector_result.w, vector_double.w, 1e-3);
+
+		ror::Vector3f point{vector.x, vector.y, vector.z};
+		auto          point_result = right * point;
+		auto          point_double = to_double(right) * ror::Vector3d{point.x, point.y, point.z};
+
+		EXPECT_NEAR(point_result.x, point_double.x, 1e-3);
+		EXPECT_NEAR(point_result.y, point_double.y, 1e-3);
+		EXPECT_NEAR(point_result.z, point_double.z, 1e-3);
+	}
+}
+
+TEST(SIMDTest, matrix4_inverse_matches_scalar)
+{
+	ror::Random<float32_t> random{-1.0f, 1.0f};
+
+	for (uint32_t i = 0; i < 1000; ++i)
+	{
+		// Well conditioned TRS matrices, random matrices can be close to singular
+		auto matrix = ror::matrix4_translation(random.next() * 10.0f, random.next() * 10.0f, random.next() * 10.0f) *
+		              ror::matrix4_rotation(ror::Quaternionf{random.next(), random.next(), random.next(), random.next()}) *
+		              ror::matrix4_scaling(random.next() + 2.0f, random.next() + 2.0f, random.next() + 2.0f);
+
+		ror::Matrix4f reference;
+		ASSERT_TRUE(ror::mesa_glu_invert_matrix(matrix.m_values, reference.m_values));
+
+		ror::Matrix4f inverse;
+		ASSERT_TRUE(matrix.inverse(inverse));
+
+		for (uint32_t j = 0; j < 16; ++j)
+			EXPECT_NEAR(inverse.m_values[j], reference.m_values[j], 1e-4);
+
+		auto identity = matrix * inverse;
+		for (uint32_t j = 0; j < 16; ++j)
+			EXPECT_NEAR(identity.m_values[j], (j % 5 == 0) ? 1.0f : 0.0f, 1e-4);
+
+		ASSERT_TRUE(matrix.invert());
+		for (uint32_t j = 0; j < 16; ++j)
+			EXPECT_FLOAT_EQ(matrix.m_values[j], inverse.m_values[j]);
+	}
+
+	// Singular matrices don't touch the output
+	ror::Matrix4f singular{0.0f};
+	ror::Matrix4f output{};
+	EXPECT_FALSE(singular.inverse(output));
+	EXPECT_EQ(output, ror::Matrix4f{});
+}
+
+TEST(SIMDTest, quaternion_matches_scalar)
+{
+	ror::Random<float32_t> random{-1.0f, 1.0f};
+
+	for (uint32_t i = 0; i < 1000; ++i)
+	{
+		ror::Quaternionf left{random.next(), random.next(), random.next(), random.next()};
+		ror::Quaternionf right{random.next(), random.next(), random.next(), random.next()};
+
+		ror::Quaternionf reference;
+		scalar_quaternion_multiply(left, right, reference);
+
+		auto result = left * right;
+		EXPECT_NEAR(result.x, reference.x, 1e-5);
+		EXPECT_NEAR(result.y, reference.y, 1e-5);
+		EXPECT_NEAR(result.z, reference.z, 1e-5);
+		EXPECT_NEAR(result.w, reference.w, 1e-5);
+
+		auto matrix        = ror::matrix4_rotation(left);
+		auto matrix_double = ror::matrix4_rotation(ror::Quaterniond{left.x, left.y, left.z, left.w});
+		for (uint32_t j = 0; j < 16; ++j)
+			EXPECT_NEAR(matrix.m_values[j], matrix_double.m_values[j], 1e-5);
+	}
+}
+
+TEST(SIMDTest, vector4_matches_scalar)
+{
+	ror::Random<float32_t> random{-10.0f, 10.0f};
+
+	for (uint32_t i = 0; i < 1000; ++i)
+	{
+		ror::Vector4f left{random.next(), random.next(), random.next(), random.next()};
+		ror::Vector4f right{random.next(), random.next(), random.next(), random.next()};
+
+		auto sum        = left + right;
+		auto difference = left - right;
+		auto product    = left * right;
+
+		for (int32_t j = 0; j < 4; ++j)
+		{
+			EXPECT_FLOAT_EQ(sum[j], left[j] + right[j]);
+			EXPECT_FLOAT_EQ(difference[j], left[j] - right[j]);
+			EXPECT_FLOAT_EQ(product[j], left[j] * right[j]);
+		}
+
+		auto accumulated = left;
+		accumulated += right;
+		EXPECT_EQ(accumulated, sum);
+
+		accumulated = left;
+		accumulated -= right;
+		EXPECT_EQ(accumulated, difference);
+
+		accumulated = left;
+		accumulated *= right;
+		EXPECT_EQ(accumulated, product);
+
+		EXPECT_FLOAT_EQ(left.dot_product(right), left.x * right.x + left.y * right.y + left.z * right.z + left.w * right.w);
+		EXPECT_FLOAT_EQ(left.length_squared(), left.x * left.x + left.y * left.y + left.z * left.z + left.w * left.w);
+	}
+}
+
+TEST(SIMDTest, DISABLED_simd_vs_scalar_performance)
+{
+	const uint32_t count      = 1024;
+	const uint32_t iterations = 2000;
+
+	ror::Random<float32_t>           random{-1.0f, 1.0f};
+	std::vector<ror::Matrix4f>       matrices(count);
+	std::vector<ror::Matrix4f>       results(count);
+	std::vector<ror::Quaternionf>    quaternions(count);
+	std::vector<ror::Quaternionf>    quaternion_results(count);
+
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		matrices[i]    = random_matrix4(random);
+		quaternions[i] = ror::Quaternionf{random.next(), random.next(), random.next(), random.next()};
+	}
+
+	auto report = [](const char *a_name, int64_t a_scalar, int64_t a_simd) {
+		std::cout << a_name << " scalar: " << static_cast<double64_t>(a_scalar) / 1000000.0 << "ms, simd: " << static_cast<double64_t>(a_simd) / 1000000.0
+		          << "ms, speedup: " << static_cast<double64_t>(a_scalar) / static_cast<double64_t>(std::max(a_simd, int64_t{1})) << "x" << std::endl;
+	};
+
+	{
+		ror::Timer timer;
+		for (uint32_t j = 0; j < iterations; ++j)
+			for (uint32_t i = 0; i < count; ++i)
+				scalar_matrix4_multiply(matrices[i], matrices[(i + j) % count], results[i]);
+		auto scalar = timer.tick();
+
+		for (uint32_t j = 0; j < iterations; ++j)
+			for (uint32_t i = 0; i < count; ++i)
+				results[i] = matrices[i] * matrices[(i + j) % count];
+		report("Matrix4f multiply", scalar, timer.tick());
+	}
+	{
+		ror::Timer timer;
+		for (uint32_t j = 0; j < iterations; ++j)
+			for (uint32_t i = 0; i < count; ++i)
+				ror::mesa_glu_invert_matrix(matrices[(i + j) % count].m_values, results[i].m_values);
+		auto scalar = timer.tick();
+
+		for (uint32_t j = 0; j < iterations; ++j)
+			for (uint32_t i = 0; i < count; ++i)
+				matrices[(i + j) % count].inverse(results[i]);
+		report("Matrix4f inverse", scalar, timer.tick());
+	}
+	{
+		ror::Timer timer;
+		for (uint32_t j = 0; j < iterations; ++j)
+			for (uint32_t i = 0; i < count; ++i)
+				scalar_quaternion_multiply(quaternions[i], quaternions[(i + j) % count], quaternion_results[i]);
+		auto scalar = timer.tick();
+
+		for (uint32_t j = 0; j < iterations; ++j)
+			for (uint32_t i = 0; i < count; ++i)
+				quaternion_results[i] = quaternions[i] * quaternions[(i + j) % count];
+		report("Quaternionf multiply", scalar, timer.tick());
+	}
+
+	EXPECT_NE(results[0].m_values[0], 12345.0f);        // Keep the results alive
+	EXPECT_NE(quaternion_results[0].x, 12345.0f);
+}
+
+}        // namespace ror_test
@@ -0,0 +1,44 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#pragma once
+
+#include "common.hpp"
+#include "foundation/rorrandom.hpp"
+#include "math/rormatrix.hpp"
+#include "math/rorquaternion.hpp"
+#include "math/rorsimd.hpp"
+#include <gtest/gtest.h>
+
+namespace ror_test
+{
+// Scalar float32_t versions of what the SIMD backend replaces, used as reference and for benchmarking
+void scalar_matrix4_multiply(const ror::Matrix4f &a_left, const ror::Matrix4f &a_right, ror::Matrix4f &a_out);
+void scalar_quaternion_multiply(const ror::Quaternionf &a_left, const ror::Quaternionf &a_right, ror::Quaternionf &a_out);
+
+ror::Matrix4f random_matrix4(ror::Random<float32_t> &a_random);
+}        // namespace ror_test
+
+#include "simd.hh"
@@ -0,0 +1,195 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "nlohmann/json.hpp"
+#include "profiling/rorprofiler.hpp"
+#include "profiling/rortimer.hpp"
+#include <gtest/gtest.h>
+#include <iostream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ror_test
+{
+using json = nlohmann::json;
+
+void zone_tree(uint32_t a_depth)
+{
+	profile_zone("zone_tree");
+
+	if (a_depth > 0)
+		zone_tree(a_depth - 1);
+}
+
+std::map<std::string, uint32_t> thread_ids(const json &a_trace)
+{
+	std::map<std::string, uint32_t> ids{};
+	for (auto &event : a_trace["traceEvents"])
+		if (event["ph"] == "M")
+			ids[event["args"]["name"]] = event["tid"];
+
+	return ids;
+}
+
+std::vector<json> zones_on(const json &a_trace, uint32_t a_tid)
+{
+	std::vector<json> zones{};
+	for (auto &event : a_trace["traceEvents"])
+		if (event["ph"] == "X" && event["tid"] == a_tid)
+			zones.push_back(event);
+
+	return zones;
+}
+
+TEST(ProfilerTest, disabled_records_nothing)
+{
+	auto &profiler = ror::profiler();
+	profiler.enable(false);
+	profiler.clear();
+
+	zone_tree(10);
+
+	auto trace = json::parse(profiler.chrome_trace());
+	for (auto &event : trace["traceEvents"])
+		EXPECT_NE(event["ph"], "X");
+}
+
+TEST(ProfilerTest, nested_zones)
+{
+	auto &profiler = ror::profiler();
+	profiler.clear();
+	profiler.enable(true);
+	profiler.set_thread_name("nested test");
+
+	{
+		profile_zone("outer");
+		zone_tree(2);
+	}
+
+	profiler.enable(false);
+
+	auto trace = json::parse(profiler.chrome_trace());
+	auto ids   = thread_ids(trace);
+	ASSERT_EQ(ids.count("nested test"), 1u);
+
+	// Zones are written as they close so children come before their parents
+	auto zones = zones_on(trace, ids["nested test"]);
+	ASSERT_EQ(zones.size(), 4u);
+	EXPECT_EQ(zones[3]["name"], "outer");
+
+	for (uint32_t i = 0; i < 4; ++i)
+	{
+		EXPECT_EQ(zones[i]["args"]["depth"], 3 - i);
+		if (i > 0)
+		{
+			// Each child must be within its parent
+			double64_t parent_start = zones[i]["ts"], parent_end = parent_start + static_cast<double64_t>(zones[i]["dur"]);
+			double64_t child_start = zones[i - 1]["ts"], child_end = child_start + static_cast<double64_t>(zones[i - 1]["dur"]);
+
+			EXPECT_GE(child_start, parent_start);
+			EXPECT_LE(child_end, parent_end);
+		}
+	}
+}
+
+TEST(ProfilerTest, multiple_threads)
+{
+	const uint32_t thread_count = 4;
+	const uint32_t zones_count  = 1000;
+
+	auto &profiler = ror::profiler();
+	profiler.clear();
+	profiler.enable(true);
+
+	std::vector<std::thread> threads{};
+	for (uint32_t i = 0; i < thread_count; ++i)
+		threads.emplace_back([i, zones_count]() {
+			ror::profiler().set_thread_name("test thread " + std::to_string(i));
+			for (uint32_t j = 0; j < zones_count; ++j)
+				zone_tree(0);
+		});
+
+	for (auto &thread : threads)
+		thread.join();
+
+	profiler.enable(false);
+
+	auto trace = json::parse(profiler.chrome_trace());
+	auto ids   = thread_ids(trace);
+
+	for (uint32_t i = 0; i < thread_count; ++i)
+	{
+		auto name = "test thread " + std::to_string(i);
+		ASSERT_EQ(ids.count(name), 1u);
+		EXPECT_EQ(zones_on(trace, ids[name]).size(), zones_count);
+	}
+}
+
+TEST(ProfilerTest, ring_buffer_wraps)
+{
+	ror::ProfileBuffer buffer{0, 8};
+
+	for (int64_t i = 0; i < 20; ++i)
+		buffer.push({"event", i, i + 1, 0});
+
+	EXPECT_EQ(buffer.size(), 8u);
+
+	int64_t expected = 12;
+	buffer.for_each([&expected](const ror::ProfileEvent &a_event) {
+		EXPECT_EQ(a_event.m_start, expected++);
+	});
+	EXPECT_EQ(expected, 20);
+
+	buffer.clear();
+	EXPECT_EQ(buffer.size(), 0u);
+}
+
+TEST(ProfilerTest, DISABLED_profiler_zone_overhead)
+{
+	const uint32_t iterations = 1000000;
+
+	auto &profiler = ror::profiler();
+	profiler.clear();
+
+	for (auto enabled : {false, true})
+	{
+		profiler.enable(enabled);
+
+		ror::Timer timer;
+		for (uint32_t i = 0; i < iterations; ++i)
+		{
+			profile_zone("overhead");
+		}
+
+		std::cout << "Profile zone " << (enabled ? "enabled" : "disabled") << ": " << static_cast<double64_t>(timer.tick()) / iterations << "ns per zone" << std::endl;
+	}
+
+	profiler.enable(false);
+	profiler.clear();
+}
+
+}        // namespace ror_test
@@ -1,12 +1,16 @@
 #include "profiling/rorlog.hpp"
+#include "profiling/rortimer.hpp"
 #include "rhi/rorshader_buffer.hpp"
 #include "rhi/rorshader_buffer_template.hpp"
 #include "rhi/rortypes.hpp"
 #include <gtest/gtest-death-test.h>
 #include <gtest/gtest.h>
+#include <cstring>
+#include <iostream>
 #include <string>
 #include <tuple>
 #include <unordered_map>
+#include <vector>
 
 namespace ror_test
 {
@@ -1492,4 +1496,166 @@ TEST(ShaderBuffer, std140_joint_transforms_test)
 	}
 }
 
+// CPU memory backed ShaderBuffer, only good for testing updates without a device
+class MemoryShaderBuffer : public rhi::ShaderBufferCrtp<MemoryShaderBuffer>
+{
+  public:
+	using rhi::ShaderBufferCrtp<MemoryShaderBuffer>::ShaderBufferCrtp;
+
+	void buffer_copy(const uint8_t *a_data, size_t a_offset, size_t a_length) noexcept
+	{
+		std::memcpy(this->m_data.data() + a_offset, a_data, a_length);
+	}
+
+	void buffer_init(const rhi::Device &, uint32_t a_size, rhi::ResourceStorageOption)
+	{
+		this->m_data.resize(a_size);
+	}
+
+	std::vector<uint8_t> m_data{};
+};
+
+struct TestNode
+{
+	int32_t   m_parent{-1};
+	float32_t m_rotation[4]{};
+	float32_t m_translation[3]{};
+	float32_t m_scale[3]{};
+};
+
+MemoryShaderBuffer make_trs_buffer(uint32_t a_count)
+{
+	MemoryShaderBuffer buffer{"nodes_transform", rhi::ShaderBufferType::ssbo, rhi::ShaderBufferFrequency::constant, rhi::Layout::std430, 0u, 0u,
+	                          "trs_transform_input", rhi::VertexFormat::struct_1, a_count,
+	                          "rotation", rhi::VertexFormat::float32_4, 1u,
+	                          "translation", rhi::VertexFormat::float32_3, 1u,
+	                          "scale", rhi::VertexFormat::float32_3, 1u,
+	                          "parent_index", rhi::VertexFormat::int32_4, 1u};
+
+	buffer.m_data.resize(buffer.shader_buffer().size());
+
+	return buffer;
+}
+
+std::vector<TestNode> make_test_nodes(uint32_t a_count)
+{
+	std::vector<TestNode> nodes(a_count);
+	for (uint32_t i = 0; i < a_count; ++i)
+	{
+		auto value = static_cast<float32_t>(i);
+
+		nodes[i].m_parent         = static_cast<int32_t>(i) - 1;
+		nodes[i].m_rotation[0]    = value;
+		nodes[i].m_rotation[3]    = -value;
+		nodes[i].m_translation[1] = value * 2.0f;
+		nodes[i].m_scale[2]       = value * 3.0f;
+	}
+
+	return nodes;
+}
+
+void update_by_name(MemoryShaderBuffer &a_buffer, const std::vector<TestNode> &a_nodes, uint32_t a_stride)
+{
+	for (uint32_t i = 0; i < a_nodes.size(); ++i)
+	{
+		int32_t parent_index[4]{a_nodes[i].m_parent, 0, 0, 0};
+
+		a_buffer.update("rotation", &a_nodes[i].m_rotation[0], i, a_stride);
+		a_buffer.update("translation", &a_nodes[i].m_translation[0], i, a_stride);
+		a_buffer.update("scale", &a_nodes[i].m_scale[0], i, a_stride);
+		a_buffer.update("parent_index", &parent_index[0], i, a_stride);
+	}
+}
+
+void update_by_handle(MemoryShaderBuffer &a_buffer, const std::vector<TestNode> &a_nodes, uint32_t a_stride)
+{
+	auto rotation     = a_buffer.handle("rotation");
+	auto translation  = a_buffer.handle("translation");
+	auto scale        = a_buffer.handle("scale");
+	auto parent       = a_buffer.handle("parent_index");
+	auto count        = static_cast<uint32_t>(a_nodes.size());
+	auto nodes_stride = static_cast<uint32_t>(sizeof(TestNode));
+
+	a_buffer.update_strided(rotation, &a_nodes[0].m_rotation[0], 0u, count, a_stride, nodes_stride);
+	a_buffer.update_strided(translation, &a_nodes[0].m_translation[0], 0u, count, a_stride, nodes_stride);
+	a_buffer.update_strided(scale, &a_nodes[0].m_scale[0], 0u, count, a_stride, nodes_stride);
+
+	for (uint32_t i = 0; i < count; ++i)
+	{
+		int32_t parent_index[4]{a_nodes[i].m_parent, 0, 0, 0};
+		a_buffer.update(parent, &parent_index[0], i, a_stride);
+	}
+}
+
+TEST(ShaderBuffer, handle_updates_match_name_updates)
+{
+	const uint32_t count = 100;
+
+	auto nodes   = make_test_nodes(count);
+	auto by_name = make_trs_buffer(count);
+	auto handled = make_trs_buffer(count);
+	auto stride  = by_name.stride("trs_transform_input");
+
+	update_by_name(by_name, nodes, stride);
+	update_by_handle(handled, nodes, stride);
+
+	EXPECT_EQ(by_name.m_data, handled.m_data);
+
+	auto rotation = handled.handle("rotation");
+	EXPECT_EQ(rotation.m_offset, 0u);
+	EXPECT_EQ(rotation.m_size, 16u);
+
+	auto parent = handled.handle("parent_index");
+	EXPECT_EQ(parent.m_offset, 48u);
+
+	int32_t parent_of_last{0};
+	std::memcpy(&parent_of_last, handled.m_data.data() + (stride * (count - 1)) + parent.m_offset, sizeof(int32_t));
+	EXPECT_EQ(parent_of_last, static_cast<int32_t>(count) - 2);
+}
+
+TEST(ShaderBuffer, strided_update_packed_array)
+{
+	MemoryShaderBuffer buffer{"weights", rhi::ShaderBufferType::ssbo, rhi::ShaderBufferFrequency::constant, rhi::Layout::std430, 0u, 0u,
+	                          "morph_weights", rhi::VertexFormat::float32_1, 64u};
+	buffer.m_data.resize(buffer.shader_buffer().size());
+
+	std::vector<float32_t> weights(64);
+	for (uint32_t i = 0; i < weights.size(); ++i)
+		weights[i] = static_cast<float32_t>(i) * 0.5f;
+
+	auto handle = buffer.handle("morph_weights");
+	EXPECT_EQ(handle.m_stride, handle.m_size);
+
+	buffer.update_strided(handle, weights.data() + 8, 8u, 56u, handle.m_stride, handle.m_stride);
+
+	for (uint32_t i = 0; i < weights.size(); ++i)
+	{
+		float32_t value{0.0f};
+		std::memcpy(&value, buffer.m_data.data() + handle.m_offset + i * handle.m_stride, sizeof(float32_t));
+		EXPECT_EQ(value, i < 8 ? 0.0f : weights[i]);
+	}
+}
+
+TEST(ShaderBuffer, DISABLED_handle_vs_name_update_performance)
+{
+	const uint32_t count      = 100000;
+	const uint32_t iterations = 10;
+
+	auto nodes  = make_test_nodes(count);
+	auto buffer = make_trs_buffer(count);
+	auto stride = buffer.stride("trs_transform_input");
+
+	ror::Timer timer;
+	for (uint32_t j = 0; j < iterations; ++j)
+		update_by_name(buffer, nodes, stride);
+	auto by_name = timer.tick();
+
+	for (uint32_t j = 0; j < iterations; ++j)
+		update_by_handle(buffer, nodes, stride);
+	auto by_handle = timer.tick();
+
+	std::cout << "Updating " << count << " nodes by name: " << static_cast<double64_t>(by_name) / (1000000.0 * iterations)
+	          << "ms, by handle: " << static_cast<double64_t>(by_handle) / (1000000.0 * iterations) << "ms" << std::endl;
+}
+
 }        // namespace ror_test
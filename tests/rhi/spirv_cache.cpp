@@ -0,0 +1,143 @@
+// Roar Source Code
+// Wasim Abbas
+// http://www.waZim.com
+// Copyright (c) 2025
+//
+// Permission is hereby granted, free of charge, to any person obtaining
+// a copy of this software and associated documentation files (the 'Software'),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software
+// is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+// IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+// CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+// TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE
+// OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+// Version: 1.0.0
+
+#include "foundation/rorresolve_includes.hpp"
+#include "resources/rorprojectroot.hpp"
+#include "resources/rorresource.hpp"
+#include "rhi/crtp_interfaces/rorshader.hpp"
+#include "rhi/rortypes.hpp"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+namespace ror_test
+{
+static const std::string spirv_cache_include_name{"spirv_cache_test_include.glsl"};
+
+static const std::string spirv_cache_shader{R"(#version 450
+
+#include "spirv_cache_test_include.glsl"
+
+layout(location = 0) out vec4 out_color;
+
+void main()
+{
+	out_color = test_color();
+}
+)"};
+
+static void write_spirv_cache_include(const std::string &a_source)
+{
+	auto          include_path = ror::get_project_root().path() / "shaders" / spirv_cache_include_name;
+	std::filesystem::create_directories(include_path.parent_path());
+	std::ofstream include_file(include_path, std::ios::out | std::ios::trunc);
+	include_file << a_source;
+}
+
+static std::string resolved_spirv_cache_shader()
+{
+	std::string              source{spirv_cache_shader};
+	std::vector<std::string> includes;
+
+	ror::resolve_includes(source, ror::ResourceSemantic::shaders, false, includes);
+
+	EXPECT_EQ(includes.size(), 1);
+
+	return source;
+}
+
+TEST(SPIRVCache, key_covers_source_and_stage)
+{
+	auto key = rhi::spirv_cache_key(spirv_cache_shader, rhi::ShaderType::fragment, "main");
+
+	EXPECT_EQ(key, rhi::spirv_cache_key(spirv_cache_shader, rhi::ShaderType::fragment, "main"));
+	EXPECT_NE(key, rhi::spirv_cache_key(spirv_cache_shader, rhi::ShaderType::vertex, "main"));
+	EXPECT_NE(key, rhi::spirv_cache_key(spirv_cache_shader, rhi::ShaderType::fragment, "other_main"));
+	EXPECT_NE(key, rhi::spirv_cache_key(spirv_cache_shader + "\n", rhi::ShaderType::fragment, "main"));
+}
+
+TEST(SPIRVCache, hit_miss_and_include_invalidation)
+{
+	write_spirv_cache_include("vec4 test_color() { return vec4(1.0, 0.0, 0.0, 1.0); }\n");
+
+	auto source = resolved_spirv_cache_shader();
+	auto key    = rhi::spirv_cache_key(source, rhi::ShaderType::fragment, "main");
+
+	std::error_code error;
+	std::filesystem::remove(rhi::spirv_cache_path(key), error);
+
+	std::vector<uint32_t> spirv;
+	EXPECT_FALSE(rhi::spirv_cache_load(key, spirv)) << "Cold cache must miss";
+
+	std::string info_log;
+	rhi::glslang_wrapper_initialize_process();
+	ASSERT_TRUE(rhi::compile_to_spirv(source, rhi::ShaderType::fragment, "main", spirv, info_log)) << info_log;
+	rhi::glslang_wrapper_finalize_process();
+
+	ASSERT_TRUE(rhi::spirv_cache_save(key, spirv));
+
+	std::vector<uint32_t> cached_spirv;
+	ASSERT_TRUE(rhi::spirv_cache_load(key, cached_spirv)) << "Warm cache must hit";
+	EXPECT_EQ(spirv, cached_spirv);
+
+	// Only the include changes, the shader itself is the same
+	write_spirv_cache_include("vec4 test_color() { return vec4(0.0, 1.0, 0.0, 1.0); }\n");
+
+	auto changed_source = resolved_spirv_cache_shader();
+	auto changed_key    = rhi::spirv_cache_key(changed_source, rhi::ShaderType::fragment, "main");
+
+	EXPECT_NE(key, changed_key);
+	std::filesystem::remove(rhi::spirv_cache_path(changed_key), error);
+
+	std::vector<uint32_t> stale_spirv;
+	EXPECT_FALSE(rhi::spirv_cache_load(changed_key, stale_spirv)) << "Changing an include must miss";
+
+	std::filesystem::remove(rhi::spirv_cache_path(key), error);
+	std::filesystem::remove(ror::get_project_root().path() / "shaders" / spirv_cache_include_name, error);
+}
+
+TEST(SPIRVCache, corrupt_module_misses)
+{
+	auto key  = rhi::spirv_cache_key("corrupt", rhi::ShaderType::compute, "main");
+	auto path = rhi::spirv_cache_path(key);
+
+	std::filesystem::create_directories(path.parent_path());
+	{
+		std::ofstream spirv_file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+		uint32_t      words[2]{0xdeadbeef, 0u};
+		spirv_file.write(reinterpret_cast<const char *>(words), sizeof(words));
+	}
+
+	std::vector<uint32_t> spirv;
+	EXPECT_FALSE(rhi::spirv_cache_load(key, spirv));
+	EXPECT_TRUE(spirv.empty());
+
+	std::error_code error;
+	std::filesystem::remove(path, error);
+}
+
+}        // namespace ror_test